@@ -48,7 +48,7 @@ void CovarianceDenseBatchKernel<algorithmFPType, method, cpu>::compute(
         new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(&nObservationsValue, 1, 1));
     bool isOnline = false;
     updateDensePartialResults<algorithmFPType, method, cpu>(dataTable,
-        covTable, meanTable, nObservationsTable, isOnline, this->_errors);
+        covTable, meanTable, nObservationsTable, isOnline, parameter, this->_errors);
     finalizeCovariance<algorithmFPType, cpu>(covTable, meanTable, nObservationsTable, parameter, this->_errors);
 }
 
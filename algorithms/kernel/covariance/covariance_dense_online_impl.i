@@ -46,7 +46,7 @@ void CovarianceDenseOnlineKernel<algorithmFPType, method, cpu>::compute(
     if (method != sumDense)
     {
         updateDensePartialResults<algorithmFPType, method, cpu>(dataTable,
-            crossProductTable, sumTable, nObservationsTable, isOnline, this->_errors);
+            crossProductTable, sumTable, nObservationsTable, isOnline, parameter, this->_errors);
     }
     else
     {
@@ -81,7 +81,7 @@ void CovarianceDenseOnlineKernel<algorithmFPType, method, cpu>::compute(
         algorithmFPType partialNObservations = 0.0;
         updateDenseCrossProductAndSums<algorithmFPType, method, cpu>(
             dataTable->isNormalized(NumericTableIface::standardScoreNormalized),
-            nFeatures, nVectors, dataBlock, partialCrossProduct, userSums, &partialNObservations, this->_errors);
+            nFeatures, nVectors, dataBlock, partialCrossProduct, userSums, &partialNObservations, parameter, this->_errors);
 
         mergeCrossProductAndSums<algorithmFPType, cpu>(nFeatures, partialCrossProduct, userSums,
             &partialNObservations, crossProduct, sums, nObservations);
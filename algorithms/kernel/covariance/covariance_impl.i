@@ -44,6 +44,15 @@ namespace covariance
 namespace internal
 {
 
+/* Minimal number of cross-product elements updated by one task of the threaded merge */
+const size_t _minElementsInMergeBlock = 4096;
+
+/* Number of input rows processed by one task of the blocked cross-product accumulation */
+const size_t _nRowsInAccumulationBlock = 1024;
+
+/* Maximal number of input elements kept in the column-wise buffer of one task of the blocked accumulation */
+const size_t _maxElementsInAccumulationChunk = 16384;
+
 template<typename algorithmFPType, CpuType cpu>
 void getTableData(ReadWriteMode rwMode, SharedPtr<NumericTable> &numericTable,
             BlockDescriptor<algorithmFPType> &bd, algorithmFPType **dataArray)
@@ -120,11 +129,273 @@ void releaseDenseCrossProductAndSums(
     nObservationsTable->releaseBlockOfRows(nObservationsBD);
 }
 
+template<typename algorithmFPType, CpuType cpu>
+void mergeCrossProductAndSums(size_t nFeatures,
+    const algorithmFPType *partialCrossProduct, const algorithmFPType *partialSums,
+    const algorithmFPType *partialNObservations,
+    algorithmFPType *crossProduct, algorithmFPType *sums, algorithmFPType *nObservations);
+
+/* Thread-local buffers of the blocked cross-product accumulation */
+template<typename accumulatorFPType, CpuType cpu>
+struct CrossProductAccumulator
+{
+    static CrossProductAccumulator *create(size_t nFeatures, size_t nRowsInChunk)
+    {
+        CrossProductAccumulator *acc = new CrossProductAccumulator();
+        acc->crossProduct = services::internal::service_calloc<accumulatorFPType, cpu>(nFeatures * (nFeatures + 1) / 2);
+        acc->sums         = services::internal::service_calloc<accumulatorFPType, cpu>(nFeatures);
+        acc->columns      = services::internal::service_malloc<accumulatorFPType, cpu>(nFeatures * nRowsInChunk);
+        if (!acc->crossProduct || !acc->sums || !acc->columns)
+        {
+            destroy(acc);
+            return 0;
+        }
+        return acc;
+    }
+
+    static void destroy(CrossProductAccumulator *acc)
+    {
+        daal_free(acc->crossProduct);
+        daal_free(acc->sums);
+        daal_free(acc->columns);
+        delete acc;
+    }
+
+    accumulatorFPType *crossProduct; /* Packed lower triangle, element (i, j), j <= i, is stored at i * (i + 1) / 2 + j */
+    accumulatorFPType *sums;         /* nFeatures */
+    accumulatorFPType *columns;      /* nFeatures x nRowsInChunk, shifted rows of the current chunk stored by columns */
+
+private:
+    CrossProductAccumulator() : crossProduct(0), sums(0), columns(0) {}
+};
+
+/**
+ *  \brief Computes the cross-product of a tall-skinny data block by splitting its rows between threads
+ *
+ *  The rows are shifted by the vector shift before they are multiplied, so that the cross-product
+ *  of data with a large mean does not lose precision. If isCentered is true, the cross-product centered
+ *  by the mean of the block and the sums of the block are returned; otherwise the cross-product of the shifted
+ *  rows is returned and sums are not changed.
+ */
+template<typename algorithmFPType, typename accumulatorFPType, CpuType cpu>
+void computeBlockedCrossProduct(size_t nFeatures, size_t nVectors, const algorithmFPType *dataBlock,
+            const accumulatorFPType *shift, bool isCentered, algorithmFPType *crossProduct, algorithmFPType *sums,
+            services::SharedPtr<services::KernelErrorCollection> &_errors)
+{
+    typedef CrossProductAccumulator<accumulatorFPType, cpu> Accumulator;
+
+    size_t nRowsInChunk = _maxElementsInAccumulationChunk / nFeatures;
+    if (nRowsInChunk == 0) { nRowsInChunk = 1; }
+    if (nRowsInChunk > _nRowsInAccumulationBlock) { nRowsInChunk = _nRowsInAccumulationBlock; }
+
+    const size_t nTasks = (nVectors + _nRowsInAccumulationBlock - 1) / _nRowsInAccumulationBlock;
+
+    daal::tls<Accumulator *> tls([ = ]()-> Accumulator *
+    {
+        return Accumulator::create(nFeatures, nRowsInChunk);
+    } );
+
+    daal::threader_for(nTasks, nTasks, [ =, &tls](int iTask)
+    {
+        Accumulator *acc = tls.local();
+        if (!acc) { return; }
+
+        const size_t iStart = iTask * _nRowsInAccumulationBlock;
+        const size_t iEnd   = (iStart + _nRowsInAccumulationBlock < nVectors ? iStart + _nRowsInAccumulationBlock : nVectors);
+
+        accumulatorFPType *columns = acc->columns;
+        accumulatorFPType *cp      = acc->crossProduct;
+        accumulatorFPType *accSums = acc->sums;
+
+        /* Rows are processed in chunks that stay in cache while the whole triangle is updated */
+        for (size_t chunkStart = iStart; chunkStart < iEnd; chunkStart += nRowsInChunk)
+        {
+            const size_t nRows = (chunkStart + nRowsInChunk < iEnd ? nRowsInChunk : iEnd - chunkStart);
+
+            for (size_t r = 0; r < nRows; r++)
+            {
+                const algorithmFPType *row = dataBlock + (chunkStart + r) * nFeatures;
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    columns[j * nRowsInChunk + r] = (accumulatorFPType)row[j] - shift[j];
+                }
+            }
+
+            for (size_t i = 0; i < nFeatures; i++)
+            {
+                const accumulatorFPType *xi = columns + i * nRowsInChunk;
+
+                accumulatorFPType s = 0;
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t r = 0; r < nRows; r++)
+                {
+                    s += xi[r];
+                }
+                accSums[i] += s;
+
+                accumulatorFPType *cpRow = cp + i * (i + 1) / 2;
+                for (size_t j = 0; j <= i; j++)
+                {
+                    const accumulatorFPType *xj = columns + j * nRowsInChunk;
+
+                    accumulatorFPType dot = 0;
+                  PRAGMA_VECTOR_ALWAYS
+                    for (size_t r = 0; r < nRows; r++)
+                    {
+                        dot += xi[r] * xj[r];
+                    }
+                    cpRow[j] += dot;
+                }
+            }
+        }
+    } );
+
+    bool isAllocated = true;
+    tls.reduce([ =, &isAllocated](Accumulator *acc)
+    {
+        if (!acc) { isAllocated = false; }
+    } );
+
+    const size_t nPacked = nFeatures * (nFeatures + 1) / 2;
+
+    /* Merge thread-local triangles pairwise */
+    Accumulator *result = (isAllocated ? tls.tree_reduce([ = ](Accumulator *dst, Accumulator *src)
+    {
+        if (!dst || !src) { return; }
+
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t k = 0; k < nPacked; k++)
+        {
+            dst->crossProduct[k] += src->crossProduct[k];
+        }
+
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            dst->sums[j] += src->sums[j];
+        }
+    } ) : 0);
+
+    if (!isAllocated)
+    {
+        _errors->add(services::ErrorMemoryAllocationFailed);
+    }
+    else if (result)
+    {
+        const accumulatorFPType *cp      = result->crossProduct;
+        const accumulatorFPType *accSums = result->sums;
+        const accumulatorFPType invNVectors = (isCentered ? (accumulatorFPType)1.0 / (accumulatorFPType)nVectors : 0);
+
+        const size_t nRowsInBlock = 1 + _minElementsInMergeBlock / nFeatures;
+        daal::threader_for_blocked_size( nFeatures, nRowsInBlock, daal::threader_get_threads_number(), [ = ](size_t iStart, size_t iEnd)
+        {
+            for (size_t i = iStart; i < iEnd; i++)
+            {
+                const accumulatorFPType *cpRow = cp + i * (i + 1) / 2;
+                for (size_t j = 0; j <= i; j++)
+                {
+                    algorithmFPType value = (algorithmFPType)(cpRow[j] - accSums[i] * accSums[j] * invNVectors);
+                    crossProduct[i * nFeatures + j] = value;
+                    crossProduct[j * nFeatures + i] = value;
+                }
+            }
+        } );
+
+        if (isCentered)
+        {
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                sums[j] = (algorithmFPType)(accSums[j] + shift[j] * (accumulatorFPType)nVectors);
+            }
+        }
+    }
+
+    tls.reduce([ = ](Accumulator *acc)
+    {
+        if (acc) { Accumulator::destroy(acc); }
+    } );
+}
+
+/**
+ *  \brief Updates the cross-product and sums with a tall-skinny data block using the blocked accumulation
+ */
+template<typename algorithmFPType, typename accumulatorFPType, Method method, CpuType cpu>
+void updateBlockedCrossProductAndSums(bool isNormalized, size_t nFeatures, size_t nVectors,
+            algorithmFPType *dataBlock, algorithmFPType *crossProduct, algorithmFPType *sums,
+            algorithmFPType *nObservations, services::SharedPtr<services::KernelErrorCollection> &_errors)
+{
+    accumulatorFPType *shift = services::internal::service_malloc<accumulatorFPType, cpu>(nFeatures);
+    algorithmFPType *partialCrossProduct = services::internal::service_malloc<algorithmFPType, cpu>(nFeatures * nFeatures);
+    algorithmFPType *partialSums = services::internal::service_calloc<algorithmFPType, cpu>(nFeatures);
+    if (!shift || !partialCrossProduct || !partialSums)
+    {
+        daal_free(shift);
+        daal_free(partialCrossProduct);
+        daal_free(partialSums);
+        _errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    /* Normalized data is not centered; data with precomputed sums is shifted by its mean;
+       otherwise the first row of the block is used as the shift */
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        if (isNormalized)           { shift[j] = 0; }
+        else if (method == sumDense) { shift[j] = (accumulatorFPType)sums[j] / (accumulatorFPType)nVectors; }
+        else                        { shift[j] = (accumulatorFPType)dataBlock[j]; }
+    }
+
+    computeBlockedCrossProduct<algorithmFPType, accumulatorFPType, cpu>(nFeatures, nVectors, dataBlock, shift,
+        !isNormalized, partialCrossProduct, partialSums, _errors);
+
+    if (_errors->size() == 0)
+    {
+        if (isNormalized || method == sumDense)
+        {
+            /* Sums are not accumulated for these inputs, the cross-product of the block is added as is */
+            for (size_t i = 0; i < nFeatures * nFeatures; i++)
+            {
+                crossProduct[i] += partialCrossProduct[i];
+            }
+            *nObservations += (algorithmFPType)nVectors;
+        }
+        else
+        {
+            algorithmFPType partialNObservations = (algorithmFPType)nVectors;
+            mergeCrossProductAndSums<algorithmFPType, cpu>(nFeatures, partialCrossProduct, partialSums,
+                &partialNObservations, crossProduct, sums, nObservations);
+        }
+    }
+
+    daal_free(shift);
+    daal_free(partialCrossProduct);
+    daal_free(partialSums);
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 void updateDenseCrossProductAndSums(bool isNormalized, size_t nFeatures, size_t nVectors,
             algorithmFPType *dataBlock, algorithmFPType *crossProduct, algorithmFPType *sums,
-            algorithmFPType *nObservations, services::SharedPtr<services::KernelErrorCollection> &_errors)
+            algorithmFPType *nObservations, const Parameter *parameter,
+            services::SharedPtr<services::KernelErrorCollection> &_errors)
 {
+    const CrossProductAccumulation accumulation = (parameter ? parameter->crossProductAccumulation : defaultAccumulation);
+    if (accumulation != defaultAccumulation && nVectors >= nFeatures)
+    {
+        if (accumulation == blockedDoubleAccumulation)
+        {
+            updateBlockedCrossProductAndSums<algorithmFPType, double, method, cpu>(isNormalized, nFeatures, nVectors,
+                dataBlock, crossProduct, sums, nObservations, _errors);
+        }
+        else
+        {
+            updateBlockedCrossProductAndSums<algorithmFPType, algorithmFPType, method, cpu>(isNormalized, nFeatures, nVectors,
+                dataBlock, crossProduct, sums, nObservations, _errors);
+        }
+        return;
+    }
+
     if (isNormalized)
     {
         char uplo  = 'U';
@@ -164,7 +435,7 @@ void updateDenseCrossProductAndSums(bool isNormalized, size_t nFeatures, size_t
 template<typename algorithmFPType, Method method, CpuType cpu>
 void updateDensePartialResults(SharedPtr<NumericTable> &dataTable,
         SharedPtr<NumericTable> &crossProductTable, SharedPtr<NumericTable> &sumTable,
-        SharedPtr<NumericTable> &nObservationsTable, bool isOnline,
+        SharedPtr<NumericTable> &nObservationsTable, bool isOnline, const Parameter *parameter,
         services::SharedPtr<services::KernelErrorCollection> &_errors)
 {
     size_t nFeatures = dataTable->getNumberOfColumns();
@@ -195,7 +466,7 @@ void updateDensePartialResults(SharedPtr<NumericTable> &dataTable,
     algorithmFPType *dataBlock = dataBD.getBlockPtr();
 
     updateDenseCrossProductAndSums<algorithmFPType, method, cpu>(isNormalized, nFeatures, nVectors,
-        dataBlock, crossProduct, sums, nObservations, _errors);
+        dataBlock, crossProduct, sums, nObservations, parameter, _errors);
 
     dataTable->releaseBlockOfRows(dataBD);
     releaseDenseCrossProductAndSums<algorithmFPType, cpu>(crossProductTable, crossProductBD, sumTable, sumBD,
@@ -250,16 +521,24 @@ void mergeCrossProductAndSums(size_t nFeatures,
     {
         algorithmFPType nObsValue = nObservations[0];
 
+        /* Process several rows of the triangle per task so that each task updates
+           at least _minElementsInMergeBlock elements of the cross-product */
+        const size_t nRowsInBlock = 1 + _minElementsInMergeBlock / nFeatures;
+        const int nThreads = daal::threader_get_threads_number();
+
         if (nObsValue == 0)
         {
-            daal::threader_for( nFeatures, nFeatures, [ = ](size_t i)
+            daal::threader_for_blocked_size( nFeatures, nRowsInBlock, nThreads, [ = ](size_t iStart, size_t iEnd)
             {
-              PRAGMA_IVDEP
-              PRAGMA_VECTOR_ALWAYS
-                for (size_t j = 0; j <= i; j++)
+                for (size_t i = iStart; i < iEnd; i++)
                 {
-                    crossProduct[i * nFeatures + j] += partialCrossProduct[i * nFeatures + j];
-                    crossProduct[j * nFeatures + i]  = crossProduct[i * nFeatures + j];
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j <= i; j++)
+                    {
+                        crossProduct[i * nFeatures + j] += partialCrossProduct[i * nFeatures + j];
+                        crossProduct[j * nFeatures + i]  = crossProduct[i * nFeatures + j];
+                    }
                 }
             } );
         }
@@ -267,19 +546,23 @@ void mergeCrossProductAndSums(size_t nFeatures,
         {
             algorithmFPType invPartialNObs = 1.0 / partialNObsValue;
             algorithmFPType invNObs = 1.0 / nObsValue;
-            algorithmFPType invNewNObs = 1.0 / (nObsValue + partialNObsValue);
+            algorithmFPType coeff = nObsValue * partialNObsValue / (nObsValue + partialNObsValue);
 
-            daal::threader_for( nFeatures, nFeatures, [ = ](size_t i)
+            /* The correction term is computed from the difference of the means rather than from the
+               squares of the sums, which cancel catastrophically for data with a large mean */
+            daal::threader_for_blocked_size( nFeatures, nRowsInBlock, nThreads, [ = ](size_t iStart, size_t iEnd)
             {
-              PRAGMA_IVDEP
-              PRAGMA_VECTOR_ALWAYS
-                for (size_t j = 0; j <= i; j++)
+                for (size_t i = iStart; i < iEnd; i++)
                 {
-                    crossProduct[i * nFeatures + j] += partialCrossProduct[i * nFeatures + j];
-                    crossProduct[i * nFeatures + j] += partialSums[i] * partialSums[j] * invPartialNObs;
-                    crossProduct[i * nFeatures + j] += sums[i] * sums[j] * invNObs;
-                    crossProduct[i * nFeatures + j] -= (partialSums[i] + sums[i]) * (partialSums[j] + sums[j]) * invNewNObs;
-                    crossProduct[j * nFeatures + i]  = crossProduct[i * nFeatures + j];
+                    algorithmFPType deltaI = partialSums[i] * invPartialNObs - sums[i] * invNObs;
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j <= i; j++)
+                    {
+                        algorithmFPType deltaJ = partialSums[j] * invPartialNObs - sums[j] * invNObs;
+                        crossProduct[i * nFeatures + j] += partialCrossProduct[i * nFeatures + j] + coeff * deltaI * deltaJ;
+                        crossProduct[j * nFeatures + i]  = crossProduct[i * nFeatures + j];
+                    }
                 }
             } );
         }
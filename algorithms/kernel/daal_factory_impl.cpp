@@ -27,6 +27,8 @@
 #include "soa_numeric_table.h"
 #include "csr_numeric_table.h"
 #include "merged_numeric_table.h"
+#include "compressed_numeric_table.h"
+#include "row_merged_numeric_table.h"
 #include "symmetric_matrix.h"
 #include "matrix.h"
 #include "data_collection.h"
@@ -54,6 +56,12 @@
 
 #include "em_gmm_types.h"
 
+#include "gbt_classification_model.h"
+#include "gbt_classification_training_types.h"
+#include "gbt_regression_model.h"
+#include "gbt_regression_training_types.h"
+#include "gbt_regression_predict_types.h"
+
 #include "implicit_als_model.h"
 #include "implicit_als_training_types.h"
 #include "implicit_als_predict_ratings_types.h"
@@ -220,6 +228,7 @@ template class BlockDescriptor<double>;
 Factory::Factory()
 {
     __DAAL_REGISTER_TEMPLATED_OBJECT(Creator, HomogenNumericTable, );
+    __DAAL_REGISTER_TEMPLATED_OBJECT(Creator, CompressedNumericTable, );
     __DAAL_REGISTER_TEMPLATED_OBJECT(Creator, Matrix, );
 
     __DAAL_REGISTER_TEMPLATED_OBJECT(Creator, PackedSymmetricMatrix,  NumericTableIface::upperPackedSymmetricMatrix, );
@@ -232,6 +241,7 @@ Factory::Factory()
     registerObject(new Creator<AOSNumericTable>());
     registerObject(new Creator<SOANumericTable>());
     registerObject(new Creator<MergedNumericTable>());
+    registerObject(new Creator<RowMergedNumericTable>());
     registerObject(new Creator<NumericTableDictionary>());
     registerObject(new Creator<DataSourceDictionary>());
     registerObject(new Creator<data_management::DataCollection >());
@@ -262,6 +272,14 @@ Factory::Factory()
     registerObject(new Creator<algorithms::em_gmm::init::Result>());
     registerObject(new Creator<algorithms::em_gmm::Result>());
 
+    registerObject(new Creator<algorithms::gbt::training::PartialResult>());
+    registerObject(new Creator<algorithms::gbt::training::DistributedPartialResult>());
+    registerObject(new Creator<algorithms::gbt::classification::Model>());
+    registerObject(new Creator<algorithms::gbt::classification::training::Result>());
+    registerObject(new Creator<algorithms::gbt::regression::Model>());
+    registerObject(new Creator<algorithms::gbt::regression::training::Result>());
+    registerObject(new Creator<algorithms::gbt::regression::prediction::Result>());
+
     registerObject(new Creator<algorithms::implicit_als::Model>());
     registerObject(new Creator<algorithms::implicit_als::PartialModel>());
     registerObject(new Creator<algorithms::implicit_als::prediction::ratings::Result>());
@@ -277,6 +295,7 @@ Factory::Factory()
     registerObject(new Creator<algorithms::kernel_function::Result>());
 
     registerObject(new Creator<algorithms::kmeans::PartialResult>());
+    registerObject(new Creator<algorithms::kmeans::OnlinePartialResult>());
     registerObject(new Creator<algorithms::kmeans::Result>());
     registerObject(new Creator<algorithms::kmeans::init::PartialResult>());
     registerObject(new Creator<algorithms::kmeans::init::Result>());
@@ -306,6 +325,7 @@ Factory::Factory()
     registerObject(new Creator<algorithms::pca::Result>());
     registerObject(new Creator<algorithms::pca::PartialResult<algorithms::pca::correlationDense> >());
     registerObject(new Creator<algorithms::pca::PartialResult<algorithms::pca::svdDense        > >());
+    registerObject(new Creator<algorithms::pca::PartialResult<algorithms::pca::randomizedDense > >());
 
     registerObject(new Creator<algorithms::pivoted_qr::Result>());
 
@@ -315,6 +335,7 @@ Factory::Factory()
     registerObject(new Creator<algorithms::qr::DistributedPartialResultStep3>());
 
     registerObject(new Creator<algorithms::quantiles::Result>());
+    registerObject(new Creator<algorithms::quantiles::PartialResult>());
 
     registerObject(new Creator<algorithms::math::relu::Result>());
     registerObject(new Creator<algorithms::math::softmax::Result>());
@@ -337,6 +358,7 @@ Factory::Factory()
     registerObject(new Creator<algorithms::weak_learner::training::Result>());
 
     registerObject(new Creator<algorithms::sorting::Result>());
+    registerObject(new Creator<algorithms::sorting::PartialResult>());
 
     registerObject(new Creator<algorithms::normalization::zscore::Result>());
 
@@ -127,15 +127,12 @@ void EMKernel<algorithmFPType, method, cpu>::compute(const size_t na, const Nume
 
         logLikelyhood = 0;
 
-        daal::threader_for( nBlocks, nBlocks, [ =, &threadBuffer, &threadLocalError ](size_t iBlock)
+        daal::threader_for_blocked_size( nVectors, blockSizeDeafult, daal::threader_get_threads_number(),
+                                         [ =, &threadBuffer, &threadLocalError ](size_t j0, size_t jEnd)
         {
             Error *localError = threadLocalError.local();
-            size_t jn = blockSizeDeafult;
-            if( iBlock == nBlocks - 1 )
-            {
-                jn = nVectors - iBlock * blockSizeDeafult;
-            }
-            size_t j0 = iBlock * blockSizeDeafult;
+            const size_t iBlock = j0 / blockSizeDeafult;
+            const size_t jn = jEnd - j0;
 
             size_t nVectorsInCurrentBlock = jn;
 
@@ -162,7 +159,7 @@ void EMKernel<algorithmFPType, method, cpu>::compute(const size_t na, const Nume
 
             dataTable.release();
         }
-                          );
+                                       );
         threadLocalError.reduce( [ = ](Error * e)-> void
         {
             if(e->id() != NoErrorMessageFound)
@@ -728,6 +728,10 @@ void ErrorMessageCollection::parseResourceFile()
     push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(
                   ErrorInputCorrelationNotSupportedInOnlineAndDistributed,
                   "Input correlation matrix is not supported in online and distributed computation modes")));
+    push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(ErrorPCAIncorrectNumberOfComponents,
+              "Number of principal components exceeds the number of features or the number of random test vectors")));
+    push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(ErrorPCAFailedToDecomposeSketch,
+              "Failed to decompose the sketch of the correlation matrix")));
 
     // QR errors: -8000..-8199
 
@@ -793,6 +797,9 @@ void ErrorMessageCollection::parseResourceFile()
     push_back(services::SharedPtr<Message<ErrorID> >(
                   new Message<ErrorID>(ErrorRleDataFormatNotFullBlock,
                                        "Input compressed stream contains not a whole number of compressed blocks")));
+    push_back(services::SharedPtr<Message<ErrorID> >(
+                  new Message<ErrorID>(ErrorCompressionFrameFormat,
+                                       "Input compressed stream is not a sequence of compressed frames or is corrupted")));
 
     // Quantile error: -10000..-11000
     push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(ErrorQuantileOrderValueIsInvalid,
@@ -835,6 +842,10 @@ void ErrorMessageCollection::parseResourceFile()
     push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(ErrorODBC, "ErrorODBC")));
     push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(ErrorSQLstmtHandle, "ErrorSQLstmtHandle")));
     push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(ErrorOnFileOpen, "Error on file open")));
+    push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(ErrorOnFileMapping, "Error on mapping of file into memory")));
+    push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(ErrorOnFileWrite, "Error on file write")));
+    push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(ErrorIncorrectDataFileFormat,
+                                                                          "Data file is in wrong format or corrupted")));
 
     // Other errors: -100000..
     push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(ErrorObjectDoesNotSupportSerialization,
@@ -0,0 +1,74 @@
+/* file: gbt_classification_predict_container.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees classification prediction algorithm container --
+//  a class that contains the prediction kernels for supported architectures.
+//--
+*/
+
+#ifndef __GBT_CLASSIFICATION_PREDICT_CONTAINER_H__
+#define __GBT_CLASSIFICATION_PREDICT_CONTAINER_H__
+
+#include "gbt_classification_predict.h"
+#include "gbt_classification_predict_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace prediction
+{
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+PredictionContainer<algorithmFPType, method, cpu>::PredictionContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INTIALIZE_KERNELS(internal::ClassificationPredictKernel, algorithmFPType, method);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+PredictionContainer<algorithmFPType, method, cpu>::~PredictionContainer()
+{
+    __DAAL_DEINTIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void PredictionContainer<algorithmFPType, method, cpu>::compute()
+{
+    classifier::prediction::Input *input = static_cast<classifier::prediction::Input *>(_in);
+    classifier::prediction::Result *result = static_cast<classifier::prediction::Result *>(_res);
+
+    NumericTable *x = input->get(classifier::prediction::data).get();
+    const gbt::classification::Model *m = static_cast<gbt::classification::Model *>(input->get(classifier::prediction::model).get());
+    NumericTable *r = result->get(classifier::prediction::prediction).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::ClassificationPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, x, m, r);
+}
+
+} // namespace prediction
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
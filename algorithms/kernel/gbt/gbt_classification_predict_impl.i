@@ -0,0 +1,139 @@
+/* file: gbt_classification_predict_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees classification prediction.
+//  The score of a class is the sum of the responses of its trees,
+//  the predicted label is the class with the largest score.
+//--
+*/
+
+#ifndef __GBT_CLASSIFICATION_PREDICT_IMPL_I__
+#define __GBT_CLASSIFICATION_PREDICT_IMPL_I__
+
+#include "threading.h"
+#include "numeric_table.h"
+#include "service_memory.h"
+#include "gbt_classification_predict_kernel.h"
+#include "gbt_predict_aux.i"
+
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace prediction
+{
+namespace internal
+{
+
+using gbt::prediction::internal::TreeEnsemble;
+using gbt::prediction::internal::predictBlockSize;
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void ClassificationPredictKernel<algorithmFPType, method, cpu>::compute(NumericTable *x, const Model *m, NumericTable *r)
+{
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+    const size_t nClasses = m->getNumberOfClasses();
+    const size_t nScores = (nClasses == 2 ? 1 : nClasses);
+
+    TreeEnsemble<algorithmFPType, cpu> trees;
+    if(!trees.init(m))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    const TreeEnsemble<algorithmFPType, cpu> *pTrees = &trees;
+
+    daal::tls<algorithmFPType *> tlsScores( [ = ]()-> algorithmFPType *
+    {
+        return service_malloc<algorithmFPType, cpu>(predictBlockSize * nScores);
+    } );
+
+    const size_t nBlocks = (nRows + predictBlockSize - 1) / predictBlockSize;
+    daal::threader_for( nBlocks, nBlocks, [ =, &tlsScores ](int iBlock)
+    {
+        algorithmFPType *scores = tlsScores.local();
+        if(!scores) { return; }
+
+        const size_t begin = iBlock * predictBlockSize;
+        const size_t end = (begin + predictBlockSize > nRows ? nRows : begin + predictBlockSize);
+        const size_t nBlockRows = end - begin;
+
+        for(size_t i = 0; i < nBlockRows * nScores; i++)
+        {
+            scores[i] = 0;
+        }
+
+        BlockDescriptor<algorithmFPType> xBlock;
+        x->getBlockOfRows(begin, nBlockRows, readOnly, xBlock);
+        const algorithmFPType *xArray = xBlock.getBlockPtr();
+        for(size_t t = 0; t < pTrees->nTrees; t++)
+        {
+            pTrees->addTreeResponses(t, nBlockRows, nFeatures, xArray, scores + (t % nScores), nScores);
+        }
+        x->releaseBlockOfRows(xBlock);
+
+        BlockDescriptor<algorithmFPType> rBlock;
+        r->getBlockOfRows(begin, nBlockRows, writeOnly, rBlock);
+        algorithmFPType *labels = rBlock.getBlockPtr();
+        for(size_t i = 0; i < nBlockRows; i++)
+        {
+            if(nScores == 1)
+            {
+                labels[i] = (scores[i] > 0 ? (algorithmFPType)1.0 : (algorithmFPType)0.0);
+                continue;
+            }
+            const algorithmFPType *s = scores + i * nScores;
+            size_t best = 0;
+            for(size_t k = 1; k < nScores; k++)
+            {
+                if(s[k] > s[best]) { best = k; }
+            }
+            labels[i] = (algorithmFPType)best;
+        }
+        r->releaseBlockOfRows(rBlock);
+    } );
+
+    bool bMemoryAllocationFailed = false;
+    tlsScores.reduce( [ =, &bMemoryAllocationFailed ](algorithmFPType *scores)-> void
+    {
+        if(!scores) { bMemoryAllocationFailed = true; return; }
+        service_free<algorithmFPType, cpu>(scores);
+    } );
+
+    if(bMemoryAllocationFailed)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,68 @@
+/* file: gbt_classification_predict_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes gradient boosted trees classification predictions.
+//--
+*/
+
+#ifndef __GBT_CLASSIFICATION_PREDICT_KERNEL_H__
+#define __GBT_CLASSIFICATION_PREDICT_KERNEL_H__
+
+#include "gbt_classification_predict.h"
+#include "gbt_classification_model.h"
+#include "kernel.h"
+#include "numeric_table.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace prediction
+{
+namespace internal
+{
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+class ClassificationPredictKernel : public daal::algorithms::Kernel
+{
+public:
+    /**
+     *  \brief Computes gradient boosted trees classification predictions
+     *
+     *  \param x[in]    Data set
+     *  \param m[in]    Trained model
+     *  \param r[out]   Class labels predicted for the observations
+     */
+    void compute(NumericTable *x, const Model *m, NumericTable *r);
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
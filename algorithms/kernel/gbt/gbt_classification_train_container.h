@@ -0,0 +1,159 @@
+/* file: gbt_classification_train_container.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees classification training algorithm container --
+//  a class that contains the histogram-based training kernels for supported architectures.
+//--
+*/
+
+#ifndef __GBT_CLASSIFICATION_TRAIN_CONTAINER_H__
+#define __GBT_CLASSIFICATION_TRAIN_CONTAINER_H__
+
+#include "gbt_classification_training_batch.h"
+#include "gbt_classification_training_distributed.h"
+#include "gbt_classification_train_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace training
+{
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INTIALIZE_KERNELS(internal::ClassificationTrainBatchKernel, algorithmFPType, method);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
+{
+    __DAAL_DEINTIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void BatchContainer<algorithmFPType, method, cpu>::compute()
+{
+    classifier::training::Input *input = static_cast<classifier::training::Input *>(_in);
+    Result *result = static_cast<Result *>(_res);
+
+    NumericTable *x = input->get(classifier::training::data).get();
+    NumericTable *y = input->get(classifier::training::labels).get();
+    NumericTable *w = input->get(classifier::training::weights).get();
+    gbt::classification::Model *m = result->get(classifier::training::model).get();
+    const Parameter *par = static_cast<const Parameter *>(_par);
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::ClassificationTrainBatchKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, x, y, w, m, par);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INTIALIZE_KERNELS(internal::ClassificationTrainDistrStep1Kernel, algorithmFPType, method);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step1Local, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINTIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step1Local, algorithmFPType, method, cpu>::compute()
+{
+    DistributedInput<step1Local> *input = static_cast<DistributedInput<step1Local> *>(_in);
+    gbt::training::PartialResult *pres = static_cast<gbt::training::PartialResult *>(_pres);
+
+    NumericTable *x = input->get(classifier::training::data).get();
+    NumericTable *y = input->get(classifier::training::labels).get();
+    NumericTable *w = input->get(classifier::training::weights).get();
+    NumericTable *binBorders = input->get(inputBinBorders).get();
+    NumericTable *state = input->get(inputTrainingState).get();
+    const Parameter *par = static_cast<const Parameter *>(_par);
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::ClassificationTrainDistrStep1Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                       x, y, w, binBorders, state, pres, par);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step1Local, algorithmFPType, method, cpu>::finalizeCompute() {}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INTIALIZE_KERNELS(internal::ClassificationTrainDistrStep2Kernel, algorithmFPType, method);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINTIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step2Master, algorithmFPType, method, cpu>::compute()
+{
+    gbt::training::DistributedStep2MasterInput *input = static_cast<gbt::training::DistributedStep2MasterInput *>(_in);
+    data_management::DataCollection *dcInput = input->get(gbt::training::partialResults).get();
+    gbt::training::DistributedPartialResult *pres = static_cast<gbt::training::DistributedPartialResult *>(_pres);
+
+    const size_t nLocal = dcInput->size();
+    NumericTable **localStats = new NumericTable*[nLocal];
+    for(size_t i = 0; i < nLocal; i++)
+    {
+        gbt::training::PartialResult *localPres = static_cast<gbt::training::PartialResult *>((*dcInput)[i].get());
+        localStats[i] = localPres->get(gbt::training::partialStatistics).get();
+    }
+    const Parameter *par = static_cast<const Parameter *>(_par);
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::ClassificationTrainDistrStep2Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute,
+                       nLocal, localStats, pres, par);
+
+    delete[] localStats;
+
+    dcInput->clear();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    gbt::training::DistributedPartialResult *pres = static_cast<gbt::training::DistributedPartialResult *>(_pres);
+    Result *result = static_cast<Result *>(_res);
+    gbt::classification::Model *m = result->get(classifier::training::model).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::ClassificationTrainDistrStep2Kernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), finalizeCompute,
+                       pres, m);
+}
+
+} // namespace training
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,317 @@
+/* file: gbt_classification_train_distr_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the histogram-based method of gradient boosted trees classification training
+//  in the distributed processing mode. The trees are fitted to the gradients of the logistic loss
+//  or of the softmax cross-entropy as in the batch processing mode.
+//--
+*/
+
+#ifndef __GBT_CLASSIFICATION_TRAIN_DISTR_IMPL_I__
+#define __GBT_CLASSIFICATION_TRAIN_DISTR_IMPL_I__
+
+#include "threading.h"
+#include "numeric_table.h"
+#include "service_memory.h"
+#include "gbt_classification_train_kernel.h"
+#include "gbt_classification_train_impl.i"
+#include "gbt_train_distr_aux.i"
+
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace training
+{
+namespace internal
+{
+
+using gbt::training::internal::LocalTrainingState;
+using gbt::training::internal::MasterTrainingState;
+using gbt::training::internal::computeBinCandidates;
+using gbt::training::internal::mergeBinCandidates;
+
+/* Data of the local node kept between the compute() calls */
+template <typename algorithmFPType, CpuType cpu>
+class ClassificationLocalTrainingState : public LocalTrainingState<algorithmFPType, cpu>
+{
+    typedef LocalTrainingState<algorithmFPType, cpu> super;
+public:
+    ClassificationLocalTrainingState(const Parameter &par) :
+        super(par, (par.nClasses == 2 ? 1 : par.nClasses)), nClasses(par.nClasses), labels(0), weights(0), prob(0) {}
+
+    ~ClassificationLocalTrainingState()
+    {
+        service_free<int, cpu>(labels);
+        service_free<algorithmFPType, cpu>(weights);
+        service_free<algorithmFPType, cpu>(prob);
+    }
+
+    /**
+     *  Copies the class labels and the weights of the observations
+     *  \param[out] bLabelsOk   Flag of the class labels in the range [0, nClasses)
+     *  \return false if memory allocation failed
+     */
+    bool initLabels(NumericTable *y, NumericTable *w, bool &bLabelsOk)
+    {
+        const size_t nRows = this->data.nRows;
+        labels = service_malloc<int, cpu>(nRows);
+        weights = (w ? service_malloc<algorithmFPType, cpu>(nRows) : 0);
+        prob = service_malloc<algorithmFPType, cpu>(nRows * this->nScores);
+        if(!labels || (w && !weights) || !prob) { return false; }
+
+        bLabelsOk = true;
+        BlockDescriptor<algorithmFPType> yBlock;
+        y->getBlockOfColumnValues(0, 0, nRows, readOnly, yBlock);
+        const algorithmFPType *yArray = yBlock.getBlockPtr();
+        for(size_t i = 0; i < nRows; i++)
+        {
+            labels[i] = (int)yArray[i];
+            if(labels[i] < 0 || (size_t)labels[i] >= nClasses || (algorithmFPType)labels[i] != yArray[i]) { bLabelsOk = false; }
+        }
+        y->releaseBlockOfColumnValues(yBlock);
+
+        if(weights)
+        {
+            BlockDescriptor<algorithmFPType> wBlock;
+            w->getBlockOfColumnValues(0, 0, nRows, readOnly, wBlock);
+            const algorithmFPType *wArray = wBlock.getBlockPtr();
+            for(size_t i = 0; i < nRows; i++)
+            {
+                weights[i] = wArray[i];
+            }
+            w->releaseBlockOfColumnValues(wBlock);
+        }
+        return true;
+    }
+
+    /* The trees of one iteration are fitted to the probabilities computed from the scores of the previous iteration */
+    void computeGradients(size_t iTree) DAAL_C11_OVERRIDE
+    {
+        const size_t nRows = this->data.nRows;
+        const size_t nScores = this->nScores;
+        const size_t k = iTree % nScores;
+        const size_t nBlocks = (nRows + rowBlockSize - 1) / rowBlockSize;
+        const algorithmFPType *f = this->f;
+        algorithmFPType *p = prob;
+
+        if(k == 0)
+        {
+            daal::threader_for( nBlocks, nBlocks, [ = ](int iBlock)
+            {
+                const size_t begin = iBlock * rowBlockSize;
+                const size_t end = (begin + rowBlockSize > nRows ? nRows : begin + rowBlockSize);
+                computeProbabilities<algorithmFPType, cpu>(begin, end, nScores, f, p);
+            } );
+        }
+
+        /* For binary classification prob is the probability of the class 1 */
+        const int positiveClass = (nScores == 1 ? 1 : (int)k);
+        const algorithmFPType minHessian = (algorithmFPType)1e-16;
+        const int *y = labels;
+        const algorithmFPType *w = weights;
+        GH<algorithmFPType> *gh = this->gh;
+        daal::threader_for( nBlocks, nBlocks, [ = ](int iBlock)
+        {
+            const size_t begin = iBlock * rowBlockSize;
+            const size_t end = (begin + rowBlockSize > nRows ? nRows : begin + rowBlockSize);
+            for(size_t i = begin; i < end; i++)
+            {
+                const algorithmFPType pi = p[i * nScores + k];
+                algorithmFPType g = pi - (y[i] == positiveClass ? (algorithmFPType)1.0 : (algorithmFPType)0.0);
+                algorithmFPType h = pi * ((algorithmFPType)1.0 - pi);
+                if(h < minHessian) { h = minHessian; }
+                if(w)
+                {
+                    g *= w[i];
+                    h *= w[i];
+                }
+                gh[i].g = g;
+                gh[i].h = h;
+            }
+        } );
+    }
+
+    size_t nClasses;
+    int *labels;
+    algorithmFPType *weights;
+    algorithmFPType *prob;      /* Probabilities of the classes computed from the scores of the previous iteration */
+};
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+ClassificationTrainDistrStep1Kernel<algorithmFPType, method, cpu>::~ClassificationTrainDistrStep1Kernel()
+{
+    delete _state;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void ClassificationTrainDistrStep1Kernel<algorithmFPType, method, cpu>::compute(NumericTable *x, NumericTable *y, NumericTable *w,
+                                                                                NumericTable *binBorders, NumericTable *state,
+                                                                                gbt::training::PartialResult *pres,
+                                                                                const Parameter *par)
+{
+    if(!binBorders)
+    {
+        /* The first call starts the new training: compute the candidates for the borders of the bins */
+        delete _state;
+        _state = 0;
+
+        services::SharedPtr<NumericTable> candidates = computeBinCandidates<algorithmFPType, cpu>(x, par->maxBins);
+        if(!candidates) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+        pres->set(gbt::training::partialStatistics, candidates);
+        return;
+    }
+
+    if(!_state)
+    {
+        _state = new ClassificationLocalTrainingState<algorithmFPType, cpu>(*par);
+        bool bLabelsOk = true;
+        if(!_state->init(x, binBorders) || !_state->initLabels(y, w, bLabelsOk))
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+        }
+        else if(!bLabelsOk)
+        {
+            this->_errors->add(services::ErrorIncorrectClassLabels);
+        }
+        if(!this->_errors->isEmpty())
+        {
+            delete _state;
+            _state = 0;
+            return;
+        }
+    }
+    else if(_state->data.nRows != x->getNumberOfRows())
+    {
+        this->_errors->add(services::ErrorIncorrectNumberOfObservations);
+        return;
+    }
+
+    if(!_state->update(state))
+    {
+        this->_errors->add(services::ErrorIncorrectInputNumericTable);
+        return;
+    }
+
+    pres->set(gbt::training::partialStatistics, _state->builder.buildRequestedHistograms(_state->gh));
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+ClassificationTrainDistrStep2Kernel<algorithmFPType, method, cpu>::~ClassificationTrainDistrStep2Kernel()
+{
+    delete _state;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void ClassificationTrainDistrStep2Kernel<algorithmFPType, method, cpu>::compute(size_t nLocal, NumericTable **localStats,
+                                                                                gbt::training::DistributedPartialResult *pres,
+                                                                                const Parameter *par)
+{
+    services::SharedPtr<data_management::DataCollection> trees = pres->get(gbt::training::trees);
+
+    if(!pres->get(gbt::training::binBorders))
+    {
+        /* The first call: the local nodes sent the candidates for the borders of the bins */
+        const size_t nCols = 1 + 2 * par->maxBins;
+        const size_t nFeatures = localStats[0]->getNumberOfRows() - 1;
+        for(size_t l = 0; l < nLocal; l++)
+        {
+            if(localStats[l]->getNumberOfRows() != nFeatures + 1 || localStats[l]->getNumberOfColumns() != nCols)
+            {
+                this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable);
+                return;
+            }
+        }
+
+        size_t nObservations = 0;
+        for(size_t l = 0; l < nLocal; l++)
+        {
+            BlockDescriptor<algorithmFPType> block;
+            localStats[l]->getBlockOfRows(nFeatures, 1, readOnly, block);
+            nObservations += (size_t)block.getBlockPtr()[0];
+            localStats[l]->releaseBlockOfRows(block);
+        }
+        const size_t nScores = (par->nClasses == 2 ? 1 : par->nClasses);
+
+        delete _state;
+        _state = new MasterTrainingState<algorithmFPType, cpu>(*par);
+        trees->clear();
+
+        services::SharedPtr<NumericTable> binBorders = mergeBinCandidates<algorithmFPType, cpu>(localStats, nLocal, par->maxBins);
+        services::SharedPtr<NumericTable> state;
+        if(binBorders)
+        {
+            state = _state->start(binBorders.get(), nObservations, par->maxIterations * nScores, 0);
+        }
+        if(!state) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+        pres->set(gbt::training::binBorders, binBorders);
+        pres->set(gbt::training::trainingState, state);
+        return;
+    }
+
+    if(!_state || _state->isCompleted())
+    {
+        this->_errors->add(services::ErrorIncorrectInputNumericTable);
+        return;
+    }
+
+    const size_t nHist = _state->builder.getNumberOfRequestedHistograms();
+    const size_t histSize = 3 * _state->data.nTotalBins;
+    for(size_t l = 0; l < nLocal; l++)
+    {
+        if(localStats[l]->getNumberOfRows() != nHist || localStats[l]->getNumberOfColumns() != histSize)
+        {
+            this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable);
+            return;
+        }
+    }
+
+    services::SharedPtr<NumericTable> state = _state->grow(localStats, nLocal, trees.get());
+    if(!state) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+    pres->set(gbt::training::trainingState, state);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void ClassificationTrainDistrStep2Kernel<algorithmFPType, method, cpu>::finalizeCompute(gbt::training::DistributedPartialResult *pres,
+                                                                                        Model *m)
+{
+    services::SharedPtr<data_management::DataCollection> trees = pres->get(gbt::training::trees);
+
+    m->clearTrees();
+    for(size_t i = 0; i < trees->size(); i++)
+    {
+        m->addTree(services::staticPointerCast<NumericTable, SerializationIface>((*trees)[i]));
+    }
+}
+
+} // namespace internal
+} // namespace training
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,237 @@
+/* file: gbt_classification_train_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the histogram-based method of gradient boosted trees classification training.
+//  Binary classification fits one tree per iteration to the gradients of the logistic loss,
+//  multi-class classification fits nClasses trees per iteration to the gradients of the
+//  softmax cross-entropy computed from the scores of the previous iteration.
+//--
+*/
+
+#ifndef __GBT_CLASSIFICATION_TRAIN_IMPL_I__
+#define __GBT_CLASSIFICATION_TRAIN_IMPL_I__
+
+#include "threading.h"
+#include "numeric_table.h"
+#include "service_memory.h"
+#include "service_math.h"
+#include "gbt_classification_train_kernel.h"
+#include "gbt_train_aux.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace training
+{
+namespace internal
+{
+
+using gbt::training::internal::GH;
+using gbt::training::internal::BinnedData;
+using gbt::training::internal::TreeBuilder;
+using gbt::training::internal::rowBlockSize;
+
+/**
+ *  Computes the probabilities of the classes from the scores f of the observations [begin, end).
+ *  For one score per observation the probability of the class 1 is computed
+ */
+template <typename algorithmFPType, CpuType cpu>
+void computeProbabilities(size_t begin, size_t end, size_t nScores, const algorithmFPType *f, algorithmFPType *prob)
+{
+    const size_t nRows = end - begin;
+    const algorithmFPType *fb = f + begin * nScores;
+    algorithmFPType *pb = prob + begin * nScores;
+
+    if(nScores == 1)
+    {
+        /* Exponent argument is bounded to avoid the overflow in single precision */
+        const algorithmFPType expThreshold = (algorithmFPType)75.0;
+        for(size_t i = 0; i < nRows; i++)
+        {
+            pb[i] = (-fb[i] > expThreshold ? expThreshold : -fb[i]);
+        }
+        Math<algorithmFPType, cpu>::vExp(nRows, pb, pb);
+        for(size_t i = 0; i < nRows; i++)
+        {
+            pb[i] = (algorithmFPType)1.0 / ((algorithmFPType)1.0 + pb[i]);
+        }
+        return;
+    }
+
+    for(size_t i = 0; i < nRows; i++)
+    {
+        algorithmFPType fMax = fb[i * nScores];
+        for(size_t k = 1; k < nScores; k++)
+        {
+            if(fb[i * nScores + k] > fMax) { fMax = fb[i * nScores + k]; }
+        }
+        for(size_t k = 0; k < nScores; k++)
+        {
+            pb[i * nScores + k] = fb[i * nScores + k] - fMax;
+        }
+    }
+    Math<algorithmFPType, cpu>::vExp(nRows * nScores, pb, pb);
+    for(size_t i = 0; i < nRows; i++)
+    {
+        algorithmFPType sum = 0;
+        for(size_t k = 0; k < nScores; k++)
+        {
+            sum += pb[i * nScores + k];
+        }
+        const algorithmFPType invSum = (algorithmFPType)1.0 / sum;
+        for(size_t k = 0; k < nScores; k++)
+        {
+            pb[i * nScores + k] *= invSum;
+        }
+    }
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void ClassificationTrainBatchKernel<algorithmFPType, method, cpu>::compute(NumericTable *x, NumericTable *y, NumericTable *w,
+                                                                           Model *m, const Parameter *par)
+{
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nClasses = par->nClasses;
+    const size_t nScores = (nClasses == 2 ? 1 : nClasses);
+
+    m->clearTrees();
+
+    int *labels = service_malloc<int, cpu>(nRows);
+    algorithmFPType *weights = (w ? service_malloc<algorithmFPType, cpu>(nRows) : 0);
+    algorithmFPType *f = service_calloc<algorithmFPType, cpu>(nRows * nScores);
+    algorithmFPType *prob = service_malloc<algorithmFPType, cpu>(nRows * nScores);
+    GH<algorithmFPType> *gh = service_malloc<GH<algorithmFPType>, cpu>(nRows);
+    if(!labels || (w && !weights) || !f || !prob || !gh)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        service_free<int, cpu>(labels);
+        service_free<algorithmFPType, cpu>(weights);
+        service_free<algorithmFPType, cpu>(f);
+        service_free<algorithmFPType, cpu>(prob);
+        service_free<GH<algorithmFPType>, cpu>(gh);
+        return;
+    }
+
+    bool bLabelsOk = true;
+    {
+        BlockDescriptor<algorithmFPType> yBlock;
+        y->getBlockOfColumnValues(0, 0, nRows, readOnly, yBlock);
+        const algorithmFPType *yArray = yBlock.getBlockPtr();
+        for(size_t i = 0; i < nRows; i++)
+        {
+            labels[i] = (int)yArray[i];
+            if(labels[i] < 0 || (size_t)labels[i] >= nClasses || (algorithmFPType)labels[i] != yArray[i]) { bLabelsOk = false; }
+        }
+        y->releaseBlockOfColumnValues(yBlock);
+    }
+    if(weights)
+    {
+        BlockDescriptor<algorithmFPType> wBlock;
+        w->getBlockOfColumnValues(0, 0, nRows, readOnly, wBlock);
+        const algorithmFPType *wArray = wBlock.getBlockPtr();
+        for(size_t i = 0; i < nRows; i++)
+        {
+            weights[i] = wArray[i];
+        }
+        w->releaseBlockOfColumnValues(wBlock);
+    }
+
+    BinnedData<algorithmFPType, cpu> data;
+    TreeBuilder<algorithmFPType, cpu> builder(data, *par);
+    if(!bLabelsOk)
+    {
+        this->_errors->add(services::ErrorIncorrectClassLabels);
+    }
+    else if(!data.init(x, par->maxBins) || !builder.init())
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+    else
+    {
+        const size_t nBlocks = (nRows + rowBlockSize - 1) / rowBlockSize;
+        const algorithmFPType minHessian = (algorithmFPType)1e-16;
+
+        for(size_t iter = 0; iter < par->maxIterations; iter++)
+        {
+            daal::threader_for( nBlocks, nBlocks, [ = ](int iBlock)
+            {
+                const size_t begin = iBlock * rowBlockSize;
+                const size_t end = (begin + rowBlockSize > nRows ? nRows : begin + rowBlockSize);
+                computeProbabilities<algorithmFPType, cpu>(begin, end, nScores, f, prob);
+            } );
+
+            for(size_t k = 0; k < nScores; k++)
+            {
+                /* For binary classification prob is the probability of the class 1 */
+                const int positiveClass = (nScores == 1 ? 1 : (int)k);
+                daal::threader_for( nBlocks, nBlocks, [ = ](int iBlock)
+                {
+                    const size_t begin = iBlock * rowBlockSize;
+                    const size_t end = (begin + rowBlockSize > nRows ? nRows : begin + rowBlockSize);
+                    for(size_t i = begin; i < end; i++)
+                    {
+                        const algorithmFPType p = prob[i * nScores + k];
+                        algorithmFPType g = p - (labels[i] == positiveClass ? (algorithmFPType)1.0 : (algorithmFPType)0.0);
+                        algorithmFPType h = p * ((algorithmFPType)1.0 - p);
+                        if(h < minHessian) { h = minHessian; }
+                        if(weights)
+                        {
+                            g *= weights[i];
+                            h *= weights[i];
+                        }
+                        gh[i].g = g;
+                        gh[i].h = h;
+                    }
+                } );
+
+                services::SharedPtr<NumericTable> tree = builder.build(gh, f + k, nScores);
+                if(!tree)
+                {
+                    this->_errors->add(services::ErrorMemoryAllocationFailed);
+                    break;
+                }
+                m->addTree(tree);
+            }
+            if(!this->_errors->isEmpty()) { break; }
+        }
+    }
+
+    service_free<int, cpu>(labels);
+    service_free<algorithmFPType, cpu>(weights);
+    service_free<algorithmFPType, cpu>(f);
+    service_free<algorithmFPType, cpu>(prob);
+    service_free<GH<algorithmFPType>, cpu>(gh);
+}
+
+} // namespace internal
+} // namespace training
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,138 @@
+/* file: gbt_classification_train_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template functions that train the gradient boosted trees classification model.
+//--
+*/
+
+#ifndef __GBT_CLASSIFICATION_TRAIN_KERNEL_H__
+#define __GBT_CLASSIFICATION_TRAIN_KERNEL_H__
+
+#include "gbt_classification_training_types.h"
+#include "gbt_classification_model.h"
+#include "kernel.h"
+#include "numeric_table.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+namespace internal
+{
+template <typename algorithmFPType, CpuType cpu>
+class MasterTrainingState;
+} // namespace internal
+} // namespace training
+
+namespace classification
+{
+namespace training
+{
+namespace internal
+{
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+class ClassificationTrainBatchKernel : public daal::algorithms::Kernel
+{
+public:
+    /**
+     *  \brief Trains the gradient boosted trees classification model
+     *
+     *  \param x[in]    Training data set
+     *  \param y[in]    Class labels of the observations
+     *  \param w[in]    Optional weights of the observations, may be NULL
+     *  \param m[out]   Trained model
+     *  \param par[in]  Parameters of the training
+     */
+    void compute(NumericTable *x, NumericTable *y, NumericTable *w, Model *m, const Parameter *par);
+};
+
+template <typename algorithmFPType, CpuType cpu>
+class ClassificationLocalTrainingState;
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+class ClassificationTrainDistrStep1Kernel : public daal::algorithms::Kernel
+{
+public:
+    ClassificationTrainDistrStep1Kernel() : _state(0) {}
+    ~ClassificationTrainDistrStep1Kernel();
+
+    /**
+     *  \brief Computes the statistics of the local data set requested by the master node.
+     *         The quantized data set and the scores of the observations are kept between the calls
+     *
+     *  \param x[in]             Local training data set
+     *  \param y[in]             Class labels of the observations
+     *  \param w[in]             Optional weights of the observations, may be NULL
+     *  \param binBorders[in]    Borders of the bins computed by the master node, NULL on the first call
+     *  \param state[in]         Training state computed by the master node, NULL on the first call
+     *  \param pres[out]         Partial result of the local node
+     *  \param par[in]           Parameters of the training
+     */
+    void compute(NumericTable *x, NumericTable *y, NumericTable *w, NumericTable *binBorders, NumericTable *state,
+                 gbt::training::PartialResult *pres, const Parameter *par);
+
+protected:
+    ClassificationLocalTrainingState<algorithmFPType, cpu> *_state;
+};
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+class ClassificationTrainDistrStep2Kernel : public daal::algorithms::Kernel
+{
+public:
+    ClassificationTrainDistrStep2Kernel() : _state(0) {}
+    ~ClassificationTrainDistrStep2Kernel();
+
+    /**
+     *  \brief Merges the statistics of the local nodes and grows the trees.
+     *         The tree under construction is kept between the calls
+     *
+     *  \param nLocal[in]        Number of the local nodes
+     *  \param localStats[in]    Statistics computed on the local nodes
+     *  \param pres[out]         Partial result of the master node
+     *  \param par[in]           Parameters of the training
+     */
+    void compute(size_t nLocal, NumericTable **localStats, gbt::training::DistributedPartialResult *pres, const Parameter *par);
+
+    /**
+     *  \brief Computes the model from the trees built by the master node
+     *
+     *  \param pres[in]          Partial result of the master node
+     *  \param m[out]            Trained model
+     */
+    void finalizeCompute(gbt::training::DistributedPartialResult *pres, Model *m);
+
+protected:
+    gbt::training::internal::MasterTrainingState<algorithmFPType, cpu> *_state;
+};
+
+} // namespace internal
+} // namespace training
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,143 @@
+/* file: gbt_predict_aux.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Auxiliary functions shared by the gradient boosted trees prediction kernels.
+//  The trees of the model are copied once into one array of compact nodes,
+//  the observations are processed in parallel in blocks, and every tree is applied
+//  to the whole block before the next one so that the tree stays in cache.
+//--
+*/
+
+#ifndef __GBT_PREDICT_AUX_I__
+#define __GBT_PREDICT_AUX_I__
+
+#include "threading.h"
+#include "numeric_table.h"
+#include "service_memory.h"
+
+using namespace daal::data_management;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace prediction
+{
+namespace internal
+{
+
+/* Number of observations processed by one task of the prediction */
+const size_t predictBlockSize = 256;
+
+template <typename algorithmFPType>
+struct PredictNode
+{
+    int featureIdx;             /* Split feature, -1 for a leaf */
+    int leftIdx;                /* Index of the left child in the tree, the right child follows it */
+    algorithmFPType value;      /* Split value or response of a leaf */
+};
+
+/**
+ *  Trees of the model stored in one array.
+ *  The nodes of the t-th tree start at nodes[treeOffsets[t]]
+ */
+template <typename algorithmFPType, CpuType cpu>
+class TreeEnsemble
+{
+public:
+    TreeEnsemble() : nTrees(0), nodes(0), treeOffsets(0) {}
+    ~TreeEnsemble()
+    {
+        service_free<PredictNode<algorithmFPType>, cpu>(nodes);
+        service_free<size_t, cpu>(treeOffsets);
+    }
+
+    /**
+     *  Copies the trees of the model
+     *  \tparam ModelType Gradient boosted trees classification or regression model
+     *  \return false if memory allocation failed
+     */
+    template <typename ModelType>
+    bool init(const ModelType *model)
+    {
+        nTrees = model->getNumberOfTrees();
+        treeOffsets = service_malloc<size_t, cpu>(nTrees + 1);
+        if(!treeOffsets) { return false; }
+
+        treeOffsets[0] = 0;
+        for(size_t t = 0; t < nTrees; t++)
+        {
+            treeOffsets[t + 1] = treeOffsets[t] + model->getTree(t)->getNumberOfRows();
+        }
+        nodes = service_malloc<PredictNode<algorithmFPType>, cpu>(treeOffsets[nTrees]);
+        if(!nodes) { return false; }
+
+        for(size_t t = 0; t < nTrees; t++)
+        {
+            services::SharedPtr<NumericTable> tree = model->getTree(t);
+            const size_t nNodes = treeOffsets[t + 1] - treeOffsets[t];
+            BlockDescriptor<algorithmFPType> block;
+            tree->getBlockOfRows(0, nNodes, readOnly, block);
+            const algorithmFPType *tt = block.getBlockPtr();
+            PredictNode<algorithmFPType> *tn = nodes + treeOffsets[t];
+            for(size_t i = 0; i < nNodes; i++)
+            {
+                tn[i].featureIdx = (int)tt[3 * i];
+                tn[i].value      = tt[3 * i + 1];
+                tn[i].leftIdx    = (int)tt[3 * i + 2];
+            }
+            tree->releaseBlockOfRows(block);
+        }
+        return true;
+    }
+
+    /**
+     *  Adds the responses of the t-th tree for nRows observations x to the scores f[i * fStride]
+     */
+    void addTreeResponses(size_t t, size_t nRows, size_t nFeatures, const algorithmFPType *x,
+                          algorithmFPType *f, size_t fStride) const
+    {
+        const PredictNode<algorithmFPType> *tn = nodes + treeOffsets[t];
+        for(size_t i = 0; i < nRows; i++)
+        {
+            const algorithmFPType *row = x + i * nFeatures;
+            size_t idx = 0;
+            while(tn[idx].featureIdx >= 0)
+            {
+                idx = tn[idx].leftIdx + (row[tn[idx].featureIdx] < tn[idx].value ? 0 : 1);
+            }
+            f[i * fStride] += tn[idx].value;
+        }
+    }
+
+    size_t nTrees;
+    PredictNode<algorithmFPType> *nodes;
+    size_t *treeOffsets;
+};
+
+} // namespace internal
+} // namespace prediction
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
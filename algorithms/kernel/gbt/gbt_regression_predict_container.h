@@ -0,0 +1,74 @@
+/* file: gbt_regression_predict_container.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees regression prediction algorithm container --
+//  a class that contains the prediction kernels for supported architectures.
+//--
+*/
+
+#ifndef __GBT_REGRESSION_PREDICT_CONTAINER_H__
+#define __GBT_REGRESSION_PREDICT_CONTAINER_H__
+
+#include "gbt_regression_predict.h"
+#include "gbt_regression_predict_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace prediction
+{
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv) : PredictionContainerIface()
+{
+    __DAAL_INTIALIZE_KERNELS(internal::RegressionPredictKernel, algorithmFPType, method);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
+{
+    __DAAL_DEINTIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void BatchContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    Result *result = static_cast<Result *>(_res);
+
+    NumericTable *x = input->get(data).get();
+    const gbt::regression::Model *m = input->get(model).get();
+    NumericTable *r = result->get(prediction).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::RegressionPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType, method), compute, x, m, r);
+}
+
+} // namespace prediction
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
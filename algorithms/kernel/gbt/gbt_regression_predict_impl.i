@@ -0,0 +1,100 @@
+/* file: gbt_regression_predict_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of gradient boosted trees regression prediction.
+//  The prediction is the sum of the responses of all trees of the model.
+//--
+*/
+
+#ifndef __GBT_REGRESSION_PREDICT_IMPL_I__
+#define __GBT_REGRESSION_PREDICT_IMPL_I__
+
+#include "threading.h"
+#include "numeric_table.h"
+#include "service_memory.h"
+#include "gbt_regression_predict_kernel.h"
+#include "gbt_predict_aux.i"
+
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace prediction
+{
+namespace internal
+{
+
+using gbt::prediction::internal::TreeEnsemble;
+using gbt::prediction::internal::predictBlockSize;
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void RegressionPredictKernel<algorithmFPType, method, cpu>::compute(NumericTable *x, const Model *m, NumericTable *r)
+{
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+
+    TreeEnsemble<algorithmFPType, cpu> trees;
+    if(!trees.init(m))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    const TreeEnsemble<algorithmFPType, cpu> *pTrees = &trees;
+
+    const size_t nBlocks = (nRows + predictBlockSize - 1) / predictBlockSize;
+    daal::threader_for( nBlocks, nBlocks, [ = ](int iBlock)
+    {
+        const size_t begin = iBlock * predictBlockSize;
+        const size_t end = (begin + predictBlockSize > nRows ? nRows : begin + predictBlockSize);
+        const size_t nBlockRows = end - begin;
+
+        BlockDescriptor<algorithmFPType> rBlock;
+        r->getBlockOfRows(begin, nBlockRows, writeOnly, rBlock);
+        algorithmFPType *prediction = rBlock.getBlockPtr();
+        for(size_t i = 0; i < nBlockRows; i++)
+        {
+            prediction[i] = 0;
+        }
+
+        BlockDescriptor<algorithmFPType> xBlock;
+        x->getBlockOfRows(begin, nBlockRows, readOnly, xBlock);
+        const algorithmFPType *xArray = xBlock.getBlockPtr();
+        for(size_t t = 0; t < pTrees->nTrees; t++)
+        {
+            pTrees->addTreeResponses(t, nBlockRows, nFeatures, xArray, prediction, 1);
+        }
+        x->releaseBlockOfRows(xBlock);
+        r->releaseBlockOfRows(rBlock);
+    } );
+}
+
+} // namespace internal
+} // namespace prediction
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,282 @@
+/* file: gbt_regression_train_distr_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the histogram-based method of gradient boosted trees regression training
+//  in the distributed processing mode. The first tree of the model is a single leaf with the mean
+//  of the dependent variable over all local data sets, every next tree is fitted to the gradients
+//  of the squared loss as in the batch processing mode.
+//--
+*/
+
+#ifndef __GBT_REGRESSION_TRAIN_DISTR_IMPL_I__
+#define __GBT_REGRESSION_TRAIN_DISTR_IMPL_I__
+
+#include "threading.h"
+#include "numeric_table.h"
+#include "service_memory.h"
+#include "gbt_regression_train_kernel.h"
+#include "gbt_train_distr_aux.i"
+
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+namespace internal
+{
+
+using gbt::training::internal::GH;
+using gbt::training::internal::TreeBuilder;
+using gbt::training::internal::LocalTrainingState;
+using gbt::training::internal::MasterTrainingState;
+using gbt::training::internal::computeBinCandidates;
+using gbt::training::internal::mergeBinCandidates;
+using gbt::training::internal::rowBlockSize;
+
+/* Data of the local node kept between the compute() calls */
+template <typename algorithmFPType, CpuType cpu>
+class RegressionLocalTrainingState : public LocalTrainingState<algorithmFPType, cpu>
+{
+    typedef LocalTrainingState<algorithmFPType, cpu> super;
+public:
+    RegressionLocalTrainingState(const Parameter &par) : super(par, 1), response(0) {}
+
+    ~RegressionLocalTrainingState()
+    {
+        service_free<algorithmFPType, cpu>(response);
+    }
+
+    /**
+     *  Copies the values of the dependent variable
+     *  \return false if memory allocation failed
+     */
+    bool initResponse(NumericTable *y)
+    {
+        const size_t nRows = this->data.nRows;
+        response = service_malloc<algorithmFPType, cpu>(nRows);
+        if(!response) { return false; }
+
+        BlockDescriptor<algorithmFPType> yBlock;
+        y->getBlockOfColumnValues(0, 0, nRows, readOnly, yBlock);
+        const algorithmFPType *yArray = yBlock.getBlockPtr();
+        for(size_t i = 0; i < nRows; i++)
+        {
+            response[i] = yArray[i];
+        }
+        y->releaseBlockOfColumnValues(yBlock);
+        return true;
+    }
+
+    void computeGradients(size_t iTree) DAAL_C11_OVERRIDE
+    {
+        const size_t nRows = this->data.nRows;
+        const size_t nBlocks = (nRows + rowBlockSize - 1) / rowBlockSize;
+        const algorithmFPType *f = this->f;
+        const algorithmFPType *y = response;
+        GH<algorithmFPType> *gh = this->gh;
+        daal::threader_for( nBlocks, nBlocks, [ = ](int iBlock)
+        {
+            const size_t begin = iBlock * rowBlockSize;
+            const size_t end = (begin + rowBlockSize > nRows ? nRows : begin + rowBlockSize);
+            for(size_t i = begin; i < end; i++)
+            {
+                gh[i].g = f[i] - y[i];
+                gh[i].h = (algorithmFPType)1.0;
+            }
+        } );
+    }
+
+    algorithmFPType *response;
+};
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+RegressionTrainDistrStep1Kernel<algorithmFPType, method, cpu>::~RegressionTrainDistrStep1Kernel()
+{
+    delete _state;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void RegressionTrainDistrStep1Kernel<algorithmFPType, method, cpu>::compute(NumericTable *x, NumericTable *y,
+                                                                            NumericTable *binBorders, NumericTable *state,
+                                                                            gbt::training::PartialResult *pres, const Parameter *par)
+{
+    const size_t nRows = x->getNumberOfRows();
+
+    if(!binBorders)
+    {
+        /* The first call starts the new training: compute the candidates for the borders of the bins
+         * and the sum of the dependent variable for the response of the first tree */
+        delete _state;
+        _state = 0;
+
+        services::SharedPtr<NumericTable> candidates = computeBinCandidates<algorithmFPType, cpu>(x, par->maxBins);
+        if(!candidates) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+        BlockDescriptor<algorithmFPType> yBlock;
+        y->getBlockOfColumnValues(0, 0, nRows, readOnly, yBlock);
+        const algorithmFPType *yArray = yBlock.getBlockPtr();
+        algorithmFPType sum = 0;
+        for(size_t i = 0; i < nRows; i++)
+        {
+            sum += yArray[i];
+        }
+        y->releaseBlockOfColumnValues(yBlock);
+
+        const size_t nFeatures = x->getNumberOfColumns();
+        BlockDescriptor<algorithmFPType> block;
+        candidates->getBlockOfRows(nFeatures, 1, readWrite, block);
+        block.getBlockPtr()[1] = sum;
+        candidates->releaseBlockOfRows(block);
+
+        pres->set(gbt::training::partialStatistics, candidates);
+        return;
+    }
+
+    if(!_state)
+    {
+        _state = new RegressionLocalTrainingState<algorithmFPType, cpu>(*par);
+        if(!_state->init(x, binBorders) || !_state->initResponse(y))
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            delete _state;
+            _state = 0;
+            return;
+        }
+    }
+    else if(_state->data.nRows != nRows)
+    {
+        this->_errors->add(services::ErrorIncorrectNumberOfObservations);
+        return;
+    }
+
+    if(!_state->update(state))
+    {
+        this->_errors->add(services::ErrorIncorrectInputNumericTable);
+        return;
+    }
+
+    pres->set(gbt::training::partialStatistics, _state->builder.buildRequestedHistograms(_state->gh));
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+RegressionTrainDistrStep2Kernel<algorithmFPType, method, cpu>::~RegressionTrainDistrStep2Kernel()
+{
+    delete _state;
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void RegressionTrainDistrStep2Kernel<algorithmFPType, method, cpu>::compute(size_t nLocal, NumericTable **localStats,
+                                                                            gbt::training::DistributedPartialResult *pres,
+                                                                            const Parameter *par)
+{
+    services::SharedPtr<data_management::DataCollection> trees = pres->get(gbt::training::trees);
+
+    if(!pres->get(gbt::training::binBorders))
+    {
+        /* The first call: the local nodes sent the candidates for the borders of the bins */
+        const size_t nCols = 1 + 2 * par->maxBins;
+        const size_t nFeatures = localStats[0]->getNumberOfRows() - 1;
+        for(size_t l = 0; l < nLocal; l++)
+        {
+            if(localStats[l]->getNumberOfRows() != nFeatures + 1 || localStats[l]->getNumberOfColumns() != nCols)
+            {
+                this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable);
+                return;
+            }
+        }
+
+        algorithmFPType nObservations = 0, sum = 0;
+        for(size_t l = 0; l < nLocal; l++)
+        {
+            BlockDescriptor<algorithmFPType> block;
+            localStats[l]->getBlockOfRows(nFeatures, 1, readOnly, block);
+            nObservations += block.getBlockPtr()[0];
+            sum += block.getBlockPtr()[1];
+            localStats[l]->releaseBlockOfRows(block);
+        }
+        const algorithmFPType mean = sum / nObservations;
+
+        delete _state;
+        _state = new MasterTrainingState<algorithmFPType, cpu>(*par);
+        trees->clear();
+
+        services::SharedPtr<NumericTable> binBorders = mergeBinCandidates<algorithmFPType, cpu>(localStats, nLocal, par->maxBins);
+        services::SharedPtr<NumericTable> state;
+        if(binBorders)
+        {
+            state = _state->start(binBorders.get(), (size_t)nObservations, 1 + par->maxIterations, &mean);
+        }
+        if(!state) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+        trees->push_back(TreeBuilder<algorithmFPType, cpu>::makeLeaf(mean));
+        pres->set(gbt::training::binBorders, binBorders);
+        pres->set(gbt::training::trainingState, state);
+        return;
+    }
+
+    if(!_state || _state->isCompleted())
+    {
+        this->_errors->add(services::ErrorIncorrectInputNumericTable);
+        return;
+    }
+
+    const size_t nHist = _state->builder.getNumberOfRequestedHistograms();
+    const size_t histSize = 3 * _state->data.nTotalBins;
+    for(size_t l = 0; l < nLocal; l++)
+    {
+        if(localStats[l]->getNumberOfRows() != nHist || localStats[l]->getNumberOfColumns() != histSize)
+        {
+            this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable);
+            return;
+        }
+    }
+
+    services::SharedPtr<NumericTable> state = _state->grow(localStats, nLocal, trees.get());
+    if(!state) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+    pres->set(gbt::training::trainingState, state);
+}
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void RegressionTrainDistrStep2Kernel<algorithmFPType, method, cpu>::finalizeCompute(gbt::training::DistributedPartialResult *pres,
+                                                                                    Model *m)
+{
+    services::SharedPtr<data_management::DataCollection> trees = pres->get(gbt::training::trees);
+
+    m->clearTrees();
+    for(size_t i = 0; i < trees->size(); i++)
+    {
+        m->addTree(services::staticPointerCast<NumericTable, SerializationIface>((*trees)[i]));
+    }
+}
+
+} // namespace internal
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
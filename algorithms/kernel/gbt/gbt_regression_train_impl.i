@@ -0,0 +1,139 @@
+/* file: gbt_regression_train_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the histogram-based method of gradient boosted trees regression training.
+//  The first tree of the model is a single leaf with the mean of the dependent variable,
+//  every next tree is fitted to the gradients of the squared loss.
+//--
+*/
+
+#ifndef __GBT_REGRESSION_TRAIN_IMPL_I__
+#define __GBT_REGRESSION_TRAIN_IMPL_I__
+
+#include "threading.h"
+#include "numeric_table.h"
+#include "service_memory.h"
+#include "gbt_regression_train_kernel.h"
+#include "gbt_train_aux.i"
+
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+namespace internal
+{
+
+using gbt::training::internal::GH;
+using gbt::training::internal::BinnedData;
+using gbt::training::internal::TreeBuilder;
+using gbt::training::internal::rowBlockSize;
+
+template <typename algorithmFPType, Method method, CpuType cpu>
+void RegressionTrainBatchKernel<algorithmFPType, method, cpu>::compute(NumericTable *x, NumericTable *y, Model *m,
+                                                                       const Parameter *par)
+{
+    const size_t nRows = x->getNumberOfRows();
+
+    m->clearTrees();
+
+    algorithmFPType *response = service_malloc<algorithmFPType, cpu>(nRows);
+    algorithmFPType *f = service_malloc<algorithmFPType, cpu>(nRows);
+    GH<algorithmFPType> *gh = service_malloc<GH<algorithmFPType>, cpu>(nRows);
+    if(!response || !f || !gh)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        service_free<algorithmFPType, cpu>(response);
+        service_free<algorithmFPType, cpu>(f);
+        service_free<GH<algorithmFPType>, cpu>(gh);
+        return;
+    }
+
+    algorithmFPType mean = 0;
+    {
+        BlockDescriptor<algorithmFPType> yBlock;
+        y->getBlockOfColumnValues(0, 0, nRows, readOnly, yBlock);
+        const algorithmFPType *yArray = yBlock.getBlockPtr();
+        for(size_t i = 0; i < nRows; i++)
+        {
+            response[i] = yArray[i];
+            mean += yArray[i];
+        }
+        y->releaseBlockOfColumnValues(yBlock);
+    }
+    mean /= (algorithmFPType)nRows;
+
+    BinnedData<algorithmFPType, cpu> data;
+    TreeBuilder<algorithmFPType, cpu> builder(data, *par);
+    if(!data.init(x, par->maxBins) || !builder.init())
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+    else
+    {
+        m->addTree(TreeBuilder<algorithmFPType, cpu>::makeLeaf(mean));
+        for(size_t i = 0; i < nRows; i++)
+        {
+            f[i] = mean;
+        }
+
+        const size_t nBlocks = (nRows + rowBlockSize - 1) / rowBlockSize;
+        for(size_t iter = 0; iter < par->maxIterations; iter++)
+        {
+            daal::threader_for( nBlocks, nBlocks, [ = ](int iBlock)
+            {
+                const size_t begin = iBlock * rowBlockSize;
+                const size_t end = (begin + rowBlockSize > nRows ? nRows : begin + rowBlockSize);
+                for(size_t i = begin; i < end; i++)
+                {
+                    gh[i].g = f[i] - response[i];
+                    gh[i].h = (algorithmFPType)1.0;
+                }
+            } );
+
+            services::SharedPtr<NumericTable> tree = builder.build(gh, f, 1);
+            if(!tree)
+            {
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+                break;
+            }
+            m->addTree(tree);
+        }
+    }
+
+    service_free<algorithmFPType, cpu>(response);
+    service_free<algorithmFPType, cpu>(f);
+    service_free<GH<algorithmFPType>, cpu>(gh);
+}
+
+} // namespace internal
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,875 @@
+/* file: gbt_train_aux.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Auxiliary functions shared by the gradient boosted trees training kernels:
+//  quantization of the features into bins and histogram-based construction
+//  of a regression tree on the gradient statistics.
+//
+//  The values of every feature are replaced once by the indices of their bins,
+//  so that a tree node is described by a histogram of the sums of gradients and
+//  hessians over the bins of every feature. The trees are grown level by level.
+//  For every pair of children the histogram is built only for the smaller one,
+//  the histogram of the larger one is the difference of the histograms of the
+//  parent and the smaller child.
+//--
+*/
+
+#ifndef __GBT_TRAIN_AUX_I__
+#define __GBT_TRAIN_AUX_I__
+
+#include "threading.h"
+#include "numeric_table.h"
+#include "homogen_numeric_table.h"
+#include "service_memory.h"
+#include "service_sort.h"
+#include "service_defines.h"
+#include "gbt_training_parameter.h"
+
+using namespace daal::data_management;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+namespace internal
+{
+
+typedef unsigned short BinIndexType;
+
+/* Number of observations processed by one task of the row-parallel loops */
+const size_t rowBlockSize = 1024;
+
+/* Sums of the gradients, hessians and the number of observations */
+template <typename algorithmFPType>
+struct GHSum
+{
+    algorithmFPType g;
+    algorithmFPType h;
+    algorithmFPType n;
+};
+
+/* Gradient and hessian of the loss function for one observation */
+template <typename algorithmFPType>
+struct GH
+{
+    algorithmFPType g;
+    algorithmFPType h;
+};
+
+/**
+ *  Values of the features replaced by the indices of their bins.
+ *  bins[i * nFeatures + j] is the bin of the j-th feature of the i-th observation.
+ *  The value x of the j-th feature falls into the bin b if
+ *  borders[binOffsets[j] + b - 1] <= x < borders[binOffsets[j] + b],
+ *  the j-th feature has binOffsets[j + 1] - binOffsets[j] bins and one border less
+ */
+template <typename algorithmFPType, CpuType cpu>
+class BinnedData
+{
+public:
+    BinnedData() : nRows(0), nFeatures(0), nTotalBins(0), bins(0), binOffsets(0), borders(0) {}
+    ~BinnedData() { release(); }
+
+    /**
+     *  Quantizes the values of the features of the data set into at most maxBins bins each.
+     *  The borders of the bins are the quantiles of the values of the feature,
+     *  features with at most maxBins distinct values get one bin per value
+     *  \return false if memory allocation failed
+     */
+    bool init(NumericTable *x, size_t maxBins)
+    {
+        release();
+        nRows     = x->getNumberOfRows();
+        nFeatures = x->getNumberOfColumns();
+
+        const size_t maxBorders = maxBins - 1;
+        algorithmFPType *featureBorders = service_malloc<algorithmFPType, cpu>(nFeatures * maxBorders);
+        size_t *nFeatureBorders = service_malloc<size_t, cpu>(nFeatures);
+        binOffsets = service_malloc<size_t, cpu>(nFeatures + 1);
+        if(!featureBorders || !nFeatureBorders || !binOffsets)
+        {
+            service_free<algorithmFPType, cpu>(featureBorders);
+            service_free<size_t, cpu>(nFeatureBorders);
+            return false;
+        }
+
+        /* Find the borders of the bins of every feature from the sorted feature values */
+        daal::tls<algorithmFPType *> sortedValues( [ = ]()-> algorithmFPType *
+        {
+            return service_malloc<algorithmFPType, cpu>(nRows);
+        } );
+
+        daal::threader_for( nFeatures, nFeatures, [ =, &sortedValues ](int j)
+        {
+            algorithmFPType *v = sortedValues.local();
+            if(!v) { nFeatureBorders[j] = 0; return; }
+
+            BlockDescriptor<algorithmFPType> block;
+            x->getBlockOfColumnValues(j, 0, nRows, readOnly, block);
+            const algorithmFPType *column = block.getBlockPtr();
+            for(size_t i = 0; i < nRows; i++)
+            {
+                v[i] = column[i];
+            }
+            x->releaseBlockOfColumnValues(block);
+
+            daal::algorithms::internal::qSort<algorithmFPType, cpu>(nRows, v);
+
+            algorithmFPType *b = featureBorders + j * maxBorders;
+            size_t nBorders = 0;
+
+            size_t nUnique = 1;
+            for(size_t i = 1; i < nRows && nUnique <= maxBins; i++)
+            {
+                nUnique += (v[i] > v[i - 1]);
+            }
+
+            if(nUnique <= maxBins)
+            {
+                for(size_t i = 1; i < nRows; i++)
+                {
+                    if(v[i] > v[i - 1]) { b[nBorders++] = v[i]; }
+                }
+            }
+            else
+            {
+                algorithmFPType last = v[0];
+                for(size_t k = 1; k < maxBins; k++)
+                {
+                    const algorithmFPType q = v[(k * nRows) / maxBins];
+                    if(q > last) { b[nBorders++] = q; last = q; }
+                }
+            }
+            nFeatureBorders[j] = nBorders;
+        } );
+
+        /* A thread whose buffer could not be allocated skipped its iterations */
+        bool bMemoryAllocationFailed = false;
+        sortedValues.reduce( [ =, &bMemoryAllocationFailed ](algorithmFPType *v)-> void
+        {
+            if(!v) { bMemoryAllocationFailed = true; return; }
+            service_free<algorithmFPType, cpu>(v);
+        } );
+
+        if(bMemoryAllocationFailed)
+        {
+            service_free<algorithmFPType, cpu>(featureBorders);
+            service_free<size_t, cpu>(nFeatureBorders);
+            return false;
+        }
+
+        binOffsets[0] = 0;
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            binOffsets[j + 1] = binOffsets[j] + nFeatureBorders[j] + 1;
+        }
+        nTotalBins = binOffsets[nFeatures];
+
+        borders = service_malloc<algorithmFPType, cpu>(nTotalBins);
+        if(!borders)
+        {
+            service_free<algorithmFPType, cpu>(featureBorders);
+            service_free<size_t, cpu>(nFeatureBorders);
+            return false;
+        }
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            algorithmFPType *b = borders + binOffsets[j];
+            const algorithmFPType *fb = featureBorders + j * maxBorders;
+            for(size_t k = 0; k < nFeatureBorders[j]; k++)
+            {
+                b[k] = fb[k];
+            }
+        }
+        service_free<algorithmFPType, cpu>(featureBorders);
+        service_free<size_t, cpu>(nFeatureBorders);
+
+        return quantize(x);
+    }
+
+    /**
+     *  Sets the borders of the bins from the table with one row per feature:
+     *  the number of borders of the feature followed by the borders in ascending order
+     *  \return false if memory allocation failed or the table is inconsistent
+     */
+    bool initBorders(NumericTable *binBorders)
+    {
+        release();
+        nRows     = 0;
+        nFeatures = binBorders->getNumberOfRows();
+        const size_t nCols = binBorders->getNumberOfColumns();
+
+        binOffsets = service_malloc<size_t, cpu>(nFeatures + 1);
+        if(!binOffsets) { return false; }
+
+        BlockDescriptor<algorithmFPType> block;
+        binBorders->getBlockOfRows(0, nFeatures, readOnly, block);
+        const algorithmFPType *rows = block.getBlockPtr();
+
+        bool bOk = true;
+        binOffsets[0] = 0;
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            const size_t nBorders = (size_t)rows[j * nCols];
+            if(nBorders + 1 > nCols) { bOk = false; break; }
+            binOffsets[j + 1] = binOffsets[j] + nBorders + 1;
+        }
+        if(bOk)
+        {
+            nTotalBins = binOffsets[nFeatures];
+            borders = service_malloc<algorithmFPType, cpu>(nTotalBins);
+            bOk = (borders != 0);
+        }
+        if(bOk)
+        {
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                algorithmFPType *b = borders + binOffsets[j];
+                const algorithmFPType *row = rows + j * nCols + 1;
+                for(size_t k = 0; k + 1 < binOffsets[j + 1] - binOffsets[j]; k++)
+                {
+                    b[k] = row[k];
+                }
+            }
+        }
+        binBorders->releaseBlockOfRows(block);
+        return bOk;
+    }
+
+    /**
+     *  Replaces the values of the features of the data set by the indices of their bins.
+     *  The borders of the bins must be already set
+     *  \return false if memory allocation failed
+     */
+    bool quantize(NumericTable *x)
+    {
+        if(bins) { service_free<BinIndexType, cpu>(bins); bins = 0; }
+        nRows = x->getNumberOfRows();
+        bins = service_malloc<BinIndexType, cpu>(nRows * nFeatures);
+        if(!bins) { return false; }
+
+        /* Replace the values by the indices of the bins */
+        const size_t nBlocks = (nRows + rowBlockSize - 1) / rowBlockSize;
+        const size_t p = nFeatures;
+        const size_t n = nRows;
+        const size_t *offsets = binOffsets;
+        const algorithmFPType *allBorders = borders;
+        BinIndexType *allBins = bins;
+        daal::threader_for( nBlocks, nBlocks, [ = ](int iBlock)
+        {
+            const size_t begin = iBlock * rowBlockSize;
+            const size_t end = (begin + rowBlockSize > n ? n : begin + rowBlockSize);
+
+            BlockDescriptor<algorithmFPType> block;
+            x->getBlockOfRows(begin, end - begin, readOnly, block);
+            const algorithmFPType *rows = block.getBlockPtr();
+
+            for(size_t i = 0; i < end - begin; i++)
+            {
+                for(size_t j = 0; j < p; j++)
+                {
+                    const algorithmFPType *b = allBorders + offsets[j];
+                    const algorithmFPType value = rows[i * p + j];
+                    /* Number of borders that do not exceed the value */
+                    size_t lo = 0, hi = offsets[j + 1] - offsets[j] - 1;
+                    while(lo < hi)
+                    {
+                        const size_t mid = (lo + hi) >> 1;
+                        if(b[mid] <= value) { lo = mid + 1; }
+                        else { hi = mid; }
+                    }
+                    allBins[(begin + i) * p + j] = (BinIndexType)lo;
+                }
+            }
+            x->releaseBlockOfRows(block);
+        } );
+
+        return true;
+    }
+
+    void release()
+    {
+        if(bins)       { service_free<BinIndexType, cpu>(bins);        bins = 0; }
+        if(binOffsets) { service_free<size_t, cpu>(binOffsets);        binOffsets = 0; }
+        if(borders)    { service_free<algorithmFPType, cpu>(borders);  borders = 0; }
+    }
+
+    size_t nRows;
+    size_t nFeatures;
+    size_t nTotalBins;
+    BinIndexType *bins;
+    size_t *binOffsets;
+    algorithmFPType *borders;
+};
+
+/* Node of the tree under construction */
+template <typename algorithmFPType>
+struct BuildNode
+{
+    int featureIdx;                 /* Split feature, -1 for a leaf */
+    size_t splitBin;                /* Observations with bins <= splitBin go to the left child */
+    size_t leftIdx;                 /* Index of the left child, the right child follows it */
+    size_t rowBegin;                /* Range of the observations of the node in the array of indices */
+    size_t rowEnd;
+    GHSum<algorithmFPType> sum;     /* Statistics of the observations of the node */
+    GHSum<algorithmFPType> leftSum; /* Statistics of the observations of the left child */
+    GHSum<algorithmFPType> *hist;   /* Histogram of the node, 0 if it is not needed */
+    algorithmFPType response;       /* Response of a leaf */
+};
+
+/* Best split of a node on one feature */
+template <typename algorithmFPType>
+struct SplitCandidate
+{
+    algorithmFPType gain;
+    size_t bin;
+    GHSum<algorithmFPType> left;
+};
+
+/**
+ *  Constructs the regression trees of gradient boosting from the gradient statistics
+ *  of the observations of a quantized data set. The object is reused for all trees of the training
+ */
+template <typename algorithmFPType, CpuType cpu>
+class TreeBuilder
+{
+public:
+    TreeBuilder(const BinnedData<algorithmFPType, cpu> &data, const gbt::training::Parameter &par) :
+        _data(data), _par(par), _rowIdx(0), _rowIdxBuf(0), _nodes(0), _nodesCapacity(0) {}
+
+    ~TreeBuilder()
+    {
+        service_free<size_t, cpu>(_rowIdx);
+        service_free<size_t, cpu>(_rowIdxBuf);
+        service_free<BuildNode<algorithmFPType>, cpu>(_nodes);
+    }
+
+    /**
+     *  Allocates the buffers for the trees on the data set, which must be already quantized
+     *  \return false if memory allocation failed
+     */
+    bool init()
+    {
+        _rowIdx    = service_malloc<size_t, cpu>(_data.nRows);
+        _rowIdxBuf = service_malloc<size_t, cpu>(_data.nRows);
+        return (_rowIdx && _rowIdxBuf && reserveNodes(maxNumberOfNodes(_data.nRows)));
+    }
+
+    /**
+     *  Builds the tree on the gradient statistics gh of the observations,
+     *  adds the responses of its leaves to the scores f[i * fStride] of the observations
+     *  and returns the tree in the format of the gradient boosted trees model.
+     *  Returns the empty pointer if memory allocation failed
+     */
+    services::SharedPtr<NumericTable> build(const GH<algorithmFPType> *gh, algorithmFPType *f, size_t fStride)
+    {
+        const size_t n = _data.nRows;
+        startTree(n);
+        size_t nNodes = 1;
+
+        /* Histogram of the root is always needed: its first feature provides the statistics of the root */
+        GHSum<algorithmFPType> *levelHist = allocHist(1);
+        if(!levelHist) { return services::SharedPtr<NumericTable>(); }
+        BuildNode<algorithmFPType> &root = _nodes[0];
+        root.hist = levelHist;
+        size_t rootIdx = 0;
+        buildHistograms(gh, &rootIdx, 1);
+        root.sum = totalSum(root.hist);
+
+        bool bOk = true;
+        size_t levelBegin = 0, levelEnd = 1;
+        for(size_t depth = 0; levelBegin < levelEnd; depth++)
+        {
+            const size_t nSplit = splitLevel(levelBegin, levelEnd, depth, nNodes);
+            if(nSplit == 0) { break; }
+
+            partition(levelBegin, levelEnd);
+
+            /* Children that may be split on the next level need the histograms */
+            const size_t nHist = countHistograms(levelBegin, levelEnd, depth);
+            GHSum<algorithmFPType> *nextHist = 0;
+            if(nHist)
+            {
+                nextHist = allocHist(nHist);
+                size_t *smallIdx = service_malloc<size_t, cpu>(nSplit);
+                if(!nextHist || !smallIdx)
+                {
+                    service_free<GHSum<algorithmFPType>, cpu>(nextHist);
+                    service_free<size_t, cpu>(smallIdx);
+                    bOk = false;
+                    break;
+                }
+                const size_t nSmall = assignHistograms(levelBegin, levelEnd, nextHist, smallIdx);
+                buildHistograms(gh, smallIdx, nSmall);
+                subtractHistograms(levelBegin, levelEnd);
+                service_free<size_t, cpu>(smallIdx);
+            }
+            service_free<GHSum<algorithmFPType>, cpu>(levelHist);
+            levelHist = nextHist;
+
+            levelBegin = levelEnd;
+            levelEnd = nNodes;
+        }
+        service_free<GHSum<algorithmFPType>, cpu>(levelHist);
+        if(!bOk) { return services::SharedPtr<NumericTable>(); }
+
+        updateScores(nNodes, f, fStride);
+        return makeTree(nNodes);
+    }
+
+    /**
+     *  Returns the tree that consists of one leaf with the given response
+     */
+    static services::SharedPtr<NumericTable> makeLeaf(algorithmFPType response)
+    {
+        services::SharedPtr<NumericTable> tree(new HomogenNumericTable<algorithmFPType>(3, 1, NumericTableIface::doAllocate));
+        BlockDescriptor<algorithmFPType> block;
+        tree->getBlockOfRows(0, 1, writeOnly, block);
+        algorithmFPType *t = block.getBlockPtr();
+        t[0] = (algorithmFPType)(-1);
+        t[1] = response;
+        t[2] = (algorithmFPType)0;
+        tree->releaseBlockOfRows(block);
+        return tree;
+    }
+
+protected:
+    /* Upper bound of the number of nodes of a tree grown on nObservations observations */
+    size_t maxNumberOfNodes(size_t nObservations) const
+    {
+        size_t maxLeaves = nObservations / _par.minObservationsInLeafNode + 1;
+        if(_par.maxTreeDepth < 62 && ((size_t)1 << _par.maxTreeDepth) < maxLeaves)
+        {
+            maxLeaves = (size_t)1 << _par.maxTreeDepth;
+        }
+        return 2 * maxLeaves - 1;
+    }
+
+    /* Grows the array of the nodes to hold at least nNodes nodes, keeping the existing nodes */
+    bool reserveNodes(size_t nNodes)
+    {
+        if(nNodes <= _nodesCapacity) { return true; }
+        BuildNode<algorithmFPType> *nodes = service_malloc<BuildNode<algorithmFPType>, cpu>(nNodes);
+        if(!nodes) { return false; }
+        for(size_t i = 0; i < _nodesCapacity; i++)
+        {
+            nodes[i] = _nodes[i];
+        }
+        service_free<BuildNode<algorithmFPType>, cpu>(_nodes);
+        _nodes = nodes;
+        _nodesCapacity = nNodes;
+        return true;
+    }
+
+    /* Makes the root of the new tree hold the first nObservations observations */
+    void startTree(size_t nObservations)
+    {
+        for(size_t i = 0; i < _data.nRows; i++)
+        {
+            _rowIdx[i] = i;
+        }
+        BuildNode<algorithmFPType> &root = _nodes[0];
+        root.featureIdx = -1;
+        root.rowBegin = 0;
+        root.rowEnd = nObservations;
+        root.hist = 0;
+    }
+
+    /**
+     *  Finds the splits of the nodes of the level, turns the other nodes into leaves
+     *  and assigns the indices of the children of the split nodes.
+     *  \return Number of the split nodes
+     */
+    size_t splitLevel(size_t levelBegin, size_t levelEnd, size_t depth, size_t &nNodes)
+    {
+        const bool bCanSplit = (depth < _par.maxTreeDepth);
+        if(bCanSplit)
+        {
+            findSplits(levelBegin, levelEnd);
+        }
+
+        size_t nSplit = 0;
+        for(size_t i = levelBegin; i < levelEnd; i++)
+        {
+            BuildNode<algorithmFPType> &node = _nodes[i];
+            if(!bCanSplit || !node.hist || node.featureIdx < 0 || nNodes + 2 > _nodesCapacity)
+            {
+                node.featureIdx = -1;
+                node.response = -node.sum.g / (node.sum.h + (algorithmFPType)_par.lambda) * (algorithmFPType)_par.shrinkage;
+                continue;
+            }
+            node.leftIdx = nNodes;
+            nNodes += 2;
+            nSplit++;
+        }
+        return nSplit;
+    }
+
+    /* Number of the histograms needed by the children of the split nodes of the level */
+    size_t countHistograms(size_t levelBegin, size_t levelEnd, size_t depth) const
+    {
+        if(depth + 1 >= _par.maxTreeDepth) { return 0; }
+        size_t nHist = 0;
+        for(size_t i = levelBegin; i < levelEnd; i++)
+        {
+            const BuildNode<algorithmFPType> &node = _nodes[i];
+            if(node.featureIdx < 0) { continue; }
+            const bool bLeftSplittable  = isSplittable(_nodes[node.leftIdx]);
+            const bool bRightSplittable = isSplittable(_nodes[node.leftIdx + 1]);
+            nHist += (bLeftSplittable ? 1 : 0) + (bRightSplittable ? 1 : 0);
+        }
+        return nHist;
+    }
+
+    /**
+     *  Assigns the histograms of the buffer hist to the children that need them.
+     *  If both children may be split, the histogram of the smaller one is built directly and
+     *  the histogram of the larger one is the difference. If only one child may be split,
+     *  its histogram is built directly whatever its size is.
+     *  \param[out] smallIdx  Indices of the children whose histograms are built directly
+     *  \return Number of the children whose histograms are built directly
+     */
+    size_t assignHistograms(size_t levelBegin, size_t levelEnd, GHSum<algorithmFPType> *hist, size_t *smallIdx)
+    {
+        size_t iHist = 0, nSmall = 0;
+        for(size_t i = levelBegin; i < levelEnd; i++)
+        {
+            const BuildNode<algorithmFPType> &node = _nodes[i];
+            if(node.featureIdx < 0) { continue; }
+            BuildNode<algorithmFPType> &left  = _nodes[node.leftIdx];
+            BuildNode<algorithmFPType> &right = _nodes[node.leftIdx + 1];
+            const bool bLeftSplittable  = isSplittable(left);
+            const bool bRightSplittable = isSplittable(right);
+            if(!bLeftSplittable && !bRightSplittable) { continue; }
+            const bool bLeftIsDirect = (bLeftSplittable && bRightSplittable ?
+                (left.rowEnd - left.rowBegin <= right.rowEnd - right.rowBegin) : bLeftSplittable);
+            BuildNode<algorithmFPType> &direct = (bLeftIsDirect ? left : right);
+            direct.hist = hist + (iHist++) * _data.nTotalBins;
+            smallIdx[nSmall++] = (bLeftIsDirect ? node.leftIdx : node.leftIdx + 1);
+        }
+
+        /* The histograms of the larger children are the differences */
+        for(size_t i = levelBegin; i < levelEnd; i++)
+        {
+            const BuildNode<algorithmFPType> &node = _nodes[i];
+            if(node.featureIdx < 0) { continue; }
+            BuildNode<algorithmFPType> &left  = _nodes[node.leftIdx];
+            BuildNode<algorithmFPType> &right = _nodes[node.leftIdx + 1];
+            if(!(isSplittable(left) && isSplittable(right))) { continue; }
+            BuildNode<algorithmFPType> &large = (left.hist ? right : left);
+            large.hist = hist + (iHist++) * _data.nTotalBins;
+        }
+        return nSmall;
+    }
+
+    /* Initializes the children of the split node, the first iLeft - node.rowBegin observations go to the left child */
+    static void initChildren(BuildNode<algorithmFPType> *nodes, const BuildNode<algorithmFPType> &node, size_t iLeft)
+    {
+        BuildNode<algorithmFPType> &left  = nodes[node.leftIdx];
+        BuildNode<algorithmFPType> &right = nodes[node.leftIdx + 1];
+        left.featureIdx = -1;
+        left.rowBegin = node.rowBegin;
+        left.rowEnd = iLeft;
+        left.sum = node.leftSum;
+        left.hist = 0;
+        right.featureIdx = -1;
+        right.rowBegin = iLeft;
+        right.rowEnd = node.rowEnd;
+        right.sum.g = node.sum.g - node.leftSum.g;
+        right.sum.h = node.sum.h - node.leftSum.h;
+        right.sum.n = node.sum.n - node.leftSum.n;
+        right.hist = 0;
+    }
+
+    bool isSplittable(const BuildNode<algorithmFPType> &node) const
+    {
+        return (node.rowEnd - node.rowBegin >= 2 * _par.minObservationsInLeafNode);
+    }
+
+    GHSum<algorithmFPType> *allocHist(size_t nHist)
+    {
+        return service_malloc<GHSum<algorithmFPType>, cpu>(nHist * _data.nTotalBins);
+    }
+
+    /* Statistics of the node computed from the bins of the first feature of its histogram */
+    GHSum<algorithmFPType> totalSum(const GHSum<algorithmFPType> *hist) const
+    {
+        GHSum<algorithmFPType> s = { 0, 0, 0 };
+        for(size_t b = _data.binOffsets[0]; b < _data.binOffsets[1]; b++)
+        {
+            s.g += hist[b].g;
+            s.h += hist[b].h;
+            s.n += hist[b].n;
+        }
+        return s;
+    }
+
+    /**
+     *  Builds the histograms of the given nodes.
+     *  The work is split into tasks by nodes and blocks of features, so that every task
+     *  owns its part of the histograms and no reduction is needed
+     */
+    void buildHistograms(const GH<algorithmFPType> *gh, const size_t *nodeIdx, size_t nNodeIdx)
+    {
+        const size_t p = _data.nFeatures;
+        const size_t nThreads = threader_get_threads_number();
+        size_t nFeatureBlocks = (4 * nThreads + nNodeIdx - 1) / nNodeIdx;
+        if(nFeatureBlocks > p) { nFeatureBlocks = p; }
+        const size_t featureBlockSize = (p + nFeatureBlocks - 1) / nFeatureBlocks;
+        nFeatureBlocks = (p + featureBlockSize - 1) / featureBlockSize;
+
+        const BinIndexType *bins = _data.bins;
+        const size_t *binOffsets = _data.binOffsets;
+        const size_t *rowIdx = _rowIdx;
+        BuildNode<algorithmFPType> *nodes = _nodes;
+
+        daal::threader_for( nNodeIdx * nFeatureBlocks, nNodeIdx * nFeatureBlocks, [ = ](int iTask)
+        {
+            const BuildNode<algorithmFPType> &node = nodes[nodeIdx[iTask / nFeatureBlocks]];
+            const size_t jBegin = (iTask % nFeatureBlocks) * featureBlockSize;
+            const size_t jEnd = (jBegin + featureBlockSize > p ? p : jBegin + featureBlockSize);
+
+            GHSum<algorithmFPType> *hist = node.hist;
+            for(size_t b = binOffsets[jBegin]; b < binOffsets[jEnd]; b++)
+            {
+                hist[b].g = 0;
+                hist[b].h = 0;
+                hist[b].n = 0;
+            }
+
+            for(size_t i = node.rowBegin; i < node.rowEnd; i++)
+            {
+                const size_t iRow = rowIdx[i];
+                const BinIndexType *rowBins = bins + iRow * p;
+                const algorithmFPType g = gh[iRow].g;
+                const algorithmFPType h = gh[iRow].h;
+                for(size_t j = jBegin; j < jEnd; j++)
+                {
+                    GHSum<algorithmFPType> &s = hist[binOffsets[j] + rowBins[j]];
+                    s.g += g;
+                    s.h += h;
+                    s.n += 1;
+                }
+            }
+        } );
+    }
+
+    /* Computes the histograms of the larger children as parent minus smaller child */
+    void subtractHistograms(size_t levelBegin, size_t levelEnd)
+    {
+        const size_t nBins = _data.nTotalBins;
+        BuildNode<algorithmFPType> *nodes = _nodes;
+        daal::threader_for( levelEnd - levelBegin, levelEnd - levelBegin, [ = ](int i)
+        {
+            const BuildNode<algorithmFPType> &node = nodes[levelBegin + i];
+            if(node.featureIdx < 0) { return; }
+            const BuildNode<algorithmFPType> &left  = nodes[node.leftIdx];
+            const BuildNode<algorithmFPType> &right = nodes[node.leftIdx + 1];
+            if(!left.hist || !right.hist) { return; }
+
+            const bool bLeftIsSmall = (left.rowEnd - left.rowBegin <= right.rowEnd - right.rowBegin);
+            const GHSum<algorithmFPType> *parentHist = node.hist;
+            const GHSum<algorithmFPType> *smallHist = (bLeftIsSmall ? left.hist : right.hist);
+            GHSum<algorithmFPType> *largeHist = (bLeftIsSmall ? right.hist : left.hist);
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(size_t b = 0; b < nBins; b++)
+            {
+                largeHist[b].g = parentHist[b].g - smallHist[b].g;
+                largeHist[b].h = parentHist[b].h - smallHist[b].h;
+                largeHist[b].n = parentHist[b].n - smallHist[b].n;
+            }
+        } );
+    }
+
+    /**
+     *  Finds the best split of every node of the level that has a histogram.
+     *  Sets featureIdx to -1 for the nodes without a split that reduces the loss by more than minSplitLoss
+     */
+    void findSplits(size_t levelBegin, size_t levelEnd)
+    {
+        const size_t p = _data.nFeatures;
+        const size_t nLevelNodes = levelEnd - levelBegin;
+        SplitCandidate<algorithmFPType> *candidates = service_malloc<SplitCandidate<algorithmFPType>, cpu>(nLevelNodes * p);
+        if(!candidates)
+        {
+            for(size_t i = levelBegin; i < levelEnd; i++) { _nodes[i].featureIdx = -1; }
+            return;
+        }
+
+        const algorithmFPType lambda = (algorithmFPType)_par.lambda;
+        const algorithmFPType minObs = (algorithmFPType)_par.minObservationsInLeafNode;
+        const size_t *binOffsets = _data.binOffsets;
+        BuildNode<algorithmFPType> *nodes = _nodes;
+
+        daal::threader_for( nLevelNodes * p, nLevelNodes * p, [ = ](int iTask)
+        {
+            const BuildNode<algorithmFPType> &node = nodes[levelBegin + iTask / p];
+            const size_t j = iTask % p;
+            SplitCandidate<algorithmFPType> &best = candidates[iTask];
+            best.gain = 0;
+            if(!node.hist) { return; }
+
+            const GHSum<algorithmFPType> &total = node.sum;
+            const algorithmFPType parentScore = total.g * total.g / (total.h + lambda);
+            const GHSum<algorithmFPType> *hist = node.hist + binOffsets[j];
+            const size_t nBins = binOffsets[j + 1] - binOffsets[j];
+
+            GHSum<algorithmFPType> left = { 0, 0, 0 };
+            for(size_t b = 0; b + 1 < nBins; b++)
+            {
+                left.g += hist[b].g;
+                left.h += hist[b].h;
+                left.n += hist[b].n;
+                if(left.n < minObs) { continue; }
+                if(total.n - left.n < minObs) { break; }
+
+                const algorithmFPType rightG = total.g - left.g;
+                const algorithmFPType rightH = total.h - left.h;
+                const algorithmFPType gain = left.g * left.g / (left.h + lambda) + rightG * rightG / (rightH + lambda) - parentScore;
+                if(gain > best.gain)
+                {
+                    best.gain = gain;
+                    best.bin = b;
+                    best.left = left;
+                }
+            }
+        } );
+
+        /* The loss reduction of a split is a half of the gain */
+        const algorithmFPType minGain = (algorithmFPType)(2.0 * _par.minSplitLoss);
+        for(size_t i = 0; i < nLevelNodes; i++)
+        {
+            BuildNode<algorithmFPType> &node = _nodes[levelBegin + i];
+            node.featureIdx = -1;
+            if(!node.hist || !isSplittable(node)) { continue; }
+
+            const SplitCandidate<algorithmFPType> *c = candidates + i * p;
+            size_t bestJ = p;
+            for(size_t j = 0; j < p; j++)
+            {
+                if(c[j].gain > minGain && (bestJ == p || c[j].gain > c[bestJ].gain)) { bestJ = j; }
+            }
+            if(bestJ == p) { continue; }
+
+            node.featureIdx = (int)bestJ;
+            node.splitBin = c[bestJ].bin;
+            node.leftSum = c[bestJ].left;
+        }
+        service_free<SplitCandidate<algorithmFPType>, cpu>(candidates);
+    }
+
+    /**
+     *  Moves the observations of every split node of the level into the ranges of its children,
+     *  preserving their order, and initializes the children
+     */
+    void partition(size_t levelBegin, size_t levelEnd)
+    {
+        const size_t p = _data.nFeatures;
+        const BinIndexType *bins = _data.bins;
+        size_t *rowIdx = _rowIdx;
+        size_t *rowIdxBuf = _rowIdxBuf;
+        BuildNode<algorithmFPType> *nodes = _nodes;
+
+        daal::threader_for( levelEnd - levelBegin, levelEnd - levelBegin, [ = ](int i)
+        {
+            const BuildNode<algorithmFPType> &node = nodes[levelBegin + i];
+            if(node.featureIdx < 0) { return; }
+
+            const size_t j = (size_t)node.featureIdx;
+            size_t iLeft = node.rowBegin, iRight = node.rowBegin;
+            for(size_t k = node.rowBegin; k < node.rowEnd; k++)
+            {
+                const size_t iRow = rowIdx[k];
+                if(bins[iRow * p + j] <= node.splitBin) { rowIdx[iLeft++] = iRow; }
+                else { rowIdxBuf[iRight++] = iRow; }
+            }
+            for(size_t k = node.rowBegin; k < iRight; k++)
+            {
+                rowIdx[iLeft + k - node.rowBegin] = rowIdxBuf[k];
+            }
+            initChildren(nodes, node, iLeft);
+        } );
+    }
+
+    /* Adds the responses of the leaves to the scores of their observations */
+    void updateScores(size_t nNodes, algorithmFPType *f, size_t fStride)
+    {
+        const size_t *rowIdx = _rowIdx;
+        const BuildNode<algorithmFPType> *nodes = _nodes;
+        daal::threader_for( nNodes, nNodes, [ = ](int i)
+        {
+            const BuildNode<algorithmFPType> &node = nodes[i];
+            if(node.featureIdx >= 0) { return; }
+            for(size_t k = node.rowBegin; k < node.rowEnd; k++)
+            {
+                f[rowIdx[k] * fStride] += node.response;
+            }
+        } );
+    }
+
+    /* Converts the nodes into the table of the model: split feature, split value or response, left child */
+    services::SharedPtr<NumericTable> makeTree(size_t nNodes)
+    {
+        services::SharedPtr<NumericTable> tree(new HomogenNumericTable<algorithmFPType>(3, nNodes, NumericTableIface::doAllocate));
+        BlockDescriptor<algorithmFPType> block;
+        tree->getBlockOfRows(0, nNodes, writeOnly, block);
+        algorithmFPType *t = block.getBlockPtr();
+        if(!t) { return services::SharedPtr<NumericTable>(); }
+
+        for(size_t i = 0; i < nNodes; i++)
+        {
+            const BuildNode<algorithmFPType> &node = _nodes[i];
+            if(node.featureIdx < 0)
+            {
+                t[3 * i]     = (algorithmFPType)(-1);
+                t[3 * i + 1] = node.response;
+                t[3 * i + 2] = (algorithmFPType)0;
+            }
+            else
+            {
+                t[3 * i]     = (algorithmFPType)node.featureIdx;
+                t[3 * i + 1] = _data.borders[_data.binOffsets[node.featureIdx] + node.splitBin];
+                t[3 * i + 2] = (algorithmFPType)node.leftIdx;
+            }
+        }
+        tree->releaseBlockOfRows(block);
+        return tree;
+    }
+
+    const BinnedData<algorithmFPType, cpu> &_data;
+    const gbt::training::Parameter &_par;
+    size_t *_rowIdx;                        /* Indices of the observations grouped by the nodes */
+    size_t *_rowIdxBuf;
+    BuildNode<algorithmFPType> *_nodes;     /* Nodes in the breadth-first order */
+    size_t _nodesCapacity;
+};
+
+} // namespace internal
+} // namespace training
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
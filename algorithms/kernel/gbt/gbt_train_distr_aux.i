@@ -0,0 +1,900 @@
+/* file: gbt_train_distr_aux.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Auxiliary functions shared by the gradient boosted trees training kernels
+//  in the distributed processing mode.
+//
+//  On the first call every local node sends the candidates for the borders of the bins:
+//  the distinct values of every feature with their counts, or the quantiles of the values
+//  if there are more than maxBins distinct values. The master node merges the candidates
+//  into the borders of the bins. With the exact counts the borders are the same as
+//  in the batch processing mode.
+//
+//  Then the trees are grown level by level. The master node sends the training state:
+//  the splits and the leaves of the nodes found since the previous call and the children
+//  whose histograms are needed. The local nodes move their observations into the children
+//  and return the histograms of the requested children, the master node sums them and
+//  computes the histograms of the other children as the differences.
+//--
+*/
+
+#ifndef __GBT_TRAIN_DISTR_AUX_I__
+#define __GBT_TRAIN_DISTR_AUX_I__
+
+#include "data_collection.h"
+#include "gbt_train_aux.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+namespace internal
+{
+
+/**
+ *  Training state passed from the master node to the local nodes.
+ *  The first row is the header: the index of the tree the records belong to, the index of the first node
+ *  of the records, the number of the records and the index of the tree to start after the records are applied,
+ *  or stateContinueTree, or stateCompleted.
+ *  Every record describes a node: the split feature or -1 for a leaf, the split bin or the response of the leaf,
+ *  the index of the left child and the child of the split node whose histogram is requested
+ */
+const size_t stateRowSize = 4;
+const int stateContinueTree = -1;
+const int stateCompleted = -2;
+
+enum RequestedHistogram
+{
+    noHistogram = 0,
+    leftHistogram = 1,
+    rightHistogram = 2
+};
+
+/**
+ *  Computes the candidates for the borders of the bins of the local data set.
+ *  The j-th row of the table is the number of the candidates of the j-th feature followed by maxBins values
+ *  and maxBins counts of the observations represented by the values.
+ *  The last row is the number of the observations followed by zeros
+ *  \return Table of the candidates, the empty pointer if memory allocation failed
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::SharedPtr<NumericTable> computeBinCandidates(NumericTable *x, size_t maxBins)
+{
+    const size_t nRows = x->getNumberOfRows();
+    const size_t nFeatures = x->getNumberOfColumns();
+    const size_t nCols = 1 + 2 * maxBins;
+
+    services::SharedPtr<NumericTable> candidates(new HomogenNumericTable<algorithmFPType>(nCols, nFeatures + 1, NumericTableIface::doAllocate));
+    BlockDescriptor<algorithmFPType> block;
+    candidates->getBlockOfRows(0, nFeatures + 1, writeOnly, block);
+    algorithmFPType *rows = block.getBlockPtr();
+    if(!rows) { return services::SharedPtr<NumericTable>(); }
+
+    daal::tls<algorithmFPType *> sortedValues( [ = ]()-> algorithmFPType *
+    {
+        return service_malloc<algorithmFPType, cpu>(nRows);
+    } );
+
+    daal::threader_for( nFeatures, nFeatures, [ =, &sortedValues ](int j)
+    {
+        algorithmFPType *v = sortedValues.local();
+        if(!v) { return; }
+
+        BlockDescriptor<algorithmFPType> columnBlock;
+        x->getBlockOfColumnValues(j, 0, nRows, readOnly, columnBlock);
+        const algorithmFPType *column = columnBlock.getBlockPtr();
+        for(size_t i = 0; i < nRows; i++)
+        {
+            v[i] = column[i];
+        }
+        x->releaseBlockOfColumnValues(columnBlock);
+
+        daal::algorithms::internal::qSort<algorithmFPType, cpu>(nRows, v);
+
+        algorithmFPType *values = rows + j * nCols + 1;
+        algorithmFPType *counts = values + maxBins;
+
+        size_t nUnique = 1;
+        for(size_t i = 1; i < nRows && nUnique <= maxBins; i++)
+        {
+            nUnique += (v[i] > v[i - 1]);
+        }
+
+        size_t nCandidates = 0;
+        if(nUnique <= maxBins)
+        {
+            for(size_t i = 0; i < nRows; i++)
+            {
+                if(i == 0 || v[i] > v[i - 1])
+                {
+                    values[nCandidates] = v[i];
+                    counts[nCandidates++] = 0;
+                }
+                counts[nCandidates - 1] += 1;
+            }
+        }
+        else
+        {
+            for(size_t k = 0; k < maxBins; k++)
+            {
+                values[nCandidates] = v[(k * nRows) / maxBins];
+                counts[nCandidates++] = (algorithmFPType)(((k + 1) * nRows) / maxBins - (k * nRows) / maxBins);
+            }
+        }
+        for(size_t k = nCandidates; k < maxBins; k++)
+        {
+            values[k] = 0;
+            counts[k] = 0;
+        }
+        rows[j * nCols] = (algorithmFPType)nCandidates;
+    } );
+
+    bool bMemoryAllocationFailed = false;
+    sortedValues.reduce( [ =, &bMemoryAllocationFailed ](algorithmFPType *v)-> void
+    {
+        if(!v) { bMemoryAllocationFailed = true; return; }
+        service_free<algorithmFPType, cpu>(v);
+    } );
+
+    algorithmFPType *last = rows + nFeatures * nCols;
+    last[0] = (algorithmFPType)nRows;
+    for(size_t k = 1; k < nCols; k++)
+    {
+        last[k] = 0;
+    }
+    candidates->releaseBlockOfRows(block);
+
+    if(bMemoryAllocationFailed) { return services::SharedPtr<NumericTable>(); }
+    return candidates;
+}
+
+/**
+ *  Merges the candidates for the borders of the bins computed on the local nodes.
+ *  If the candidates have at most maxBins distinct values, every value but the smallest one is a border,
+ *  otherwise the borders are the quantiles of the candidates weighted by their counts
+ *  \return Table of the borders in the format of BinnedData::initBorders, the empty pointer if memory allocation failed
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::SharedPtr<NumericTable> mergeBinCandidates(NumericTable **localCandidates, size_t nLocal, size_t maxBins)
+{
+    const size_t nFeatures = localCandidates[0]->getNumberOfRows() - 1;
+    const size_t nCols = 1 + 2 * maxBins;
+
+    services::SharedPtr<NumericTable> binBorders(new HomogenNumericTable<algorithmFPType>(maxBins, nFeatures, NumericTableIface::doAllocate));
+    BlockDescriptor<algorithmFPType> bordersBlock;
+    binBorders->getBlockOfRows(0, nFeatures, writeOnly, bordersBlock);
+    algorithmFPType *borders = bordersBlock.getBlockPtr();
+    if(!borders) { return services::SharedPtr<NumericTable>(); }
+
+    BlockDescriptor<algorithmFPType> *blocks = new BlockDescriptor<algorithmFPType>[nLocal];
+    const algorithmFPType **candidates = new const algorithmFPType *[nLocal];
+    for(size_t l = 0; l < nLocal; l++)
+    {
+        localCandidates[l]->getBlockOfRows(0, nFeatures, readOnly, blocks[l]);
+        candidates[l] = blocks[l].getBlockPtr();
+    }
+
+    daal::tls<algorithmFPType *> buffer( [ = ]()-> algorithmFPType *
+    {
+        return service_malloc<algorithmFPType, cpu>(2 * nLocal * maxBins);
+    } );
+
+    daal::threader_for( nFeatures, nFeatures, [ =, &buffer ](int j)
+    {
+        algorithmFPType *v = buffer.local();
+        if(!v) { return; }
+        algorithmFPType *w = v + nLocal * maxBins;
+
+        size_t n = 0;
+        for(size_t l = 0; l < nLocal; l++)
+        {
+            const algorithmFPType *row = candidates[l] + j * nCols;
+            size_t nCandidates = (size_t)row[0];
+            if(nCandidates > maxBins) { nCandidates = maxBins; }
+            for(size_t k = 0; k < nCandidates; k++)
+            {
+                v[n] = row[1 + k];
+                w[n++] = row[1 + maxBins + k];
+            }
+        }
+
+        daal::algorithms::internal::qSort<algorithmFPType, algorithmFPType, cpu>(n, v, w);
+
+        /* Merge the equal values */
+        size_t nUnique = 0;
+        for(size_t i = 0; i < n; i++)
+        {
+            if(nUnique > 0 && v[i] == v[nUnique - 1])
+            {
+                w[nUnique - 1] += w[i];
+                continue;
+            }
+            v[nUnique] = v[i];
+            w[nUnique++] = w[i];
+        }
+
+        algorithmFPType *b = borders + j * maxBins + 1;
+        size_t nBorders = 0;
+        if(nUnique <= maxBins)
+        {
+            for(size_t i = 1; i < nUnique; i++)
+            {
+                b[nBorders++] = v[i];
+            }
+        }
+        else
+        {
+            /* The k-th border is the value of the observation of rank k * nObservations / maxBins */
+            size_t nObservations = 0;
+            for(size_t i = 0; i < nUnique; i++)
+            {
+                nObservations += (size_t)w[i];
+            }
+            algorithmFPType last = v[0];
+            size_t i = 0, rankEnd = (size_t)w[0];
+            for(size_t k = 1; k < maxBins; k++)
+            {
+                const size_t rank = (k * nObservations) / maxBins;
+                while(rankEnd <= rank && i + 1 < nUnique)
+                {
+                    rankEnd += (size_t)w[++i];
+                }
+                if(v[i] > last) { b[nBorders++] = v[i]; last = v[i]; }
+            }
+        }
+        b[-1] = (algorithmFPType)nBorders;
+        for(size_t k = nBorders; k + 1 < maxBins; k++)
+        {
+            b[k] = 0;
+        }
+    } );
+
+    bool bMemoryAllocationFailed = false;
+    buffer.reduce( [ =, &bMemoryAllocationFailed ](algorithmFPType *v)-> void
+    {
+        if(!v) { bMemoryAllocationFailed = true; return; }
+        service_free<algorithmFPType, cpu>(v);
+    } );
+
+    for(size_t l = 0; l < nLocal; l++)
+    {
+        localCandidates[l]->releaseBlockOfRows(blocks[l]);
+    }
+    delete[] blocks;
+    delete[] candidates;
+    binBorders->releaseBlockOfRows(bordersBlock);
+
+    if(bMemoryAllocationFailed) { return services::SharedPtr<NumericTable>(); }
+    return binBorders;
+}
+
+/**
+ *  Creates the table of the training state with the header and room for nRecords records
+ */
+template <typename algorithmFPType, CpuType cpu>
+services::SharedPtr<NumericTable> createTrainingState(int iTree, size_t nodeBegin, size_t nRecords, int nextTree)
+{
+    services::SharedPtr<NumericTable> state(new HomogenNumericTable<algorithmFPType>(stateRowSize, nRecords + 1, NumericTableIface::doAllocate));
+    BlockDescriptor<algorithmFPType> block;
+    state->getBlockOfRows(0, 1, writeOnly, block);
+    algorithmFPType *header = block.getBlockPtr();
+    if(!header) { return services::SharedPtr<NumericTable>(); }
+    header[0] = (algorithmFPType)iTree;
+    header[1] = (algorithmFPType)nodeBegin;
+    header[2] = (algorithmFPType)nRecords;
+    header[3] = (algorithmFPType)nextTree;
+    state->releaseBlockOfRows(block);
+    return state;
+}
+
+/**
+ *  Tree builder of a local node. The splits of the nodes are received from the master node,
+ *  the builder only moves the observations into the children and computes the requested histograms
+ */
+template <typename algorithmFPType, CpuType cpu>
+class LocalTreeBuilder : public TreeBuilder<algorithmFPType, cpu>
+{
+    typedef TreeBuilder<algorithmFPType, cpu> super;
+public:
+    LocalTreeBuilder(const BinnedData<algorithmFPType, cpu> &data, const gbt::training::Parameter &par) :
+        super(data, par), _iTree(-1), _nNodes(0), _requestedIdx(0), _nRequested(0), _requestedCapacity(0) {}
+
+    ~LocalTreeBuilder()
+    {
+        service_free<size_t, cpu>(_requestedIdx);
+    }
+
+    /**
+     *  Applies the records of the training state to the nodes of the tree and collects the requested histograms
+     *  \param[out] nextTree  Index of the tree to start, stateContinueTree or stateCompleted
+     *  \return false if memory allocation failed or the training state is inconsistent
+     */
+    bool applyState(NumericTable *state, int &nextTree)
+    {
+        const size_t nStateRows = state->getNumberOfRows();
+        if(nStateRows == 0) { return false; }
+
+        BlockDescriptor<algorithmFPType> block;
+        state->getBlockOfRows(0, nStateRows, readOnly, block);
+        const algorithmFPType *header = block.getBlockPtr();
+
+        const int iTree = (int)header[0];
+        const size_t nodeBegin = (size_t)header[1];
+        const size_t nRecords = (size_t)header[2];
+        nextTree = (int)header[3];
+        const algorithmFPType *records = header + stateRowSize;
+
+        bool bOk = (nRecords + 1 == nStateRows);
+        if(bOk && nRecords)
+        {
+            if(iTree != _iTree)
+            {
+                this->startTree(this->_data.nRows);
+                _iTree = iTree;
+                _nNodes = 1;
+            }
+            bOk = (nodeBegin < _nNodes && nodeBegin + nRecords >= _nNodes) && applyRecords(records, nodeBegin, nRecords);
+        }
+        state->releaseBlockOfRows(block);
+        return bOk;
+    }
+
+    /**
+     *  Adds the responses of the leaves of the current tree to the scores of the observations.
+     *  The trees of the model are fitted to the nScores scores of an observation in turn
+     */
+    void finishTree(algorithmFPType *f, size_t nScores)
+    {
+        if(_iTree >= 0)
+        {
+            this->updateScores(_nNodes, f + (size_t)_iTree % nScores, nScores);
+        }
+        _iTree = -1;
+        _nRequested = 0;
+    }
+
+    /**
+     *  Starts the tree with the given index, the histogram of its root is requested
+     */
+    void startNextTree(int iTree)
+    {
+        this->startTree(this->_data.nRows);
+        _iTree = iTree;
+        _nNodes = 1;
+        _requestedIdx[0] = 0;
+        _nRequested = 1;
+    }
+
+    /**
+     *  Computes the requested histograms on the gradient statistics gh of the observations.
+     *  Every histogram is a row of the table, the sums of every bin are three consecutive values
+     *  \return Table of the histograms, the empty pointer if nothing is requested or memory allocation failed
+     */
+    services::SharedPtr<NumericTable> buildRequestedHistograms(const GH<algorithmFPType> *gh)
+    {
+        if(_nRequested == 0) { return services::SharedPtr<NumericTable>(); }
+
+        const size_t histSize = 3 * this->_data.nTotalBins;
+        services::SharedPtr<NumericTable> hist(new HomogenNumericTable<algorithmFPType>(histSize, _nRequested, NumericTableIface::doAllocate));
+        BlockDescriptor<algorithmFPType> block;
+        hist->getBlockOfRows(0, _nRequested, writeOnly, block);
+        algorithmFPType *h = block.getBlockPtr();
+        if(!h) { return services::SharedPtr<NumericTable>(); }
+
+        for(size_t r = 0; r < _nRequested; r++)
+        {
+            this->_nodes[_requestedIdx[r]].hist = (GHSum<algorithmFPType> *)(h + r * histSize);
+        }
+        this->buildHistograms(gh, _requestedIdx, _nRequested);
+        for(size_t r = 0; r < _nRequested; r++)
+        {
+            this->_nodes[_requestedIdx[r]].hist = 0;
+        }
+        hist->releaseBlockOfRows(block);
+        return hist;
+    }
+
+    bool init()
+    {
+        _requestedCapacity = 1;
+        _requestedIdx = service_malloc<size_t, cpu>(_requestedCapacity);
+        return (_requestedIdx && super::init());
+    }
+
+protected:
+    /**
+     *  Sets the nodes [nodeBegin, nodeBegin + nRecords) from the records and moves the observations of the split nodes
+     *  into their children. The records may span several levels, the levels are processed one after another
+     */
+    bool applyRecords(const algorithmFPType *records, size_t nodeBegin, size_t nRecords)
+    {
+        const size_t nodeEnd = nodeBegin + nRecords;
+        size_t nNodes = nodeEnd, nRequested = 0;
+        for(size_t i = 0; i < nRecords; i++)
+        {
+            const algorithmFPType *record = records + i * stateRowSize;
+            if(record[0] < 0) { continue; }
+            const size_t leftIdx = (size_t)record[2];
+            if(leftIdx < nodeBegin + i + 1 || (size_t)record[0] >= this->_data.nFeatures) { return false; }
+            if(leftIdx + 2 > nNodes) { nNodes = leftIdx + 2; }
+            nRequested += ((int)record[3] != noHistogram);
+        }
+        if(!this->reserveNodes(nNodes) || !reserveRequests(nRequested)) { return false; }
+
+        _nRequested = 0;
+        for(size_t levelBegin = nodeBegin; levelBegin < nodeEnd;)
+        {
+            /* Children of the first split node of the level follow the last node of the level */
+            size_t levelEnd = nodeEnd;
+            for(size_t i = levelBegin; i < nodeEnd; i++)
+            {
+                const algorithmFPType *record = records + (i - nodeBegin) * stateRowSize;
+                if(record[0] >= 0)
+                {
+                    levelEnd = (size_t)record[2];
+                    break;
+                }
+            }
+            if(levelEnd > nodeEnd) { levelEnd = nodeEnd; }
+
+            for(size_t i = levelBegin; i < levelEnd; i++)
+            {
+                const algorithmFPType *record = records + (i - nodeBegin) * stateRowSize;
+                BuildNode<algorithmFPType> &node = this->_nodes[i];
+                node.hist = 0;
+                if(record[0] < 0)
+                {
+                    node.featureIdx = -1;
+                    node.response = record[1];
+                    continue;
+                }
+                node.featureIdx = (int)record[0];
+                node.splitBin = (size_t)record[1];
+                node.leftIdx = (size_t)record[2];
+                const int requested = (int)record[3];
+                if(requested != noHistogram)
+                {
+                    _requestedIdx[_nRequested++] = node.leftIdx + (requested == rightHistogram ? 1 : 0);
+                }
+            }
+            this->partition(levelBegin, levelEnd);
+            levelBegin = levelEnd;
+        }
+        _nNodes = nNodes;
+        return true;
+    }
+
+    bool reserveRequests(size_t n)
+    {
+        if(n <= _requestedCapacity) { return true; }
+        service_free<size_t, cpu>(_requestedIdx);
+        _requestedIdx = service_malloc<size_t, cpu>(n);
+        _requestedCapacity = (_requestedIdx ? n : 0);
+        return (_requestedIdx != 0);
+    }
+
+    int _iTree;                 /* Index of the current tree, -1 if there is no current tree */
+    size_t _nNodes;             /* Number of the nodes of the current tree */
+    size_t *_requestedIdx;      /* Indices of the nodes whose histograms are requested */
+    size_t _nRequested;
+    size_t _requestedCapacity;
+};
+
+/**
+ *  Tree builder of the master node. The nodes hold the numbers of the observations of the whole data set,
+ *  the histograms of the nodes are the sums of the histograms computed on the local nodes
+ */
+template <typename algorithmFPType, CpuType cpu>
+class MasterTreeBuilder : public TreeBuilder<algorithmFPType, cpu>
+{
+    typedef TreeBuilder<algorithmFPType, cpu> super;
+public:
+    MasterTreeBuilder(const BinnedData<algorithmFPType, cpu> &data, const gbt::training::Parameter &par) :
+        super(data, par), _nObservations(0), _levelBegin(0), _levelEnd(0), _depth(0), _nNodes(0), _nSent(0),
+        _parentBegin(0), _parentEnd(0), _parentHist(0), _levelHist(0), _directIdx(0), _nDirect(0) {}
+
+    ~MasterTreeBuilder()
+    {
+        releaseHistograms();
+    }
+
+    bool init(size_t nObservations)
+    {
+        _nObservations = nObservations;
+        return this->reserveNodes(this->maxNumberOfNodes(nObservations));
+    }
+
+    /**
+     *  Starts the new tree, the histogram of its root is requested
+     *  \return false if memory allocation failed
+     */
+    bool startNextTree()
+    {
+        releaseHistograms();
+        this->startTree(_nObservations);
+        _levelHist = this->allocHist(1);
+        _directIdx = service_malloc<size_t, cpu>(1);
+        if(!_levelHist || !_directIdx) { return false; }
+        this->_nodes[0].hist = _levelHist;
+        _directIdx[0] = 0;
+        _nDirect = 1;
+        _levelBegin = 0;
+        _levelEnd = 1;
+        _depth = 0;
+        _nNodes = 1;
+        _nSent = 0;
+        return true;
+    }
+
+    /* Number of the histograms requested from the local nodes */
+    size_t getNumberOfRequestedHistograms() const { return _nDirect; }
+
+    /**
+     *  Sets the requested histograms to the sums of the histograms computed on the local nodes.
+     *  The requested histograms are the first ones of the buffer of the level
+     */
+    void sumHistograms(NumericTable **localHist, size_t nLocal)
+    {
+        BlockDescriptor<algorithmFPType> *blocks = new BlockDescriptor<algorithmFPType>[nLocal];
+        const algorithmFPType **local = new const algorithmFPType *[nLocal];
+        for(size_t l = 0; l < nLocal; l++)
+        {
+            localHist[l]->getBlockOfRows(0, _nDirect, readOnly, blocks[l]);
+            local[l] = blocks[l].getBlockPtr();
+        }
+
+        const size_t size = _nDirect * 3 * this->_data.nTotalBins;
+        const size_t blockSize = 3 * rowBlockSize;
+        const size_t nBlocks = (size + blockSize - 1) / blockSize;
+        algorithmFPType *sum = (algorithmFPType *)_levelHist;
+        daal::threader_for( nBlocks, nBlocks, [ = ](int iBlock)
+        {
+            const size_t begin = iBlock * blockSize;
+            const size_t end = (begin + blockSize > size ? size : begin + blockSize);
+            for(size_t i = begin; i < end; i++)
+            {
+                sum[i] = local[0][i];
+            }
+            for(size_t l = 1; l < nLocal; l++)
+            {
+                const algorithmFPType *h = local[l];
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for(size_t i = begin; i < end; i++)
+                {
+                    sum[i] += h[i];
+                }
+            }
+        } );
+
+        for(size_t l = 0; l < nLocal; l++)
+        {
+            localHist[l]->releaseBlockOfRows(blocks[l]);
+        }
+        delete[] blocks;
+        delete[] local;
+    }
+
+    /**
+     *  Completes the histograms of the level after the requested ones are summed and grows the tree
+     *  until the histograms of the next level are needed or the tree is completed
+     *  \param[out] bCompleted  Flag of the completed tree
+     *  \return false if memory allocation failed
+     */
+    bool grow(bool &bCompleted)
+    {
+        if(_parentEnd == 0)
+        {
+            this->_nodes[0].sum = this->totalSum(_levelHist);
+        }
+        else
+        {
+            this->subtractHistograms(_parentBegin, _parentEnd);
+            service_free<GHSum<algorithmFPType>, cpu>(_parentHist);
+            _parentHist = 0;
+        }
+
+        for(;;)
+        {
+            const size_t nSplit = this->splitLevel(_levelBegin, _levelEnd, _depth, _nNodes);
+            if(nSplit == 0) { break; }
+
+            for(size_t i = _levelBegin; i < _levelEnd; i++)
+            {
+                const BuildNode<algorithmFPType> &node = this->_nodes[i];
+                if(node.featureIdx < 0) { continue; }
+                super::initChildren(this->_nodes, node, node.rowBegin + (size_t)(node.leftSum.n + (algorithmFPType)0.5));
+            }
+
+            const size_t nHist = this->countHistograms(_levelBegin, _levelEnd, _depth);
+            if(nHist)
+            {
+                GHSum<algorithmFPType> *nextHist = this->allocHist(nHist);
+                size_t *directIdx = service_malloc<size_t, cpu>(nSplit);
+                if(!nextHist || !directIdx)
+                {
+                    service_free<GHSum<algorithmFPType>, cpu>(nextHist);
+                    service_free<size_t, cpu>(directIdx);
+                    return false;
+                }
+                service_free<size_t, cpu>(_directIdx);
+                _directIdx = directIdx;
+                _nDirect = this->assignHistograms(_levelBegin, _levelEnd, nextHist, _directIdx);
+
+                _parentBegin = _levelBegin;
+                _parentEnd = _levelEnd;
+                _parentHist = _levelHist;
+                _levelHist = nextHist;
+                _levelBegin = _levelEnd;
+                _levelEnd = _nNodes;
+                _depth++;
+                bCompleted = false;
+                return true;
+            }
+            service_free<GHSum<algorithmFPType>, cpu>(_levelHist);
+            _levelHist = 0;
+            _levelBegin = _levelEnd;
+            _levelEnd = _nNodes;
+            _depth++;
+        }
+
+        releaseHistograms();
+        bCompleted = true;
+        return true;
+    }
+
+    /* Number of the nodes not yet sent to the local nodes */
+    size_t getNumberOfRecords(bool bCompleted) const
+    {
+        return (bCompleted ? _nNodes : _parentEnd) - _nSent;
+    }
+
+    /* Index of the first node not yet sent to the local nodes */
+    size_t getFirstRecord() const { return _nSent; }
+
+    /**
+     *  Writes the records of the nodes not yet sent to the local nodes
+     *  and marks the children whose histograms are requested
+     */
+    void writeRecords(algorithmFPType *records, bool bCompleted)
+    {
+        const size_t nodeEnd = (bCompleted ? _nNodes : _parentEnd);
+        size_t iDirect = 0;
+        for(size_t i = _nSent; i < nodeEnd; i++)
+        {
+            const BuildNode<algorithmFPType> &node = this->_nodes[i];
+            algorithmFPType *record = records + (i - _nSent) * stateRowSize;
+            if(node.featureIdx < 0)
+            {
+                record[0] = (algorithmFPType)(-1);
+                record[1] = node.response;
+                record[2] = 0;
+                record[3] = (algorithmFPType)noHistogram;
+                continue;
+            }
+            int requested = noHistogram;
+            if(!bCompleted && iDirect < _nDirect)
+            {
+                if(_directIdx[iDirect] == node.leftIdx)          { requested = leftHistogram; iDirect++; }
+                else if(_directIdx[iDirect] == node.leftIdx + 1) { requested = rightHistogram; iDirect++; }
+            }
+            record[0] = (algorithmFPType)node.featureIdx;
+            record[1] = (algorithmFPType)node.splitBin;
+            record[2] = (algorithmFPType)node.leftIdx;
+            record[3] = (algorithmFPType)requested;
+        }
+        _nSent = nodeEnd;
+    }
+
+    /* Returns the completed tree in the format of the model */
+    services::SharedPtr<NumericTable> getTree()
+    {
+        return this->makeTree(_nNodes);
+    }
+
+protected:
+    void releaseHistograms()
+    {
+        service_free<GHSum<algorithmFPType>, cpu>(_parentHist);
+        service_free<GHSum<algorithmFPType>, cpu>(_levelHist);
+        service_free<size_t, cpu>(_directIdx);
+        _parentHist = 0;
+        _levelHist = 0;
+        _directIdx = 0;
+        _nDirect = 0;
+        _parentBegin = 0;
+        _parentEnd = 0;
+    }
+
+    size_t _nObservations;                  /* Number of the observations on all local nodes */
+    size_t _levelBegin;                     /* Range of the nodes of the level whose histograms are requested */
+    size_t _levelEnd;
+    size_t _depth;
+    size_t _nNodes;
+    size_t _nSent;                          /* Number of the nodes sent to the local nodes */
+    size_t _parentBegin;                    /* Range of the nodes of the previous level, 0 for the root */
+    size_t _parentEnd;
+    GHSum<algorithmFPType> *_parentHist;    /* Histograms of the previous level */
+    GHSum<algorithmFPType> *_levelHist;     /* Histograms of the level, the requested ones go first */
+    size_t *_directIdx;                     /* Nodes whose histograms are requested from the local nodes */
+    size_t _nDirect;
+};
+
+/**
+ *  Data of the local node kept between the compute() calls: the quantized data set,
+ *  the scores and the gradient statistics of the observations
+ */
+template <typename algorithmFPType, CpuType cpu>
+class LocalTrainingState
+{
+public:
+    LocalTrainingState(const gbt::training::Parameter &parameter, size_t nScores) :
+        par(parameter), builder(data, par), nScores(nScores), f(0), gh(0) {}
+
+    virtual ~LocalTrainingState()
+    {
+        service_free<algorithmFPType, cpu>(f);
+        service_free<GH<algorithmFPType>, cpu>(gh);
+    }
+
+    /**
+     *  Quantizes the local data set with the borders of the bins computed by the master node
+     *  \return false if memory allocation failed or the borders are inconsistent
+     */
+    bool init(NumericTable *x, NumericTable *binBorders)
+    {
+        if(!data.initBorders(binBorders) || !data.quantize(x) || !builder.init()) { return false; }
+        f = service_calloc<algorithmFPType, cpu>(data.nRows * nScores);
+        gh = service_malloc<GH<algorithmFPType>, cpu>(data.nRows);
+        return (f && gh);
+    }
+
+    /**
+     *  Applies the training state received from the master node. When the current tree is completed,
+     *  updates the scores of the observations and starts the next tree
+     *  \return false if the training state is inconsistent
+     */
+    bool update(NumericTable *trainingState)
+    {
+        int nextTree = stateContinueTree;
+        if(!builder.applyState(trainingState, nextTree)) { return false; }
+        if(nextTree == stateContinueTree) { return true; }
+
+        builder.finishTree(f, nScores);
+        if(nextTree >= 0)
+        {
+            computeGradients((size_t)nextTree);
+            builder.startNextTree(nextTree);
+        }
+        return true;
+    }
+
+    /* Computes the gradient statistics of the observations for the tree with the given index */
+    virtual void computeGradients(size_t iTree) = 0;
+
+    gbt::training::Parameter par;
+    BinnedData<algorithmFPType, cpu> data;
+    LocalTreeBuilder<algorithmFPType, cpu> builder;
+    size_t nScores;             /* Number of the scores of an observation */
+    algorithmFPType *f;         /* Scores of the observations */
+    GH<algorithmFPType> *gh;    /* Gradient statistics of the observations for the current tree */
+};
+
+/**
+ *  Data of the master node kept between the compute() calls: the borders of the bins and the tree under construction
+ */
+template <typename algorithmFPType, CpuType cpu>
+class MasterTrainingState
+{
+public:
+    MasterTrainingState(const gbt::training::Parameter &parameter) :
+        par(parameter), builder(data, par), nTrees(0), iTree(0) {}
+
+    virtual ~MasterTrainingState() {}
+
+    /**
+     *  Sets the borders of the bins and starts the first tree to grow.
+     *  If initialResponse is not 0, the first tree is the leaf with the given response
+     *  and its record is sent to the local nodes
+     *  \return Training state to pass to the local nodes, the empty pointer if memory allocation failed
+     */
+    services::SharedPtr<NumericTable> start(NumericTable *binBorders, size_t nObservations, size_t nTotalTrees,
+                                            const algorithmFPType *initialResponse)
+    {
+        nTrees = nTotalTrees;
+        iTree = (initialResponse ? 1 : 0);
+        if(!data.initBorders(binBorders) || !builder.init(nObservations)) { return services::SharedPtr<NumericTable>(); }
+
+        services::SharedPtr<NumericTable> state =
+            createTrainingState<algorithmFPType, cpu>(iTree - 1, 0, iTree, (iTree < nTrees ? iTree : stateCompleted));
+        if(!state) { return state; }
+        if(initialResponse)
+        {
+            BlockDescriptor<algorithmFPType> block;
+            state->getBlockOfRows(1, 1, writeOnly, block);
+            algorithmFPType *record = block.getBlockPtr();
+            record[0] = (algorithmFPType)(-1);
+            record[1] = *initialResponse;
+            record[2] = 0;
+            record[3] = (algorithmFPType)noHistogram;
+            state->releaseBlockOfRows(block);
+        }
+        if(iTree < nTrees && !builder.startNextTree()) { return services::SharedPtr<NumericTable>(); }
+        return state;
+    }
+
+    /**
+     *  Sums the histograms computed on the local nodes and grows the current tree.
+     *  The completed tree is added to the collection of the trees and the next tree is started
+     *  \return Training state to pass to the local nodes, the empty pointer if memory allocation failed
+     */
+    services::SharedPtr<NumericTable> grow(NumericTable **localHist, size_t nLocal, DataCollection *trees)
+    {
+        builder.sumHistograms(localHist, nLocal);
+
+        bool bCompleted = false;
+        if(!builder.grow(bCompleted)) { return services::SharedPtr<NumericTable>(); }
+
+        const int iCurrentTree = (int)iTree;
+        int nextTree = stateContinueTree;
+        if(bCompleted)
+        {
+            services::SharedPtr<NumericTable> tree = builder.getTree();
+            if(!tree) { return tree; }
+            trees->push_back(tree);
+            iTree++;
+            nextTree = (iTree < nTrees ? (int)iTree : stateCompleted);
+        }
+
+        const size_t nRecords = builder.getNumberOfRecords(bCompleted);
+        services::SharedPtr<NumericTable> state =
+            createTrainingState<algorithmFPType, cpu>(iCurrentTree, builder.getFirstRecord(), nRecords, nextTree);
+        if(!state) { return state; }
+        if(nRecords)
+        {
+            BlockDescriptor<algorithmFPType> block;
+            state->getBlockOfRows(1, nRecords, writeOnly, block);
+            builder.writeRecords(block.getBlockPtr(), bCompleted);
+            state->releaseBlockOfRows(block);
+        }
+
+        if(nextTree >= 0 && !builder.startNextTree()) { return services::SharedPtr<NumericTable>(); }
+        return state;
+    }
+
+    bool isCompleted() const { return (iTree >= nTrees); }
+
+    gbt::training::Parameter par;
+    BinnedData<algorithmFPType, cpu> data;
+    MasterTreeBuilder<algorithmFPType, cpu> builder;
+    size_t nTrees;      /* Number of the trees of the model */
+    size_t iTree;       /* Index of the tree under construction */
+};
+
+} // namespace internal
+} // namespace training
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -24,6 +24,7 @@
 
 #include "kmeans_types.h"
 #include "kmeans_batch.h"
+#include "kmeans_online.h"
 #include "kmeans_distributed.h"
 #include "kmeans_lloyd_kernel.h"
 
@@ -70,6 +71,68 @@ void BatchContainer<algorithmFPType, method, cpu>::compute()
     __DAAL_CALL_KERNEL(env, internal::KMeansBatchKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, na, a, nr, r, par);
 }
 
+template<typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INTIALIZE_KERNELS(internal::KMeansOnlineKernel, method, algorithmFPType);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINTIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void OnlineContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input               *input = static_cast<Input *>(_in );
+    OnlinePartialResult *pres  = static_cast<OnlinePartialResult *>(_pres);
+
+    const size_t na = 1;
+    NumericTable *a[na];
+    a[0] = static_cast<NumericTable *>(input->get(data).get());
+
+    const size_t nr = 4;
+    NumericTable *r[nr];
+    r[0] = static_cast<NumericTable *>(pres->get(currentCentroids ).get());
+    r[1] = static_cast<NumericTable *>(pres->get(clusterCounts    ).get());
+    r[2] = static_cast<NumericTable *>(pres->get(blockGoalFunction).get());
+    r[3] = static_cast<NumericTable *>(pres->get(nProcessedBlocks ).get());
+
+    Parameter *par = static_cast<Parameter *>(_par);
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::KMeansOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, na, a, nr, r, par);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
+{
+    Input               *input  = static_cast<Input *>(_in );
+    OnlinePartialResult *pres   = static_cast<OnlinePartialResult *>(_pres);
+    Result              *result = static_cast<Result *>(_res);
+
+    const size_t na = 4;
+    NumericTable *a[na];
+    a[0] = static_cast<NumericTable *>(pres->get(currentCentroids ).get());
+    a[1] = static_cast<NumericTable *>(pres->get(blockGoalFunction).get());
+    a[2] = static_cast<NumericTable *>(pres->get(nProcessedBlocks ).get());
+    a[3] = static_cast<NumericTable *>(input->get(data).get());
+
+    const size_t nr = 4;
+    NumericTable *r[nr];
+    r[0] = static_cast<NumericTable *>(result->get(centroids   ).get());
+    r[1] = static_cast<NumericTable *>(result->get(assignments ).get());
+    r[2] = static_cast<NumericTable *>(result->get(goalFunction).get());
+    r[3] = static_cast<NumericTable *>(result->get(nIterations ).get());
+
+    Parameter *par = static_cast<Parameter *>(_par);
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::KMeansOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), finalizeCompute, na, a, nr, r, par);
+}
+
 template<typename algorithmFPType, Method method, CpuType cpu>
 DistributedContainer<step1Local, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
 {
@@ -90,10 +90,11 @@ void DistributedContainer<step1Local, algorithmFPType, method, cpu>::compute()
     NumericTable *a[na];
     a[0] = static_cast<NumericTable *>(input->get(data            ).get());
 
-    const size_t nr = 2;
+    const size_t nr = 3;
     NumericTable *r[nr];
-    r[0] = static_cast<NumericTable *>(pres->get(partialClustersNumber).get());
-    r[1] = static_cast<NumericTable *>(pres->get(partialClusters      ).get());
+    r[0] = static_cast<NumericTable *>(pres->get(partialClustersNumber ).get());
+    r[1] = static_cast<NumericTable *>(pres->get(partialClusters       ).get());
+    r[2] = static_cast<NumericTable *>(pres->get(partialClustersWeights).get());
 
     Parameter *par = static_cast<Parameter *>(_par);
     daal::services::Environment::env &env = *_env;
@@ -125,19 +126,21 @@ void DistributedContainer<step2Master, algorithmFPType, method, cpu>::compute()
 
     size_t nPartials = dcInput->size();
 
-    size_t na = nPartials * 2;
+    size_t na = nPartials * 3;
     NumericTable **a = new NumericTable*[na];
     for(size_t i = 0; i < nPartials; i++)
     {
         PartialResult *inPres = static_cast<PartialResult *>( (*dcInput)[i].get() );
-        a[i * 2 + 0] = static_cast<NumericTable *>(inPres->get(partialClustersNumber).get());
-        a[i * 2 + 1] = static_cast<NumericTable *>(inPres->get(partialClusters      ).get());
+        a[i * 3 + 0] = static_cast<NumericTable *>(inPres->get(partialClustersNumber ).get());
+        a[i * 3 + 1] = static_cast<NumericTable *>(inPres->get(partialClusters       ).get());
+        a[i * 3 + 2] = static_cast<NumericTable *>(inPres->get(partialClustersWeights).get());
     }
 
-    const size_t nr = 2;
+    const size_t nr = 3;
     NumericTable *r[nr];
-    r[0] = static_cast<NumericTable *>(pres->get(partialClustersNumber).get());
-    r[1] = static_cast<NumericTable *>(pres->get(partialClusters      ).get());
+    r[0] = static_cast<NumericTable *>(pres->get(partialClustersNumber ).get());
+    r[1] = static_cast<NumericTable *>(pres->get(partialClusters       ).get());
+    r[2] = static_cast<NumericTable *>(pres->get(partialClustersWeights).get());
 
     Parameter *par = static_cast<Parameter *>(_par);
     daal::services::Environment::env &env = *_env;
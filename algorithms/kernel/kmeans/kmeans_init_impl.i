@@ -28,6 +28,8 @@
 #include "service_memory.h"
 #include "service_micro_table.h"
 #include "service_rng.h"
+#include "service_data_utils.h"
+#include "homogen_numeric_table.h"
 
 using namespace daal::internal;
 using namespace daal::services::internal;
@@ -43,6 +45,425 @@ namespace init
 namespace internal
 {
 
+
+/* Number of observations processed by one task of the seeding passes over the data */
+const size_t seedingBlockSize = 512;
+
+/**
+ *  Updates minDist with the squared distances from the observations to the centroids
+ *  [firstCenter, firstCenter + nCenters) and the nearest indices if requested.
+ *  Returns the sum of the distances multiplied by the weights of the observations,
+ *  per block sums are stored in blockSums.
+ */
+template <typename interm, CpuType cpu>
+interm updateMinDistancesDense(const NumericTable *ntData, const interm *weights, const interm *centers, size_t firstCenter,
+                          size_t nCenters, interm *minDist, int *nearest, interm *blockSums)
+{
+    size_t n = ntData->getNumberOfRows();
+    size_t p = ntData->getNumberOfColumns();
+
+    daal::threader_for_blocked_size( n, seedingBlockSize, daal::threader_get_threads_number(),
+                                     [=](size_t iStart, size_t iEnd)
+    {
+        BlockMicroTable<interm, readOnly, cpu> mtData( ntData );
+        interm *data;
+        mtData.getBlockOfRows( iStart, iEnd - iStart, &data );
+
+        interm sum = (interm)0.0;
+        for(size_t i = iStart; i < iEnd; i++)
+        {
+            const interm *x = data + (i - iStart) * p;
+            for(size_t k = firstCenter; k < firstCenter + nCenters; k++)
+            {
+                const interm *c = centers + k * p;
+                interm dist = (interm)0.0;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for(size_t j = 0; j < p; j++)
+                {
+                    interm diff = x[j] - c[j];
+                    dist += diff * diff;
+                }
+                if(dist < minDist[i])
+                {
+                    minDist[i] = dist;
+                    if(nearest) { nearest[i] = (int)k; }
+                }
+            }
+            sum += (weights ? weights[i] * minDist[i] : minDist[i]);
+        }
+        blockSums[iStart / seedingBlockSize] = sum;
+
+        mtData.release();
+    } );
+
+    size_t nBlocks = (n + seedingBlockSize - 1) / seedingBlockSize;
+    interm total = (interm)0.0;
+    for(size_t b = 0; b < nBlocks; b++)
+    {
+        total += blockSums[b];
+    }
+    return total;
+}
+
+/**
+ *  Sparse version of updateMinDistancesDense: the observations are read from the CSR blocks
+ *  and the squared distances are computed as |x|^2 - 2 * x * c + |c|^2
+ */
+template <typename interm, CpuType cpu>
+interm updateMinDistancesCSR(const NumericTable *ntDataGen, const interm *weights, const interm *centers, size_t firstCenter,
+                             size_t nCenters, interm *minDist, int *nearest, interm *blockSums)
+{
+    CSRNumericTableIface *ntData = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(ntDataGen));
+
+    size_t n = ntDataGen->getNumberOfRows();
+    size_t p = ntDataGen->getNumberOfColumns();
+
+    interm *centersSq = service_malloc<interm, cpu>(nCenters);
+    if(!centersSq) { return (interm)-1.0; }
+
+    for(size_t k = 0; k < nCenters; k++)
+    {
+        const interm *c = centers + (firstCenter + k) * p;
+        centersSq[k] = (interm)0.0;
+        for(size_t j = 0; j < p; j++)
+        {
+            centersSq[k] += c[j] * c[j];
+        }
+    }
+
+    daal::threader_for_blocked_size( n, seedingBlockSize, daal::threader_get_threads_number(),
+                                     [=](size_t iStart, size_t iEnd)
+    {
+        CSRBlockDescriptor<interm> dataBlock;
+        ntData->getSparseBlock( iStart, iEnd - iStart, readOnly, dataBlock );
+
+        const interm *values = dataBlock.getBlockValuesPtr();
+        const size_t *colIdx = dataBlock.getBlockColumnIndicesPtr();
+        const size_t *rowIdx = dataBlock.getBlockRowIndicesPtr();
+
+        interm sum = (interm)0.0;
+        for(size_t i = iStart; i < iEnd; i++)
+        {
+            size_t first = rowIdx[i - iStart] - 1;
+            size_t last  = rowIdx[i - iStart + 1] - 1;
+
+            interm xSq = (interm)0.0;
+            for(size_t l = first; l < last; l++)
+            {
+                xSq += values[l] * values[l];
+            }
+
+            for(size_t k = 0; k < nCenters; k++)
+            {
+                const interm *c = centers + (firstCenter + k) * p;
+                interm xc = (interm)0.0;
+                for(size_t l = first; l < last; l++)
+                {
+                    xc += values[l] * c[colIdx[l] - 1];
+                }
+
+                interm dist = xSq - (interm)2.0 * xc + centersSq[k];
+                if(dist < (interm)0.0) { dist = (interm)0.0; }
+                if(dist < minDist[i])
+                {
+                    minDist[i] = dist;
+                    if(nearest) { nearest[i] = (int)(firstCenter + k); }
+                }
+            }
+            sum += (weights ? weights[i] * minDist[i] : minDist[i]);
+        }
+        blockSums[iStart / seedingBlockSize] = sum;
+
+        ntData->releaseSparseBlock( dataBlock );
+    } );
+
+    service_free<interm, cpu>(centersSq);
+
+    size_t nBlocks = (n + seedingBlockSize - 1) / seedingBlockSize;
+    interm total = (interm)0.0;
+    for(size_t b = 0; b < nBlocks; b++)
+    {
+        total += blockSums[b];
+    }
+    return total;
+}
+
+/**
+ *  Returns the weighted sum of the distances to the nearest centroids or a negative value
+ *  if the memory allocation fails
+ */
+template <Method method, typename interm, CpuType cpu>
+interm updateMinDistances(const NumericTable *ntData, const interm *weights, const interm *centers, size_t firstCenter,
+                          size_t nCenters, interm *minDist, int *nearest, interm *blockSums)
+{
+    if(method == plusPlusCSR)
+    {
+        return updateMinDistancesCSR<interm, cpu>(ntData, weights, centers, firstCenter, nCenters, minDist, nearest, blockSums);
+    }
+    return updateMinDistancesDense<interm, cpu>(ntData, weights, centers, firstCenter, nCenters, minDist, nearest, blockSums);
+}
+
+/**
+ *  Samples an observation with the probability proportional to weights[i] * minDist[i]
+ */
+template <typename interm, CpuType cpu>
+size_t sampleObservation(size_t n, const interm *weights, const interm *minDist, const interm *blockSums, interm total,
+                         IntRng<int, cpu> &rng)
+{
+    const int maxInt = 2147483647;
+    int r;
+    rng.uniform(1, 0, maxInt, &r);
+    interm u = total * ((interm)r / (interm)maxInt);
+
+    size_t nBlocks = (n + seedingBlockSize - 1) / seedingBlockSize;
+    size_t b = 0;
+    for(; b + 1 < nBlocks && u >= blockSums[b]; b++)
+    {
+        u -= blockSums[b];
+    }
+
+    size_t iEnd = ((b + 1) * seedingBlockSize < n ? (b + 1) * seedingBlockSize : n);
+    size_t last = b * seedingBlockSize;
+    for(size_t i = b * seedingBlockSize; i < iEnd; i++)
+    {
+        interm value = (weights ? weights[i] * minDist[i] : minDist[i]);
+        if(value <= (interm)0.0) { continue; }
+        if(u < value) { return i; }
+        u -= value;
+        last = i;
+    }
+    return last;
+}
+
+template <typename interm, CpuType cpu>
+void copyObservationDense(const NumericTable *ntData, size_t iRow, interm *dst)
+{
+    size_t p = ntData->getNumberOfColumns();
+    BlockMicroTable<interm, readOnly, cpu> mtData( ntData );
+    interm *data;
+    mtData.getBlockOfRows( iRow, 1, &data );
+    for(size_t j = 0; j < p; j++)
+    {
+        dst[j] = data[j];
+    }
+    mtData.release();
+}
+
+/**
+ *  Converts the observation of the CSR numeric table into the dense centroid
+ */
+template <typename interm, CpuType cpu>
+void copyObservationCSR(const NumericTable *ntDataGen, size_t iRow, interm *dst)
+{
+    CSRNumericTableIface *ntData = dynamic_cast<CSRNumericTableIface *>(const_cast<NumericTable *>(ntDataGen));
+    size_t p = ntDataGen->getNumberOfColumns();
+
+    CSRBlockDescriptor<interm> dataBlock;
+    ntData->getSparseBlock( iRow, 1, readOnly, dataBlock );
+
+    const interm *values = dataBlock.getBlockValuesPtr();
+    const size_t *colIdx = dataBlock.getBlockColumnIndicesPtr();
+    const size_t *rowIdx = dataBlock.getBlockRowIndicesPtr();
+
+    for(size_t j = 0; j < p; j++)
+    {
+        dst[j] = (interm)0.0;
+    }
+    for(size_t l = rowIdx[0] - 1; l < rowIdx[1] - 1; l++)
+    {
+        dst[colIdx[l] - 1] = values[l];
+    }
+
+    ntData->releaseSparseBlock( dataBlock );
+}
+
+template <Method method, typename interm, CpuType cpu>
+void copyObservation(const NumericTable *ntData, size_t iRow, interm *dst)
+{
+    if(method == plusPlusCSR)
+    {
+        copyObservationCSR<interm, cpu>(ntData, iRow, dst);
+    }
+    else
+    {
+        copyObservationDense<interm, cpu>(ntData, iRow, dst);
+    }
+}
+
+/**
+ *  Samples the first centroid with the probability proportional to the weights of the observations
+ *  and initializes the distances to the nearest centroid
+ */
+template <typename interm, CpuType cpu>
+size_t sampleFirstObservation(size_t n, const interm *weights, interm *minDist, interm *blockSums, IntRng<int, cpu> &rng)
+{
+    size_t nBlocks = (n + seedingBlockSize - 1) / seedingBlockSize;
+    for(size_t i = 0; i < n; i++)
+    {
+        minDist[i] = (interm)1.0;
+    }
+    interm total = (interm)0.0;
+    for(size_t b = 0; b < nBlocks; b++)
+    {
+        size_t iEnd = ((b + 1) * seedingBlockSize < n ? (b + 1) * seedingBlockSize : n);
+        blockSums[b] = (interm)0.0;
+        for(size_t i = b * seedingBlockSize; i < iEnd; i++)
+        {
+            blockSums[b] += (weights ? weights[i] : (interm)1.0);
+        }
+        total += blockSums[b];
+    }
+
+    size_t iFirst = sampleObservation<interm, cpu>(n, weights, minDist, blockSums, total, rng);
+
+    for(size_t i = 0; i < n; i++)
+    {
+        minDist[i] = data_feature_utils::internal::MaxVal<interm, cpu>::get();
+    }
+    return iFirst;
+}
+
+/**
+ *  Chooses nClusters centroids with the k-means++ algorithm:
+ *  every next centroid is sampled with the probability proportional to the (weighted)
+ *  squared distance from the observation to the nearest centroid chosen so far
+ */
+template <Method method, typename interm, CpuType cpu>
+bool initPlusPlus(const NumericTable *ntData, const interm *weights, size_t nClusters, unsigned int seed,
+                  interm *clusters, size_t &clustersFound)
+{
+    size_t n = ntData->getNumberOfRows();
+    size_t p = ntData->getNumberOfColumns();
+    size_t nBlocks = (n + seedingBlockSize - 1) / seedingBlockSize;
+
+    interm *minDist   = service_malloc<interm, cpu>(n);
+    interm *blockSums = service_malloc<interm, cpu>(nBlocks);
+    if(!minDist || !blockSums)
+    {
+        if(minDist)   { service_free<interm, cpu>(minDist);   }
+        if(blockSums) { service_free<interm, cpu>(blockSums); }
+        return false;
+    }
+
+    IntRng<int, cpu> rng(seed);
+
+    size_t iFirst = sampleFirstObservation<interm, cpu>(n, weights, minDist, blockSums, rng);
+    copyObservation<method, interm, cpu>(ntData, iFirst, clusters);
+
+    bool ok = true;
+    size_t k = 1;
+    for(; k < nClusters; k++)
+    {
+        interm total = updateMinDistances<method, interm, cpu>(ntData, weights, clusters, k - 1, 1, minDist, 0, blockSums);
+        if(total < (interm)0.0) { ok = false; break; }
+        if(total == (interm)0.0) { break; }
+
+        size_t iRow = sampleObservation<interm, cpu>(n, weights, minDist, blockSums, total, rng);
+        copyObservation<method, interm, cpu>(ntData, iRow, clusters + k * p);
+    }
+    clustersFound = k;
+
+    service_free<interm, cpu>(minDist);
+    service_free<interm, cpu>(blockSums);
+    return ok;
+}
+
+/**
+ *  Computes candidate centroids with the k-means|| algorithm: in every round nPerRound observations
+ *  are sampled with the probability proportional to the squared distance to the nearest candidate.
+ *  Weights of the candidates are the numbers of observations closest to them.
+ */
+template <typename interm, CpuType cpu>
+bool initParallelPlusCandidates(const NumericTable *ntData, size_t nPerRound, size_t nRounds, unsigned int seed,
+                                size_t maxCandidates, interm *candidates, interm *candidateWeights, size_t &nCandidates)
+{
+    size_t n = ntData->getNumberOfRows();
+    size_t p = ntData->getNumberOfColumns();
+    size_t nBlocks = (n + seedingBlockSize - 1) / seedingBlockSize;
+
+    interm *minDist   = service_malloc<interm, cpu>(n);
+    interm *blockSums = service_malloc<interm, cpu>(nBlocks);
+    int    *nearest   = service_malloc<int, cpu>(n);
+    size_t *sampled   = service_malloc<size_t, cpu>(nPerRound);
+    if(!minDist || !blockSums || !nearest || !sampled)
+    {
+        if(minDist)   { service_free<interm, cpu>(minDist);   }
+        if(blockSums) { service_free<interm, cpu>(blockSums); }
+        if(nearest)   { service_free<int, cpu>(nearest);      }
+        if(sampled)   { service_free<size_t, cpu>(sampled);   }
+        return false;
+    }
+
+    IntRng<int, cpu> rng(seed);
+
+    size_t iFirst = sampleFirstObservation<interm, cpu>(n, 0, minDist, blockSums, rng);
+    copyObservation<parallelPlusDense, interm, cpu>(ntData, iFirst, candidates);
+    nCandidates = 1;
+
+    interm total = updateMinDistances<parallelPlusDense, interm, cpu>(ntData, 0, candidates, 0, 1, minDist, nearest, blockSums);
+
+    for(size_t round = 0; round < nRounds && total > (interm)0.0 && nCandidates < maxCandidates; round++)
+    {
+        /* All candidates of the round are sampled with the distances of the previous round */
+        size_t nNew = 0;
+        for(size_t s = 0; s < nPerRound && nCandidates + nNew < maxCandidates; s++)
+        {
+            size_t iRow = sampleObservation<interm, cpu>(n, 0, minDist, blockSums, total, rng);
+
+            bool duplicate = false;
+            for(size_t j = 0; j < nNew; j++)
+            {
+                if(sampled[j] == iRow) { duplicate = true; break; }
+            }
+            if(duplicate) { continue; }
+
+            sampled[nNew] = iRow;
+            copyObservation<parallelPlusDense, interm, cpu>(ntData, iRow, candidates + (nCandidates + nNew) * p);
+            nNew++;
+        }
+
+        total = updateMinDistances<parallelPlusDense, interm, cpu>(ntData, 0, candidates, nCandidates, nNew, minDist, nearest, blockSums);
+        nCandidates += nNew;
+    }
+
+    for(size_t k = 0; k < nCandidates; k++)
+    {
+        candidateWeights[k] = (interm)0.0;
+    }
+    for(size_t i = 0; i < n; i++)
+    {
+        candidateWeights[nearest[i]] += (interm)1.0;
+    }
+
+    service_free<interm, cpu>(minDist);
+    service_free<interm, cpu>(blockSums);
+    service_free<int, cpu>(nearest);
+    service_free<size_t, cpu>(sampled);
+    return true;
+}
+
+/**
+ *  Reduces weighted candidate centroids to nClusters centroids with the weighted k-means++ algorithm
+ */
+template <typename interm, CpuType cpu>
+bool reduceCandidates(size_t p, size_t nCandidates, interm *candidates, const interm *candidateWeights, size_t nClusters,
+                      unsigned int seed, interm *clusters, size_t &clustersFound)
+{
+    if(nCandidates <= nClusters)
+    {
+        for(size_t j = 0; j < nCandidates * p; j++)
+        {
+            clusters[j] = candidates[j];
+        }
+        clustersFound = nCandidates;
+        return true;
+    }
+
+    HomogenNumericTable<interm> ntCandidates(candidates, p, nCandidates);
+    return initPlusPlus<plusPlusDense, interm, cpu>(&ntCandidates, candidateWeights, nClusters, seed, clusters, clustersFound);
+}
+
 template <Method method, typename interm, CpuType cpu>
 bool init( size_t p, size_t n, size_t nRowsTotal, size_t nClusters, size_t offset, interm *clusters,
     BlockMicroTable<interm, readOnly, cpu> &mtData, unsigned int seed, size_t& clustersFound)
@@ -138,12 +559,38 @@ void KMeansinitKernel<method, interm, cpu>::compute( size_t na, const NumericTab
     mtClusters.getBlockOfRows( 0, nClusters, &clusters );
 
     size_t clustersFound = 0;
-    if( !init<method, interm, cpu>( p, n, n, nClusters, 0, clusters, mtData, par->seed, clustersFound) )
+    bool ok;
+    if(method == plusPlusDense || method == plusPlusCSR)
     {
-        this->_errors->add(services::ErrorMemoryAllocationFailed); return;
+        ok = initPlusPlus<method, interm, cpu>( ntData, 0, nClusters, par->seed, clusters, clustersFound );
+    }
+    else if(method == parallelPlusDense)
+    {
+        size_t maxCandidates = par->getNumberOfCandidates(parallelPlusDense);
+        interm *candidates       = service_malloc<interm, cpu>( maxCandidates * p );
+        interm *candidateWeights = service_malloc<interm, cpu>( maxCandidates );
+
+        size_t nCandidates = 0;
+        ok = (candidates && candidateWeights);
+        ok = ok && initParallelPlusCandidates<interm, cpu>( ntData, par->getNumberOfCandidatesPerRound(), par->nRounds, par->seed,
+                                                            maxCandidates, candidates, candidateWeights, nCandidates );
+        ok = ok && reduceCandidates<interm, cpu>( p, nCandidates, candidates, candidateWeights, nClusters, par->seed,
+                                                  clusters, clustersFound );
+
+        if(candidates)       { service_free<interm, cpu>( candidates );       }
+        if(candidateWeights) { service_free<interm, cpu>( candidateWeights ); }
+    }
+    else
+    {
+        ok = init<method, interm, cpu>( p, n, n, nClusters, 0, clusters, mtData, par->seed, clustersFound);
     }
 
     mtClusters.release();
+
+    if( !ok )
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed); return;
+    }
 }
 
 template <Method method, typename interm, CpuType cpu>
@@ -197,7 +644,7 @@ void KMeansinitStep2MasterKernel<method, interm, cpu>::compute( size_t na, const
     NumericTable *ntClustersN= const_cast<NumericTable *>( r[0] );
     NumericTable *ntClusters = const_cast<NumericTable *>( r[1] );
 
-    size_t nBlocks = na / 2;
+    size_t nBlocks = na / 3;
     size_t p = r[1]->getNumberOfColumns();
     size_t nClusters = par->nClusters;
 
@@ -214,8 +661,8 @@ void KMeansinitStep2MasterKernel<method, interm, cpu>::compute( size_t na, const
 
     for( size_t i = 0; i<nBlocks; i++ )
     {
-        BlockMicroTable<int,    readOnly, cpu> mtInClustersN( a[i*2 + 0] );
-        BlockMicroTable<interm, readOnly, cpu> mtInClusters ( a[i*2 + 1] );
+        BlockMicroTable<int,    readOnly, cpu> mtInClustersN( a[i*3 + 0] );
+        BlockMicroTable<interm, readOnly, cpu> mtInClusters ( a[i*3 + 1] );
 
         int    *inClustersN;
         interm *inClusters;
@@ -243,9 +690,8 @@ void KMeansinitStep2MasterKernel<method, interm, cpu>::compute( size_t na, const
     mtClusters.release();
 }
 
-template <Method method, typename interm, CpuType cpu>
-void KMeansinitStep2MasterKernel<method, interm, cpu>::finalizeCompute( size_t na, const NumericTable *const *a,
-                                                                              size_t nr, const NumericTable *const *r, const Parameter *par)
+template <typename interm, CpuType cpu>
+void finalizeClusters( size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par)
 {
     NumericTable *ntInClusters  = const_cast<NumericTable *>( a[1] );
     NumericTable *ntClusters    = const_cast<NumericTable *>( r[0] );
@@ -274,6 +720,142 @@ void KMeansinitStep2MasterKernel<method, interm, cpu>::finalizeCompute( size_t n
     mtClusters.release();
 }
 
+template <Method method, typename interm, CpuType cpu>
+void KMeansinitStep2MasterKernel<method, interm, cpu>::finalizeCompute( size_t na, const NumericTable *const *a,
+                                                                              size_t nr, const NumericTable *const *r, const Parameter *par)
+{
+    finalizeClusters<interm, cpu>( na, a, nr, r, par );
+}
+
+template <typename interm, CpuType cpu>
+void KMeansinitStep1LocalKernel<parallelPlusDense, interm, cpu>::compute( size_t na, const NumericTable *const *a,
+                                                                          size_t nr, const NumericTable *const *r, const Parameter *par)
+{
+    NumericTable *ntData      = const_cast<NumericTable *>( a[0] );
+    NumericTable *ntClustersN = const_cast<NumericTable *>( r[0] );
+    NumericTable *ntClusters  = const_cast<NumericTable *>( r[1] );
+    NumericTable *ntWeights   = const_cast<NumericTable *>( r[2] );
+
+    size_t maxCandidates = ntClusters->getNumberOfRows();
+
+    BlockMicroTable<interm, writeOnly, cpu> mtClusters( ntClusters );
+    BlockMicroTable<interm, writeOnly, cpu> mtWeights( ntWeights );
+    BlockMicroTable<int, writeOnly, cpu> mtClustersN( ntClustersN );
+
+    int    *clustersN;
+    interm *clusters;
+    interm *weights;
+
+    mtClusters.getBlockOfRows( 0, maxCandidates, &clusters );
+    mtWeights.getBlockOfRows( 0, maxCandidates, &weights );
+    mtClustersN.getBlockOfRows( 0, 1, &clustersN );
+
+    /* Local nodes sample candidates independently, so their seeds have to differ */
+    size_t nCandidates = 0;
+    if( !initParallelPlusCandidates<interm, cpu>( ntData, par->getNumberOfCandidatesPerRound(), par->nRounds,
+                                                  (unsigned int)(par->seed + par->offset), maxCandidates, clusters, weights, nCandidates ) )
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+    *clustersN = (int)nCandidates;
+
+    mtClustersN.release();
+    mtWeights.release();
+    mtClusters.release();
+}
+
+template <typename interm, CpuType cpu>
+void KMeansinitStep2MasterKernel<parallelPlusDense, interm, cpu>::compute( size_t na, const NumericTable *const *a,
+                                                                           size_t nr, const NumericTable *const *r, const Parameter *par)
+{
+    NumericTable *ntClustersN= const_cast<NumericTable *>( r[0] );
+    NumericTable *ntClusters = const_cast<NumericTable *>( r[1] );
+
+    size_t nBlocks = na / 3;
+    size_t p = r[1]->getNumberOfColumns();
+    size_t nClusters = par->nClusters;
+
+    size_t nCandidates = 0;
+    for( size_t i = 0; i<nBlocks; i++ )
+    {
+        BlockMicroTable<int, readOnly, cpu> mtInClustersN( a[i*3 + 0] );
+        int *inClustersN;
+        mtInClustersN.getBlockOfRows( 0, 1, &inClustersN );
+        nCandidates += *inClustersN;
+        mtInClustersN.release();
+    }
+
+    interm *candidates       = service_malloc<interm, cpu>( nCandidates * p );
+    interm *candidateWeights = service_malloc<interm, cpu>( nCandidates );
+    if( !candidates || !candidateWeights )
+    {
+        if(candidates)       { service_free<interm, cpu>( candidates );       }
+        if(candidateWeights) { service_free<interm, cpu>( candidateWeights ); }
+        this->_errors->add(services::ErrorMemoryAllocationFailed); return;
+    }
+
+    size_t k = 0;
+    for( size_t i = 0; i<nBlocks; i++ )
+    {
+        BlockMicroTable<int,    readOnly, cpu> mtInClustersN( a[i*3 + 0] );
+        BlockMicroTable<interm, readOnly, cpu> mtInClusters ( a[i*3 + 1] );
+        BlockMicroTable<interm, readOnly, cpu> mtInWeights  ( a[i*3 + 2] );
+
+        int    *inClustersN;
+        interm *inClusters;
+        interm *inWeights;
+
+        mtInClustersN.getBlockOfRows( 0, 1, &inClustersN );
+        size_t inK = *inClustersN;
+
+        mtInClusters.getBlockOfRows( 0, inK, &inClusters );
+        mtInWeights.getBlockOfRows( 0, inK, &inWeights );
+
+        for( size_t j=0; j<inK; j++ )
+        {
+            for( size_t h=0; h<p; h++ )
+            {
+                candidates[k*p + h] = inClusters[j*p + h];
+            }
+            candidateWeights[k] = inWeights[j];
+            k++;
+        }
+
+        mtInClustersN.release();
+        mtInClusters.release();
+        mtInWeights.release();
+    }
+
+    BlockMicroTable<interm, writeOnly, cpu> mtClusters( ntClusters );
+    BlockMicroTable<int, writeOnly, cpu> mtClustersN( ntClustersN );
+
+    int    *clustersN;
+    interm *clusters;
+
+    mtClusters.getBlockOfRows( 0, nClusters, &clusters );
+    mtClustersN.getBlockOfRows( 0, 1, &clustersN );
+
+    size_t clustersFound = 0;
+    if( !reduceCandidates<interm, cpu>( p, nCandidates, candidates, candidateWeights, nClusters, par->seed, clusters, clustersFound ) )
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+    *clustersN = (int)clustersFound;
+
+    mtClustersN.release();
+    mtClusters.release();
+
+    service_free<interm, cpu>( candidates );
+    service_free<interm, cpu>( candidateWeights );
+}
+
+template <typename interm, CpuType cpu>
+void KMeansinitStep2MasterKernel<parallelPlusDense, interm, cpu>::finalizeCompute( size_t na, const NumericTable *const *a,
+                                                                                   size_t nr, const NumericTable *const *r, const Parameter *par)
+{
+    finalizeClusters<interm, cpu>( na, a, nr, r, par );
+}
+
 } // namespace daal::algorithms::kmeans::init::internal
 } // namespace daal::algorithms::kmeans::init
 } // namespace daal::algorithms::kmeans
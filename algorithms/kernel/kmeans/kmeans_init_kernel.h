@@ -64,6 +64,22 @@ public:
     void finalizeCompute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par);
 };
 
+template <typename interm, CpuType cpu>
+class KMeansinitStep1LocalKernel<parallelPlusDense, interm, cpu>: public Kernel
+{
+public:
+    void compute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par);
+    void finalizeCompute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par) {}
+};
+
+template <typename interm, CpuType cpu>
+class KMeansinitStep2MasterKernel<parallelPlusDense, interm, cpu>: public Kernel
+{
+public:
+    void compute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par);
+    void finalizeCompute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par);
+};
+
 } // namespace daal::algorithms::kmeans::init::internal
 } // namespace daal::algorithms::kmeans::init
 } // namespace daal::algorithms::kmeans
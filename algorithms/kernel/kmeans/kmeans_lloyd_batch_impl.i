@@ -112,22 +112,21 @@ void KMeansBatchKernel<method, interm, cpu>::compute( size_t na, const NumericTa
     size_t kIter;
     interm oldTargetFunc = (interm)0.0;
 
+    /* The task and its thread local buffers are reused by all iterations */
+    void *task = kmeansInitTask<interm, cpu>(p, nClusters, inClusters, this->_errors);
+    if(!task){ daal::services::daal_free( clusterS0 ); daal::services::daal_free( clusterS1 ); return; }
+
     for(kIter = 0; kIter < nIter; kIter++)
     {
-        void *task = kmeansInitTask<interm, cpu>(p, nClusters, inClusters, this->_errors);
-        if(!task){ daal::services::daal_free( clusterS0 ); daal::services::daal_free( clusterS1 ); return; }
+        if(kIter > 0)
+        {
+            kmeansResetTask<interm, cpu>(task, inClusters);
+        }
 
         addNTToTaskThreaded<method, interm, cpu, 0>(task, ntData, catCoef );
 
-        for (size_t i = 0; i < nClusters; i++)
-        {
-            for (size_t j = 0; j < p; j++)
-            {
-                clusterS1[i * p + j] = 0.0;
-            }
-
-            clusterS0[i] = kmeansUpdateCluster<interm, cpu>( task, i, &clusterS1[i * p] );
-        }
+        interm newTargetFunc = (interm)0.0;
+        kmeansReduceClusters<interm, size_t, cpu>(task, clusterS0, clusterS1, &newTargetFunc);
 
         for (size_t i = 0; i < nClusters; i++)
         {
@@ -144,35 +143,26 @@ void KMeansBatchKernel<method, interm, cpu>::compute( size_t na, const NumericTa
 
         if ( par->accuracyThreshold > (interm)0.0 )
         {
-            interm newTargetFunc = (interm)0.0;
-
-            kmeansClearClusters<interm, cpu>(task, &newTargetFunc);
-
             if ( __DAAL_FABS(oldTargetFunc - newTargetFunc) < par->accuracyThreshold )
             {
                 kIter++;
                 break;
             }
-
-            oldTargetFunc = newTargetFunc;
-        }
-        else
-        {
-            kmeansClearClusters<interm, cpu>(task, &oldTargetFunc);
         }
 
+        oldTargetFunc = newTargetFunc;
+
         inClusters = clusters;
     }
 
     if( par->assignFlag )
     {
-        void *task = kmeansInitTask<interm, cpu>(p, nClusters, clusters, this->_errors);
-        if(!task){ daal::services::daal_free( clusterS0 ); daal::services::daal_free( clusterS1 ); return; }
-
+        kmeansResetTask<interm, cpu>(task, clusters);
         getNTAssignmentsThreaded<method, interm, cpu>(task, ntData, r[1], catCoef);
-        kmeansClearClusters<interm, cpu>(task, 0);
     }
 
+    kmeansClearClusters<interm, cpu>(task, 0);
+
     daal::services::daal_free( clusterS0 );
     daal::services::daal_free( clusterS1 );
 
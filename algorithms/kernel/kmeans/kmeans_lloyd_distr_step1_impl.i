@@ -131,16 +131,8 @@ void KMeansDistributedStep1Kernel<method, interm, cpu>::compute( size_t na, cons
             addNTToTaskThreaded<method, interm, cpu, 0>(task, ntData, catCoef);
         }
 
-        for (size_t i = 0; i < nClusters; i++)
-        {
-            for (size_t j = 0; j < p; j++)
-            {
-                clusterS1[i * p + j] = 0.0;
-            }
-
-            clusterS0[i] = kmeansUpdateCluster<interm, cpu>( task, i, &clusterS1[i * p] );
-        }
-        kmeansClearClusters<interm, cpu>(task, goalFunc);
+        kmeansReduceClusters<interm, int, cpu>(task, clusterS0, clusterS1, goalFunc);
+        kmeansClearClusters<interm, cpu>(task, 0);
     }
 
     if (catFlag)
@@ -0,0 +1,584 @@
+/* file: kmeans_lloyd_elkan_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of Lloyd method for K-means algorithm accelerated with
+//  the triangle inequality.
+//
+//  Every observation keeps an upper bound of the distance to its centroid
+//  and a lower bound of the distance to the second closest centroid
+//  (Hamerly variant of the Elkan bounds, which needs O(n) memory instead
+//  of O(n*nClusters)). The bounds are relaxed by the centroid drifts after
+//  each iteration; observations with upper <= max(lower, s[a]), where s[a]
+//  is a half of the distance from centroid a to the nearest other centroid,
+//  keep their assignments without any distance computations. Cluster sums
+//  are updated incrementally with the observations that change clusters.
+//
+//  Categorical features are weighted with gamma. The weighted distance is
+//  the Euclidean distance between the observations and the centroids scaled
+//  by sqrt(gamma) in the categorical coordinates, so distances and bounds are
+//  computed in the scaled space while cluster sums use the original values.
+//--
+*/
+
+#include "algorithm.h"
+#include "numeric_table.h"
+#include "threading.h"
+#include "daal_defines.h"
+#include "service_memory.h"
+#include "service_micro_table.h"
+#include "service_math.h"
+#include "service_data_utils.h"
+
+#include "kmeans_lloyd_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+
+#define __DAAL_FABS(a) (((a)>(interm)0.0)?(a):(-(a)))
+
+template<typename interm, CpuType cpu>
+struct tls_elkan_task_t
+{
+    interm* rows;      /* Observations of the block that need distance computations */
+    size_t* rowIdx;    /* Indices of these observations in the block */
+};
+
+template<typename interm, CpuType cpu>
+daal::tls<tls_elkan_task_t<interm,cpu>*> * kmeansElkanInitTls(size_t dim, size_t blockSize,
+                                                             services::SharedPtr<services::KernelErrorCollection> &_errors)
+{
+    return new daal::tls<tls_elkan_task_t<interm,cpu>*>( [=]()-> tls_elkan_task_t<interm,cpu>*
+    {
+        tls_elkan_task_t<interm,cpu>* tt = new tls_elkan_task_t<interm,cpu>;
+        if(!tt)
+        {
+            _errors->add(services::ErrorMemoryAllocationFailed);
+            return 0;
+        }
+
+        tt->rows   = service_malloc<interm,cpu>(blockSize*dim);
+        tt->rowIdx = service_malloc<size_t,cpu>(blockSize);
+        if(!tt->rows || !tt->rowIdx)
+        {
+            _errors->add(services::ErrorMemoryAllocationFailed);
+            if(tt->rows)   { service_free<interm,cpu>(tt->rows);   }
+            if(tt->rowIdx) { service_free<size_t,cpu>(tt->rowIdx); }
+            delete tt;
+            return 0;
+        }
+
+        return tt;
+    } );
+}
+
+template<typename interm, CpuType cpu>
+void kmeansElkanClearTls(daal::tls<tls_elkan_task_t<interm,cpu>*> *tls)
+{
+    tls->reduce( [=](tls_elkan_task_t<interm,cpu> *tt)-> void
+    {
+        if(!tt) { return; }
+        service_free<interm,cpu>( tt->rows );
+        service_free<size_t,cpu>( tt->rowIdx );
+        delete tt;
+    } );
+    delete tls;
+}
+
+/**
+ *  Computes s[k], a half of the distance from the centroid k to the nearest other centroid
+ */
+template<typename interm, CpuType cpu>
+void kmeansElkanHalfMinDistances(size_t dim, size_t clNum, const interm *centroids, interm *halfMinDist)
+{
+    daal::threader_for( clNum, clNum, [=](size_t k)
+    {
+        interm minDist = data_feature_utils::internal::MaxVal<interm, cpu>::get();
+        for(size_t l = 0; l < clNum; l++)
+        {
+            if(l == k) { continue; }
+
+            interm dist = (interm)0.0;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < dim; j++)
+            {
+                interm diff = centroids[k*dim + j] - centroids[l*dim + j];
+                dist += diff * diff;
+            }
+            if(dist < minDist) { minDist = dist; }
+        }
+        halfMinDist[k] = (interm)0.5 * Math<interm,cpu>::sSqrt(minDist);
+    } );
+}
+
+/**
+ *  Assigns observations of the data set to the centroids of the task.
+ *  Observations whose bounds prove that the assignment does not change are skipped,
+ *  distances for the rest are computed with GEMM on the gathered rows.
+ *  Changes of cluster sums are accumulated in the thread local buffers of the task.
+ */
+template<typename interm, CpuType cpu>
+void addNTToTaskThreadedElkan(void * task_id, daal::tls<tls_elkan_task_t<interm,cpu>*> *elkanTls, const NumericTable * ntData,
+                              const interm *catScale, int *assign, interm *upper, interm *lower, const interm *halfMinDist)
+{
+    struct task_t<interm,cpu> * t  = static_cast<task_t<interm,cpu> *>(task_id);
+
+    size_t n = ntData->getNumberOfRows();
+
+    size_t blockSizeDeafult = t->max_block_size;
+
+    daal::threader_for_blocked_size( n, blockSizeDeafult, daal::threader_get_threads_number(),
+                                     [=](size_t iStart, size_t iEnd)
+    {
+        struct tls_task_t<interm,cpu> * tt = t->tls_task->local();
+        struct tls_elkan_task_t<interm,cpu> * te = elkanTls->local();
+        size_t blockSize = iEnd - iStart;
+
+        BlockMicroTable<interm, readOnly,  cpu> mtData( ntData );
+        interm* data;
+
+        size_t p           = t->dim;
+        size_t nClusters   = t->clNum;
+        interm* inClusters = t->cCenters;
+        interm* clustersSq = t->clSq;
+        int*    cS0        = tt->cS0;
+        interm* cS1        = tt->cS1;
+        interm* x_clusters = tt->mkl_buff;
+        interm* rows       = te->rows;
+        size_t* rowIdx     = te->rowIdx;
+
+        mtData.getBlockOfRows( iStart, blockSize, &data );
+
+        size_t nActive = 0;
+        for (size_t i = 0; i < blockSize; i++)
+        {
+            size_t iRow = iStart + i;
+            int a = assign[iRow];
+            const interm *x = data + i*p;
+
+            if( a >= 0 )
+            {
+                interm bound = (halfMinDist[a] > lower[iRow] ? halfMinDist[a] : lower[iRow]);
+                if( upper[iRow] <= bound ) { continue; }
+
+                /* Tighten the upper bound with the exact distance to the assigned centroid */
+                const interm *c = inClusters + a*p;
+                interm dist = (interm)0.0;
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; j++)
+                {
+                    interm diff = x[j] * catScale[j] - c[j];
+                    dist += diff * diff;
+                }
+                upper[iRow] = Math<interm,cpu>::sSqrt(dist);
+                if( upper[iRow] <= bound ) { continue; }
+            }
+
+          PRAGMA_IVDEP
+            for (size_t j = 0; j < p; j++)
+            {
+                rows[nActive*p + j] = x[j] * catScale[j];
+            }
+            rowIdx[nActive] = i;
+            nActive++;
+        }
+
+        if( nActive > 0 )
+        {
+            char transa = 't';
+            char transb = 'n';
+            MKL_INT _m = nClusters;
+            MKL_INT _n = nActive;
+            MKL_INT _k = p;
+            interm alpha = 1.0;
+            MKL_INT lda = p;
+            MKL_INT ldy = p;
+            interm beta = 0.0;
+            MKL_INT ldaty = nClusters;
+
+            Blas<interm, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &alpha, inClusters,
+                &lda, rows, &ldy, &beta, x_clusters, &ldaty);
+        }
+
+        for (size_t r = 0; r < nActive; r++)
+        {
+            size_t iRow = iStart + rowIdx[r];
+            const interm *xScaled = rows + r*p;
+            const interm *x = data + rowIdx[r]*p;
+
+            interm minGoalVal    = clustersSq[0] - x_clusters[r*nClusters];
+            interm secondGoalVal = data_feature_utils::internal::MaxVal<interm, cpu>::get();
+            size_t minIdx = 0;
+
+            for (size_t j = 1; j < nClusters; j++)
+            {
+                interm goalVal = clustersSq[j] - x_clusters[r*nClusters + j];
+                if( goalVal < minGoalVal )
+                {
+                    secondGoalVal = minGoalVal;
+                    minGoalVal = goalVal;
+                    minIdx = j;
+                }
+                else if( goalVal < secondGoalVal )
+                {
+                    secondGoalVal = goalVal;
+                }
+            }
+
+            interm xSq = (interm)0.0;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < p; j++)
+            {
+                xSq += xScaled[j] * xScaled[j];
+            }
+
+            interm minDist = xSq + 2.0 * minGoalVal;
+            upper[iRow] = (minDist > (interm)0.0 ? Math<interm,cpu>::sSqrt(minDist) : (interm)0.0);
+
+            if( nClusters > 1 )
+            {
+                interm secondDist = xSq + 2.0 * secondGoalVal;
+                lower[iRow] = (secondDist > (interm)0.0 ? Math<interm,cpu>::sSqrt(secondDist) : (interm)0.0);
+            }
+            else
+            {
+                lower[iRow] = data_feature_utils::internal::MaxVal<interm, cpu>::get();
+            }
+
+            int a = assign[iRow];
+            if( a == (int)minIdx ) { continue; }
+
+            if( a >= 0 )
+            {
+                cS0[a]--;
+              PRAGMA_IVDEP
+                for (size_t j = 0; j < p; j++)
+                {
+                    cS1[a * p + j] -= x[j];
+                }
+            }
+            else
+            {
+                /* First assignment of the observation: accumulate the sum of squared norms */
+                tt->goalFunc += xSq;
+            }
+
+            cS0[minIdx]++;
+          PRAGMA_IVDEP
+            for (size_t j = 0; j < p; j++)
+            {
+                cS1[minIdx * p + j] += x[j];
+            }
+
+            assign[iRow] = (int)minIdx;
+        }
+
+        mtData.release();
+
+    } ); /* daal::threader_for_blocked_size( n, blockSizeDeafult, ... ) */
+}
+
+/**
+ *  Relaxes the bounds of the observations with the drifts of the centroids
+ */
+template<typename interm, CpuType cpu>
+void kmeansElkanUpdateBounds(size_t n, size_t blockSize, const interm *drift, interm maxDrift, interm secondDrift,
+                             size_t maxDriftIdx, const int *assign, interm *upper, interm *lower)
+{
+    daal::threader_for_blocked_size( n, blockSize, daal::threader_get_threads_number(),
+                                     [=](size_t iStart, size_t iEnd)
+    {
+        for (size_t i = iStart; i < iEnd; i++)
+        {
+            size_t a = (size_t)assign[i];
+            upper[i] += drift[a];
+            lower[i] -= (a == maxDriftIdx ? secondDrift : maxDrift);
+        }
+    } );
+}
+
+template <typename interm, CpuType cpu>
+void KMeansBatchKernel<lloydElkanDense, interm, cpu>::compute( size_t na, const NumericTable *const *a,
+                                                                size_t nr, const NumericTable *const *r, const Parameter *par)
+{
+    NumericTable *ntData     = const_cast<NumericTable *>( a[0] );
+
+    size_t nIter = par->maxIterations;
+
+    size_t p = ntData->getNumberOfColumns();
+    size_t n = ntData->getNumberOfRows();
+    size_t nClusters = par->nClusters;
+
+    interm *clusterS1   = service_calloc<interm,cpu>( nClusters * p );
+    interm *deltaS1     = service_malloc<interm,cpu>( nClusters * p );
+    interm *centroids   = service_malloc<interm,cpu>( nClusters * p );
+    interm *scaledCent  = service_malloc<interm,cpu>( nClusters * p );
+    interm *catCoef     = service_malloc<interm,cpu>( p );
+    interm *catScale    = service_malloc<interm,cpu>( p );
+    int    *clusterS0   = service_calloc<int,cpu>( nClusters );
+    int    *deltaS0     = service_malloc<int,cpu>( nClusters );
+    interm *halfMinDist = service_malloc<interm,cpu>( nClusters );
+    interm *drift       = service_malloc<interm,cpu>( nClusters );
+    int    *assign      = service_malloc<int,cpu>( n );
+    interm *upper       = service_malloc<interm,cpu>( n );
+    interm *lower       = service_malloc<interm,cpu>( n );
+
+    if(!clusterS1 || !deltaS1 || !centroids || !scaledCent || !catCoef || !catScale ||
+       !clusterS0 || !deltaS0 || !halfMinDist || !drift || !assign || !upper || !lower)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        if(clusterS1)   { service_free<interm,cpu>( clusterS1 );   }
+        if(deltaS1)     { service_free<interm,cpu>( deltaS1 );     }
+        if(centroids)   { service_free<interm,cpu>( centroids );   }
+        if(scaledCent)  { service_free<interm,cpu>( scaledCent );  }
+        if(catCoef)     { service_free<interm,cpu>( catCoef );     }
+        if(catScale)    { service_free<interm,cpu>( catScale );    }
+        if(clusterS0)   { service_free<int,cpu>( clusterS0 );      }
+        if(deltaS0)     { service_free<int,cpu>( deltaS0 );        }
+        if(halfMinDist) { service_free<interm,cpu>( halfMinDist ); }
+        if(drift)       { service_free<interm,cpu>( drift );       }
+        if(assign)      { service_free<int,cpu>( assign );         }
+        if(upper)       { service_free<interm,cpu>( upper );       }
+        if(lower)       { service_free<interm,cpu>( lower );       }
+        return;
+    }
+
+    /* Categorial variables support: the weights of the features and their square roots */
+    for(size_t j = 0; j < p; j++)
+    {
+        catCoef[j] = (ntData->getFeatureType(j) == data_management::data_feature_utils::DAAL_CATEGORICAL ? (interm)par->gamma : (interm)1.0);
+        catScale[j] = Math<interm,cpu>::sSqrt(catCoef[j]);
+    }
+
+    /* Observations without assignments are always processed with the full distance computation */
+    for(size_t i = 0; i < n; i++)
+    {
+        assign[i] = -1;
+        upper[i]  = data_feature_utils::internal::MaxVal<interm, cpu>::get();
+        lower[i]  = (interm)0.0;
+    }
+
+    BlockMicroTable<interm, readOnly,  cpu> mtInClusters( a[1] );
+    BlockMicroTable<interm, writeOnly, cpu> mtClusters( r[0] );
+
+    interm *inClusters;
+    interm *clusters;
+
+    mtInClusters.getBlockOfRows( 0, nClusters, &inClusters );
+    mtClusters  .getBlockOfRows( 0, nClusters, &clusters   );
+
+    for(size_t i = 0; i < nClusters; i++)
+    {
+        for(size_t j = 0; j < p; j++)
+        {
+            centroids [i * p + j] = inClusters[i * p + j];
+            scaledCent[i * p + j] = inClusters[i * p + j] * catScale[j];
+        }
+    }
+
+    mtInClusters.release();
+
+    size_t kIter;
+    interm oldTargetFunc = (interm)0.0;
+    interm sumXSq = (interm)0.0;
+
+    /* Distances are computed to the centroids in the scaled space */
+    void *task = kmeansInitTask<interm, cpu>(p, nClusters, scaledCent, this->_errors);
+    size_t blockSize = (task ? static_cast<task_t<interm,cpu> *>(task)->max_block_size : 0);
+    daal::tls<tls_elkan_task_t<interm,cpu>*> *elkanTls = (task ? kmeansElkanInitTls<interm, cpu>(p, blockSize, this->_errors) : 0);
+
+    if(!task || !elkanTls)
+    {
+        if(task) { kmeansClearClusters<interm, cpu>(task, 0); }
+        nIter = 0;
+    }
+
+    for(kIter = 0; kIter < nIter; kIter++)
+    {
+        if(kIter > 0)
+        {
+            kmeansResetTask<interm, cpu>(task, scaledCent);
+        }
+
+        kmeansElkanHalfMinDistances<interm, cpu>(p, nClusters, scaledCent, halfMinDist);
+
+        addNTToTaskThreadedElkan<interm, cpu>(task, elkanTls, ntData, catScale, assign, upper, lower, halfMinDist);
+
+        interm sumXSqDelta = (interm)0.0;
+        kmeansReduceClusters<interm, int, cpu>(task, deltaS0, deltaS1, &sumXSqDelta);
+        sumXSq += sumXSqDelta;
+
+        for(size_t i = 0; i < nClusters; i++)
+        {
+            clusterS0[i] += deltaS0[i];
+        }
+        for(size_t j = 0; j < nClusters * p; j++)
+        {
+            clusterS1[j] += deltaS1[j];
+        }
+
+        /* Goal function for the current centroids: sum(|x|^2) - 2 * sum(c * S1) + sum(S0 * |c|^2) with the weighted products */
+        interm newTargetFunc = sumXSq;
+        for(size_t i = 0; i < nClusters; i++)
+        {
+            interm cS1 = (interm)0.0;
+            interm cSq = (interm)0.0;
+            for(size_t j = 0; j < p; j++)
+            {
+                cS1 += catCoef[j] * centroids[i * p + j] * clusterS1[i * p + j];
+                cSq += catCoef[j] * centroids[i * p + j] * centroids[i * p + j];
+            }
+            newTargetFunc += clusterS0[i] * cSq - 2.0 * cS1;
+        }
+
+        interm maxDrift = (interm)0.0;
+        interm secondDrift = (interm)0.0;
+        size_t maxDriftIdx = 0;
+
+        for(size_t i = 0; i < nClusters; i++)
+        {
+            interm dist = (interm)0.0;
+
+            if ( clusterS0[i] > 0 )
+            {
+                interm coeff = 1.0 / clusterS0[i];
+
+                for(size_t j = 0; j < p; j++)
+                {
+                    interm c = clusterS1[i * p + j] * coeff;
+                    interm diff = c - centroids[i * p + j];
+                    dist += catCoef[j] * diff * diff;
+                    clusters[i * p + j] = c;
+                }
+            }
+            else
+            {
+                for(size_t j = 0; j < p; j++)
+                {
+                    clusters[i * p + j] = centroids[i * p + j];
+                }
+            }
+
+            drift[i] = Math<interm,cpu>::sSqrt(dist);
+
+            if( drift[i] > maxDrift )
+            {
+                secondDrift = maxDrift;
+                maxDrift = drift[i];
+                maxDriftIdx = i;
+            }
+            else if( drift[i] > secondDrift )
+            {
+                secondDrift = drift[i];
+            }
+        }
+
+        for(size_t i = 0; i < nClusters; i++)
+        {
+            for(size_t j = 0; j < p; j++)
+            {
+                centroids [i * p + j] = clusters[i * p + j];
+                scaledCent[i * p + j] = clusters[i * p + j] * catScale[j];
+            }
+        }
+
+        kmeansElkanUpdateBounds<interm, cpu>(n, blockSize, drift, maxDrift, secondDrift, maxDriftIdx, assign, upper, lower);
+
+        if ( par->accuracyThreshold > (interm)0.0 )
+        {
+            if ( __DAAL_FABS(oldTargetFunc - newTargetFunc) < par->accuracyThreshold )
+            {
+                kIter++;
+                break;
+            }
+        }
+
+        oldTargetFunc = newTargetFunc;
+    }
+
+    if( task && elkanTls )
+    {
+        if( par->assignFlag && nIter > 0 )
+        {
+            kmeansResetTask<interm, cpu>(task, scaledCent);
+            kmeansElkanHalfMinDistances<interm, cpu>(p, nClusters, scaledCent, halfMinDist);
+            addNTToTaskThreadedElkan<interm, cpu>(task, elkanTls, ntData, catScale, assign, upper, lower, halfMinDist);
+
+            BlockMicroTable<int, writeOnly, cpu> mtAssign( r[1] );
+            int *assignments;
+            mtAssign.getBlockOfRows( 0, n, &assignments );
+            for(size_t i = 0; i < n; i++)
+            {
+                assignments[i] = assign[i];
+            }
+            mtAssign.release();
+        }
+
+        kmeansClearClusters<interm, cpu>(task, 0);
+    }
+
+    if( elkanTls )
+    {
+        kmeansElkanClearTls<interm, cpu>(elkanTls);
+    }
+
+    service_free<interm,cpu>( clusterS1 );
+    service_free<interm,cpu>( deltaS1 );
+    service_free<interm,cpu>( centroids );
+    service_free<interm,cpu>( scaledCent );
+    service_free<interm,cpu>( catCoef );
+    service_free<interm,cpu>( catScale );
+    service_free<int,cpu>( clusterS0 );
+    service_free<int,cpu>( deltaS0 );
+    service_free<interm,cpu>( halfMinDist );
+    service_free<interm,cpu>( drift );
+    service_free<int,cpu>( assign );
+    service_free<interm,cpu>( upper );
+    service_free<interm,cpu>( lower );
+
+    mtClusters.release();
+
+    int* nIterations;
+    BlockMicroTable<int, writeOnly, cpu> mtIterations( r[3] );
+    mtIterations.getBlockOfRows(0, 1, &nIterations);
+    *nIterations = kIter;
+    mtIterations.release();
+
+    interm* goal;
+    BlockMicroTable<interm, writeOnly, cpu> mtTarget( r[2] );
+    mtTarget.getBlockOfRows(0, 1, &goal);
+    *goal = oldTargetFunc;
+    mtTarget.release();
+}
+
+} // namespace daal::algorithms::kmeans::internal
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
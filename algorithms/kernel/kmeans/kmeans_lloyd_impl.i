@@ -146,9 +146,9 @@ void * kmeansInitTask(int dim, int clNum, interm * centroids,
         return 0;
     }
 
-    for(size_t k=0;k<clNum;k++)
+    for(int k=0;k<clNum;k++)
     {
-        for(size_t j=0;j<dim;j++)
+        for(int j=0;j<dim;j++)
         {
             t->clSq[k] += centroids[k*dim + j]*centroids[k*dim + j] * 0.5;
         }
@@ -169,17 +169,11 @@ void addNTToTaskThreadedDense(void * task_id, const NumericTable * ntData, inter
 
     size_t blockSizeDeafult = t->max_block_size;
 
-    size_t nBlocks = n / blockSizeDeafult;
-    nBlocks += (nBlocks*blockSizeDeafult != n);
-
-    daal::threader_for( nBlocks, nBlocks, [=](int k)
+    daal::threader_for_blocked_size( n, blockSizeDeafult, daal::threader_get_threads_number(),
+                                     [=](size_t iStart, size_t iEnd)
     {
         struct tls_task_t<interm,cpu> * tt = t->tls_task->local();
-        size_t blockSize = blockSizeDeafult;
-        if( k == nBlocks-1 )
-        {
-            blockSize = n - k*blockSizeDeafult;
-        }
+        size_t blockSize = iEnd - iStart;
 
         BlockDescriptor<int> assignBlock;
 
@@ -195,13 +189,13 @@ void addNTToTaskThreadedDense(void * task_id, const NumericTable * ntData, inter
         interm* trg        = &(tt->goalFunc);
         interm* x_clusters = tt->mkl_buff;
 
-        mtData.getBlockOfRows( k*blockSizeDeafult, blockSize, &data );
+        mtData.getBlockOfRows( iStart, blockSize, &data );
 
         int* assignments = 0;
 
         if(assignFlag)
         {
-            ntAssign->getBlockOfRows( k*blockSizeDeafult, blockSize, writeOnly, assignBlock );
+            ntAssign->getBlockOfRows( iStart, blockSize, writeOnly, assignBlock );
             assignments = assignBlock.getBlockPtr();
         }
 
@@ -258,7 +252,7 @@ void addNTToTaskThreadedDense(void * task_id, const NumericTable * ntData, inter
 
         mtData.release();
 
-    } ); /* daal::threader_for( nBlocks, nBlocks, [=](int k) */
+    } ); /* daal::threader_for_blocked_size( n, blockSizeDeafult, ... ) */
 }
 
 template<typename interm, CpuType cpu, int assignFlag>
@@ -272,22 +266,16 @@ void addNTToTaskThreadedCSR(void * task_id, const NumericTable * ntDataGen, inte
 
     size_t blockSizeDeafult = t->max_block_size;
 
-    size_t nBlocks = n / blockSizeDeafult;
-    nBlocks += (nBlocks*blockSizeDeafult != n);
-
-    daal::threader_for( nBlocks, nBlocks, [=](int k)
+    daal::threader_for_blocked_size( n, blockSizeDeafult, daal::threader_get_threads_number(),
+                                     [=](size_t iStart, size_t iEnd)
     {
         struct tls_task_t<interm,cpu> * tt = t->tls_task->local();
-        size_t blockSize = blockSizeDeafult;
-        if( k == nBlocks-1 )
-        {
-            blockSize = n - k*blockSizeDeafult;
-        }
+        size_t blockSize = iEnd - iStart;
 
         BlockDescriptor<int> assignBlock;
         CSRBlockDescriptor<interm> dataBlock;
 
-        ntData->getSparseBlock( k*blockSizeDeafult, blockSize, readOnly, dataBlock );
+        ntData->getSparseBlock( iStart, blockSize, readOnly, dataBlock );
 
         interm *data        = dataBlock.getBlockValuesPtr();
         size_t *colIdx      = dataBlock.getBlockColumnIndicesPtr();
@@ -306,7 +294,7 @@ void addNTToTaskThreadedCSR(void * task_id, const NumericTable * ntDataGen, inte
 
         if(assignFlag)
         {
-            ntAssign->getBlockOfRows( k*blockSizeDeafult, blockSize, writeOnly, assignBlock );
+            ntAssign->getBlockOfRows( iStart, blockSize, writeOnly, assignBlock );
             assignments = assignBlock.getBlockPtr();
         }
 
@@ -392,25 +380,19 @@ void getNTAssignmentsThreaded(void * task_id, const NumericTable * ntData, const
 
     size_t blockSizeDeafult = t->max_block_size;
 
-    size_t nBlocks = n / blockSizeDeafult;
-    nBlocks += (nBlocks*blockSizeDeafult != n);
-
-    daal::threader_for( nBlocks, nBlocks, [=](int k)
+    daal::threader_for_blocked_size( n, blockSizeDeafult, daal::threader_get_threads_number(),
+                                     [=](size_t iStart, size_t iEnd)
     {
         struct tls_task_t<interm,cpu> * tt = t->tls_task->local();
-        size_t blockSize = blockSizeDeafult;
-        if( k == nBlocks-1 )
-        {
-            blockSize = n - k*blockSizeDeafult;
-        }
+        size_t blockSize = iEnd - iStart;
 
         BlockMicroTable<interm, readOnly,  cpu> mtData( ntData );
         BlockMicroTable<int   , writeOnly, cpu> mtAssign( ntAssign );
         interm* data;
         int*    assign;
 
-        mtData  .getBlockOfRows( k*blockSizeDeafult, blockSize, &data   );
-        mtAssign.getBlockOfRows( k*blockSizeDeafult, blockSize, &assign );
+        mtData  .getBlockOfRows( iStart, blockSize, &data   );
+        mtAssign.getBlockOfRows( iStart, blockSize, &assign );
 
         size_t p           = t->dim;
         size_t nClusters   = t->clNum;
@@ -455,33 +437,83 @@ void getNTAssignmentsThreaded(void * task_id, const NumericTable * ntData, const
 }
 
 template<typename interm, CpuType cpu>
-int kmeansUpdateCluster(void * task_id, int jidx, interm *s1)
+void kmeansResetTask(void * task_id, interm * centroids)
 {
-    int i, j;
     struct task_t<interm,cpu> * t = static_cast<task_t<interm,cpu> *>(task_id);
 
-    int idx   = (int)jidx;
-    int dim   = t->dim;
-    int clNum = t->clNum;
+    const size_t dim   = t->dim;
+    const size_t clNum = t->clNum;
+
+    t->cCenters = centroids;
 
-    int s0=0;
+    for(size_t k=0;k<clNum;k++)
+    {
+        t->clSq[k] = (interm)0.0;
+        for(size_t j=0;j<dim;j++)
+        {
+            t->clSq[k] += centroids[k*dim + j]*centroids[k*dim + j] * 0.5;
+        }
+    }
 
-    t->tls_task->reduce( [&](tls_task_t<interm,cpu> *tt)-> void
+    /* Thread local buffers are reused by the next pass over the data */
+    t->tls_task->parallel_reduce( [=](tls_task_t<interm,cpu> *tt)-> void
     {
-        s0 += tt->cS0[idx];
+        if(!tt) { return; }
+        service_memset<int,   cpu>(tt->cS0, 0, clNum);
+        service_memset<interm,cpu>(tt->cS1, (interm)0.0, clNum*dim);
+        tt->goalFunc = (interm)(0.0);
     } );
+}
+
+template<typename interm, typename countType, CpuType cpu>
+void kmeansReduceClusters(void * task_id, countType *s0, interm *s1, interm *goalFunc)
+{
+    struct task_t<interm,cpu> * t = static_cast<task_t<interm,cpu> *>(task_id);
+
+    const size_t dim   = t->dim;
+    const size_t clNum = t->clNum;
 
-    t->tls_task->reduce( [=](tls_task_t<interm,cpu> *tt)-> void
+    /* Merge thread local partial sums pairwise */
+    tls_task_t<interm,cpu> *res = t->tls_task->tree_reduce( [=](tls_task_t<interm,cpu> *dst, tls_task_t<interm,cpu> *src)-> void
     {
-        int j;
+        if(!dst || !src) { return; }
+
+        const int *srcS0 = src->cS0;
+        const interm *srcS1 = src->cS1;
+        int *dstS0 = dst->cS0;
+        interm *dstS1 = dst->cS1;
+
+      PRAGMA_IVDEP
+        for(size_t k=0;k<clNum;k++)
+        {
+            dstS0[k] += srcS0[k];
+        }
+
       PRAGMA_IVDEP
-        for(j=0;j<dim;j++)
+      PRAGMA_VECTOR_ALWAYS
+        for(size_t j=0;j<clNum*dim;j++)
         {
-            s1[j] += tt->cS1[idx*dim + j];
+            dstS1[j] += srcS1[j];
         }
+
+        dst->goalFunc += src->goalFunc;
     } );
 
-    return s0;
+    for(size_t k=0;k<clNum;k++)
+    {
+        s0[k] = (res ? (countType)res->cS0[k] : (countType)0);
+    }
+
+  PRAGMA_IVDEP
+    for(size_t j=0;j<clNum*dim;j++)
+    {
+        s1[j] = (res ? res->cS1[j] : (interm)0.0);
+    }
+
+    if( goalFunc != 0 )
+    {
+        *goalFunc = (res ? res->goalFunc : (interm)0.0);
+    }
 }
 
 template<typename interm, CpuType cpu>
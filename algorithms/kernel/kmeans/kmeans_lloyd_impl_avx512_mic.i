@@ -118,17 +118,11 @@ template<> void addNTToTaskThreadedDense<double, avx512_mic, 0>
 
     size_t blockSizeDeafult = t->max_block_size;
 
-    size_t nBlocks = n / blockSizeDeafult;
-    nBlocks += (nBlocks*blockSizeDeafult != n);
-
-    daal::threader_for( nBlocks, nBlocks, [=](int k)
+    daal::threader_for_blocked_size( n, blockSizeDeafult, daal::threader_get_threads_number(),
+                                     [=](size_t iStart, size_t iEnd)
     {
         struct tls_task_t<double, avx512_mic> * tt = t->tls_task->local();
-        size_t blockSize = blockSizeDeafult;
-        if( k == nBlocks-1 )
-        {
-            blockSize = n - k*blockSizeDeafult;
-        }
+        size_t blockSize = iEnd - iStart;
 
         BlockDescriptor<int> assignBlock;
 
@@ -144,7 +138,7 @@ template<> void addNTToTaskThreadedDense<double, avx512_mic, 0>
         double* trg        = &(tt->goalFunc);
         double* x_clusters = tt->mkl_buff;
 
-        mtData.getBlockOfRows( k*blockSizeDeafult, blockSize, &data );
+        mtData.getBlockOfRows( iStart, blockSize, &data );
 
         int* assignments = 0;
 
@@ -223,7 +217,7 @@ template<> void addNTToTaskThreadedDense<double, avx512_mic, 0>
 
         mtData.release();
 
-    } ); /* daal::threader_for( nBlocks, nBlocks, [=](int k) */
+    } ); /* daal::threader_for_blocked_size( n, blockSizeDeafult, ... ) */
 }
 
 template<> void getNTAssignmentsThreaded <lloydDense, double, avx512_mic>
@@ -235,25 +229,19 @@ template<> void getNTAssignmentsThreaded <lloydDense, double, avx512_mic>
 
     size_t blockSizeDeafult = t->max_block_size;
 
-    size_t nBlocks = n / blockSizeDeafult;
-    nBlocks += (nBlocks*blockSizeDeafult != n);
-
-    daal::threader_for( nBlocks, nBlocks, [=](int k)
+    daal::threader_for_blocked_size( n, blockSizeDeafult, daal::threader_get_threads_number(),
+                                     [=](size_t iStart, size_t iEnd)
     {
         struct tls_task_t<double, avx512_mic> * tt = t->tls_task->local();
-        size_t blockSize = blockSizeDeafult;
-        if( k == nBlocks-1 )
-        {
-            blockSize = n - k*blockSizeDeafult;
-        }
+        size_t blockSize = iEnd - iStart;
 
         BlockMicroTable<double, readOnly,  avx512_mic> mtData( ntData );
         BlockMicroTable<int   , writeOnly, avx512_mic> mtAssign( ntAssign );
         double* data;
         int*    assign;
 
-        mtData  .getBlockOfRows( k*blockSizeDeafult, blockSize, &data   );
-        mtAssign.getBlockOfRows( k*blockSizeDeafult, blockSize, &assign );
+        mtData  .getBlockOfRows( iStart, blockSize, &data   );
+        mtAssign.getBlockOfRows( iStart, blockSize, &assign );
 
         size_t p           = t->dim;
         size_t nClusters   = t->clNum;
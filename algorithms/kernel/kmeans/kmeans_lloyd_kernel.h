@@ -47,6 +47,21 @@ public:
     void compute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par);
 };
 
+template <typename interm, CpuType cpu>
+class KMeansBatchKernel<lloydElkanDense, interm, cpu>: public Kernel
+{
+public:
+    void compute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par);
+};
+
+template <Method method, typename interm, CpuType cpu>
+class KMeansOnlineKernel: public Kernel
+{
+public:
+    void compute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par);
+    void finalizeCompute(size_t na, const NumericTable *const *a, size_t nr, const NumericTable *const *r, const Parameter *par);
+};
+
 template <Method method, typename interm, CpuType cpu>
 class KMeansDistributedStep1Kernel: public Kernel
 {
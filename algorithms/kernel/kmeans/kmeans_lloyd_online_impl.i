@@ -0,0 +1,231 @@
+/* file: kmeans_lloyd_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of mini-batch Lloyd method for K-means algorithm
+//  in the online processing mode.
+//--
+*/
+
+#include "algorithm.h"
+#include "numeric_table.h"
+#include "threading.h"
+#include "daal_defines.h"
+#include "service_memory.h"
+#include "service_micro_table.h"
+
+#include "kmeans_lloyd_impl.i"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+namespace internal
+{
+
+/* Returns weights of the categorical features or 0 if the table has no categorical features */
+template <typename interm, CpuType cpu>
+interm *kmeansOnlineCatCoef(const NumericTable *ntData, const Parameter *par)
+{
+    size_t p = ntData->getNumberOfColumns();
+
+    int catFlag = 0;
+    for(size_t i = 0; i < p; i++)
+    {
+        if (ntData->getFeatureType(i) == data_feature_utils::DAAL_CATEGORICAL)
+        {
+            catFlag = 1;
+            break;
+        }
+    }
+
+    if(!catFlag) { return 0; }
+
+    interm *catCoef = new interm[p];
+    for(size_t i = 0; i < p; i++)
+    {
+        if (ntData->getFeatureType(i) == data_feature_utils::DAAL_CATEGORICAL)
+        {
+            catCoef[i] = par->gamma;
+        }
+        else
+        {
+            catCoef[i] = (interm)1.0;
+        }
+    }
+    return catCoef;
+}
+
+/**
+ *  Processes one block of observations: the observations are assigned to the current centroids
+ *  with the blocked GEMM based path of the batch method, then every centroid c is moved towards
+ *  the mean of its observations with the learning rate 1/count(c), where count(c) is the number
+ *  of observations assigned to c over all processed blocks:
+ *      c = c + (S1(c) - S0(c) * c) / count(c)
+ */
+template <Method method, typename interm, CpuType cpu>
+void KMeansOnlineKernel<method, interm, cpu>::compute( size_t na, const NumericTable *const *a,
+                                                           size_t nr, const NumericTable *const *r, const Parameter *par)
+{
+    const NumericTable *ntData = a[0];
+
+    size_t p = ntData->getNumberOfColumns();
+    size_t nClusters = par->nClusters;
+
+    size_t *clusterS0 = (size_t *)daal::services::daal_malloc( sizeof(size_t) * nClusters );
+    if(!clusterS0)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    interm *clusterS1 = (interm *)daal::services::daal_malloc( sizeof(interm) * nClusters * p );
+    if(!clusterS1)
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        daal::services::daal_free( clusterS0 );
+        return;
+    }
+
+    BlockMicroTable<interm, readWrite, cpu> mtClusters  ( r[0] );
+    BlockMicroTable<interm, readWrite, cpu> mtCounts    ( r[1] );
+    BlockMicroTable<interm, writeOnly, cpu> mtTargetFunc( r[2] );
+    BlockMicroTable<int,    readWrite, cpu> mtNBlocks   ( r[3] );
+
+    interm *clusters;
+    interm *counts;
+    interm *goalFunc;
+    int    *nBlocks;
+
+    mtClusters  .getBlockOfRows(0, nClusters, &clusters);
+    mtCounts    .getBlockOfRows(0, nClusters, &counts  );
+    mtTargetFunc.getBlockOfRows(0, 1,         &goalFunc);
+    mtNBlocks   .getBlockOfRows(0, 1,         &nBlocks );
+
+    interm *catCoef = kmeansOnlineCatCoef<interm, cpu>(ntData, par);
+
+    void *task = kmeansInitTask<interm, cpu>(p, nClusters, clusters, this->_errors);
+    if(task)
+    {
+        addNTToTaskThreaded<method, interm, cpu, 0>(task, ntData, catCoef);
+        kmeansReduceClusters<interm, size_t, cpu>(task, clusterS0, clusterS1, goalFunc);
+        kmeansClearClusters<interm, cpu>(task, 0);
+
+        for (size_t i = 0; i < nClusters; i++)
+        {
+            if ( clusterS0[i] > 0 )
+            {
+                interm s0 = (interm)clusterS0[i];
+                counts[i] += s0;
+
+                interm eta = (interm)1.0 / counts[i];
+
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < p; j++)
+                {
+                    clusters[i * p + j] += (clusterS1[i * p + j] - s0 * clusters[i * p + j]) * eta;
+                }
+            }
+        }
+
+        (*nBlocks)++;
+    }
+
+    if (catCoef)
+    {
+        delete[] catCoef;
+    }
+
+    daal::services::daal_free( clusterS0 );
+    daal::services::daal_free( clusterS1 );
+
+    mtClusters  .release();
+    mtCounts    .release();
+    mtTargetFunc.release();
+    mtNBlocks   .release();
+}
+
+template <Method method, typename interm, CpuType cpu>
+void KMeansOnlineKernel<method, interm, cpu>::finalizeCompute( size_t na, const NumericTable *const *a,
+                                                                   size_t nr, const NumericTable *const *r, const Parameter *par)
+{
+    size_t nClusters = par->nClusters;
+    size_t p = a[0]->getNumberOfColumns();
+
+    BlockMicroTable<interm, readOnly,  cpu> mtInClusters  ( a[0] );
+    BlockMicroTable<interm, readOnly,  cpu> mtInTargetFunc( a[1] );
+    BlockMicroTable<int,    readOnly,  cpu> mtInNBlocks   ( a[2] );
+    BlockMicroTable<interm, writeOnly, cpu> mtClusters    ( r[0] );
+    BlockMicroTable<interm, writeOnly, cpu> mtTargetFunc  ( r[2] );
+    BlockMicroTable<int,    writeOnly, cpu> mtIterations  ( r[3] );
+
+    interm *inClusters, *clusters;
+    interm *inGoal, *goal;
+    int    *inNBlocks, *nIterations;
+
+    mtInClusters  .getBlockOfRows(0, nClusters, &inClusters );
+    mtInTargetFunc.getBlockOfRows(0, 1,         &inGoal     );
+    mtInNBlocks   .getBlockOfRows(0, 1,         &inNBlocks  );
+    mtClusters    .getBlockOfRows(0, nClusters, &clusters   );
+    mtTargetFunc  .getBlockOfRows(0, 1,         &goal       );
+    mtIterations  .getBlockOfRows(0, 1,         &nIterations);
+
+  PRAGMA_IVDEP
+    for (size_t j = 0; j < nClusters * p; j++)
+    {
+        clusters[j] = inClusters[j];
+    }
+    *goal        = *inGoal;
+    *nIterations = *inNBlocks;
+
+    if( par->assignFlag )
+    {
+        const NumericTable *ntData = a[3];
+        interm *catCoef = kmeansOnlineCatCoef<interm, cpu>(ntData, par);
+
+        void *task = kmeansInitTask<interm, cpu>(p, nClusters, clusters, this->_errors);
+        if(task)
+        {
+            getNTAssignmentsThreaded<method, interm, cpu>(task, ntData, r[1], catCoef);
+            kmeansClearClusters<interm, cpu>(task, 0);
+        }
+
+        if (catCoef)
+        {
+            delete[] catCoef;
+        }
+    }
+
+    mtInClusters  .release();
+    mtInTargetFunc.release();
+    mtInNBlocks   .release();
+    mtClusters    .release();
+    mtTargetFunc  .release();
+    mtIterations  .release();
+}
+
+} // namespace daal::algorithms::kmeans::internal
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
@@ -83,16 +83,30 @@ template <typename interm, CpuType cpu>
 void LinearRegressionTrainDistributedKernel<interm, training::normEqDense, cpu>::mergePartialSums(
             MKL_INT nBetas, MKL_INT nResponses, interm *axtx, interm *axty, interm *rxtx, interm *rxty)
 {
+    /* Elementwise sums are memory bound: process them in large blocks */
+    const size_t blockSize = 4096;
+    const int nThreads = daal::threader_get_threads_number();
+
     size_t xtxSize = nBetas * nBetas;
-    daal::threader_for( xtxSize, xtxSize, [ = ](size_t i)
+    daal::threader_for_blocked_size( xtxSize, blockSize, nThreads, [ = ](size_t iStart, size_t iEnd)
     {
-        rxtx[i] += axtx[i];
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t i = iStart; i < iEnd; i++)
+        {
+            rxtx[i] += axtx[i];
+        }
     } );
 
     size_t xtySize = nResponses * nBetas;
-    daal::threader_for( xtySize, xtySize, [ = ](size_t i)
+    daal::threader_for_blocked_size( xtySize, blockSize, nThreads, [ = ](size_t iStart, size_t iEnd)
     {
-        rxty[i] += axty[i];
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t i = iStart; i < iEnd; i++)
+        {
+            rxty[i] += axty[i];
+        }
     } );
 }
 
@@ -186,23 +186,28 @@ void collectCounters( const Parameter *nbPar, NumericTable *ntData, NumericTable
 
     daal::tls<interm*> tls_n_ci( [=]()-> interm * { return _CALLOC_<interm,cpu>(p*c); } );
 
-    daal::threader_for_blocked( n, n, [=,&tls_n_ci](interm j0, interm jn)
+    /* Number of rows processed by one task of the threading layer */
+    const size_t nRowsInTask = 4096;
+
+    daal::threader_for_blocked_size( n, nRowsInTask, daal::threader_get_threads_number(),
+                                     [=,&tls_n_ci](size_t iStart, size_t iEnd)
     {
         interm* local_n_ci = tls_n_ci.local();
 
         localDataCollector<interm, method, cpu> ldc(p,c, ntData, ntClass, local_n_ci);
 
-        interm block_size = ldc.getBlockSize(jn);
-        int i;
+        size_t jn = iEnd - iStart;
+        size_t block_size = ldc.getBlockSize(jn);
+        size_t i;
 
         for ( i = 0 ; i + block_size < jn + 1 ; i += block_size )
         {
-            ldc.addData( j0+i, block_size );
+            ldc.addData( iStart+i, block_size );
         }
 
         if ( i != jn )
         {
-            ldc.addData( j0+i, jn-i );
+            ldc.addData( iStart+i, jn-i );
         }
     } );
 
@@ -221,19 +226,33 @@ void collectCounters( const Parameter *nbPar, NumericTable *ntData, NumericTable
         }
     }
 
-    tls_n_ci.reduce( [=](interm* v)
+    /* Merge per-thread counters pairwise in parallel, then add the total to the model */
+    interm *total_n_ci = tls_n_ci.tree_reduce( [=](interm* dst, interm* src)
     {
       PRAGMA_IVDEP
       PRAGMA_VECTOR_ALWAYS
-      PRAGMA_VECTOR_ALIGNED
+        for(size_t j=0;j<p*c;j++)
+        {
+            dst[j] += src[j];
+        }
+    } );
+
+    if( total_n_ci )
+    {
         for(size_t j=0;j<c;j++)
         {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
             for(size_t i=0;i<p;i++)
             {
-                n_ci[j*p+i] += v[j*p+i];
-                n_c [j    ] += v[j*p+i];
+                n_ci[j*p+i] += total_n_ci[j*p+i];
+                n_c [j    ] += total_n_ci[j*p+i];
             }
         }
+    }
+
+    tls_n_ci.parallel_reduce( [=](interm* v)
+    {
         _FREE_<interm, cpu>( v );
     } );
 }
@@ -50,23 +50,159 @@ namespace backward
 namespace internal
 {
 
+/* Creates the conversion between the layouts and the buffer in the internal layout lt_pr
+ * if the layouts differ, toInner specifies the direction of the conversion */
 template<typename algorithmFPType, CpuType cpu>
-static dnnError_t init_conversion(dnnPrimitive_t *cv, algorithmFPType **ptr_out,
-                                 dnnLayout_t lt_pr, dnnLayout_t lt_us, algorithmFPType *ptr_us)
+static dnnError_t init_conversion(dnnPrimitive_t *cv, algorithmFPType **ptr_pr,
+                                 dnnLayout_t lt_pr, dnnLayout_t lt_us, bool toInner = true)
 {
     dnnError_t err = E_SUCCESS;
-    *ptr_out = NULL;
+    *cv = NULL;
+    *ptr_pr = NULL;
     if (!Dnn<algorithmFPType, cpu>::xLayoutCompare(lt_pr, lt_us))
     {
-        err = Dnn<algorithmFPType, cpu>::xConversionCreate(cv, lt_us, lt_pr);
+        err = (toInner ? Dnn<algorithmFPType, cpu>::xConversionCreate(cv, lt_us, lt_pr) :
+                         Dnn<algorithmFPType, cpu>::xConversionCreate(cv, lt_pr, lt_us));
         if(err != E_SUCCESS) return err;
-        err = Dnn<algorithmFPType, cpu>::xAllocateBuffer((void**)ptr_out, lt_pr);
+        err = Dnn<algorithmFPType, cpu>::xAllocateBuffer((void**)ptr_pr, lt_pr);
     }
-    else
+    return err;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+Convolution2dKernel<algorithmFPType, method, cpu>::Convolution2dKernel() : _cacheValid(false),
+    _convFwd(NULL), _convGrad(NULL), _convFilt(NULL), _convBias(NULL),
+    _cvToInnerInput(NULL), _cvToInnerFilt(NULL), _cvToInnerGrad(NULL),
+    _cvFromInnerBack(NULL), _cvFromInnerDerFilt(NULL), _cvFromInnerDerBias(NULL),
+    _ltUserX(NULL), _ltUserFilt(NULL), _ltUserBias(NULL), _ltUserGrad(NULL),
+    _ltInnerInput(NULL), _ltInnerFilt(NULL), _ltInnerGrad(NULL),
+    _ltInnerBack(NULL), _ltInnerDerFilt(NULL), _ltInnerDerBias(NULL),
+    _innerInput(NULL), _innerFilt(NULL), _innerGrad(NULL),
+    _innerBack(NULL), _innerDerFilt(NULL), _innerDerBias(NULL)
+{}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+Convolution2dKernel<algorithmFPType, method, cpu>::~Convolution2dKernel()
+{
+    releaseCache();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+bool Convolution2dKernel<algorithmFPType, method, cpu>::isCacheValid(const size_t *xSize, const size_t *gradSize,
+    const size_t *filterSize, const size_t *convolutionStride, const int *xOffset) const
+{
+    if (!_cacheValid) { return false; }
+    for (size_t i = 0; i < dimension; i++)
     {
-        *ptr_out = ptr_us;
+        if (_xSize[i] != xSize[i] || _gradSize[i] != gradSize[i] || _filterSize[i] != filterSize[i]) { return false; }
     }
-    return err;
+    for (size_t i = 0; i < 2; i++)
+    {
+        if (_convolutionStride[i] != convolutionStride[i] || _xOffset[i] != xOffset[i]) { return false; }
+    }
+    return true;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+dnnError_t Convolution2dKernel<algorithmFPType, method, cpu>::initCache(const size_t *xSize, const size_t *gradSize,
+    const size_t *filterSize, const size_t *convolutionStride, const int *xOffset, size_t nKernels)
+{
+    dnnError_t err;
+
+    releaseCache();
+
+    size_t xStrides[dimension], gradStrides[dimension], filterStrides[dimension];
+    xStrides     [0] = 1;
+    gradStrides  [0] = 1;
+    filterStrides[0] = 1;
+    for(size_t i=1; i<dimension; i++)
+    {
+        xStrides     [i] = xStrides     [i-1]*xSize     [i-1];
+        gradStrides  [i] = gradStrides  [i-1]*gradSize  [i-1];
+        filterStrides[i] = filterStrides[i-1]*filterSize[i-1];
+    }
+
+    size_t  biasSize[1] = {nKernels};
+    size_t  biasStrides[1] = {1};
+
+    err = dnn::xLayoutCreate(&_ltUserX,    dimension, xSize,      xStrides     ); if(err != E_SUCCESS) return err;
+    err = dnn::xLayoutCreate(&_ltUserFilt, dimension, filterSize, filterStrides); if(err != E_SUCCESS) return err;
+    err = dnn::xLayoutCreate(&_ltUserBias, 1,         biasSize,   biasStrides  ); if(err != E_SUCCESS) return err;
+    err = dnn::xLayoutCreate(&_ltUserGrad, dimension, gradSize,   gradStrides  ); if(err != E_SUCCESS) return err;
+
+    err = dnn::xConvolutionCreateForwardBias   ( &_convFwd,  dnnAlgorithmConvolutionDirect, dimension, xSize, gradSize,
+                                                 filterSize, convolutionStride, xOffset, dnnBorderZeros); if(err != E_SUCCESS) return err;
+    err = dnn::xConvolutionCreateBackwardData  ( &_convGrad, dnnAlgorithmConvolutionDirect, dimension, xSize, gradSize,
+                                                 filterSize, convolutionStride, xOffset, dnnBorderZeros); if(err != E_SUCCESS) return err;
+    err = dnn::xConvolutionCreateBackwardFilter( &_convFilt, dnnAlgorithmConvolutionDirect, dimension, xSize, gradSize,
+                                                 filterSize, convolutionStride, xOffset, dnnBorderZeros); if(err != E_SUCCESS) return err;
+    err = dnn::xConvolutionCreateBackwardBias  ( &_convBias, dnnAlgorithmConvolutionDirect, dimension, gradSize); if(err != E_SUCCESS) return err;
+
+    err = dnn::xLayoutCreateFromPrimitive(&_ltInnerInput, _convFwd, dnnResourceSrc   ); if(err != E_SUCCESS) return err;
+    err = dnn::xLayoutCreateFromPrimitive(&_ltInnerFilt,  _convFwd, dnnResourceFilter); if(err != E_SUCCESS) return err;
+    err = dnn::xLayoutCreateFromPrimitive(&_ltInnerGrad,  _convFwd, dnnResourceDst   ); if(err != E_SUCCESS) return err;
+
+    err = dnn::xLayoutCreateFromPrimitive(&_ltInnerBack,    _convGrad, dnnResourceDiffSrc   ); if(err != E_SUCCESS) return err;
+    err = dnn::xLayoutCreateFromPrimitive(&_ltInnerDerFilt, _convFilt, dnnResourceDiffFilter); if(err != E_SUCCESS) return err;
+    err = dnn::xLayoutCreateFromPrimitive(&_ltInnerDerBias, _convBias, dnnResourceDiffBias  ); if(err != E_SUCCESS) return err;
+
+    err = init_conversion<algorithmFPType, cpu>(&_cvToInnerInput,     &_innerInput,   _ltInnerInput,   _ltUserX   ); if(err != E_SUCCESS) return err;
+    err = init_conversion<algorithmFPType, cpu>(&_cvToInnerFilt,      &_innerFilt,    _ltInnerFilt,    _ltUserFilt); if(err != E_SUCCESS) return err;
+    err = init_conversion<algorithmFPType, cpu>(&_cvToInnerGrad,      &_innerGrad,    _ltInnerGrad,    _ltUserGrad); if(err != E_SUCCESS) return err;
+    err = init_conversion<algorithmFPType, cpu>(&_cvFromInnerBack,    &_innerBack,    _ltInnerBack,    _ltUserX,    false); if(err != E_SUCCESS) return err;
+    err = init_conversion<algorithmFPType, cpu>(&_cvFromInnerDerFilt, &_innerDerFilt, _ltInnerDerFilt, _ltUserFilt, false); if(err != E_SUCCESS) return err;
+    err = init_conversion<algorithmFPType, cpu>(&_cvFromInnerDerBias, &_innerDerBias, _ltInnerDerBias, _ltUserBias, false); if(err != E_SUCCESS) return err;
+
+    for (size_t i = 0; i < dimension; i++)
+    {
+        _xSize     [i] = xSize     [i];
+        _gradSize  [i] = gradSize  [i];
+        _filterSize[i] = filterSize[i];
+    }
+    for (size_t i = 0; i < 2; i++)
+    {
+        _convolutionStride[i] = convolutionStride[i];
+        _xOffset          [i] = xOffset          [i];
+    }
+    _cacheValid = true;
+
+    return E_SUCCESS;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void Convolution2dKernel<algorithmFPType, method, cpu>::releaseCache()
+{
+    if(_innerInput  ) { dnn::xReleaseBuffer(_innerInput  ); _innerInput   = NULL; }
+    if(_innerFilt   ) { dnn::xReleaseBuffer(_innerFilt   ); _innerFilt    = NULL; }
+    if(_innerGrad   ) { dnn::xReleaseBuffer(_innerGrad   ); _innerGrad    = NULL; }
+    if(_innerBack   ) { dnn::xReleaseBuffer(_innerBack   ); _innerBack    = NULL; }
+    if(_innerDerFilt) { dnn::xReleaseBuffer(_innerDerFilt); _innerDerFilt = NULL; }
+    if(_innerDerBias) { dnn::xReleaseBuffer(_innerDerBias); _innerDerBias = NULL; }
+
+    if(_convFwd ) { dnn::xDelete(_convFwd ); _convFwd  = NULL; }
+    if(_convGrad) { dnn::xDelete(_convGrad); _convGrad = NULL; }
+    if(_convFilt) { dnn::xDelete(_convFilt); _convFilt = NULL; }
+    if(_convBias) { dnn::xDelete(_convBias); _convBias = NULL; }
+
+    if(_cvToInnerInput    ) { dnn::xDelete(_cvToInnerInput    ); _cvToInnerInput     = NULL; }
+    if(_cvToInnerFilt     ) { dnn::xDelete(_cvToInnerFilt     ); _cvToInnerFilt      = NULL; }
+    if(_cvToInnerGrad     ) { dnn::xDelete(_cvToInnerGrad     ); _cvToInnerGrad      = NULL; }
+    if(_cvFromInnerBack   ) { dnn::xDelete(_cvFromInnerBack   ); _cvFromInnerBack    = NULL; }
+    if(_cvFromInnerDerFilt) { dnn::xDelete(_cvFromInnerDerFilt); _cvFromInnerDerFilt = NULL; }
+    if(_cvFromInnerDerBias) { dnn::xDelete(_cvFromInnerDerBias); _cvFromInnerDerBias = NULL; }
+
+    if(_ltUserX       ) { dnn::xLayoutDelete(_ltUserX       ); _ltUserX        = NULL; }
+    if(_ltUserFilt    ) { dnn::xLayoutDelete(_ltUserFilt    ); _ltUserFilt     = NULL; }
+    if(_ltUserBias    ) { dnn::xLayoutDelete(_ltUserBias    ); _ltUserBias     = NULL; }
+    if(_ltUserGrad    ) { dnn::xLayoutDelete(_ltUserGrad    ); _ltUserGrad     = NULL; }
+    if(_ltInnerInput  ) { dnn::xLayoutDelete(_ltInnerInput  ); _ltInnerInput   = NULL; }
+    if(_ltInnerFilt   ) { dnn::xLayoutDelete(_ltInnerFilt   ); _ltInnerFilt    = NULL; }
+    if(_ltInnerGrad   ) { dnn::xLayoutDelete(_ltInnerGrad   ); _ltInnerGrad    = NULL; }
+    if(_ltInnerBack   ) { dnn::xLayoutDelete(_ltInnerBack   ); _ltInnerBack    = NULL; }
+    if(_ltInnerDerFilt) { dnn::xLayoutDelete(_ltInnerDerFilt); _ltInnerDerFilt = NULL; }
+    if(_ltInnerDerBias) { dnn::xLayoutDelete(_ltInnerDerBias); _ltInnerDerBias = NULL; }
+
+    _cacheValid = false;
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
@@ -74,9 +210,6 @@ void Convolution2dKernel<algorithmFPType, method, cpu>::compute(const convolutio
     const convolution2d::Parameter *parameter, convolution2d::backward::Result *result)
 {
     dnnError_t err;
-    typedef Dnn<algorithmFPType, cpu> dnn;
-
-    const size_t dimension = 4;
 
     SharedPtr<Tensor> inGradTable  = input->get(layers::backward::inputGradient);
     SharedPtr<LayerData> layerData = input->get(layers::backward::inputFromForward);
@@ -109,6 +242,26 @@ void Convolution2dKernel<algorithmFPType, method, cpu>::compute(const convolutio
         xDims[i] = xDimsFull[fullSize - dimension + i];
     }
 
+    size_t xSize     [dimension];
+    size_t gradSize  [dimension];
+    size_t filterSize[dimension];
+    for(size_t i=0; i<dimension; i++)
+    {
+        xSize     [i] = xDims[dimension-1-i];
+        gradSize  [i] = gDims[dimension-1-i];
+        filterSize[i] = wDims[dimension-1-i];
+    }
+
+    size_t convolutionStride[2] = {parameter->stride.size[1],  parameter->stride.size[0]};
+    int    xOffset          [2] = {-(int)(parameter->padding.size[1]), -(int)(parameter->padding.size[0])};
+
+    if (!isCacheValid(xSize, gradSize, filterSize, convolutionStride, xOffset))
+    {
+        err = initCache(xSize, gradSize, filterSize, convolutionStride, xOffset, parameter->nKernels);
+        if (err != E_SUCCESS) { releaseCache(); }
+        ON_ERR(err);
+    }
+
     SubtensorDescriptor<algorithmFPType> inGradBlock;
     inGradTable->getSubtensor(0, 0, 0, gDimsFull[0], readOnly, inGradBlock);
     algorithmFPType *inGradArray = inGradBlock.getPtr();
@@ -133,149 +286,27 @@ void Convolution2dKernel<algorithmFPType, method, cpu>::compute(const convolutio
     resultTable->getSubtensor(0, 0, 0, xDimsFull[0], writeOnly, resultBlock);
     algorithmFPType *resultArray = resultBlock.getPtr();
 
-    const size_t bufferSize = 6 * dimension * sizeof(size_t);
-    size_t *buffer = (size_t*)services::daal_malloc(bufferSize);
-    if(!buffer) {this->_errors->add(services::ErrorMemoryAllocationFailed); return;}
-    size_t *xSize         = buffer;
-    size_t *xStrides      = buffer +     dimension;
-    size_t *gradSize      = buffer + 2 * dimension;
-    size_t *gradStrides   = buffer + 3 * dimension;
-    size_t *filterSize    = buffer + 4 * dimension;
-    size_t *filterStrides = buffer + 5 * dimension;
-
-    size_t  biasSize[1] = {parameter->nKernels};
-    size_t  biasStrides[1] = {1};
-
-    xSize        [0] = xDims[dimension-1];
-    xStrides     [0] = 1;
-    gradSize     [0] = gDims[dimension-1];
-    gradStrides  [0] = 1;
-    filterSize   [0] = wDims[dimension-1];
-    filterStrides[0] = 1;
-
-    for(size_t i=1; i<dimension; i++)
-    {
-        xSize        [i] = xDims[dimension-1-i];
-        xStrides     [i] = xStrides[i-1]*xSize[i-1];
-        gradSize     [i] = gDims[dimension-1-i];
-        gradStrides  [i] = gradStrides[i-1]*gradSize[i-1];
-        filterSize   [i] = wDims[dimension-1-i];
-        filterStrides[i] = filterStrides[i-1]*filterSize[i-1];
-    }
-
-    size_t convolutionStride[2] = {parameter->stride.size[1],  parameter->stride.size[0]};
-    int    xOffset          [2] = {-(int)(parameter->padding.size[1]), -(int)(parameter->padding.size[0])};
-
-    dnnLayout_t ltUserX=NULL, ltUserFilt=NULL, ltUserBias=NULL, ltUserGrad=NULL;
-
-    err = dnn::xLayoutCreate(&ltUserX,      dimension, xSize,      xStrides     ); ON_ERR(err);
-    err = dnn::xLayoutCreate(&ltUserFilt,   dimension, filterSize, filterStrides); ON_ERR(err);
-    err = dnn::xLayoutCreate(&ltUserBias,   1,         biasSize,   biasStrides  ); ON_ERR(err);
-    err = dnn::xLayoutCreate(&ltUserGrad,   dimension, gradSize,   gradStrides  ); ON_ERR(err);
-
-    dnnPrimitive_t convFwd = NULL, convGrad = NULL, convFilt = NULL, convBias = NULL;
-
-    err = dnn::xConvolutionCreateForwardBias   ( &convFwd,  dnnAlgorithmConvolutionDirect, dimension, xSize, gradSize,
-                                                 filterSize, convolutionStride, xOffset, dnnBorderZeros);  ON_ERR(err);
-    err = dnn::xConvolutionCreateBackwardData  ( &convGrad, dnnAlgorithmConvolutionDirect, dimension, xSize, gradSize,
-                                                 filterSize, convolutionStride, xOffset, dnnBorderZeros);  ON_ERR(err);
-    err = dnn::xConvolutionCreateBackwardFilter( &convFilt, dnnAlgorithmConvolutionDirect, dimension, xSize, gradSize,
-                                                 filterSize, convolutionStride, xOffset, dnnBorderZeros);  ON_ERR(err);
-    err = dnn::xConvolutionCreateBackwardBias  ( &convBias, dnnAlgorithmConvolutionDirect, dimension, gradSize);  ON_ERR(err);
-
-    dnnLayout_t ltInnerInput = NULL, ltInnerFilt = NULL, ltInnerGrad = NULL;
-    dnnLayout_t ltInnerBack  = NULL, ltInnerDerFilt = NULL, ltInnerDerBias = NULL;
-
-    err = dnn::xLayoutCreateFromPrimitive(&ltInnerInput, convFwd, dnnResourceSrc   ); ON_ERR(err);
-    err = dnn::xLayoutCreateFromPrimitive(&ltInnerFilt,  convFwd, dnnResourceFilter); ON_ERR(err);
-    err = dnn::xLayoutCreateFromPrimitive(&ltInnerGrad,  convFwd, dnnResourceDst   ); ON_ERR(err);
-
-    err = dnn::xLayoutCreateFromPrimitive(&ltInnerBack,    convGrad, dnnResourceDiffSrc   ); ON_ERR(err);
-    err = dnn::xLayoutCreateFromPrimitive(&ltInnerDerFilt, convFilt, dnnResourceDiffFilter); ON_ERR(err);
-    err = dnn::xLayoutCreateFromPrimitive(&ltInnerDerBias, convBias, dnnResourceDiffBias  ); ON_ERR(err);
-
     algorithmFPType* convRes[dnnResourceNumber] = {0};
-    dnnPrimitive_t cvToInnerInput = NULL, cvToInnerFilt = NULL, cvToInnerGrad = NULL;
-    dnnPrimitive_t cvFromInnerBack = NULL, cvFromInnerDerFilt = NULL, cvFromInnerDerBias = NULL;
-    err = init_conversion<algorithmFPType, cpu>(&cvToInnerInput, &convRes[dnnResourceSrc    ], ltInnerInput, ltUserX,
-        (algorithmFPType*)xArray); ON_ERR(err);
-    err = init_conversion<algorithmFPType, cpu>(&cvToInnerFilt,  &convRes[dnnResourceFilter ], ltInnerFilt,  ltUserFilt,
-        (algorithmFPType*)wArray); ON_ERR(err);
-    err = init_conversion<algorithmFPType, cpu>(&cvToInnerGrad,  &convRes[dnnResourceDiffDst], ltInnerGrad,  ltUserGrad,
-        (algorithmFPType*)inGradArray); ON_ERR(err);
-
-    err = dnn::xAllocateBuffer((void**) &convRes[dnnResourceDiffSrc   ], ltInnerBack   ); ON_ERR(err);
-    err = dnn::xAllocateBuffer((void**) &convRes[dnnResourceDiffFilter], ltInnerDerFilt); ON_ERR(err);
-    err = dnn::xAllocateBuffer((void**) &convRes[dnnResourceDiffBias  ], ltInnerDerBias); ON_ERR(err);
-
-    algorithmFPType *backData=0, *derFilt=0, *derBias=0;
-    err = init_conversion<algorithmFPType, cpu>(&cvFromInnerBack,    (algorithmFPType**)&backData, ltUserX   , ltInnerBack   ,
-        convRes[dnnResourceDiffSrc   ]); ON_ERR(err);
-    err = init_conversion<algorithmFPType, cpu>(&cvFromInnerDerFilt, (algorithmFPType**)&derFilt,  ltUserFilt, ltInnerDerFilt,
-        convRes[dnnResourceDiffFilter]); ON_ERR(err);
-    err = init_conversion<algorithmFPType, cpu>(&cvFromInnerDerBias, (algorithmFPType**)&derBias,  ltUserBias, ltInnerDerBias,
-        convRes[dnnResourceDiffBias  ]); ON_ERR(err);
-
-    err = dnn::xConversionExecute(cvToInnerInput, xArray,      convRes[dnnResourceSrc    ]); ON_ERR(err);
-    err = dnn::xConversionExecute(cvToInnerFilt,  wArray,      convRes[dnnResourceFilter ]); ON_ERR(err);
-    err = dnn::xConversionExecute(cvToInnerGrad,  inGradArray, convRes[dnnResourceDiffDst]); ON_ERR(err);
-
-    err = dnn::xExecute(convGrad, (void**)convRes); ON_ERR(err);
-    err = dnn::xExecute(convFilt, (void**)convRes); ON_ERR(err);
-    err = dnn::xExecute(convBias, (void**)convRes); ON_ERR(err);
-
-    err = dnn::xConversionExecute(cvFromInnerBack,    convRes[dnnResourceDiffDst   ], backData); ON_ERR(err);
-    err = dnn::xConversionExecute(cvFromInnerDerFilt, convRes[dnnResourceDiffFilter], derFilt ); ON_ERR(err);
-    err = dnn::xConversionExecute(cvFromInnerDerBias, convRes[dnnResourceDiffBias  ], derBias ); ON_ERR(err);
-
-    size_t size = resultBlock.getSize();
-    for(size_t i=0; i<size; i++)
-    {
-        resultArray[i] = backData[i];
-    }
-
-    size = wDerBlock.getSize();
-    for(size_t i=0; i<size; i++)
-    {
-        wDerArray[i] = derFilt[i];
-    }
-
-    size = bDerBlock.getSize();
-    for(size_t i=0; i<size; i++)
-    {
-        bDerArray[i] = derBias[i];
-    }
-
-    dnn::xReleaseBuffer(convRes[dnnResourceDiffSrc   ]);
-    dnn::xReleaseBuffer(convRes[dnnResourceDiffFilter]);
-    dnn::xReleaseBuffer(convRes[dnnResourceDiffBias  ]);
-
-    dnn::xDelete(convFwd );
-    dnn::xDelete(convGrad);
-    dnn::xDelete(convFilt);
-    dnn::xDelete(convBias);
-
-    dnn::xDelete(cvToInnerInput);
-    dnn::xDelete(cvToInnerFilt);
-    dnn::xDelete(cvToInnerGrad);
-    dnn::xDelete(cvFromInnerBack);
-    dnn::xDelete(cvFromInnerDerFilt);
-    dnn::xDelete(cvFromInnerDerBias);
-
-    dnn::xLayoutDelete(ltUserX);
-    dnn::xLayoutDelete(ltUserFilt);
-    dnn::xLayoutDelete(ltUserBias);
-    dnn::xLayoutDelete(ltUserGrad);
-
-    dnn::xLayoutDelete(ltInnerInput);
-    dnn::xLayoutDelete(ltInnerFilt);
-    dnn::xLayoutDelete(ltInnerGrad);
-
-    dnn::xLayoutDelete(ltInnerBack);
-    dnn::xLayoutDelete(ltInnerDerFilt);
-    dnn::xLayoutDelete(ltInnerDerBias);
-
-    services::daal_free(buffer);
+    convRes[dnnResourceSrc       ] = (_cvToInnerInput     ? _innerInput   : xArray     );
+    convRes[dnnResourceFilter    ] = (_cvToInnerFilt      ? _innerFilt    : wArray     );
+    convRes[dnnResourceDiffDst   ] = (_cvToInnerGrad      ? _innerGrad    : inGradArray);
+    convRes[dnnResourceDiffSrc   ] = (_cvFromInnerBack    ? _innerBack    : resultArray);
+    convRes[dnnResourceDiffFilter] = (_cvFromInnerDerFilt ? _innerDerFilt : wDerArray  );
+    convRes[dnnResourceDiffBias  ] = (_cvFromInnerDerBias ? _innerDerBias : bDerArray  );
+
+    err = dnn::xConversionExecute(_cvToInnerInput, xArray,      convRes[dnnResourceSrc    ]);
+    if (err == E_SUCCESS) { err = dnn::xConversionExecute(_cvToInnerFilt, wArray,      convRes[dnnResourceFilter ]); }
+    if (err == E_SUCCESS) { err = dnn::xConversionExecute(_cvToInnerGrad, inGradArray, convRes[dnnResourceDiffDst]); }
+
+    /* The gradient may be written into the memory of the forward input when no conversion is needed,
+       so the derivatives that read the forward input are computed first */
+    if (err == E_SUCCESS) { err = dnn::xExecute(_convFilt, (void**)convRes); }
+    if (err == E_SUCCESS) { err = dnn::xExecute(_convBias, (void**)convRes); }
+    if (err == E_SUCCESS) { err = dnn::xExecute(_convGrad, (void**)convRes); }
+
+    if (err == E_SUCCESS) { err = dnn::xConversionExecute(_cvFromInnerBack,    convRes[dnnResourceDiffSrc   ], resultArray); }
+    if (err == E_SUCCESS) { err = dnn::xConversionExecute(_cvFromInnerDerFilt, convRes[dnnResourceDiffFilter], wDerArray  ); }
+    if (err == E_SUCCESS) { err = dnn::xConversionExecute(_cvFromInnerDerBias, convRes[dnnResourceDiffBias  ], bDerArray  ); }
 
     inGradTable->releaseSubtensor(inGradBlock);
     xTable->releaseSubtensor(xBlock);
@@ -283,6 +314,8 @@ void Convolution2dKernel<algorithmFPType, method, cpu>::compute(const convolutio
     wDerTable->releaseSubtensor(wDerBlock);
     bDerTable->releaseSubtensor(bDerBlock);
     resultTable->releaseSubtensor(resultBlock);
+
+    ON_ERR(err);
 }
 
 } // internal
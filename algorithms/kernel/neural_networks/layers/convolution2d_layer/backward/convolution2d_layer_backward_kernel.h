@@ -27,6 +27,7 @@
 #include "neural_networks/layers/convolution2d/convolution2d_layer_types.h"
 #include "kernel.h"
 #include "service_math.h"
+#include "service_dnn.h"
 #include "numeric_table.h"
 
 using namespace daal::data_management;
@@ -54,8 +55,43 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 class Convolution2dKernel : public Kernel
 {
 public:
+    Convolution2dKernel();
+    ~Convolution2dKernel();
+
     void compute(const convolution2d::backward::Input *input, const convolution2d::Parameter *parameter,
                  convolution2d::backward::Result *result);
+
+private:
+    typedef daal::internal::Dnn<algorithmFPType, cpu> dnn;
+
+    static const size_t dimension = 4;
+
+    /* The convolution primitives, the layouts and the conversions depend only on the shapes of the
+     * layer inputs and are built once per shape; the kernel lives as long as the layer does */
+    bool isCacheValid(const size_t *xSize, const size_t *gradSize, const size_t *filterSize,
+                      const size_t *convolutionStride, const int *xOffset) const;
+    dnnError_t initCache(const size_t *xSize, const size_t *gradSize, const size_t *filterSize,
+                         const size_t *convolutionStride, const int *xOffset, size_t nKernels);
+    void releaseCache();
+
+    size_t _xSize     [dimension];
+    size_t _gradSize  [dimension];
+    size_t _filterSize[dimension];
+    size_t _convolutionStride[2];
+    int    _xOffset[2];
+    bool   _cacheValid;
+
+    dnnPrimitive_t _convFwd, _convGrad, _convFilt, _convBias;
+    dnnPrimitive_t _cvToInnerInput, _cvToInnerFilt, _cvToInnerGrad;
+    dnnPrimitive_t _cvFromInnerBack, _cvFromInnerDerFilt, _cvFromInnerDerBias;
+
+    dnnLayout_t _ltUserX, _ltUserFilt, _ltUserBias, _ltUserGrad;
+    dnnLayout_t _ltInnerInput, _ltInnerFilt, _ltInnerGrad;
+    dnnLayout_t _ltInnerBack, _ltInnerDerFilt, _ltInnerDerBias;
+
+    /* Buffers in the internal layouts, allocated only when the layouts differ from the user ones */
+    algorithmFPType *_innerInput, *_innerFilt, *_innerGrad;
+    algorithmFPType *_innerBack, *_innerDerFilt, *_innerDerBias;
 };
 
 } // internal
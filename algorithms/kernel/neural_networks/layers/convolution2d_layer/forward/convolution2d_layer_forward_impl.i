@@ -51,23 +51,139 @@ namespace forward
 namespace internal
 {
 
+/* Creates the conversion between the layouts and the buffer in the internal layout lt_pr
+ * if the layouts differ, toInner specifies the direction of the conversion */
 template<typename algorithmFPType, CpuType cpu>
-static dnnError_t init_conversion(dnnPrimitive_t *cv, algorithmFPType **ptr_out,
-                                 dnnLayout_t lt_pr, dnnLayout_t lt_us, algorithmFPType *ptr_us)
+static dnnError_t init_conversion(dnnPrimitive_t *cv, algorithmFPType **ptr_pr,
+                                 dnnLayout_t lt_pr, dnnLayout_t lt_us, bool toInner = true)
 {
     dnnError_t err = E_SUCCESS;
-    *ptr_out = NULL;
+    *cv = NULL;
+    *ptr_pr = NULL;
     if (!Dnn<algorithmFPType, cpu>::xLayoutCompare(lt_pr, lt_us))
     {
-        err = Dnn<algorithmFPType, cpu>::xConversionCreate(cv, lt_us, lt_pr);
+        err = (toInner ? Dnn<algorithmFPType, cpu>::xConversionCreate(cv, lt_us, lt_pr) :
+                         Dnn<algorithmFPType, cpu>::xConversionCreate(cv, lt_pr, lt_us));
         if(err != E_SUCCESS) return err;
-        err = Dnn<algorithmFPType, cpu>::xAllocateBuffer((void**)ptr_out, lt_pr);
+        err = Dnn<algorithmFPType, cpu>::xAllocateBuffer((void**)ptr_pr, lt_pr);
     }
-    else
+    return err;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+Convolution2dKernel<algorithmFPType, method, cpu>::Convolution2dKernel() : _cacheValid(false),
+    _convPrim(NULL), _cvToInnerInput(NULL), _cvToInnerFilt(NULL), _cvToInnerBias(NULL), _cvFromInnerOutput(NULL),
+    _ltUserInput(NULL), _ltUserFilt(NULL), _ltUserBias(NULL), _ltUserOutput(NULL),
+    _ltInnerInput(NULL), _ltInnerFilt(NULL), _ltInnerBias(NULL), _ltInnerOutput(NULL),
+    _innerInput(NULL), _innerFilt(NULL), _innerBias(NULL), _innerOutput(NULL),
+    _convertedWeights(NULL), _convertedBiases(NULL)
+{}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+Convolution2dKernel<algorithmFPType, method, cpu>::~Convolution2dKernel()
+{
+    releaseCache();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+bool Convolution2dKernel<algorithmFPType, method, cpu>::isCacheValid(const size_t *inputSize, const size_t *outputSize,
+    const size_t *filterSize, const size_t *convolutionStride, const int *inputOffset) const
+{
+    if (!_cacheValid) { return false; }
+    for (size_t i = 0; i < dimension; i++)
     {
-        *ptr_out = ptr_us;
+        if (_inputSize[i] != inputSize[i] || _outputSize[i] != outputSize[i] || _filterSize[i] != filterSize[i]) { return false; }
     }
-    return err;
+    for (size_t i = 0; i < 2; i++)
+    {
+        if (_convolutionStride[i] != convolutionStride[i] || _inputOffset[i] != inputOffset[i]) { return false; }
+    }
+    return true;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+dnnError_t Convolution2dKernel<algorithmFPType, method, cpu>::initCache(const size_t *inputSize, const size_t *outputSize,
+    const size_t *filterSize, const size_t *convolutionStride, const int *inputOffset, size_t nKernels)
+{
+    dnnError_t err;
+
+    releaseCache();
+
+    size_t inputStrides[dimension], outputStrides[dimension], filterStrides[dimension];
+    inputStrides [0] = 1;
+    outputStrides[0] = 1;
+    filterStrides[0] = 1;
+    for(size_t i=1; i<dimension; i++)
+    {
+        inputStrides [i] = inputStrides [i-1]*inputSize [i-1];
+        outputStrides[i] = outputStrides[i-1]*outputSize[i-1];
+        filterStrides[i] = filterStrides[i-1]*filterSize[i-1];
+    }
+
+    size_t  biasSize[1] = {nKernels};
+    size_t  biasStrides[1] = {1};
+
+    err = dnn::xLayoutCreate(&_ltUserInput,  dimension, inputSize,  inputStrides ); if(err != E_SUCCESS) return err;
+    err = dnn::xLayoutCreate(&_ltUserFilt,   dimension, filterSize, filterStrides); if(err != E_SUCCESS) return err;
+    err = dnn::xLayoutCreate(&_ltUserBias,   1,         biasSize,   biasStrides  ); if(err != E_SUCCESS) return err;
+    err = dnn::xLayoutCreate(&_ltUserOutput, dimension, outputSize, outputStrides); if(err != E_SUCCESS) return err;
+
+    err = dnn::xConvolutionCreateForwardBias( &_convPrim, dnnAlgorithmConvolutionDirect, dimension, inputSize, outputSize,
+        filterSize, convolutionStride, inputOffset, dnnBorderZeros); if(err != E_SUCCESS) return err;
+
+    err = dnn::xLayoutCreateFromPrimitive(&_ltInnerInput,  _convPrim, dnnResourceSrc   ); if(err != E_SUCCESS) return err;
+    err = dnn::xLayoutCreateFromPrimitive(&_ltInnerFilt,   _convPrim, dnnResourceFilter); if(err != E_SUCCESS) return err;
+    err = dnn::xLayoutCreateFromPrimitive(&_ltInnerBias,   _convPrim, dnnResourceBias  ); if(err != E_SUCCESS) return err;
+    err = dnn::xLayoutCreateFromPrimitive(&_ltInnerOutput, _convPrim, dnnResourceDst   ); if(err != E_SUCCESS) return err;
+
+    err = init_conversion<algorithmFPType, cpu>(&_cvToInnerInput,    &_innerInput,  _ltInnerInput,  _ltUserInput ); if(err != E_SUCCESS) return err;
+    err = init_conversion<algorithmFPType, cpu>(&_cvToInnerFilt,     &_innerFilt,   _ltInnerFilt,   _ltUserFilt  ); if(err != E_SUCCESS) return err;
+    err = init_conversion<algorithmFPType, cpu>(&_cvToInnerBias,     &_innerBias,   _ltInnerBias,   _ltUserBias  ); if(err != E_SUCCESS) return err;
+    err = init_conversion<algorithmFPType, cpu>(&_cvFromInnerOutput, &_innerOutput, _ltInnerOutput, _ltUserOutput,
+        false); if(err != E_SUCCESS) return err;
+
+    for (size_t i = 0; i < dimension; i++)
+    {
+        _inputSize [i] = inputSize [i];
+        _outputSize[i] = outputSize[i];
+        _filterSize[i] = filterSize[i];
+    }
+    for (size_t i = 0; i < 2; i++)
+    {
+        _convolutionStride[i] = convolutionStride[i];
+        _inputOffset      [i] = inputOffset      [i];
+    }
+    _cacheValid = true;
+
+    return E_SUCCESS;
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void Convolution2dKernel<algorithmFPType, method, cpu>::releaseCache()
+{
+    if(_innerInput ) { dnn::xReleaseBuffer(_innerInput ); _innerInput  = NULL; }
+    if(_innerFilt  ) { dnn::xReleaseBuffer(_innerFilt  ); _innerFilt   = NULL; }
+    if(_innerBias  ) { dnn::xReleaseBuffer(_innerBias  ); _innerBias   = NULL; }
+    if(_innerOutput) { dnn::xReleaseBuffer(_innerOutput); _innerOutput = NULL; }
+
+    if(_convPrim         ) { dnn::xDelete(_convPrim         ); _convPrim          = NULL; }
+    if(_cvToInnerInput   ) { dnn::xDelete(_cvToInnerInput   ); _cvToInnerInput    = NULL; }
+    if(_cvToInnerFilt    ) { dnn::xDelete(_cvToInnerFilt    ); _cvToInnerFilt     = NULL; }
+    if(_cvToInnerBias    ) { dnn::xDelete(_cvToInnerBias    ); _cvToInnerBias     = NULL; }
+    if(_cvFromInnerOutput) { dnn::xDelete(_cvFromInnerOutput); _cvFromInnerOutput = NULL; }
+
+    if(_ltUserInput  ) { dnn::xLayoutDelete(_ltUserInput  ); _ltUserInput   = NULL; }
+    if(_ltUserFilt   ) { dnn::xLayoutDelete(_ltUserFilt   ); _ltUserFilt    = NULL; }
+    if(_ltUserBias   ) { dnn::xLayoutDelete(_ltUserBias   ); _ltUserBias    = NULL; }
+    if(_ltUserOutput ) { dnn::xLayoutDelete(_ltUserOutput ); _ltUserOutput  = NULL; }
+    if(_ltInnerInput ) { dnn::xLayoutDelete(_ltInnerInput ); _ltInnerInput  = NULL; }
+    if(_ltInnerFilt  ) { dnn::xLayoutDelete(_ltInnerFilt  ); _ltInnerFilt   = NULL; }
+    if(_ltInnerBias  ) { dnn::xLayoutDelete(_ltInnerBias  ); _ltInnerBias   = NULL; }
+    if(_ltInnerOutput) { dnn::xLayoutDelete(_ltInnerOutput); _ltInnerOutput = NULL; }
+
+    _convertedWeights = NULL;
+    _convertedBiases  = NULL;
+    _cacheValid = false;
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
@@ -75,9 +191,6 @@ void Convolution2dKernel<algorithmFPType, method, cpu>::compute(const convolutio
     const convolution2d::Parameter *parameter, convolution2d::forward::Result *result)
 {
     dnnError_t err;
-    typedef Dnn<algorithmFPType, cpu> dnn;
-
-    const size_t dimension = 4;
 
     SharedPtr<Tensor> inputTable   = input->get(layers::forward::data);
     SharedPtr<Tensor> wTable       = input->get(layers::forward::weights);
@@ -107,9 +220,47 @@ void Convolution2dKernel<algorithmFPType, method, cpu>::compute(const convolutio
         outDims[i] = outDimsFull[fullSize - dimension + i];
     }
 
+    size_t inputSize [dimension];
+    size_t outputSize[dimension];
+    size_t filterSize[dimension];
+    for(size_t i=0; i<dimension; i++)
+    {
+        inputSize [i] = inDims [dimension-1-i];
+        outputSize[i] = outDims[dimension-1-i];
+        filterSize[i] = wDims  [dimension-1-i];
+    }
+
+    size_t convolutionStride[2] = {parameter->stride.size[1], parameter->stride.size[0]};
+    int    inputOffset      [2] = {-(int)(parameter->padding.size[1]), -(int)(parameter->padding.size[0])};
+
+    if (!isCacheValid(inputSize, outputSize, filterSize, convolutionStride, inputOffset))
+    {
+        err = initCache(inputSize, outputSize, filterSize, convolutionStride, inputOffset, parameter->nKernels);
+        if (err != E_SUCCESS) { releaseCache(); }
+        ON_ERR(err);
+    }
+
+    /* In the layout propagation mode the input may already be in the internal layout of the primitive
+     * and the result is written into the internal buffer of the tensor read by the next layer */
+    LayoutTensor *inputLayoutTensor  = dynamic_cast<LayoutTensor *>(inputTable.get());
+    LayoutTensor *resultLayoutTensor = dynamic_cast<LayoutTensor *>(resultTable.get());
+
+    algorithmFPType *innerInputData = (inputLayoutTensor && _cvToInnerInput ? inputLayoutTensor->getInnerData(_ltInnerInput) : NULL);
+    bool writeInnerResult = false;
+    if (resultLayoutTensor && _cvFromInnerOutput)
+    {
+        err = resultLayoutTensor->bindInnerLayout(_convPrim, dnnResourceDst);
+        ON_ERR(err);
+        writeInnerResult = true;
+    }
+
     SubtensorDescriptor<algorithmFPType> inputBlock;
-    inputTable->getSubtensor(0, 0, 0, inDimsFull[0], readOnly, inputBlock);
-    algorithmFPType *inputArray = inputBlock.getPtr();
+    algorithmFPType *inputArray = innerInputData;
+    if (!innerInputData)
+    {
+        inputTable->getSubtensor(0, 0, 0, inDimsFull[0], readOnly, inputBlock);
+        inputArray = inputBlock.getPtr();
+    }
 
     SubtensorDescriptor<algorithmFPType> wBlock;
     wTable->getSubtensor(0, 0, 0, wDims[0], readOnly, wBlock);
@@ -120,113 +271,70 @@ void Convolution2dKernel<algorithmFPType, method, cpu>::compute(const convolutio
     algorithmFPType *bArray = bBlock.getPtr();
 
     SubtensorDescriptor<algorithmFPType> resultBlock;
-    resultTable->getSubtensor(0, 0, 0, outDimsFull[0], writeOnly, resultBlock);
-    algorithmFPType *resultArray = resultBlock.getPtr();
-
-    const size_t bufferSize = 6 * dimension * sizeof(size_t);
-    size_t *buffer = (size_t*)services::daal_malloc(bufferSize);
-    if(!buffer) {this->_errors->add(services::ErrorMemoryAllocationFailed); return;}
-    size_t *inputSize     = buffer;
-    size_t *inputStrides  = buffer +     dimension;
-    size_t *outputSize    = buffer + 2 * dimension;
-    size_t *outputStrides = buffer + 3 * dimension;
-    size_t *filterSize    = buffer + 4 * dimension;
-    size_t *filterStrides = buffer + 5 * dimension;
-
-    size_t  biasSize[1] = {parameter->nKernels};
-    size_t  biasStrides[1] = {1};
-
-    inputSize    [0] = inDims [dimension-1];
-    inputStrides [0] = 1;
-    outputSize   [0] = outDims[dimension-1];
-    outputStrides[0] = 1;
-    filterSize   [0] = wDims  [dimension-1];
-    filterStrides[0] = 1;
-
-    for(size_t i=1; i<dimension; i++)
+    algorithmFPType *resultArray = NULL;
+    if (!writeInnerResult)
     {
-        inputSize    [i] = inDims[dimension-1-i];
-        inputStrides [i] = inputStrides [i-1]*inputSize[i-1];
-        outputSize   [i] = outDims[dimension-1-i];
-        outputStrides[i] = outputStrides[i-1]*outputSize[i-1];
-        filterSize   [i] = wDims[dimension-1-i];
-        filterStrides[i] = filterStrides[i-1]*filterSize[i-1];
+        resultTable->getSubtensor(0, 0, 0, outDimsFull[0], writeOnly, resultBlock);
+        resultArray = resultBlock.getPtr();
     }
 
-    size_t convolutionStride[2] = {parameter->stride.size[1], parameter->stride.size[0]};
-    int    inputOffset      [2] = {-(int)(parameter->padding.size[1]), -(int)(parameter->padding.size[0])};
-
-    dnnLayout_t ltUserInput=NULL, ltUserFilt=NULL, ltUserBias=NULL, ltUserOutput=NULL;
-
-    err = dnn::xLayoutCreate(&ltUserInput,  dimension, inputSize,  inputStrides ); ON_ERR(err);
-    err = dnn::xLayoutCreate(&ltUserFilt,   dimension, filterSize, filterStrides); ON_ERR(err);
-    err = dnn::xLayoutCreate(&ltUserBias,   1,         biasSize,   biasStrides  ); ON_ERR(err);
-    err = dnn::xLayoutCreate(&ltUserOutput, dimension, outputSize, outputStrides); ON_ERR(err);
-
-    dnnPrimitive_t convPrim = NULL;
-
-    err = dnn::xConvolutionCreateForwardBias( &convPrim, dnnAlgorithmConvolutionDirect, dimension, inputSize, outputSize,
-        filterSize, convolutionStride, inputOffset, dnnBorderZeros);  ON_ERR(err);
-
-    dnnLayout_t ltInnerInput = NULL, ltInnerFilt = NULL, ltInnerBias = NULL, ltInnerOutput = NULL;
-
-    err = dnn::xLayoutCreateFromPrimitive(&ltInnerInput,  convPrim, dnnResourceSrc   ); ON_ERR(err);
-    err = dnn::xLayoutCreateFromPrimitive(&ltInnerFilt,   convPrim, dnnResourceFilter); ON_ERR(err);
-    err = dnn::xLayoutCreateFromPrimitive(&ltInnerBias,   convPrim, dnnResourceBias  ); ON_ERR(err);
-    err = dnn::xLayoutCreateFromPrimitive(&ltInnerOutput, convPrim, dnnResourceDst   ); ON_ERR(err);
-
-    algorithmFPType* uOut;
     algorithmFPType* convRes[dnnResourceNumber] = {0};
-    dnnPrimitive_t cvToInnerInput = NULL, cvToInnerFilt = NULL, cvToInnerBias = NULL, cvFromInnerOutput = NULL;
-    err = init_conversion<algorithmFPType, cpu>(&cvToInnerInput, &convRes[dnnResourceSrc],    ltInnerInput, ltUserInput,
-        (algorithmFPType*)inputArray); ON_ERR(err);
-    err = init_conversion<algorithmFPType, cpu>(&cvToInnerFilt,  &convRes[dnnResourceFilter], ltInnerFilt,  ltUserFilt,
-        (algorithmFPType*)wArray    ); ON_ERR(err);
-    err = init_conversion<algorithmFPType, cpu>(&cvToInnerBias,  &convRes[dnnResourceBias],   ltInnerBias,  ltUserBias,
-        (algorithmFPType*)bArray    ); ON_ERR(err);
-
-    err = dnn::xAllocateBuffer((void**) &convRes[dnnResourceDst],    ltInnerOutput); ON_ERR(err);
-
-    err = init_conversion<algorithmFPType, cpu>(&cvFromInnerOutput, (algorithmFPType**)&uOut, ltUserOutput, ltInnerOutput,
-        convRes[dnnResourceDst]); ON_ERR(err);
-
-    err = dnn::xConversionExecute(cvToInnerInput, inputArray, convRes[dnnResourceSrc]   ); ON_ERR(err);
-    err = dnn::xConversionExecute(cvToInnerFilt,  wArray,     convRes[dnnResourceFilter]); ON_ERR(err);
-    err = dnn::xConversionExecute(cvToInnerBias,  bArray,     convRes[dnnResourceBias]  ); ON_ERR(err);
-
-    err = dnn::xExecute(convPrim, (void**)convRes); ON_ERR(err);
-
-    err = dnn::xConversionExecute(cvFromInnerOutput, convRes[dnnResourceDst], uOut); ON_ERR(err);
-
-    size_t size = resultBlock.getSize();
-    for(size_t i=0; i<size; i++)
+    convRes[dnnResourceSrc   ] = (_cvToInnerInput && !innerInputData ? _innerInput : inputArray);
+    convRes[dnnResourceFilter] = (_cvToInnerFilt     ? _innerFilt   : wArray     );
+    convRes[dnnResourceBias  ] = (_cvToInnerBias     ? _innerBias   : bArray     );
+    convRes[dnnResourceDst   ] = (writeInnerResult ? resultLayoutTensor->getInnerBuffer() :
+                                 (_cvFromInnerOutput ? _innerOutput : resultArray));
+
+    /* Weights and biases do not change at the prediction stage, so their converted copies are reused
+     * until other weights or biases are passed to the layer. Otherwise they may have been updated
+     * in place by the optimization solver and are converted on every call */
+    if (!parameter->predictionStage || _convertedWeights != wArray || _convertedBiases != bArray)
     {
-        resultArray[i] = uOut[i];
+        err = dnn::xConversionExecute(_cvToInnerFilt, wArray, convRes[dnnResourceFilter]);
+        if (err == E_SUCCESS)
+        {
+            err = dnn::xConversionExecute(_cvToInnerBias, bArray, convRes[dnnResourceBias]);
+        }
+        _convertedWeights = (parameter->predictionStage && err == E_SUCCESS ? wArray : NULL);
+        _convertedBiases  = (parameter->predictionStage && err == E_SUCCESS ? bArray : NULL);
+    }
+    else
+    {
+        err = E_SUCCESS;
     }
 
-    dnn::xReleaseBuffer(convRes[dnnResourceDst]);
-
-    dnn::xDelete(convPrim);
-    dnn::xDelete(cvToInnerInput);
-    dnn::xDelete(cvToInnerFilt);
-    dnn::xDelete(cvToInnerBias);
-    dnn::xDelete(cvFromInnerOutput);
-
-    dnn::xLayoutDelete(ltUserInput);
-    dnn::xLayoutDelete(ltUserFilt);
-    dnn::xLayoutDelete(ltUserBias);
-    dnn::xLayoutDelete(ltUserOutput);
-    dnn::xLayoutDelete(ltInnerInput);
-    dnn::xLayoutDelete(ltInnerFilt);
-    dnn::xLayoutDelete(ltInnerBias);
-    dnn::xLayoutDelete(ltInnerOutput);
-
-    services::daal_free(buffer);
+    if (err == E_SUCCESS && !innerInputData)
+    {
+        err = dnn::xConversionExecute(_cvToInnerInput, inputArray, convRes[dnnResourceSrc]);
+    }
+    if (err == E_SUCCESS)
+    {
+        err = dnn::xExecute(_convPrim, (void**)convRes);
+    }
+    if (err == E_SUCCESS)
+    {
+        if (writeInnerResult)
+        {
+            resultLayoutTensor->setInnerDataValid();
+        }
+        else
+        {
+            err = dnn::xConversionExecute(_cvFromInnerOutput, convRes[dnnResourceDst], resultArray);
+        }
+    }
 
-    inputTable->releaseSubtensor(inputBlock);
+    if (!innerInputData)
+    {
+        inputTable->releaseSubtensor(inputBlock);
+    }
     wTable->releaseSubtensor(wBlock);
     bTable->releaseSubtensor(bBlock);
-    resultTable->releaseSubtensor(resultBlock);
+    if (!writeInnerResult)
+    {
+        resultTable->releaseSubtensor(resultBlock);
+    }
+
+    ON_ERR(err);
 }
 
 } // internal
@@ -27,6 +27,8 @@
 #include "neural_networks/layers/convolution2d/convolution2d_layer_types.h"
 #include "kernel.h"
 #include "service_math.h"
+#include "service_dnn.h"
+#include "neural_networks_dnn_tensor.h"
 #include "numeric_table.h"
 
 using namespace daal::data_management;
@@ -53,8 +55,44 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 class Convolution2dKernel : public Kernel
 {
 public:
+    Convolution2dKernel();
+    ~Convolution2dKernel();
+
     void compute(const convolution2d::forward::Input *input, const convolution2d::Parameter *parameter,
                  convolution2d::forward::Result *result);
+
+private:
+    typedef daal::internal::Dnn<algorithmFPType, cpu> dnn;
+    typedef neural_networks::internal::DnnLayoutTensor<algorithmFPType, cpu> LayoutTensor;
+
+    static const size_t dimension = 4;
+
+    /* The convolution primitive, the layouts and the conversions depend only on the shapes of the
+     * layer inputs and are built once per shape; the kernel lives as long as the layer does */
+    bool isCacheValid(const size_t *inputSize, const size_t *outputSize, const size_t *filterSize,
+                      const size_t *convolutionStride, const int *inputOffset) const;
+    dnnError_t initCache(const size_t *inputSize, const size_t *outputSize, const size_t *filterSize,
+                         const size_t *convolutionStride, const int *inputOffset, size_t nKernels);
+    void releaseCache();
+
+    size_t _inputSize [dimension];
+    size_t _outputSize[dimension];
+    size_t _filterSize[dimension];
+    size_t _convolutionStride[2];
+    int    _inputOffset[2];
+    bool   _cacheValid;
+
+    dnnPrimitive_t _convPrim;
+    dnnPrimitive_t _cvToInnerInput, _cvToInnerFilt, _cvToInnerBias, _cvFromInnerOutput;
+
+    dnnLayout_t _ltUserInput, _ltUserFilt, _ltUserBias, _ltUserOutput;
+    dnnLayout_t _ltInnerInput, _ltInnerFilt, _ltInnerBias, _ltInnerOutput;
+
+    /* Buffers in the internal layouts, allocated only when the layouts differ from the user ones */
+    algorithmFPType *_innerInput, *_innerFilt, *_innerBias, *_innerOutput;
+
+    /* Weights and biases the converted buffers were obtained from at the prediction stage */
+    const algorithmFPType *_convertedWeights, *_convertedBiases;
 };
 } // internal
 } // forward
@@ -56,6 +56,9 @@ public:
     void compute(const average_pooling1d::backward::Input *input,
                 const average_pooling1d::Parameter *parameter,
                 average_pooling1d::backward::Result *result);
+
+protected:
+    static size_t const nKernelDims = 1; /*!< Number of kernel dimensions */
 };
 
 } // internal
@@ -56,6 +56,9 @@ public:
     void compute(const maximum_pooling1d::backward::Input *input,
                 const maximum_pooling1d::Parameter *parameter,
                 maximum_pooling1d::backward::Result *result);
+
+protected:
+    static size_t const nKernelDims = 1; /*!< Number of kernel dimensions */
 };
 
 } // internal
@@ -57,6 +57,9 @@ public:
                  const average_pooling1d::Parameter *parameter,
                  average_pooling1d::forward::Result *result);
 
+protected:
+    static size_t const nKernelDims = 1; /*!< Number of kernel dimensions */
+
 };
 } // internal
 } // forward
@@ -25,8 +25,7 @@
 #define __MAXIMUM_POOLING1D_LAYER_FORWARD_KERNEL_IMPL_I__
 
 #include "service_memory.h"
-#include "service_data_utils.h"
-#include "service_blas.h"
+#include "pooling_layer_task.h"
 
 using namespace daal::services;
 
@@ -49,98 +48,40 @@ void PoolingKernel<algorithmFPType, method, cpu>::compute(
     const maximum_pooling1d::forward::Input *input, const maximum_pooling1d::Parameter *parameter,
     maximum_pooling1d::forward::Result *result)
 {
-    const algorithmFPType zero = 0.0;
-    const algorithmFPType one = 1.0;
-
     SharedPtr<Tensor> dataTensor = input->get(layers::forward::data);
-    SharedPtr<Tensor> maskTensor = result->get(auxMask);
     SharedPtr<Tensor> valueTensor = result->get(layers::forward::value);
+    SharedPtr<Tensor> selectedIndicesTensor = result->get(auxSelectedIndices);
 
     const Collection<size_t> &dims = dataTensor->getDimensions();
     const Collection<size_t> &valueDims = valueTensor->getDimensions();
-    SubtensorDescriptor<algorithmFPType> dataBlock, maskBlock, valueBlock;
-    dataTensor->getSubtensor(0, 0, 0, dims[0], readOnly, dataBlock);
-    maskTensor->getSubtensor(0, 0, 0, dims[0], writeOnly, maskBlock);
-    valueTensor->getSubtensor(0, 0, 0, valueDims[0], writeOnly, valueBlock);
-
-    algorithmFPType *data = dataBlock.getPtr();
-    algorithmFPType *mask = maskBlock.getPtr();
-    algorithmFPType *value = valueBlock.getPtr();
-
-    size_t maskSize = maskBlock.getSize();
-    daal::services::internal::service_memset<algorithmFPType, cpu>(mask, zero, maskSize);
 
-    size_t firstIndex    = parameter->indices.size[0];
-    size_t firstPadding  = parameter->padding.size[0];
-    size_t firstStride   = parameter->stride.size[0];
-    MKL_INT firstKernelSize  = (MKL_INT)(parameter->kernelSize.size[0]);
-
-    /*
-     * Input data tensor is viewed by this method as a 3-dimensional tensor of size:
-     * offsetBefore * firstSize * offsetAfter
-     */
-    size_t offsetBefore = 1;
-    for (size_t i = 0; i < firstIndex; i++)
+    SharedPtr<NumericTable> inputDimensionsTable = result->get(auxInputDimensions);
+    data_management::BlockDescriptor<int> block;
+    inputDimensionsTable->getBlockOfRows(0, 1, data_management::writeOnly, block);
+    int *inputDimensionsInt = block.getBlockPtr();
+    for(size_t i = 0; i < inputDimensionsTable->getNumberOfColumns(); i++)
     {
-        offsetBefore *= dims[i];
+        inputDimensionsInt[i] = (int)dims[i];
     }
-    size_t firstSize = dims[firstIndex];
-    size_t firstOutSize = valueDims[firstIndex];
-    size_t offsetAfter = 1;
-    for (size_t i = firstIndex + 1; i < dims.size(); i++)
-    {
-        offsetAfter *= dims[i];
-    }
-
-    for (MKL_INT i = 0; i < (MKL_INT)offsetBefore; i++)
-    {
-        /*
-         * Loop by the first kernel dimension
-         * f - index of the left upper corner of the kernel
-         * fo - index of the output value
-         */
-        for (MKL_INT f = -firstPadding, fo = 0; fo < (MKL_INT)firstOutSize; f += firstStride, fo++)
-        {
-            for (MKL_INT j = 0; j < (MKL_INT)offsetAfter; j++)
-            {
-                /*
-                 * Resulting value index
-                 */
-                MKL_INT valueIndex = j + offsetAfter * (fo + firstOutSize * i);
+    inputDimensionsTable->releaseBlockOfRows(block);
 
-                algorithmFPType max = -(data_feature_utils::internal::MaxVal<algorithmFPType, cpu>::get());
-                MKL_INT maxIdx = -1;
+    SubtensorDescriptor<algorithmFPType> dataBlock, valueBlock;
+    SubtensorDescriptor<int> selectedIndicesBlock;
+    dataTensor->getSubtensor(0, 0, 0, dims[0], readOnly, dataBlock);
+    valueTensor->getSubtensor(0, 0, 0, valueDims[0], writeOnly, valueBlock);
+    selectedIndicesTensor->getSubtensor(0, 0, 0, valueDims[0], writeOnly, selectedIndicesBlock);
 
-                /*
-                 * Loop over the kernel
-                 */
-                for (MKL_INT fi = f; fi < f + firstKernelSize; fi++)
-                {
-                    MKL_INT dataIndex = j + offsetAfter * (fi + firstSize * i);
-                    bool paddingFlag = (fi < 0) || (fi >= (MKL_INT)firstSize);
-                    algorithmFPType dataValue = (paddingFlag ? zero : data[dataIndex]);
+    /*
+     * Only the position of the maximum element in the input is stored for each output element,
+     * so the size of the auxiliary data is the size of the output rather than the size of the input
+     */
+    layers::internal::PoolingTask<algorithmFPType, cpu> task(nKernelDims, parameter->indices.size, parameter->padding.size,
+        parameter->stride.size, parameter->kernelSize.size, dims, valueDims);
+    task.computeMaximum(dataBlock.getPtr(), valueBlock.getPtr(), selectedIndicesBlock.getPtr());
 
-                    if (dataValue > max)
-                    {
-                        max = dataValue;
-                        if (!paddingFlag)
-                        {
-                            maxIdx = dataIndex;
-                        }
-                        else
-                        {
-                            maxIdx = -1;
-                        }
-                    }
-                }
-                value[valueIndex] = max;
-                if (maxIdx != -1) { mask[maxIdx] = one; }
-            }
-        }
-    }
     dataTensor->releaseSubtensor(dataBlock);
-    maskTensor->releaseSubtensor(maskBlock);
     valueTensor->releaseSubtensor(valueBlock);
+    selectedIndicesTensor->releaseSubtensor(selectedIndicesBlock);
 }
 
 } // namespace internal
@@ -56,6 +56,9 @@ public:
     void compute(const average_pooling2d::backward::Input *input,
                 const average_pooling2d::Parameter *parameter,
                 average_pooling2d::backward::Result *result);
+
+protected:
+    static size_t const nKernelDims = 2; /*!< Number of kernel dimensions */
 };
 
 } // internal
@@ -56,6 +56,9 @@ public:
     void compute(const maximum_pooling2d::backward::Input *input,
                 const maximum_pooling2d::Parameter *parameter,
                 maximum_pooling2d::backward::Result *result);
+
+protected:
+    static size_t const nKernelDims = 2; /*!< Number of kernel dimensions */
 };
 
 } // internal
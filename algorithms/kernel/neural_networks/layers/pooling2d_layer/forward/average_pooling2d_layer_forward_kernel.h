@@ -56,6 +56,9 @@ public:
     void compute(const average_pooling2d::forward::Input *input,
                  const average_pooling2d::Parameter *parameter,
                  average_pooling2d::forward::Result *result);
+
+protected:
+    static size_t const nKernelDims = 2; /*!< Number of kernel dimensions */
 };
 
 } // internal
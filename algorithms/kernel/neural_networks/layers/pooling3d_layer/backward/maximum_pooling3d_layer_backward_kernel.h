@@ -59,13 +59,6 @@ public:
                 maximum_pooling3d::backward::Result *result);
 
 protected:
-    void recurrentCompute(size_t d,
-                MKL_INT *ii, MKL_INT *ik, MKL_INT *iv,
-                const MKL_INT *padding, const MKL_INT *stride, const MKL_INT *kernelSize,
-                const MKL_INT* gradSize, const MKL_INT* inputSize,
-                const MKL_INT* offset, MKL_INT* gradOffset, MKL_INT* inputOffset,
-                const algorithmFPType *inputGrad, algorithmFPType *grad, algorithmFPType *mask);
-
     static size_t const nKernelDims = 3; /*!< Number of kernel dimensions */
 };
 
@@ -59,13 +59,6 @@ public:
                  maximum_pooling3d::forward::Result *result);
 
 protected:
-    void recurrentCompute(size_t d,
-                MKL_INT *ii, MKL_INT *ik, MKL_INT *iv,
-                const MKL_INT *padding, const MKL_INT *stride, const MKL_INT *kernelSize,
-                const MKL_INT* dataSize, const MKL_INT* valueSize,
-                const MKL_INT* offset, MKL_INT* dataOffset, MKL_INT* valueOffset,
-                const algorithmFPType *data, algorithmFPType *value, algorithmFPType *mask);
-
     static size_t const nKernelDims = 3; /*!< Number of kernel dimensions */
 };
 
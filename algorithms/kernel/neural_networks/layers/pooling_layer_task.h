@@ -0,0 +1,567 @@
+/* file: pooling_layer_task.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Implementation of the computations shared by the 1D, 2D and 3D pooling layers
+//--
+
+
+#ifndef __POOLING_LAYER_TASK_H__
+#define __POOLING_LAYER_TASK_H__
+
+#include "services/collection.h"
+#include "service_defines.h"
+#include "service_memory.h"
+#include "service_data_utils.h"
+#include "service_blas.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace layers
+{
+namespace internal
+{
+
+/**
+ *  \brief Geometry of the pooling and the computational routines of the maximum and average pooling layers.
+ *
+ *  The input tensor is viewed as a (2 * nKernelDims + 1)-dimensional tensor of size:
+ *  offset[0] * dataSize[0] * offset[1] * dataSize[1] * ... * dataSize[nKernelDims - 1] * offset[nKernelDims],
+ *  where dataSize are the sizes of the dimensions the kernel is applied to.
+ *  The product of offset[0], ..., offset[nKernelDims - 1] (batch x channels in the typical case) forms independent
+ *  slices of the tensor, the computations are parallelized over these slices.
+ *  Along the last pooled dimension the output positions whose kernel windows lie entirely inside the input are
+ *  processed without any padding checks, the innermost loops run along the contiguous dimension of the data:
+ *  either along offset[nKernelDims] or, if it is 1, along the last pooled dimension.
+ */
+template<typename algorithmFPType, CpuType cpu>
+class PoolingTask
+{
+public:
+    static const size_t maxKernelDims = 3;
+
+    /**
+     * Constructs the pooling task
+     * \param[in] nKernelDims  Number of the dimensions the kernel is applied to
+     * \param[in] indices      Indices of the dimensions the kernel is applied to, in any order
+     * \param[in] padding      Paddings for the dimensions in the order of indices
+     * \param[in] stride       Strides for the dimensions in the order of indices
+     * \param[in] kernelSize   Sizes of the kernel for the dimensions in the order of indices
+     * \param[in] dataDims     Dimensions of the input tensor
+     * \param[in] valueDims    Dimensions of the output tensor
+     */
+    PoolingTask(size_t nKernelDims, const size_t *indices, const size_t *padding, const size_t *stride,
+                const size_t *kernelSize, const services::Collection<size_t> &dataDims,
+                const services::Collection<size_t> &valueDims);
+
+    /**
+     * Computes the maximum pooling and the positions of the selected elements.
+     * The position is the index of the element in the slice of the input tensor or -1 if the padding is selected
+     */
+    void computeMaximum(const algorithmFPType *data, algorithmFPType *value, int *selectedIndices) const;
+
+    /** Computes the gradient of the maximum pooling from the positions of the selected elements */
+    void computeMaximumGradient(const algorithmFPType *inputGradient, const int *selectedIndices,
+                                algorithmFPType *gradient) const;
+
+    /** Computes the average pooling */
+    void computeAverage(const algorithmFPType *data, algorithmFPType *value) const;
+
+    /** Computes the gradient of the average pooling, the padding gets no gradient */
+    void computeAverageGradient(const algorithmFPType *inputGradient, algorithmFPType *gradient) const;
+
+protected:
+    /* Kernel window along the leading pooled dimensions for one output row */
+    struct Window
+    {
+        MKL_INT first[maxKernelDims];
+        MKL_INT last [maxKernelDims];
+        bool clipped;
+    };
+
+    void getSliceOffsets(size_t slice, size_t &dataOffset, size_t &valueOffset) const;
+    void getWindow(size_t row, Window &window, size_t &valueRowOffset) const;
+    size_t nextWindowRow(const Window &window, MKL_INT *pos) const;
+
+    void initMaximumRow(algorithmFPType *value, int *selectedIndices, bool clipped) const;
+    void maximumRow(const algorithmFPType *data, int dataRowOffset, algorithmFPType *value, int *selectedIndices) const;
+    void sumRow(const algorithmFPType *data, algorithmFPType *value) const;
+    void spreadRow(const algorithmFPType *inputGradient, algorithmFPType *gradient) const; /* Adds the scaled gradient */
+
+    size_t _nKernelDims;
+    MKL_INT _padding[maxKernelDims];
+    MKL_INT _stride[maxKernelDims];
+    MKL_INT _kernelSize[maxKernelDims];
+    MKL_INT _dataSize[maxKernelDims];
+    MKL_INT _valueSize[maxKernelDims];
+    size_t _offset[maxKernelDims + 1];
+
+    size_t _dataStride[maxKernelDims];          /* Distance between the neighbour elements along the pooled dimensions */
+    size_t _valueStride[maxKernelDims];
+    size_t _dataOffsetStride[maxKernelDims];    /* Distance between the neighbour elements along the offset dimensions */
+    size_t _valueOffsetStride[maxKernelDims];
+
+    size_t _nSlices;         /* Number of the independent slices of the tensor */
+    size_t _nRows;           /* Number of the output rows (positions along the leading pooled dimensions) in a slice */
+    size_t _rowSize;         /* Number of the output elements in a row */
+    MKL_INT _interiorFirst;  /* Output positions along the last pooled dimension whose windows need no padding */
+    MKL_INT _interiorLast;
+    algorithmFPType _kernelVolumeInv;
+};
+
+template<typename algorithmFPType, CpuType cpu>
+PoolingTask<algorithmFPType, cpu>::PoolingTask(size_t nKernelDims, const size_t *indices, const size_t *padding,
+    const size_t *stride, const size_t *kernelSize, const services::Collection<size_t> &dataDims,
+    const services::Collection<size_t> &valueDims) : _nKernelDims(nKernelDims)
+{
+    /* Arrange the pooled dimensions in the ascending order of their indices */
+    size_t order[maxKernelDims];
+    for (size_t d = 0; d < nKernelDims; d++) { order[d] = d; }
+    for (size_t d = 1; d < nKernelDims; d++)
+    {
+        for (size_t e = d; e > 0 && indices[order[e]] < indices[order[e - 1]]; e--)
+        {
+            size_t tmp = order[e]; order[e] = order[e - 1]; order[e - 1] = tmp;
+        }
+    }
+
+    size_t kernelVolume = 1;
+    for (size_t d = 0; d < nKernelDims; d++)
+    {
+        _padding[d]    = (MKL_INT)padding   [order[d]];
+        _stride[d]     = (MKL_INT)stride    [order[d]];
+        _kernelSize[d] = (MKL_INT)kernelSize[order[d]];
+        _dataSize[d]   = (MKL_INT)dataDims [indices[order[d]]];
+        _valueSize[d]  = (MKL_INT)valueDims[indices[order[d]]];
+        kernelVolume *= kernelSize[order[d]];
+    }
+    _kernelVolumeInv = (algorithmFPType)1.0 / (algorithmFPType)kernelVolume;
+
+    size_t prevIndex = 0;
+    for (size_t d = 0; d <= nKernelDims; d++)
+    {
+        size_t index = (d < nKernelDims ? indices[order[d]] : dataDims.size());
+        _offset[d] = 1;
+        for (size_t i = (d == 0 ? 0 : prevIndex + 1); i < index; i++)
+        {
+            _offset[d] *= dataDims[i];
+        }
+        prevIndex = index;
+    }
+
+    size_t dataStride = _offset[nKernelDims], valueStride = _offset[nKernelDims];
+    _nSlices = 1;
+    _nRows = 1;
+    for (size_t d = nKernelDims; d-- > 0;)
+    {
+        _dataStride [d] = dataStride;
+        _valueStride[d] = valueStride;
+        dataStride  *= _dataSize [d];
+        valueStride *= _valueSize[d];
+        _dataOffsetStride [d] = dataStride;
+        _valueOffsetStride[d] = valueStride;
+        dataStride  *= _offset[d];
+        valueStride *= _offset[d];
+
+        _nSlices *= _offset[d];
+        if (d + 1 < nKernelDims) { _nRows *= _valueSize[d]; }
+    }
+
+    const size_t last = nKernelDims - 1;
+    _rowSize = _valueSize[last] * _offset[nKernelDims];
+
+    _interiorFirst = _valueSize[last];
+    _interiorLast  = _valueSize[last];
+    for (MKL_INT o = 0; o < _valueSize[last]; o++)
+    {
+        MKL_INT first = o * _stride[last] - _padding[last];
+        bool inside = (first >= 0 && first + _kernelSize[last] <= _dataSize[last]);
+        if (inside && _interiorFirst == _valueSize[last]) { _interiorFirst = o; }
+        if (inside) { _interiorLast = o + 1; }
+    }
+    if (_interiorFirst == _valueSize[last]) { _interiorLast = _interiorFirst; }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void PoolingTask<algorithmFPType, cpu>::getSliceOffsets(size_t slice, size_t &dataOffset, size_t &valueOffset) const
+{
+    dataOffset = 0;
+    valueOffset = 0;
+    for (size_t d = _nKernelDims; d-- > 0;)
+    {
+        size_t i = slice % _offset[d];
+        slice /= _offset[d];
+        dataOffset  += i * _dataOffsetStride [d];
+        valueOffset += i * _valueOffsetStride[d];
+    }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void PoolingTask<algorithmFPType, cpu>::getWindow(size_t row, Window &window, size_t &valueRowOffset) const
+{
+    window.clipped = false;
+    valueRowOffset = 0;
+    for (size_t d = _nKernelDims - 1; d-- > 0;)
+    {
+        MKL_INT o = (MKL_INT)(row % _valueSize[d]);
+        row /= _valueSize[d];
+        valueRowOffset += o * _valueStride[d];
+
+        MKL_INT first = o * _stride[d] - _padding[d];
+        MKL_INT last  = first + _kernelSize[d];
+        window.clipped = window.clipped || first < 0 || last > _dataSize[d];
+        window.first[d] = (first < 0 ? 0 : first);
+        window.last [d] = (last > _dataSize[d] ? _dataSize[d] : last);
+        if (window.first[d] >= window.last[d]) { window.first[d] = window.last[d]; }
+    }
+}
+
+/* Moves pos to the next position of the window along the leading pooled dimensions in the row-major order,
+ * returns the number of the leading dimensions or 0 if the window is over */
+template<typename algorithmFPType, CpuType cpu>
+size_t PoolingTask<algorithmFPType, cpu>::nextWindowRow(const Window &window, MKL_INT *pos) const
+{
+    for (size_t d = _nKernelDims - 1; d-- > 0;)
+    {
+        if (++pos[d] < window.last[d]) { return _nKernelDims - 1; }
+        pos[d] = window.first[d];
+    }
+    return 0;
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void PoolingTask<algorithmFPType, cpu>::initMaximumRow(algorithmFPType *value, int *selectedIndices, bool clipped) const
+{
+    const algorithmFPType zero = 0.0;
+    const algorithmFPType lowest = -(data_feature_utils::internal::MaxVal<algorithmFPType, cpu>::get());
+    const size_t inner = _offset[_nKernelDims];
+    const size_t interiorFirst = _interiorFirst * inner;
+    const size_t interiorLast  = _interiorLast  * inner;
+
+    /* Padding is treated as zero values, so the windows that cover the padding start from zero */
+    for (size_t i = 0; i < _rowSize; i++)
+    {
+        value[i] = ((clipped || i < interiorFirst || i >= interiorLast) ? zero : lowest);
+        selectedIndices[i] = -1;
+    }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void PoolingTask<algorithmFPType, cpu>::maximumRow(const algorithmFPType *data, int dataRowOffset,
+    algorithmFPType *value, int *selectedIndices) const
+{
+    const size_t last = _nKernelDims - 1;
+    const MKL_INT inner = (MKL_INT)_offset[_nKernelDims];
+    const MKL_INT stride = _stride[last];
+    const MKL_INT dataSize = _dataSize[last];
+
+    for (MKL_INT k = 0; k < _kernelSize[last]; k++)
+    {
+        const MKL_INT shift = k - _padding[last];
+        if (inner == 1)
+        {
+            for (MKL_INT o = 0; o < _interiorFirst; o++)
+            {
+                MKL_INT x = o * stride + shift;
+                if (x >= 0 && x < dataSize && data[x] > value[o]) { value[o] = data[x]; selectedIndices[o] = dataRowOffset + x; }
+            }
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+            for (MKL_INT o = _interiorFirst; o < _interiorLast; o++)
+            {
+                MKL_INT x = o * stride + shift;
+                if (data[x] > value[o]) { value[o] = data[x]; selectedIndices[o] = dataRowOffset + x; }
+            }
+            for (MKL_INT o = _interiorLast; o < _valueSize[last]; o++)
+            {
+                MKL_INT x = o * stride + shift;
+                if (x >= 0 && x < dataSize && data[x] > value[o]) { value[o] = data[x]; selectedIndices[o] = dataRowOffset + x; }
+            }
+        }
+        else
+        {
+            for (MKL_INT o = 0; o < _valueSize[last]; o++)
+            {
+                MKL_INT x = o * stride + shift;
+                if (x < 0 || x >= dataSize) { continue; }
+
+                const algorithmFPType *src = data + x * inner;
+                algorithmFPType *dst = value + o * inner;
+                int *dstIndices = selectedIndices + o * inner;
+                const int srcOffset = dataRowOffset + x * inner;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+                for (MKL_INT j = 0; j < inner; j++)
+                {
+                    if (src[j] > dst[j]) { dst[j] = src[j]; dstIndices[j] = srcOffset + j; }
+                }
+            }
+        }
+    }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void PoolingTask<algorithmFPType, cpu>::sumRow(const algorithmFPType *data, algorithmFPType *value) const
+{
+    const size_t last = _nKernelDims - 1;
+    const MKL_INT inner = (MKL_INT)_offset[_nKernelDims];
+    const MKL_INT stride = _stride[last];
+    const MKL_INT dataSize = _dataSize[last];
+
+    for (MKL_INT k = 0; k < _kernelSize[last]; k++)
+    {
+        const MKL_INT shift = k - _padding[last];
+        if (inner == 1)
+        {
+            for (MKL_INT o = 0; o < _interiorFirst; o++)
+            {
+                MKL_INT x = o * stride + shift;
+                if (x >= 0 && x < dataSize) { value[o] += data[x]; }
+            }
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+            for (MKL_INT o = _interiorFirst; o < _interiorLast; o++)
+            {
+                value[o] += data[o * stride + shift];
+            }
+            for (MKL_INT o = _interiorLast; o < _valueSize[last]; o++)
+            {
+                MKL_INT x = o * stride + shift;
+                if (x >= 0 && x < dataSize) { value[o] += data[x]; }
+            }
+        }
+        else
+        {
+            for (MKL_INT o = 0; o < _valueSize[last]; o++)
+            {
+                MKL_INT x = o * stride + shift;
+                if (x < 0 || x >= dataSize) { continue; }
+
+                const algorithmFPType *src = data + x * inner;
+                algorithmFPType *dst = value + o * inner;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+                for (MKL_INT j = 0; j < inner; j++)
+                {
+                    dst[j] += src[j];
+                }
+            }
+        }
+    }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void PoolingTask<algorithmFPType, cpu>::spreadRow(const algorithmFPType *inputGradient, algorithmFPType *gradient) const
+{
+    const algorithmFPType multiplier = _kernelVolumeInv;
+    const size_t last = _nKernelDims - 1;
+    const MKL_INT inner = (MKL_INT)_offset[_nKernelDims];
+    const MKL_INT stride = _stride[last];
+    const MKL_INT dataSize = _dataSize[last];
+
+    /* For a fixed position in the kernel different outputs update different inputs,
+     * so the loops over the outputs have no dependencies */
+    for (MKL_INT k = 0; k < _kernelSize[last]; k++)
+    {
+        const MKL_INT shift = k - _padding[last];
+        if (inner == 1)
+        {
+            for (MKL_INT o = 0; o < _interiorFirst; o++)
+            {
+                MKL_INT x = o * stride + shift;
+                if (x >= 0 && x < dataSize) { gradient[x] += multiplier * inputGradient[o]; }
+            }
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+            for (MKL_INT o = _interiorFirst; o < _interiorLast; o++)
+            {
+                gradient[o * stride + shift] += multiplier * inputGradient[o];
+            }
+            for (MKL_INT o = _interiorLast; o < _valueSize[last]; o++)
+            {
+                MKL_INT x = o * stride + shift;
+                if (x >= 0 && x < dataSize) { gradient[x] += multiplier * inputGradient[o]; }
+            }
+        }
+        else
+        {
+            for (MKL_INT o = 0; o < _valueSize[last]; o++)
+            {
+                MKL_INT x = o * stride + shift;
+                if (x < 0 || x >= dataSize) { continue; }
+
+                const algorithmFPType *src = inputGradient + o * inner;
+                algorithmFPType *dst = gradient + x * inner;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+                for (MKL_INT j = 0; j < inner; j++)
+                {
+                    dst[j] += multiplier * src[j];
+                }
+            }
+        }
+    }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void PoolingTask<algorithmFPType, cpu>::computeMaximum(const algorithmFPType *data, algorithmFPType *value,
+    int *selectedIndices) const
+{
+    /* The rows of the output are independent, so the work is split over all rows of all slices */
+    const size_t nRows = _nRows;
+    daal::threader_for(_nSlices * nRows, _nSlices * nRows, [ = ](int task)
+    {
+        size_t dataOffset, valueOffset, valueRowOffset;
+        getSliceOffsets(task / nRows, dataOffset, valueOffset);
+
+        Window window;
+        getWindow(task % nRows, window, valueRowOffset);
+
+        algorithmFPType *valueRow = value + valueOffset + valueRowOffset;
+        int *selectedIndicesRow = selectedIndices + valueOffset + valueRowOffset;
+        initMaximumRow(valueRow, selectedIndicesRow, window.clipped);
+
+        MKL_INT pos[maxKernelDims];
+        for (size_t d = 0; d + 1 < _nKernelDims; d++)
+        {
+            if (window.first[d] == window.last[d]) { return; }
+            pos[d] = window.first[d];
+        }
+        do
+        {
+            size_t dataRowOffset = 0;
+            for (size_t d = 0; d + 1 < _nKernelDims; d++) { dataRowOffset += pos[d] * _dataStride[d]; }
+            maximumRow(data + dataOffset + dataRowOffset, (int)dataRowOffset, valueRow, selectedIndicesRow);
+        }
+        while (nextWindowRow(window, pos));
+    } );
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void PoolingTask<algorithmFPType, cpu>::computeAverage(const algorithmFPType *data, algorithmFPType *value) const
+{
+    const algorithmFPType zero = 0.0;
+    const size_t nRows = _nRows;
+    daal::threader_for(_nSlices * nRows, _nSlices * nRows, [ = ](int task)
+    {
+        size_t dataOffset, valueOffset, valueRowOffset;
+        getSliceOffsets(task / nRows, dataOffset, valueOffset);
+
+        Window window;
+        getWindow(task % nRows, window, valueRowOffset);
+
+        algorithmFPType *valueRow = value + valueOffset + valueRowOffset;
+        for (size_t i = 0; i < _rowSize; i++) { valueRow[i] = zero; }
+
+        MKL_INT pos[maxKernelDims];
+        bool empty = false;
+        for (size_t d = 0; d + 1 < _nKernelDims; d++)
+        {
+            empty = empty || (window.first[d] == window.last[d]);
+            pos[d] = window.first[d];
+        }
+        if (!empty)
+        {
+            do
+            {
+                size_t dataRowOffset = 0;
+                for (size_t d = 0; d + 1 < _nKernelDims; d++) { dataRowOffset += pos[d] * _dataStride[d]; }
+                sumRow(data + dataOffset + dataRowOffset, valueRow);
+            }
+            while (nextWindowRow(window, pos));
+        }
+
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t i = 0; i < _rowSize; i++) { valueRow[i] *= _kernelVolumeInv; }
+    } );
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void PoolingTask<algorithmFPType, cpu>::computeMaximumGradient(const algorithmFPType *inputGradient,
+    const int *selectedIndices, algorithmFPType *gradient) const
+{
+    /* Windows of the neighbour rows overlap, so the work is split over the slices only */
+    const size_t nRows = _nRows;
+    daal::threader_for(_nSlices, _nSlices, [ = ](int slice)
+    {
+        size_t dataOffset, valueOffset, valueRowOffset;
+        getSliceOffsets(slice, dataOffset, valueOffset);
+        algorithmFPType *gradientSlice = gradient + dataOffset;
+
+        for (size_t row = 0; row < nRows; row++)
+        {
+            Window window;
+            getWindow(row, window, valueRowOffset);
+            const algorithmFPType *inputGradientRow = inputGradient + valueOffset + valueRowOffset;
+            const int *selectedIndicesRow = selectedIndices + valueOffset + valueRowOffset;
+
+            for (size_t i = 0; i < _rowSize; i++)
+            {
+                if (selectedIndicesRow[i] >= 0) { gradientSlice[selectedIndicesRow[i]] += inputGradientRow[i]; }
+            }
+        }
+    } );
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void PoolingTask<algorithmFPType, cpu>::computeAverageGradient(const algorithmFPType *inputGradient,
+    algorithmFPType *gradient) const
+{
+    const size_t nRows = _nRows;
+    daal::threader_for(_nSlices, _nSlices, [ = ](int slice)
+    {
+        size_t dataOffset, valueOffset, valueRowOffset;
+        getSliceOffsets(slice, dataOffset, valueOffset);
+
+        for (size_t row = 0; row < nRows; row++)
+        {
+            Window window;
+            getWindow(row, window, valueRowOffset);
+            const algorithmFPType *inputGradientRow = inputGradient + valueOffset + valueRowOffset;
+
+            MKL_INT pos[maxKernelDims];
+            bool empty = false;
+            for (size_t d = 0; d + 1 < _nKernelDims; d++)
+            {
+                empty = empty || (window.first[d] == window.last[d]);
+                pos[d] = window.first[d];
+            }
+            if (empty) { continue; }
+            do
+            {
+                size_t dataRowOffset = 0;
+                for (size_t d = 0; d + 1 < _nKernelDims; d++) { dataRowOffset += pos[d] * _dataStride[d]; }
+                spreadRow(inputGradientRow, gradient + dataOffset + dataRowOffset);
+            }
+            while (nextWindowRow(window, pos));
+        }
+    } );
+}
+
+} // namespace internal
+} // namespace layers
+} // namespace neural_networks
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,319 @@
+/* file: neural_networks_dnn_tensor.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Declaration of the tensor that keeps its data in the internal layout of the DNN primitives.
+//--
+
+
+#ifndef __NEURAL_NETWORKS_DNN_TENSOR_H__
+#define __NEURAL_NETWORKS_DNN_TENSOR_H__
+
+#include "homogen_tensor.h"
+#include "neural_networks/neural_networks_types.h"
+#include "neural_networks/layers/convolution2d/convolution2d_layer_forward.h"
+#include "service_dnn.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace internal
+{
+
+/**
+ *  \brief Tensor passed between the layers that use DNN primitives.
+ *  Besides the data in the default layout the tensor owns a buffer in the internal layout of the primitive
+ *  that produced it. The layer that produces the tensor writes into the internal buffer, the next layer
+ *  reads it directly if it expects the same layout. The data in the default layout is converted from the
+ *  internal buffer only when it is accessed via getSubtensor(), e.g. by a layer that does not use DNN.
+ */
+template<typename algorithmFPType, CpuType cpu>
+class DnnLayoutTensor : public HomogenTensor<algorithmFPType>
+{
+public:
+    typedef daal::internal::Dnn<algorithmFPType, cpu> dnn;
+
+    static const size_t dimension = 4;
+
+    DnnLayoutTensor(const Collection<size_t> &dims) : HomogenTensor<algorithmFPType>(dims, Tensor::doAllocate),
+        _ltUser(NULL), _ltInner(NULL), _cvFromInner(NULL), _innerBuffer(NULL), _innerValid(false), _userValid(true) {}
+
+    virtual ~DnnLayoutTensor()
+    {
+        releaseInner();
+    }
+
+    /**
+     * Binds the tensor to the layout of the resource of the DNN primitive that writes the tensor.
+     * The internal buffer is reallocated only if the layout differs from the one the tensor is bound to
+     * \param[in] primitive  DNN primitive that produces the tensor
+     * \param[in] type       Type of the resource of the primitive
+     * \return Status of the DNN operations
+     */
+    dnnError_t bindInnerLayout(dnnPrimitive_t primitive, dnnResourceType_t type)
+    {
+        dnnLayout_t ltInner = NULL;
+        dnnError_t err = dnn::xLayoutCreateFromPrimitive(&ltInner, primitive, type);
+        if(err != E_SUCCESS) { return err; }
+
+        if(_ltInner && dnn::xLayoutCompare(_ltInner, ltInner))
+        {
+            dnn::xLayoutDelete(ltInner);
+            return E_SUCCESS;
+        }
+
+        syncUserData();
+        releaseInner();
+        _ltInner = ltInner;
+
+        err = createUserLayout();
+        if(err == E_SUCCESS) { err = dnn::xConversionCreate(&_cvFromInner, _ltInner, _ltUser); }
+        if(err == E_SUCCESS) { err = dnn::xAllocateBuffer((void **)&_innerBuffer, _ltInner); }
+        if(err != E_SUCCESS) { releaseInner(); }
+        return err;
+    }
+
+    /**
+     * Returns the buffer in the internal layout the tensor is bound to.
+     * The caller writes the data into the buffer and then calls setInnerDataValid()
+     * \return Buffer in the internal layout
+     */
+    algorithmFPType *getInnerBuffer() const
+    {
+        return _innerBuffer;
+    }
+
+    /**
+     * Marks the data in the internal buffer as the actual data of the tensor
+     */
+    void setInnerDataValid()
+    {
+        _innerValid = true;
+        _userValid  = false;
+    }
+
+    /**
+     * Returns the actual data of the tensor in the internal layout if the layout is the same as the expected one
+     * \param[in] ltExpected  Layout the caller expects the data in
+     * \return Buffer with the data in the internal layout or NULL if the data has to be read via getSubtensor()
+     */
+    algorithmFPType *getInnerData(dnnLayout_t ltExpected) const
+    {
+        if(!_innerValid || !_ltInner || !dnn::xLayoutCompare(_ltInner, ltExpected)) { return NULL; }
+        return _innerBuffer;
+    }
+
+    void getSubtensor(size_t fixedDims, const size_t *fixedDimNums, size_t rangeDimIdx, size_t rangeDimNum,
+                      ReadWriteMode rwflag, SubtensorDescriptor<double> &block,
+                      Tensor::DataLayout layout = Tensor::defaultLayout) DAAL_C11_OVERRIDE
+    {
+        syncUserData();
+        HomogenTensor<algorithmFPType>::getSubtensor(fixedDims, fixedDimNums, rangeDimIdx, rangeDimNum, rwflag, block, layout);
+    }
+
+    void getSubtensor(size_t fixedDims, const size_t *fixedDimNums, size_t rangeDimIdx, size_t rangeDimNum,
+                      ReadWriteMode rwflag, SubtensorDescriptor<float> &block,
+                      Tensor::DataLayout layout = Tensor::defaultLayout) DAAL_C11_OVERRIDE
+    {
+        syncUserData();
+        HomogenTensor<algorithmFPType>::getSubtensor(fixedDims, fixedDimNums, rangeDimIdx, rangeDimNum, rwflag, block, layout);
+    }
+
+    void getSubtensor(size_t fixedDims, const size_t *fixedDimNums, size_t rangeDimIdx, size_t rangeDimNum,
+                      ReadWriteMode rwflag, SubtensorDescriptor<int> &block,
+                      Tensor::DataLayout layout = Tensor::defaultLayout) DAAL_C11_OVERRIDE
+    {
+        syncUserData();
+        HomogenTensor<algorithmFPType>::getSubtensor(fixedDims, fixedDimNums, rangeDimIdx, rangeDimNum, rwflag, block, layout);
+    }
+
+    void releaseSubtensor(SubtensorDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        if(block.getRWFlag() & (int)writeOnly) { _innerValid = false; }
+        HomogenTensor<algorithmFPType>::releaseSubtensor(block);
+    }
+
+    void releaseSubtensor(SubtensorDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        if(block.getRWFlag() & (int)writeOnly) { _innerValid = false; }
+        HomogenTensor<algorithmFPType>::releaseSubtensor(block);
+    }
+
+    void releaseSubtensor(SubtensorDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        if(block.getRWFlag() & (int)writeOnly) { _innerValid = false; }
+        HomogenTensor<algorithmFPType>::releaseSubtensor(block);
+    }
+
+    virtual SharedPtr<Tensor> getSampleTensor(size_t firstDimIndex) DAAL_C11_OVERRIDE
+    {
+        syncUserData();
+        _innerValid = false;
+        return HomogenTensor<algorithmFPType>::getSampleTensor(firstDimIndex);
+    }
+
+protected:
+    /* Converts the data from the internal buffer into the default layout if the latter is outdated */
+    void syncUserData()
+    {
+        if(_userValid) { return; }
+        if(dnn::xConversionExecute(_cvFromInner, _innerBuffer, this->getArray()) != E_SUCCESS)
+        {
+            this->_errors->add(services::ErrorConvolutionInternal);
+        }
+        _userValid = true;
+    }
+
+    /* Creates the default layout of the data collapsed to 4 dimensions in the same way the layers do it */
+    dnnError_t createUserLayout()
+    {
+        const Collection<size_t> &dims = this->getDimensions();
+        const size_t nDims = dims.size();
+        if(nDims < dimension) { return E_UNSUPPORTED_DIMENSION; }
+
+        size_t size[dimension], strides[dimension];
+        size[dimension - 1] = 1;
+        for(size_t i = 0; i < nDims - dimension + 1; i++)
+        {
+            size[dimension - 1] *= dims[i];
+        }
+        for(size_t i = 1; i < dimension; i++)
+        {
+            size[dimension - 1 - i] = dims[nDims - dimension + i];
+        }
+
+        strides[0] = 1;
+        for(size_t i = 1; i < dimension; i++)
+        {
+            strides[i] = strides[i - 1] * size[i - 1];
+        }
+        return dnn::xLayoutCreate(&_ltUser, dimension, size, strides);
+    }
+
+    void releaseInner()
+    {
+        if(_innerBuffer) { dnn::xReleaseBuffer(_innerBuffer); _innerBuffer = NULL; }
+        if(_cvFromInner) { dnn::xDelete(_cvFromInner);        _cvFromInner = NULL; }
+        if(_ltInner    ) { dnn::xLayoutDelete(_ltInner);      _ltInner     = NULL; }
+        if(_ltUser     ) { dnn::xLayoutDelete(_ltUser);       _ltUser      = NULL; }
+        _innerValid = false;
+    }
+
+    dnnLayout_t _ltUser;
+    dnnLayout_t _ltInner;
+    dnnPrimitive_t _cvFromInner;
+    algorithmFPType *_innerBuffer;
+
+    bool _innerValid; /* True if the internal buffer contains the actual data of the tensor */
+    bool _userValid;  /* True if the data in the default layout is actual */
+};
+
+/**
+ *  \brief Returns true if the forward layer computes its result using DNN primitives
+ */
+template<typename algorithmFPType>
+bool isDnnLayer(const SharedPtr<layers::forward::LayerIface> &layer)
+{
+    return (dynamic_cast<layers::convolution2d::forward::Batch<algorithmFPType> *>(layer.get()) != NULL);
+}
+
+/**
+ *  \brief Replaces the tensors passed between the adjacent layers that use DNN primitives with the tensors
+ *  that keep the data in the internal layout of the primitives. The same tensor object is set everywhere
+ *  the replaced value was referenced: in the results of the layer and in the inputs of the next layers.
+ *  If the backward layers are provided, the gradient passed between the corresponding backward layers gets
+ *  a separate tensor, so that the backward layers never overwrite the data saved for them by the forward layers
+ *  \param[in] forwardLayers   Forward stages of the layers of the network
+ *  \param[in] nextLayers      List of next layers for each layer
+ *  \param[in] backwardLayers  Backward stages of the layers of the network, NULL at the prediction stage
+ */
+template<typename algorithmFPType, CpuType cpu>
+void propagateDnnLayouts(const SharedPtr<ForwardLayers> &forwardLayers,
+                         const SharedPtr<Collection<layers::NextLayers> > &nextLayers,
+                         const SharedPtr<BackwardLayers> &backwardLayers)
+{
+    using namespace layers;
+    typedef DnnLayoutTensor<algorithmFPType, cpu> LayoutTensor;
+
+    const size_t nLayers = forwardLayers->size();
+    if(!nextLayers || nextLayers->size() != nLayers) { return; }
+
+    for(size_t layerId = 0; layerId < nLayers; layerId++)
+    {
+        const SharedPtr<forward::LayerIface> &layer = forwardLayers->get(layerId);
+        const NextLayers &next = nextLayers->get(layerId);
+        if(!isDnnLayer<algorithmFPType>(layer) || next.size() == 0) { continue; }
+
+        SharedPtr<forward::Result> layerResult = layer->getLayerResult();
+        SharedPtr<Tensor> value = layerResult->get(forward::value);
+        if(!value || value->getDimensions().size() < LayoutTensor::dimension ||
+           dynamic_cast<LayoutTensor *>(value.get())) { continue; }
+
+        bool allNextAreDnn = true;
+        for(size_t j = 0; j < next.size(); j++)
+        {
+            const SharedPtr<forward::LayerIface> &nextLayer = forwardLayers->get(next[j]);
+            allNextAreDnn = allNextAreDnn && isDnnLayer<algorithmFPType>(nextLayer) &&
+                            nextLayer->getLayerInput()->getLayout() == tensorInput;
+        }
+        if(!allNextAreDnn) { continue; }
+
+        SharedPtr<Tensor> layoutTensor(new LayoutTensor(value->getDimensions()));
+        if(layoutTensor->getErrors()->size() != 0) { continue; }
+
+        SharedPtr<Tensor> gradientTensor;
+        if(backwardLayers)
+        {
+            gradientTensor = SharedPtr<Tensor>(new LayoutTensor(value->getDimensions()));
+            if(gradientTensor->getErrors()->size() != 0) { continue; }
+        }
+
+        layerResult->set(forward::value, layoutTensor);
+        if(backwardLayers)
+        {
+            backwardLayers->get(layerId)->getLayerInput()->set(backward::inputGradient, gradientTensor);
+        }
+
+        for(size_t j = 0; j < next.size(); j++)
+        {
+            const SharedPtr<forward::LayerIface> &nextLayer = forwardLayers->get(next[j]);
+            forward::Input *nextInput = nextLayer->getLayerInput();
+            nextInput->set(forward::data, layoutTensor);
+            nextLayer->getLayerResult()->setResultForBackward(nextInput);
+            if(backwardLayers)
+            {
+                SharedPtr<backward::LayerIface> &nextBackwardLayer = backwardLayers->get(next[j]);
+                nextBackwardLayer->getLayerInput()->set(backward::inputFromForward,
+                                                        nextLayer->getLayerResult()->get(forward::resultForBackward));
+                nextBackwardLayer->getLayerResult()->set(backward::gradient, gradientTensor);
+            }
+        }
+    }
+}
+
+} // namespace internal
+} // namespace neural_networks
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -64,6 +64,12 @@ void NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::co
 
     forwardLayers->get(0)->getLayerInput()->set(forward::data, sample);
 
+    if (parameter->layoutPropagation)
+    {
+        neural_networks::internal::propagateDnnLayouts<algorithmFPType, cpu>(forwardLayers, model->getNextLayers(),
+                                                                               SharedPtr<BackwardLayers>());
+    }
+
     for(size_t i = 0; i < nSamples; i++)
     {
         data->getSubtensor(0, 0, i, 1, readOnly, sampleSubtensor);
@@ -27,6 +27,7 @@
 #include "neural_networks/neural_networks_types.h"
 #include "neural_networks/neural_networks_prediction_types.h"
 #include "kernel.h"
+#include "neural_networks_dnn_tensor.h"
 #include "homogen_tensor.h"
 
 using namespace daal::data_management;
@@ -125,6 +125,11 @@ void NeuralNetworksFeedforwardTrainingKernel<algorithmFPType, method, cpu>::comp
     lossInput->set(loss::forward::groundTruth, sampleGroundTruth);
     forwardLayers->get(nLayers - 1)->getLayerResult()->setResultForBackward(lossInput);
 
+    if (parameter->layoutPropagation)
+    {
+        neural_networks::internal::propagateDnnLayouts<algorithmFPType, cpu>(forwardLayers, nnModel->getNextLayers(), backwardLayers);
+    }
+
     SubtensorDescriptor<algorithmFPType> sampleSubtensor, sampleGroundTruthSubtensor;
     for(size_t i = 0; i < nSamples; i += batchSize)
     {
@@ -27,6 +27,7 @@
 #include "neural_networks/neural_networks_training_types.h"
 #include "neural_networks_training_service.h"
 #include "kernel.h"
+#include "neural_networks_dnn_tensor.h"
 #include "numeric_table.h"
 #include "service_numeric_table.h"
 #include "neural_networks/layers/loss/loss_layer_forward_types.h"
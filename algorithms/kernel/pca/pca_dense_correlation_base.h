@@ -26,6 +26,7 @@
 
 #include "pca_types.h"
 #include "service_lapack.h"
+#include "service_memory.h"
 #include "service_defines.h"
 #include "services/error_handling.h"
 
@@ -80,23 +81,49 @@ void PCACorrelationBase<algorithmFPType, cpu>::computeCorrelationEigenvalues(
     using data_management::BlockDescriptor;
 
     size_t nFeatures = correlation->getNumberOfColumns();
+    size_t nComponents = eigenvectors->getNumberOfRows();
 
     BlockDescriptor<algorithmFPType> correlationBlock;
     correlation->getBlockOfRows(0, nFeatures, data_management::readOnly, correlationBlock);
     algorithmFPType *correlationArray = correlationBlock.getBlockPtr();
 
     BlockDescriptor<algorithmFPType> eigenvectorsBlock;
-    eigenvectors->getBlockOfRows(0, nFeatures, data_management::writeOnly, eigenvectorsBlock);
+    eigenvectors->getBlockOfRows(0, nComponents, data_management::writeOnly, eigenvectorsBlock);
     algorithmFPType *eigenvectorsArray = eigenvectorsBlock.getBlockPtr();
 
     BlockDescriptor<algorithmFPType> eigenvaluesBlock;
     eigenvalues->getBlockOfRows(0, 1, data_management::writeOnly, eigenvaluesBlock);
     algorithmFPType *eigenvaluesArray = eigenvaluesBlock.getBlockPtr();
 
-    copyArray(nFeatures * nFeatures, correlationArray, eigenvectorsArray);
+    /* The full eigen decomposition is computed in temporary buffers when only the leading components are requested */
+    algorithmFPType *fullEigenvectors = eigenvectorsArray;
+    algorithmFPType *fullEigenvalues  = eigenvaluesArray;
+    if(nComponents < nFeatures)
+    {
+        fullEigenvectors = services::internal::service_malloc<algorithmFPType, cpu>(nFeatures * nFeatures);
+        fullEigenvalues  = services::internal::service_malloc<algorithmFPType, cpu>(nFeatures);
+    }
+
+    if(fullEigenvectors && fullEigenvalues)
+    {
+        copyArray(nFeatures * nFeatures, correlationArray, fullEigenvectors);
+
+        computeEigenvectorsInplace(nFeatures, fullEigenvectors, fullEigenvalues);
+        sortEigenvectorsDescending(nFeatures, fullEigenvectors, fullEigenvalues);
+
+        copyArray(nComponents * nFeatures, fullEigenvectors, eigenvectorsArray);
+        copyArray(nComponents, fullEigenvalues, eigenvaluesArray);
+    }
+    else
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
 
-    computeEigenvectorsInplace(nFeatures, eigenvectorsArray, eigenvaluesArray);
-    sortEigenvectorsDescending(nFeatures, eigenvectorsArray, eigenvaluesArray);
+    if(nComponents < nFeatures)
+    {
+        services::daal_free(fullEigenvectors);
+        services::daal_free(fullEigenvalues);
+    }
 
     correlation->releaseBlockOfRows(correlationBlock);
     eigenvectors->releaseBlockOfRows(eigenvectorsBlock);
@@ -0,0 +1,544 @@
+/* file: pca_dense_randomized_base.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that calculate PCA randomized.
+//
+//  The correlation matrix R of the data set is never formed. The kernels
+//  accumulate the sketch X^t X T of the cross-product for a random test matrix T
+//  of nSketch = nComponents + nOversamples columns, together with the feature
+//  sums and sums of squares. All of these are additive over blocks of
+//  observations, so the online and distributed modes merge them by summation.
+//  The sketch is converted into the sketch Y = R T of the correlation matrix,
+//  optionally refined with power iterations over the data (batch mode only),
+//  and the principal components are obtained from the Nystrom approximation
+//  R ~ Y (T^t Y)^-1 Y^t with a Cholesky factorization and a thin SVD of
+//  nFeatures x nSketch matrices.
+//
+//  All nFeatures x nSketch matrices are stored with one test vector per row.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_BASE_H__
+#define __PCA_DENSE_RANDOMIZED_BASE_H__
+
+#include "pca_types.h"
+#include "service_lapack.h"
+#include "service_blas.h"
+#include "service_math.h"
+#include "service_rng.h"
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "service_defines.h"
+#include "services/error_handling.h"
+#include "threading.h"
+
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+/**
+ *  Thread-local buffers used to accumulate the sketch of the cross-product
+ */
+template <typename algorithmFPType, CpuType cpu>
+struct RandomizedSketchTask
+{
+    static RandomizedSketchTask *create(size_t nFeatures, size_t nSketch, size_t blockSize)
+    {
+        RandomizedSketchTask *task = new RandomizedSketchTask();
+        task->crossProduct = services::internal::service_calloc<algorithmFPType, cpu>(nSketch * nFeatures);
+        task->sum          = services::internal::service_calloc<algorithmFPType, cpu>(nFeatures);
+        task->sumSquares   = services::internal::service_calloc<algorithmFPType, cpu>(nFeatures);
+        task->projection   = services::internal::service_malloc<algorithmFPType, cpu>(nSketch * blockSize);
+        if(!task->crossProduct || !task->sum || !task->sumSquares || !task->projection)
+        {
+            destroy(task);
+            return 0;
+        }
+        return task;
+    }
+
+    static void destroy(RandomizedSketchTask *task)
+    {
+        services::daal_free(task->crossProduct);
+        services::daal_free(task->sum);
+        services::daal_free(task->sumSquares);
+        services::daal_free(task->projection);
+        delete task;
+    }
+
+    algorithmFPType *crossProduct; /* nSketch x nFeatures */
+    algorithmFPType *sum;          /* nFeatures */
+    algorithmFPType *sumSquares;   /* nFeatures */
+    algorithmFPType *projection;   /* blockSize x nSketch */
+
+private:
+    RandomizedSketchTask() : crossProduct(0), sum(0), sumSquares(0), projection(0) {}
+};
+
+template <typename algorithmFPType, CpuType cpu>
+class PCARandomizedBase : public Kernel
+{
+public:
+    explicit PCARandomizedBase() {};
+
+    virtual ~PCARandomizedBase() {};
+
+protected:
+    static const size_t _blockSize = 256;
+
+    void generateTestMatrix(size_t nFeatures, size_t nSketch, int seed, algorithmFPType *testMatrix);
+
+    void updateCrossProduct(data_management::NumericTable *data, size_t nSketch, const algorithmFPType *testMatrix,
+                            algorithmFPType *crossProduct, algorithmFPType *sum, algorithmFPType *sumSquares);
+
+    void computeInvStdDev(size_t nFeatures, algorithmFPType nObservations, const algorithmFPType *sum,
+                          const algorithmFPType *sumSquares, algorithmFPType *invStdDev);
+
+    void computeCorrelationSketch(size_t nFeatures, size_t nSketch, algorithmFPType nObservations,
+                                  const algorithmFPType *sum, const algorithmFPType *invStdDev,
+                                  const algorithmFPType *scaledTestMatrix, const algorithmFPType *crossProduct,
+                                  algorithmFPType *sketch);
+
+    void orthonormalize(size_t nFeatures, size_t nSketch, algorithmFPType *vectors);
+
+    void computeComponents(size_t nFeatures, size_t nSketch, const algorithmFPType *testMatrix, algorithmFPType *sketch,
+                           data_management::NumericTable *eigenvalues, data_management::NumericTable *eigenvectors);
+
+    void computeFromPartialResults(data_management::NumericTable *nObservationsTable, data_management::NumericTable *sumTable,
+                                   data_management::NumericTable *sumSquaresTable, data_management::NumericTable *crossProductTable,
+                                   int seed, data_management::NumericTable *eigenvalues, data_management::NumericTable *eigenvectors);
+};
+
+/**
+ *  Generates the nSketch x nFeatures matrix of random signs that is reproducible from the seed
+ */
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedBase<algorithmFPType, cpu>::generateTestMatrix(size_t nFeatures, size_t nSketch, int seed,
+                                                                 algorithmFPType *testMatrix)
+{
+    size_t size = nSketch * nFeatures;
+    int *signs = services::internal::service_malloc<int, cpu>(size);
+    if(!signs) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    IntRng<int, cpu> rng(seed);
+    rng.bernoulli(size, signs, 0.5);
+
+    for(size_t i = 0; i < size; i++)
+    {
+        testMatrix[i] = (algorithmFPType)(2 * signs[i] - 1);
+    }
+
+    services::daal_free(signs);
+}
+
+/**
+ *  Adds X^t X T to crossProduct and the feature sums and sums of squares of X to sum and sumSquares.
+ *  sum and sumSquares may be null when only the cross-product is needed
+ */
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedBase<algorithmFPType, cpu>::updateCrossProduct(data_management::NumericTable *data, size_t nSketch,
+                                                                 const algorithmFPType *testMatrix, algorithmFPType *crossProduct,
+                                                                 algorithmFPType *sum, algorithmFPType *sumSquares)
+{
+    const size_t nFeatures = data->getNumberOfColumns();
+    const size_t nVectors  = data->getNumberOfRows();
+    const size_t blockSize = (nVectors < _blockSize ? nVectors : _blockSize);
+    const size_t nBlocks   = nVectors / blockSize + !!(nVectors % blockSize);
+
+    daal::tls<RandomizedSketchTask<algorithmFPType, cpu> *> tls([ = ]()-> RandomizedSketchTask<algorithmFPType, cpu> *
+    {
+        return RandomizedSketchTask<algorithmFPType, cpu>::create(nFeatures, nSketch, blockSize);
+    } );
+
+    daal::threader_for(nBlocks, nBlocks, [ =, &tls](int iBlock)
+    {
+        RandomizedSketchTask<algorithmFPType, cpu> *task = tls.local();
+        if(!task) { return; }
+
+        size_t startRow = iBlock * blockSize;
+        size_t nRows = (iBlock == nBlocks - 1 ? nVectors - startRow : blockSize);
+
+        data_management::BlockDescriptor<algorithmFPType> block;
+        data->getBlockOfRows(startRow, nRows, data_management::readOnly, block);
+        algorithmFPType *x = block.getBlockPtr();
+
+        char transa = 't';
+        char transb = 'n';
+        MKL_INT _m = nSketch;
+        MKL_INT _n = nRows;
+        MKL_INT _k = nFeatures;
+        algorithmFPType one = 1.0;
+        algorithmFPType zero = 0.0;
+        MKL_INT ldt = nFeatures;
+        MKL_INT ldx = nFeatures;
+        MKL_INT ldp = nSketch;
+
+        /* projection = (X T)^t, nRows x nSketch in row-major layout */
+        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &one, const_cast<algorithmFPType *>(testMatrix), &ldt,
+                                           x, &ldx, &zero, task->projection, &ldp);
+
+        /* crossProduct += X^t (X T) */
+        transa = 'n';
+        transb = 't';
+        _m = nFeatures;
+        _n = nSketch;
+        _k = nRows;
+        MKL_INT ldc = nFeatures;
+        Blas<algorithmFPType, cpu>::xxgemm(&transa, &transb, &_m, &_n, &_k, &one, x, &ldx,
+                                           task->projection, &ldp, &one, task->crossProduct, &ldc);
+
+        if(sum)
+        {
+            for(size_t i = 0; i < nRows; i++)
+            {
+               PRAGMA_IVDEP
+               PRAGMA_VECTOR_ALWAYS
+                for(size_t j = 0; j < nFeatures; j++)
+                {
+                    task->sum[j]        += x[i * nFeatures + j];
+                    task->sumSquares[j] += x[i * nFeatures + j] * x[i * nFeatures + j];
+                }
+            }
+        }
+
+        data->releaseBlockOfRows(block);
+    } );
+
+    bool isAllocated = true;
+    tls.reduce([ =, &isAllocated](RandomizedSketchTask<algorithmFPType, cpu> *task)
+    {
+        if(!task) { isAllocated = false; return; }
+
+        for(size_t i = 0; i < nSketch * nFeatures; i++)
+        {
+            crossProduct[i] += task->crossProduct[i];
+        }
+        if(sum)
+        {
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                sum[j]        += task->sum[j];
+                sumSquares[j] += task->sumSquares[j];
+            }
+        }
+        RandomizedSketchTask<algorithmFPType, cpu>::destroy(task);
+    } );
+
+    if(!isAllocated) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+}
+
+/**
+ *  Computes inverse standard deviations of the features, zero for features with zero variance.
+ *  The sample variance requires at least two observations
+ */
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedBase<algorithmFPType, cpu>::computeInvStdDev(size_t nFeatures, algorithmFPType nObservations,
+                                                               const algorithmFPType *sum, const algorithmFPType *sumSquares,
+                                                               algorithmFPType *invStdDev)
+{
+    if(!(nObservations > 1)) { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+
+    for(size_t j = 0; j < nFeatures; j++)
+    {
+        algorithmFPType variance = (sumSquares[j] - sum[j] * sum[j] / nObservations) / (nObservations - 1);
+        invStdDev[j] = (variance > 0 ? (algorithmFPType)1.0 / Math<algorithmFPType, cpu>::sSqrt(variance) : 0);
+    }
+}
+
+/**
+ *  Converts the sketch X^t X T' of the cross-product into the sketch R T of the correlation matrix,
+ *  where T' = D^-1/2 T is the test matrix scaled by inverse standard deviations
+ */
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedBase<algorithmFPType, cpu>::computeCorrelationSketch(size_t nFeatures, size_t nSketch, algorithmFPType nObservations,
+                                                                       const algorithmFPType *sum, const algorithmFPType *invStdDev,
+                                                                       const algorithmFPType *scaledTestMatrix,
+                                                                       const algorithmFPType *crossProduct, algorithmFPType *sketch)
+{
+    if(!(nObservations > 1)) { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+
+    const algorithmFPType invN = (algorithmFPType)1.0 / nObservations;
+    const algorithmFPType invN1 = (algorithmFPType)1.0 / (nObservations - 1);
+
+    for(size_t i = 0; i < nSketch; i++)
+    {
+        const algorithmFPType *t = scaledTestMatrix + i * nFeatures;
+        algorithmFPType sumDotT = 0;
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            sumDotT += sum[j] * t[j];
+        }
+
+        const algorithmFPType *z = crossProduct + i * nFeatures;
+        algorithmFPType *y = sketch + i * nFeatures;
+       PRAGMA_IVDEP
+       PRAGMA_VECTOR_ALWAYS
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            y[j] = invStdDev[j] * (z[j] - sum[j] * sumDotT * invN) * invN1;
+        }
+    }
+}
+
+/**
+ *  Replaces nSketch vectors of length nFeatures with an orthonormal basis of their span
+ */
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedBase<algorithmFPType, cpu>::orthonormalize(size_t nFeatures, size_t nSketch, algorithmFPType *vectors)
+{
+    MKL_INT m = nFeatures;
+    MKL_INT n = nSketch;
+    MKL_INT info = 0;
+    MKL_INT workDim = -1;
+    algorithmFPType workQuery[2];
+
+    algorithmFPType *tau = services::internal::service_malloc<algorithmFPType, cpu>(nSketch);
+    if(!tau) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    Lapack<algorithmFPType, cpu>::xgeqrf(m, n, vectors, m, tau, workQuery, workDim, &info);
+    workDim = (MKL_INT)workQuery[0];
+    Lapack<algorithmFPType, cpu>::xorgqr(m, n, n, vectors, m, tau, workQuery, -1, &info);
+    if((MKL_INT)workQuery[0] > workDim) { workDim = (MKL_INT)workQuery[0]; }
+
+    algorithmFPType *work = services::internal::service_malloc<algorithmFPType, cpu>(workDim);
+    if(!work)
+    {
+        services::daal_free(tau);
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    Lapack<algorithmFPType, cpu>::xgeqrf(m, n, vectors, m, tau, work, workDim, &info);
+    if(info == 0)
+    {
+        Lapack<algorithmFPType, cpu>::xorgqr(m, n, n, vectors, m, tau, work, workDim, &info);
+    }
+    if(info != 0) { this->_errors->add(services::ErrorPCAFailedToDecomposeSketch); }
+
+    services::daal_free(work);
+    services::daal_free(tau);
+}
+
+/**
+ *  Computes the leading eigenpairs of the Nystrom approximation Y (T^t Y)^-1 Y^t of the correlation matrix
+ *  from the sketch Y = R T. The sketch is overwritten
+ */
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedBase<algorithmFPType, cpu>::computeComponents(size_t nFeatures, size_t nSketch, const algorithmFPType *testMatrix,
+                                                                algorithmFPType *sketch, data_management::NumericTable *eigenvalues,
+                                                                data_management::NumericTable *eigenvectors)
+{
+    const size_t nComponents = eigenvectors->getNumberOfRows();
+    const size_t size = nSketch * nFeatures;
+
+    algorithmFPType *gram     = services::internal::service_calloc<algorithmFPType, cpu>(nSketch * nSketch);
+    algorithmFPType *invChol  = services::internal::service_calloc<algorithmFPType, cpu>(nSketch * nSketch);
+    algorithmFPType *factor   = services::internal::service_malloc<algorithmFPType, cpu>(size);
+    algorithmFPType *left     = services::internal::service_malloc<algorithmFPType, cpu>(size);
+    algorithmFPType *singular = services::internal::service_malloc<algorithmFPType, cpu>(nSketch);
+    if(!gram || !invChol || !factor || !left || !singular)
+    {
+        services::daal_free(gram);
+        services::daal_free(invChol);
+        services::daal_free(factor);
+        services::daal_free(left);
+        services::daal_free(singular);
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    /* Shift the sketch by a small multiple of the test matrix to keep T^t Y numerically positive definite */
+    const algorithmFPType eps = (sizeof(algorithmFPType) == sizeof(float) ? (algorithmFPType)1.0e-6 : (algorithmFPType)1.0e-14);
+    algorithmFPType sketchNorm = 0;
+    algorithmFPType testNorm = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        sketchNorm += sketch[i] * sketch[i];
+        testNorm   += testMatrix[i] * testMatrix[i];
+    }
+    const algorithmFPType shift = (testNorm > 0 ? eps * Math<algorithmFPType, cpu>::sSqrt(sketchNorm / testNorm) : 0);
+    for(size_t i = 0; i < size; i++)
+    {
+        sketch[i] += shift * testMatrix[i];
+    }
+
+    char uplo = 'U';
+    char notrans = 'N';
+    char trans = 'T';
+    char diag = 'N';
+    MKL_INT p = nFeatures;
+    MKL_INT l = nSketch;
+    MKL_INT info = 0;
+    algorithmFPType one = 1.0;
+    algorithmFPType zero = 0.0;
+
+    /* gram = T^t Y */
+    Blas<algorithmFPType, cpu>::xgemm(&trans, &notrans, &l, &l, &p, &one, const_cast<algorithmFPType *>(testMatrix), &p,
+                                      sketch, &p, &zero, gram, &l);
+    for(size_t i = 0; i < nSketch; i++)
+    {
+        for(size_t j = 0; j < i; j++)
+        {
+            algorithmFPType value = (gram[i * nSketch + j] + gram[j * nSketch + i]) * (algorithmFPType)0.5;
+            gram[i * nSketch + j] = value;
+            gram[j * nSketch + i] = value;
+        }
+        invChol[i * nSketch + i] = 1.0;
+    }
+
+    /* gram = U^t U, invChol = U^-1, factor = Y U^-1 */
+    Lapack<algorithmFPType, cpu>::xpotrf(&uplo, &l, gram, &l, &info);
+    if(info == 0)
+    {
+        Lapack<algorithmFPType, cpu>::xtrtrs(&uplo, &notrans, &diag, &l, &l, gram, &l, invChol, &l, &info);
+    }
+    if(info == 0)
+    {
+        Blas<algorithmFPType, cpu>::xgemm(&notrans, &notrans, &p, &l, &l, &one, sketch, &p, invChol, &l, &zero, factor, &p);
+
+        MKL_INT workDim = -1;
+        algorithmFPType workQuery[2];
+        algorithmFPType vt;
+        Lapack<algorithmFPType, cpu>::xgesvd('S', 'N', p, l, factor, p, singular, left, p, &vt, 1, workQuery, workDim, &info);
+        workDim = (MKL_INT)workQuery[0];
+
+        algorithmFPType *work = services::internal::service_malloc<algorithmFPType, cpu>(workDim);
+        if(work)
+        {
+            Lapack<algorithmFPType, cpu>::xgesvd('S', 'N', p, l, factor, p, singular, left, p, &vt, 1, work, workDim, &info);
+            services::daal_free(work);
+        }
+        else
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+        }
+    }
+
+    if(info != 0)
+    {
+        this->_errors->add(services::ErrorPCAFailedToDecomposeSketch);
+    }
+    else if(this->_errors->size() == 0)
+    {
+        data_management::BlockDescriptor<algorithmFPType> eigenvaluesBlock;
+        eigenvalues->getBlockOfRows(0, 1, data_management::writeOnly, eigenvaluesBlock);
+        algorithmFPType *eigenvaluesArray = eigenvaluesBlock.getBlockPtr();
+
+        data_management::BlockDescriptor<algorithmFPType> eigenvectorsBlock;
+        eigenvectors->getBlockOfRows(0, nComponents, data_management::writeOnly, eigenvectorsBlock);
+        algorithmFPType *eigenvectorsArray = eigenvectorsBlock.getBlockPtr();
+
+        for(size_t i = 0; i < nComponents; i++)
+        {
+            algorithmFPType value = singular[i] * singular[i] - shift;
+            eigenvaluesArray[i] = (value > 0 ? value : 0);
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                eigenvectorsArray[i * nFeatures + j] = left[i * nFeatures + j];
+            }
+        }
+
+        eigenvalues->releaseBlockOfRows(eigenvaluesBlock);
+        eigenvectors->releaseBlockOfRows(eigenvectorsBlock);
+    }
+
+    services::daal_free(gram);
+    services::daal_free(invChol);
+    services::daal_free(factor);
+    services::daal_free(left);
+    services::daal_free(singular);
+}
+
+/**
+ *  Computes the results of the algorithm from the merged partial results of the online or distributed processing mode
+ */
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedBase<algorithmFPType, cpu>::computeFromPartialResults(
+    data_management::NumericTable *nObservationsTable, data_management::NumericTable *sumTable,
+    data_management::NumericTable *sumSquaresTable, data_management::NumericTable *crossProductTable,
+    int seed, data_management::NumericTable *eigenvalues, data_management::NumericTable *eigenvectors)
+{
+    const size_t nFeatures = crossProductTable->getNumberOfColumns();
+    const size_t nSketch   = crossProductTable->getNumberOfRows();
+    if(eigenvectors->getNumberOfRows() > nSketch)
+    { this->_errors->add(services::ErrorPCAIncorrectNumberOfComponents); return; }
+
+    ReadRows<algorithmFPType, cpu, data_management::NumericTable> nObservationsRows(*nObservationsTable, 1);
+    ReadRows<algorithmFPType, cpu, data_management::NumericTable> sumRows(*sumTable, 1);
+    ReadRows<algorithmFPType, cpu, data_management::NumericTable> sumSquaresRows(*sumSquaresTable, 1);
+    ReadRows<algorithmFPType, cpu, data_management::NumericTable> crossProductRows(*crossProductTable, nSketch);
+    const algorithmFPType nObservations = nObservationsRows.get()[0];
+    const algorithmFPType *sum = sumRows.get();
+
+    algorithmFPType *scaledTestMatrix = services::internal::service_malloc<algorithmFPType, cpu>(nSketch * nFeatures);
+    algorithmFPType *testMatrix = services::internal::service_malloc<algorithmFPType, cpu>(nSketch * nFeatures);
+    algorithmFPType *sketch = services::internal::service_malloc<algorithmFPType, cpu>(nSketch * nFeatures);
+    algorithmFPType *invStdDev = services::internal::service_malloc<algorithmFPType, cpu>(nFeatures);
+    if(!(scaledTestMatrix && testMatrix && sketch && invStdDev))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+    else
+    {
+        generateTestMatrix(nFeatures, nSketch, seed, scaledTestMatrix);
+        computeInvStdDev(nFeatures, nObservations, sum, sumSquaresRows.get(), invStdDev);
+    }
+
+    if(this->_errors->size() == 0)
+    {
+        /* The cross-product was accumulated for the random matrix T' = D^-1/2 T, so T = D^1/2 T' */
+        for(size_t i = 0; i < nSketch; i++)
+        {
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                testMatrix[i * nFeatures + j] = (invStdDev[j] > 0 ? scaledTestMatrix[i * nFeatures + j] / invStdDev[j] : 0);
+            }
+        }
+
+        computeCorrelationSketch(nFeatures, nSketch, nObservations, sum, invStdDev, scaledTestMatrix,
+                                 crossProductRows.get(), sketch);
+    }
+
+    if(this->_errors->size() == 0)
+    {
+        computeComponents(nFeatures, nSketch, testMatrix, sketch, eigenvalues, eigenvectors);
+    }
+
+    services::daal_free(scaledTestMatrix);
+    services::daal_free(testMatrix);
+    services::daal_free(sketch);
+    services::daal_free(invStdDev);
+}
+
+template <ComputeMode mode, typename algorithmFPType, CpuType cpu>
+class PCARandomizedKernel : public PCARandomizedBase<algorithmFPType, cpu> {};
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,160 @@
+/* file: pca_dense_randomized_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Functions that are used in PCA randomized algorithm
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_BATCH_IMPL_I__
+#define __PCA_DENSE_RANDOMIZED_BATCH_IMPL_I__
+
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "pca_dense_randomized_batch_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedKernel<batch, algorithmFPType, cpu>::compute(
+    const services::SharedPtr<data_management::NumericTable> data,
+    bool isCorrelation,
+    BatchParameter<algorithmFPType, randomizedDense> *parameter,
+    services::SharedPtr<data_management::NumericTable> eigenvectors,
+    services::SharedPtr<data_management::NumericTable> eigenvalues)
+{
+    const size_t nFeatures = data->getNumberOfColumns();
+    const size_t nSketch   = parameter->getSketchSize(nFeatures);
+    const size_t size      = nSketch * nFeatures;
+
+    algorithmFPType *testMatrix       = services::internal::service_malloc<algorithmFPType, cpu>(size);
+    algorithmFPType *scaledTestMatrix = services::internal::service_malloc<algorithmFPType, cpu>(size);
+    algorithmFPType *crossProduct     = services::internal::service_malloc<algorithmFPType, cpu>(size);
+    algorithmFPType *sketch           = services::internal::service_malloc<algorithmFPType, cpu>(size);
+    _sum       = services::internal::service_calloc<algorithmFPType, cpu>(nFeatures);
+    _invStdDev = services::internal::service_malloc<algorithmFPType, cpu>(nFeatures);
+    _nObservations = 0;
+
+    if(testMatrix && scaledTestMatrix && crossProduct && sketch && _sum && _invStdDev)
+    {
+        this->generateTestMatrix(nFeatures, nSketch, parameter->seed, testMatrix);
+        computeSketch(data.get(), isCorrelation, nSketch, testMatrix, scaledTestMatrix, crossProduct, sketch);
+
+        /* Each power iteration replaces the test matrix with an orthonormal basis of the current sketch */
+        for(size_t it = 0; it < parameter->nPowerIterations && this->_errors->size() == 0; it++)
+        {
+            daal::services::daal_memcpy_s(testMatrix, size * sizeof(algorithmFPType), sketch, size * sizeof(algorithmFPType));
+            this->orthonormalize(nFeatures, nSketch, testMatrix);
+            if(this->_errors->size() != 0) { break; }
+            computeSketch(data.get(), isCorrelation, nSketch, testMatrix, scaledTestMatrix, crossProduct, sketch);
+        }
+
+        if(this->_errors->size() == 0)
+        {
+            this->computeComponents(nFeatures, nSketch, testMatrix, sketch, eigenvalues.get(), eigenvectors.get());
+        }
+    }
+    else
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+
+    services::daal_free(testMatrix);
+    services::daal_free(scaledTestMatrix);
+    services::daal_free(crossProduct);
+    services::daal_free(sketch);
+    services::daal_free(_sum);
+    services::daal_free(_invStdDev);
+}
+
+/**
+ *  Computes the sketch R T of the correlation matrix for the test matrix T with one pass over the data.
+ *  The first pass also computes the feature statistics and replaces T with D^1/2 T
+ */
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedKernel<batch, algorithmFPType, cpu>::computeSketch(
+    data_management::NumericTable *data, bool isCorrelation, size_t nSketch, algorithmFPType *testMatrix,
+    algorithmFPType *scaledTestMatrix, algorithmFPType *crossProduct, algorithmFPType *sketch)
+{
+    const size_t nFeatures = data->getNumberOfColumns();
+    const size_t size = nSketch * nFeatures;
+
+    if(isCorrelation)
+    {
+        ReadRows<algorithmFPType, cpu, data_management::NumericTable> correlationRows(*data, nFeatures);
+
+        char notrans = 'n';
+        MKL_INT p = nFeatures;
+        MKL_INT l = nSketch;
+        algorithmFPType one = 1.0;
+        algorithmFPType zero = 0.0;
+        Blas<algorithmFPType, cpu>::xgemm(&notrans, &notrans, &p, &l, &p, &one, const_cast<algorithmFPType *>(correlationRows.get()), &p,
+                                          const_cast<algorithmFPType *>(testMatrix), &p, &zero, sketch, &p);
+        return;
+    }
+
+    /* The feature statistics do not depend on the test matrix, so they are accumulated in the first pass only */
+    const bool isFirstPass = (_nObservations == 0);
+    algorithmFPType *sumSquares = 0;
+    if(isFirstPass)
+    {
+        sumSquares = services::internal::service_calloc<algorithmFPType, cpu>(nFeatures);
+        if(!sumSquares) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+    }
+
+    /* The cross-product is accumulated for T' = D^-1/2 T that is unknown before the first pass, so T' = T there */
+    for(size_t i = 0; i < size; i++)
+    {
+        crossProduct[i] = 0;
+        scaledTestMatrix[i] = (isFirstPass ? testMatrix[i] : testMatrix[i] * _invStdDev[i % nFeatures]);
+    }
+
+    this->updateCrossProduct(data, nSketch, scaledTestMatrix, crossProduct, (isFirstPass ? _sum : 0), sumSquares);
+
+    if(isFirstPass)
+    {
+        _nObservations = (algorithmFPType)data->getNumberOfRows();
+        this->computeInvStdDev(nFeatures, _nObservations, _sum, sumSquares, _invStdDev);
+        services::daal_free(sumSquares);
+        if(this->_errors->size() != 0) { return; }
+
+        /* T' = T in the first pass, so the sketch is computed for the test matrix D^1/2 T */
+        for(size_t i = 0; i < size; i++)
+        {
+            algorithmFPType invStdDev = _invStdDev[i % nFeatures];
+            testMatrix[i] = (invStdDev > 0 ? testMatrix[i] / invStdDev : 0);
+        }
+    }
+    if(this->_errors->size() != 0) { return; }
+
+    this->computeCorrelationSketch(nFeatures, nSketch, _nObservations, _sum, _invStdDev, scaledTestMatrix, crossProduct, sketch);
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
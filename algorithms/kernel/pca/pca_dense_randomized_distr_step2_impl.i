@@ -0,0 +1,104 @@
+/* file: pca_dense_randomized_distr_step2_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Functions that are used in PCA randomized algorithm
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_DISTR_STEP2_IMPL_I__
+#define __PCA_DENSE_RANDOMIZED_DISTR_STEP2_IMPL_I__
+
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "pca_dense_randomized_distr_step2_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+/**
+ *  Merges partial results computed on local nodes. All the partial results are sums over the observations,
+ *  so they are merged by summation
+ */
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedKernel<distributed, algorithmFPType, cpu>::compute(DistributedInput<randomizedDense> *input,
+                                                                     PartialResult<randomizedDense> *partialResult,
+                                                                     DistributedParameter<step2Master, algorithmFPType, randomizedDense> *parameter)
+{
+    data_management::NumericTable *crossProductTable = partialResult->get(sketchRandomized).get();
+    const size_t nPartialResults = input->get(partialResults)->size();
+
+    for(size_t i = 0; i < nPartialResults; i++)
+    {
+        services::SharedPtr<PartialResult<randomizedDense> > localPartialResult = input->getPartialResult(i);
+        if(localPartialResult->get(sketchRandomized)->getNumberOfRows() != crossProductTable->getNumberOfRows())
+        {
+            this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable);
+            return;
+        }
+
+        addTable(localPartialResult->get(nObservationsRandomized).get(), partialResult->get(nObservationsRandomized).get());
+        addTable(localPartialResult->get(sumRandomized).get(),           partialResult->get(sumRandomized).get());
+        addTable(localPartialResult->get(sumSquaresRandomized).get(),    partialResult->get(sumSquaresRandomized).get());
+        addTable(localPartialResult->get(sketchRandomized).get(),        crossProductTable);
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedKernel<distributed, algorithmFPType, cpu>::finalize(PartialResult<randomizedDense> *partialResult,
+                                                                      DistributedParameter<step2Master,
+                                                                      algorithmFPType, randomizedDense> *parameter,
+                                                                      services::SharedPtr<data_management::NumericTable> eigenvectors,
+                                                                      services::SharedPtr<data_management::NumericTable> eigenvalues)
+{
+    this->computeFromPartialResults(partialResult->get(nObservationsRandomized).get(), partialResult->get(sumRandomized).get(),
+                                    partialResult->get(sumSquaresRandomized).get(), partialResult->get(sketchRandomized).get(),
+                                    parameter->seed, eigenvalues.get(), eigenvectors.get());
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedKernel<distributed, algorithmFPType, cpu>::addTable(data_management::NumericTable *src, data_management::NumericTable *dst)
+{
+    const size_t nRows = dst->getNumberOfRows();
+    const size_t nDataElements = nRows * dst->getNumberOfColumns();
+
+    ReadRows<algorithmFPType, cpu, data_management::NumericTable> srcRows(*src, nRows);
+    WriteRows<algorithmFPType, cpu, data_management::NumericTable> dstRows(*dst, nRows);
+    const algorithmFPType *srcArray = srcRows.get();
+    algorithmFPType *dstArray = dstRows.get();
+
+   PRAGMA_IVDEP
+   PRAGMA_VECTOR_ALWAYS
+    for(size_t i = 0; i < nDataElements; i++)
+    {
+        dstArray[i] += srcArray[i];
+    }
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,64 @@
+/* file: pca_dense_randomized_distr_step2_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template structs that calculate PCA randomized.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_DISTR_STEP2_KERNEL_H__
+#define __PCA_DENSE_RANDOMIZED_DISTR_STEP2_KERNEL_H__
+
+#include "pca_types.h"
+#include "service_defines.h"
+#include "services/error_handling.h"
+#include "pca_dense_randomized_base.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+template <typename algorithmFPType, CpuType cpu>
+class PCARandomizedKernel<distributed, algorithmFPType, cpu> : public PCARandomizedBase<algorithmFPType, cpu>
+{
+public:
+    explicit PCARandomizedKernel() {};
+
+    void compute(DistributedInput<randomizedDense> *input,
+                 PartialResult<randomizedDense> *partialResult,
+                 DistributedParameter<step2Master, algorithmFPType, randomizedDense> *parameter);
+
+    void finalize(PartialResult<randomizedDense> *partialResult,
+                  DistributedParameter<step2Master, algorithmFPType, randomizedDense> *parameter,
+                  services::SharedPtr<data_management::NumericTable> eigenvectors,
+                  services::SharedPtr<data_management::NumericTable> eigenvalues);
+private:
+    void addTable(data_management::NumericTable *src, data_management::NumericTable *dst);
+};
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,83 @@
+/* file: pca_dense_randomized_online_container.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of PCA randomized algorithm container.
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_ONLINE_CONTAINER_H__
+#define __PCA_DENSE_RANDOMIZED_ONLINE_CONTAINER_H__
+
+#include "kernel.h"
+#include "pca_online.h"
+#include "pca_dense_randomized_online_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+
+template <typename algorithmFPType, CpuType cpu>
+OnlineContainer<algorithmFPType, randomizedDense, cpu>::OnlineContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INTIALIZE_KERNELS(internal::PCARandomizedKernel, online, algorithmFPType);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+OnlineContainer<algorithmFPType, randomizedDense, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINTIALIZE_KERNELS();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void OnlineContainer<algorithmFPType, randomizedDense, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    OnlineParameter<algorithmFPType, randomizedDense> *parameter = static_cast<OnlineParameter<algorithmFPType, randomizedDense> *>(_par);
+    PartialResult<randomizedDense> *partialResult = static_cast<PartialResult<randomizedDense> *>(_pres);
+    services::Environment::env &env = *_env;
+
+    services::SharedPtr<data_management::NumericTable> data = input->get(pca::data);
+
+    __DAAL_CALL_KERNEL(env, internal::PCARandomizedKernel, __DAAL_KERNEL_ARGUMENTS(online, algorithmFPType),
+                       compute, data, partialResult, parameter);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void OnlineContainer<algorithmFPType, randomizedDense, cpu>::finalizeCompute()
+{
+    OnlineParameter<algorithmFPType, randomizedDense> *parameter = static_cast<OnlineParameter<algorithmFPType, randomizedDense> *>(_par);
+    PartialResult<randomizedDense> *partialResult = static_cast<PartialResult<randomizedDense> *>(_pres);
+    Result *result = static_cast<Result *>(_res);
+    services::Environment::env &env = *_env;
+
+    services::SharedPtr<data_management::NumericTable> eigenvalues  = result->get(pca::eigenvalues);
+    services::SharedPtr<data_management::NumericTable> eigenvectors = result->get(pca::eigenvectors);
+
+    __DAAL_CALL_KERNEL(env, internal::PCARandomizedKernel, __DAAL_KERNEL_ARGUMENTS(online, algorithmFPType),
+                       finalize, partialResult, parameter, eigenvectors, eigenvalues);
+}
+
+}
+}
+} // namespace daal
+
+#endif
@@ -0,0 +1,85 @@
+/* file: pca_dense_randomized_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Functions that are used in PCA randomized algorithm
+//--
+*/
+
+#ifndef __PCA_DENSE_RANDOMIZED_ONLINE_IMPL_I__
+#define __PCA_DENSE_RANDOMIZED_ONLINE_IMPL_I__
+
+#include "service_memory.h"
+#include "service_numeric_table.h"
+#include "pca_dense_randomized_online_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace pca
+{
+namespace internal
+{
+
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedKernel<online, algorithmFPType, cpu>::compute(
+    const services::SharedPtr<data_management::NumericTable> data,
+    PartialResult<randomizedDense> *partialResult,
+    OnlineParameter<algorithmFPType, randomizedDense> *parameter)
+{
+    data_management::NumericTable *crossProductTable = partialResult->get(sketchRandomized).get();
+    const size_t nFeatures = crossProductTable->getNumberOfColumns();
+    const size_t nSketch   = crossProductTable->getNumberOfRows();
+
+    algorithmFPType *testMatrix = services::internal::service_malloc<algorithmFPType, cpu>(nSketch * nFeatures);
+    if(!testMatrix) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    this->generateTestMatrix(nFeatures, nSketch, parameter->seed, testMatrix);
+    if(this->_errors->size() == 0)
+    {
+        WriteRows<algorithmFPType, cpu, data_management::NumericTable> nObservationsRows(*partialResult->get(nObservationsRandomized), 1);
+        WriteRows<algorithmFPType, cpu, data_management::NumericTable> sumRows(*partialResult->get(sumRandomized), 1);
+        WriteRows<algorithmFPType, cpu, data_management::NumericTable> sumSquaresRows(*partialResult->get(sumSquaresRandomized), 1);
+        WriteRows<algorithmFPType, cpu, data_management::NumericTable> crossProductRows(*crossProductTable, nSketch);
+
+        this->updateCrossProduct(data.get(), nSketch, testMatrix, crossProductRows.get(), sumRows.get(), sumSquaresRows.get());
+        nObservationsRows.get()[0] += (algorithmFPType)data->getNumberOfRows();
+    }
+
+    services::daal_free(testMatrix);
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void PCARandomizedKernel<online, algorithmFPType, cpu>::finalize(
+    PartialResult<randomizedDense> *partialResult,
+    OnlineParameter<algorithmFPType, randomizedDense> *parameter,
+    services::SharedPtr<data_management::NumericTable> eigenvectors,
+    services::SharedPtr<data_management::NumericTable> eigenvalues)
+{
+    this->computeFromPartialResults(partialResult->get(nObservationsRandomized).get(), partialResult->get(sumRandomized).get(),
+                                    partialResult->get(sumSquaresRandomized).get(), partialResult->get(sketchRandomized).get(),
+                                    parameter->seed, eigenvalues.get(), eigenvectors.get());
+}
+
+} // namespace internal
+} // namespace pca
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -24,6 +24,8 @@
 #ifndef __PCA_DENSE_SVD_BASE_H__
 #define __PCA_DENSE_SVD_BASE_H__
 
+#include "service_numeric_table.h"
+
 namespace daal
 {
 namespace algorithms
@@ -56,6 +58,14 @@ public:
 protected:
     void scaleSingularValues(data_management::NumericTable *eigenvaluesTable, size_t nVectors);
 
+    void allocateFullResults(const services::SharedPtr<data_management::NumericTable> &eigenvalues,
+                             const services::SharedPtr<data_management::NumericTable> &eigenvectors,
+                             services::SharedPtr<data_management::NumericTable> &fullEigenvalues,
+                             services::SharedPtr<data_management::NumericTable> &fullEigenvectors);
+
+    void copyLeadingComponents(data_management::NumericTable *fullEigenvalues, data_management::NumericTable *fullEigenvectors,
+                               data_management::NumericTable *eigenvalues, data_management::NumericTable *eigenvectors);
+
     InputDataType _type;
 };
 
@@ -77,6 +87,62 @@ void PCASVDKernelBase<interm, cpu>::scaleSingularValues(NumericTable *eigenvalue
     eigenvaluesTable->releaseBlockOfRows(block);
 }
 
+/**
+ *  Returns tables for the full set of singular values and right singular vectors.
+ *  The result tables are used directly when all principal components are requested
+ */
+template <typename interm, CpuType cpu>
+void PCASVDKernelBase<interm, cpu>::allocateFullResults(const services::SharedPtr<data_management::NumericTable> &eigenvalues,
+                                                        const services::SharedPtr<data_management::NumericTable> &eigenvectors,
+                                                        services::SharedPtr<data_management::NumericTable> &fullEigenvalues,
+                                                        services::SharedPtr<data_management::NumericTable> &fullEigenvectors)
+{
+    size_t nFeatures = eigenvectors->getNumberOfColumns();
+    if(eigenvectors->getNumberOfRows() == nFeatures)
+    {
+        fullEigenvalues  = eigenvalues;
+        fullEigenvectors = eigenvectors;
+        return;
+    }
+
+    fullEigenvalues  = services::SharedPtr<data_management::NumericTable>(new daal::internal::HomogenNumericTableCPU<interm, cpu>(nFeatures, 1));
+    fullEigenvectors = services::SharedPtr<data_management::NumericTable>(new daal::internal::HomogenNumericTableCPU<interm, cpu>(nFeatures, nFeatures));
+}
+
+/**
+ *  Copies the leading principal components into the result tables
+ */
+template <typename interm, CpuType cpu>
+void PCASVDKernelBase<interm, cpu>::copyLeadingComponents(data_management::NumericTable *fullEigenvalues,
+                                                          data_management::NumericTable *fullEigenvectors,
+                                                          data_management::NumericTable *eigenvalues,
+                                                          data_management::NumericTable *eigenvectors)
+{
+    if(fullEigenvectors == eigenvectors) { return; }
+
+    size_t nFeatures = eigenvectors->getNumberOfColumns();
+    size_t nComponents = eigenvectors->getNumberOfRows();
+
+    daal::internal::ReadRows<interm, cpu, data_management::NumericTable> fullEigenvaluesRows(*fullEigenvalues, 1);
+    daal::internal::ReadRows<interm, cpu, data_management::NumericTable> fullEigenvectorsRows(*fullEigenvectors, nComponents);
+    daal::internal::WriteRows<interm, cpu, data_management::NumericTable> eigenvaluesRows(*eigenvalues, 1);
+    daal::internal::WriteRows<interm, cpu, data_management::NumericTable> eigenvectorsRows(*eigenvectors, nComponents);
+
+    const interm *fullEigenvaluesArray  = fullEigenvaluesRows.get();
+    const interm *fullEigenvectorsArray = fullEigenvectorsRows.get();
+    interm *eigenvaluesArray  = eigenvaluesRows.get();
+    interm *eigenvectorsArray = eigenvectorsRows.get();
+
+    for(size_t i = 0; i < nComponents; i++)
+    {
+        eigenvaluesArray[i] = fullEigenvaluesArray[i];
+    }
+    for(size_t i = 0; i < nComponents * nFeatures; i++)
+    {
+        eigenvectorsArray[i] = fullEigenvectorsArray[i];
+    }
+}
+
 } // namespace internal
 } // namespace pca
 } // namespace algorithms
@@ -43,8 +43,7 @@ void PCASVDBatchKernel<interm, cpu>::compute(const services::SharedPtr<data_mana
                                              services::SharedPtr<data_management::NumericTable> &eigenvectors)
 {
     _data = data;
-    _eigenvalues = eigenvalues;
-    _eigenvectors = eigenvectors;
+    this->allocateFullResults(eigenvalues, eigenvectors, _eigenvalues, _eigenvectors);
 
     _nObservations = _data->getNumberOfRows();
     _nFeatures = _data->getNumberOfColumns();
@@ -58,6 +57,7 @@ void PCASVDBatchKernel<interm, cpu>::compute(const services::SharedPtr<data_mana
     if (this->_errors->size() != 0) { return; }
 
     this->scaleSingularValues(_eigenvalues.get(), _nObservations);
+    this->copyLeadingComponents(_eigenvalues.get(), _eigenvectors.get(), eigenvalues.get(), eigenvectors.get());
 }
 
 namespace
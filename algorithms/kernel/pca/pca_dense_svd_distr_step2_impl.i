@@ -89,9 +89,13 @@ void PCASVDStep2MasterKernel<interm, cpu>::finalizeMerge(const services::SharedP
     size_t nResults = 3;
     NumericTable *svdResults[3];
 
-    svdResults[0] = eigenvalues.get();
+    services::SharedPtr<data_management::NumericTable> fullEigenvalues;
+    services::SharedPtr<data_management::NumericTable> fullEigenvectors;
+    this->allocateFullResults(eigenvalues, eigenvectors, fullEigenvalues, fullEigenvectors);
+
+    svdResults[0] = fullEigenvalues.get();
     svdResults[1] = 0;
-    svdResults[2] = eigenvectors.get();
+    svdResults[2] = fullEigenvectors.get();
 
     daal::algorithms::svd::internal::SVDOnlineKernel<interm, svd::defaultDense, cpu> svdKernel;
     svdKernel.finalizeCompute(nInputs, svdInputs, nResults, svdResults, &kmPar);
@@ -100,7 +104,8 @@ void PCASVDStep2MasterKernel<interm, cpu>::finalizeMerge(const services::SharedP
 
     delete[] svdInputs;
 
-    this->scaleSingularValues(eigenvalues.get(), nObservations);
+    this->scaleSingularValues(fullEigenvalues.get(), nObservations);
+    this->copyLeadingComponents(fullEigenvalues.get(), fullEigenvectors.get(), eigenvalues.get(), eigenvectors.get());
 }
 
 } // namespace internal
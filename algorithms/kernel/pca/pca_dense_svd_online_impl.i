@@ -107,9 +107,13 @@ void PCASVDOnlineKernel<interm, cpu>::finalizeMerge(const services::SharedPtr<da
     size_t nResults = 3;
     data_management::NumericTable *svdResults[3];
 
-    svdResults[0] = eigenvalues.get();
+    services::SharedPtr<data_management::NumericTable> fullEigenvalues;
+    services::SharedPtr<data_management::NumericTable> fullEigenvectors;
+    this->allocateFullResults(eigenvalues, eigenvectors, fullEigenvalues, fullEigenvectors);
+
+    svdResults[0] = fullEigenvalues.get();
     svdResults[1] = 0;
-    svdResults[2] = eigenvectors.get();
+    svdResults[2] = fullEigenvectors.get();
 
     daal::algorithms::svd::internal::SVDOnlineKernel<interm, svd::defaultDense, cpu> svdKernel;
     svdKernel.finalizeCompute(nInputs, svdInputs, nResults, svdResults, &kmPar);
@@ -118,7 +122,8 @@ void PCASVDOnlineKernel<interm, cpu>::finalizeMerge(const services::SharedPtr<da
 
     delete[] svdInputs;
 
-    this->scaleSingularValues(eigenvalues.get(), *nObservations);
+    this->scaleSingularValues(fullEigenvalues.get(), *nObservations);
+    this->copyLeadingComponents(fullEigenvalues.get(), fullEigenvectors.get(), eigenvalues.get(), eigenvectors.get());
 }
 
 template <typename interm, CpuType cpu>
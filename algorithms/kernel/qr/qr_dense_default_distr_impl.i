@@ -126,6 +126,50 @@ void QRDistributedStep2Kernel<interm, method, cpu>::compute(const size_t na, con
     daal::services::daal_free( Aux2T );
 }
 
+/**
+ *  \brief Kernel that applies the matrix received from the parent node of the reduction tree to the blocks computed
+ *         by the second step on an intermediate node
+ */
+template <typename interm, daal::algorithms::qr::Method method, CpuType cpu>
+void QRDistributedStep2Kernel<interm, method, cpu>::finalizeCompute(const size_t na, const NumericTable *const *a,
+                                                                    const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par)
+{
+    size_t nBlocks = nr;
+
+    BlockMicroTable<interm, readOnly, cpu> mtParent(a[0]);
+
+    size_t n = mtParent.getFullNumberOfColumns();
+
+    interm *Parent;
+    mtParent.getBlockOfRows( 0, n, &Parent ); /* Parent[n][n] */
+
+    interm *Aux3T = (interm *)daal::services::daal_malloc( sizeof(interm) * n * n );
+
+    MKL_INT ldParent = n;
+    MKL_INT ldAux3   = n;
+
+    for(size_t k = 0; k < nBlocks; k++)
+    {
+        interm *Aux3;
+        BlockMicroTable<interm, readWrite, cpu> mtAux3(r[k]);
+        mtAux3.getBlockOfRows( 0, n, &Aux3 ); /* Aux3[n][n] */
+
+        /* Aux3 := Aux3 * Parent, computed in the column-major layout as Parent^T * Aux3^T */
+        compute_gemm_on_one_node<interm, cpu>( n, n, Parent, ldParent, Aux3, ldAux3, Aux3T, ldAux3 );
+
+        for ( size_t i = 0 ; i < n * n ; i++ )
+        {
+            Aux3[i] = Aux3T[i];
+        }
+
+        mtAux3.release();
+    }
+
+    mtParent.release();
+
+    daal::services::daal_free( Aux3T );
+}
+
 /**
  *  \brief Kernel for QR QR calculation
  */
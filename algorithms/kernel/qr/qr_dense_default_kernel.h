@@ -64,6 +64,8 @@ class QRDistributedStep2Kernel : public Kernel
 public:
     void compute(const size_t na, const NumericTable *const *a,
                  const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par = 0);
+    void finalizeCompute(const size_t na, const NumericTable *const *a,
+                 const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par = 0);
 
 };
 
@@ -0,0 +1,87 @@
+/* file: quantiles_distributed_container.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of quantiles algorithm container in the distributed processing mode.
+//--
+*/
+
+#ifndef __QUANTILES_DISTRIBUTED_CONTAINER_H__
+#define __QUANTILES_DISTRIBUTED_CONTAINER_H__
+
+#include "quantiles_distributed.h"
+#include "quantiles_kernel.h"
+#include "kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INTIALIZE_KERNELS(internal::QuantilesDistributedKernel, method, algorithmFPType);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+DistributedContainer<step2Master, algorithmFPType, method, cpu>::~DistributedContainer()
+{
+    __DAAL_DEINTIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step2Master, algorithmFPType, method, cpu>::compute()
+{
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    DistributedInput<step2Master> *input = static_cast<DistributedInput<step2Master> *>(_in);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    services::SharedPtr<DataCollection> collection = input->get(partialResults);
+    NumericTable *sketchTable = static_cast<NumericTable *>(partialResult->get(sketches).get());
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::QuantilesDistributedKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute,
+                       collection.get(), sketchTable, par);
+
+    collection->clear();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void DistributedContainer<step2Master, algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Result *result = static_cast<Result *>(_res);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    NumericTable *sketchTable = static_cast<NumericTable *>(partialResult->get(sketches).get());
+    NumericTable *r           = static_cast<NumericTable *>(result->get(quantiles).get());
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::QuantilesDistributedKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), finalizeCompute,
+                       sketchTable, r, par);
+}
+
+} // namespace daal::algorithms::quantiles
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
@@ -26,6 +26,8 @@
 
 #include "numeric_table.h"
 #include "quantiles_batch.h"
+#include "quantiles_online.h"
+#include "quantiles_distributed.h"
 
 #include "service_defines.h"
 #include "service_micro_table.h"
@@ -48,6 +50,29 @@ struct QuantilesKernel : public Kernel
     void compute(const NumericTable *a, NumericTable *r, const Parameter *par);
 };
 
+template<typename algorithmFPType, CpuType cpu>
+struct QuantilesKernel<sketchDense, algorithmFPType, cpu> : public Kernel
+{
+    virtual ~QuantilesKernel() {}
+    void compute(const NumericTable *a, NumericTable *r, const Parameter *par);
+};
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesOnlineKernel : public Kernel
+{
+    virtual ~QuantilesOnlineKernel() {}
+    void compute(const NumericTable *a, NumericTable *sketchTable, const Parameter *par);
+    void finalizeCompute(const NumericTable *sketchTable, NumericTable *r, const Parameter *par);
+};
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesDistributedKernel : public Kernel
+{
+    virtual ~QuantilesDistributedKernel() {}
+    void compute(DataCollection *partialResults, NumericTable *sketchTable, const Parameter *par);
+    void finalizeCompute(const NumericTable *sketchTable, NumericTable *r, const Parameter *par);
+};
+
 } // namespace daal::algorithms::quantiles::internal
 
 } // namespace daal::algorithms::quantiles
@@ -0,0 +1,66 @@
+/* file: quantiles_sketch_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Sketch-based quantiles computation in the batch processing mode
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_BATCH_IMPL_I__
+#define __QUANTILES_SKETCH_BATCH_IMPL_I__
+
+#include "quantiles_sketch_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+
+template<typename algorithmFPType, CpuType cpu>
+void QuantilesKernel<sketchDense, algorithmFPType, cpu>::compute(const NumericTable *a, NumericTable *r, const Parameter *par)
+{
+    const size_t nFeatures  = a->getNumberOfColumns();
+    const size_t sketchSize = par->getSketchSize();
+
+    double *sketchData = services::internal::service_calloc<double, cpu>(nFeatures * sketchSize);
+    if (!sketchData) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    updateSketches<algorithmFPType, cpu>(a, sketchData, sketchSize, par->getSketchCompression(), this->_errors);
+
+    if (this->_errors->size() == 0)
+    {
+        HomogenNumericTable<double> sketchTable(sketchData, sketchSize, nFeatures);
+        finalizeSketchQuantiles<algorithmFPType, cpu>(&sketchTable, r, par, this->_errors);
+    }
+
+    daal::services::daal_free(sketchData);
+}
+
+} // namespace daal::algorithms::quantiles::internal
+
+} // namespace daal::algorithms::quantiles
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
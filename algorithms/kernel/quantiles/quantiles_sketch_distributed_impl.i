@@ -0,0 +1,110 @@
+/* file: quantiles_sketch_distributed_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Sketch-based quantiles computation in the distributed processing mode
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_DISTRIBUTED_IMPL_I__
+#define __QUANTILES_SKETCH_DISTRIBUTED_IMPL_I__
+
+#include "quantiles_sketch_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantilesDistributedKernel<method, algorithmFPType, cpu>::compute(DataCollection *partialResults, NumericTable *sketchTable,
+                                                                       const Parameter *par)
+{
+    const size_t nFeatures  = sketchTable->getNumberOfRows();
+    const size_t sketchSize = sketchTable->getNumberOfColumns();
+    const size_t nBlocks    = partialResults->size();
+
+    /* The current sketches are merged together with the sketches from local nodes */
+    const size_t nSets = nBlocks + 1;
+
+    BlockMicroTable<double, readOnly, cpu> **localMicroTables =
+        (BlockMicroTable<double, readOnly, cpu> **)daal::services::daal_malloc(nBlocks * sizeof(BlockMicroTable<double, readOnly, cpu> *));
+    const double **sets = (const double **)daal::services::daal_malloc(nSets * sizeof(double *));
+    if (!localMicroTables || !sets)
+    {
+        daal::services::daal_free(localMicroTables);
+        daal::services::daal_free(sets);
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    BlockMicroTable<double, readWrite, cpu> sketchMicroTable(sketchTable);
+    double *sketchData;
+    bool isRead = (sketchMicroTable.getBlockOfRows(0, nFeatures, &sketchData) == nFeatures);
+    sets[0] = sketchData;
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        PartialResult *partialResult = static_cast<PartialResult *>((*partialResults)[i].get());
+        localMicroTables[i] = new BlockMicroTable<double, readOnly, cpu>(partialResult->get(sketches).get());
+
+        double *localSketchData;
+        isRead = (localMicroTables[i]->getBlockOfRows(0, nFeatures, &localSketchData) == nFeatures) && isRead;
+        sets[i + 1] = localSketchData;
+    }
+
+    if (isRead)
+    {
+        mergeSketchSets<cpu>(nSets, sets, sketchData, nFeatures, sketchSize, par->getSketchCompression(), this->_errors);
+    }
+    else
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        localMicroTables[i]->release();
+        delete localMicroTables[i];
+    }
+    sketchMicroTable.release();
+
+    daal::services::daal_free(localMicroTables);
+    daal::services::daal_free(sets);
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantilesDistributedKernel<method, algorithmFPType, cpu>::finalizeCompute(const NumericTable *sketchTable, NumericTable *r,
+                                                                               const Parameter *par)
+{
+    finalizeSketchQuantiles<algorithmFPType, cpu>(sketchTable, r, par, this->_errors);
+}
+
+} // namespace daal::algorithms::quantiles::internal
+
+} // namespace daal::algorithms::quantiles
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,581 @@
+/* file: quantiles_sketch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Common functions of the sketch-based quantiles computation.
+//
+//  The distribution of each feature is summarized with a merging t-digest:
+//  a list of weighted centroids sorted by their means. A centroid that covers
+//  the quantiles [qLeft, qRight] satisfies k(qRight) - k(qLeft) <= 1 for the
+//  scale function k(q) = compression / 4 * (sqrt(q) - sqrt(1 - q)), so
+//  centroids are small near the tails of the distribution and their number
+//  does not exceed compression + 1.
+//
+//  A sketch is stored in one row of a double precision table:
+//      [nObservations, minimum, maximum, nCentroids, means[capacity], weights[capacity]]
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_IMPL_I__
+#define __QUANTILES_SKETCH_IMPL_I__
+
+#include "service_micro_table.h"
+#include "service_memory.h"
+#include "service_math.h"
+#include "service_sort.h"
+#include "threading.h"
+
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+
+/* Number of values of one feature that are sorted and merged into its sketch at once */
+const size_t _nValuesInSketchChunk = 4096;
+
+/* Offsets of the sketch fields in a row of the table of sketches */
+const size_t _sketchNObservations = 0;
+const size_t _sketchMinimum       = 1;
+const size_t _sketchMaximum       = 2;
+const size_t _sketchNCentroids    = 3;
+const size_t _sketchCentroids     = 4;
+
+/**
+ *  \brief Returns the upper bound of the quantiles covered by a centroid that starts at the quantile qLeft
+ */
+template<CpuType cpu>
+double getSketchQuantileLimit(double qLeft, double compression)
+{
+    const double k = (Math<double, cpu>::sSqrt(qLeft) - Math<double, cpu>::sSqrt(1.0 - qLeft)) + 4.0 / compression;
+    if (k >= 1.0) { return 1.0; }
+
+    /* Inverse of the scale function: sqrt(q) = (k + sqrt(2 - k^2)) / 2 */
+    const double sqrtQ = 0.5 * (k + Math<double, cpu>::sSqrt(2.0 - k * k));
+    return sqrtQ * sqrtQ;
+}
+
+/* Takes the centroid with the smallest mean from the heads of two sorted lists */
+inline void takeNextCentroid(size_t nA, const double *meansA, const double *weightsA,
+                             size_t nB, const double *meansB, const double *weightsB,
+                             size_t &iA, size_t &iB, double &mean, double &weight)
+{
+    if (iB >= nB || (iA < nA && meansA[iA] <= meansB[iB]))
+    {
+        mean   = meansA[iA];
+        weight = weightsA[iA];
+        iA++;
+    }
+    else
+    {
+        mean   = meansB[iB];
+        weight = (weightsB ? weightsB[iB] : 1.0);
+        iB++;
+    }
+}
+
+/**
+ *  \brief Merges two lists of centroids sorted by their means and compresses the result
+ *
+ *  \param[in]  nA          Number of centroids in the first list
+ *  \param[in]  meansA      Means of the centroids in the first list
+ *  \param[in]  weightsA    Weights of the centroids in the first list
+ *  \param[in]  nB          Number of centroids in the second list
+ *  \param[in]  meansB      Means of the centroids in the second list
+ *  \param[in]  weightsB    Weights of the centroids in the second list, unit weights are used if 0
+ *  \param[in]  totalWeight Sum of the weights in both lists
+ *  \param[in]  compression Compression of the sketch
+ *  \param[in]  capacity    Maximal number of centroids in the result
+ *  \param[out] outMeans    Means of the resulting centroids
+ *  \param[out] outWeights  Weights of the resulting centroids
+ *  \return Number of the resulting centroids
+ */
+template<CpuType cpu>
+size_t mergeAndCompressCentroids(size_t nA, const double *meansA, const double *weightsA,
+                                 size_t nB, const double *meansB, const double *weightsB,
+                                 double totalWeight, double compression, size_t capacity,
+                                 double *outMeans, double *outWeights)
+{
+    if (nA + nB == 0) { return 0; }
+
+    size_t iA = 0, iB = 0;
+    double mean, weight;
+
+    double curMean, curWeight;
+    takeNextCentroid(nA, meansA, weightsA, nB, meansB, weightsB, iA, iB, curMean, curWeight);
+
+    size_t nOut = 0;
+    double weightSoFar = 0.0;
+    double weightLimit = totalWeight * getSketchQuantileLimit<cpu>(0.0, compression);
+
+    while (iA < nA || iB < nB)
+    {
+        takeNextCentroid(nA, meansA, weightsA, nB, meansB, weightsB, iA, iB, mean, weight);
+
+        if (weightSoFar + curWeight + weight <= weightLimit || nOut + 1 >= capacity)
+        {
+            curWeight += weight;
+            curMean   += (mean - curMean) * weight / curWeight;
+        }
+        else
+        {
+            outMeans  [nOut] = curMean;
+            outWeights[nOut] = curWeight;
+            nOut++;
+
+            weightSoFar += curWeight;
+            weightLimit  = totalWeight * getSketchQuantileLimit<cpu>(weightSoFar / totalWeight, compression);
+
+            curMean   = mean;
+            curWeight = weight;
+        }
+    }
+
+    outMeans  [nOut] = curMean;
+    outWeights[nOut] = curWeight;
+    return nOut + 1;
+}
+
+/**
+ *  \brief Adds sorted values with unit weights to a sketch
+ */
+template<CpuType cpu>
+void addSortedValuesToSketch(double *sketch, size_t capacity, double compression, size_t nValues, const double *values,
+                             double *outMeans, double *outWeights)
+{
+    if (nValues == 0) { return; }
+
+    double *means   = sketch + _sketchCentroids;
+    double *weights = sketch + _sketchCentroids + capacity;
+
+    size_t nCentroids = (size_t)sketch[_sketchNCentroids];
+    double nObservations = sketch[_sketchNObservations];
+
+    if (nObservations == 0.0)
+    {
+        sketch[_sketchMinimum] = values[0];
+        sketch[_sketchMaximum] = values[nValues - 1];
+    }
+    else
+    {
+        if (values[0] < sketch[_sketchMinimum])           { sketch[_sketchMinimum] = values[0]; }
+        if (values[nValues - 1] > sketch[_sketchMaximum]) { sketch[_sketchMaximum] = values[nValues - 1]; }
+    }
+
+    nObservations += (double)nValues;
+    nCentroids = mergeAndCompressCentroids<cpu>(nCentroids, means, weights, nValues, values, 0,
+                                                nObservations, compression, capacity, outMeans, outWeights);
+
+    for (size_t i = 0; i < nCentroids; i++)
+    {
+        means  [i] = outMeans  [i];
+        weights[i] = outWeights[i];
+    }
+    sketch[_sketchNCentroids]    = (double)nCentroids;
+    sketch[_sketchNObservations] = nObservations;
+}
+
+/**
+ *  \brief Merges the sketches of the same feature from several tables into the sketch dst.
+ *         The sketch dst may coincide with one of the merged sketches
+ *
+ *  \param[in]  nSketches   Number of sketches to merge
+ *  \param[in]  sets        Pointers to the tables of sketches
+ *  \param[in]  offset      Offset of the merged sketch in each table
+ *  \param[out] dst         Resulting sketch
+ *  \param[in]  bufMeans    Buffer of size nSketches * capacity
+ *  \param[in]  bufWeights  Buffer of size nSketches * capacity
+ *  \param[in]  outMeans    Buffer of size capacity
+ *  \param[in]  outWeights  Buffer of size capacity
+ */
+template<CpuType cpu>
+void mergeSketches(size_t nSketches, const double *const *sets, size_t offset, double *dst, size_t capacity, double compression,
+                   double *bufMeans, double *bufWeights, double *outMeans, double *outWeights)
+{
+    double nObservations = 0.0, minimum = 0.0, maximum = 0.0;
+    size_t nCentroids = 0;
+
+    for (size_t s = 0; s < nSketches; s++)
+    {
+        const double *sketch = sets[s] + offset;
+        if (sketch[_sketchNObservations] == 0.0) { continue; }
+
+        if (nObservations == 0.0)
+        {
+            minimum = sketch[_sketchMinimum];
+            maximum = sketch[_sketchMaximum];
+        }
+        else
+        {
+            if (sketch[_sketchMinimum] < minimum) { minimum = sketch[_sketchMinimum]; }
+            if (sketch[_sketchMaximum] > maximum) { maximum = sketch[_sketchMaximum]; }
+        }
+        nObservations += sketch[_sketchNObservations];
+
+        const size_t n = (size_t)sketch[_sketchNCentroids];
+        const double *means   = sketch + _sketchCentroids;
+        const double *weights = sketch + _sketchCentroids + capacity;
+        for (size_t i = 0; i < n; i++)
+        {
+            bufMeans  [nCentroids + i] = means  [i];
+            bufWeights[nCentroids + i] = weights[i];
+        }
+        nCentroids += n;
+    }
+
+    if (nCentroids > 0)
+    {
+        daal::algorithms::internal::qSort<double, double, cpu>(nCentroids, bufMeans, bufWeights);
+        nCentroids = mergeAndCompressCentroids<cpu>(nCentroids, bufMeans, bufWeights, 0, 0, 0,
+                                                    nObservations, compression, capacity, outMeans, outWeights);
+    }
+
+    double *dstMeans   = dst + _sketchCentroids;
+    double *dstWeights = dst + _sketchCentroids + capacity;
+    for (size_t i = 0; i < nCentroids; i++)
+    {
+        dstMeans  [i] = outMeans  [i];
+        dstWeights[i] = outWeights[i];
+    }
+    dst[_sketchNObservations] = nObservations;
+    dst[_sketchMinimum]       = minimum;
+    dst[_sketchMaximum]       = maximum;
+    dst[_sketchNCentroids]    = (double)nCentroids;
+}
+
+/**
+ *  \brief Computes the quantile of the given order from a sketch.
+ *         The centroids are placed at the middle of the ranks they cover, the minimum and the maximum
+ *         at the ranks 0 and nObservations, the quantile is linearly interpolated between these points
+ */
+template<CpuType cpu>
+double getQuantileFromSketch(const double *sketch, size_t capacity, double quantileOrder)
+{
+    const double nObservations = sketch[_sketchNObservations];
+    if (nObservations == 0.0) { return 0.0; }
+
+    const size_t nCentroids = (size_t)sketch[_sketchNCentroids];
+    const double *means   = sketch + _sketchCentroids;
+    const double *weights = sketch + _sketchCentroids + capacity;
+
+    const double rank = quantileOrder * nObservations;
+
+    double leftRank  = 0.0;
+    double leftValue = sketch[_sketchMinimum];
+    double weightSoFar = 0.0;
+
+    for (size_t i = 0; i <= nCentroids; i++)
+    {
+        double rightRank, rightValue;
+        if (i < nCentroids)
+        {
+            rightRank  = weightSoFar + 0.5 * weights[i];
+            rightValue = means[i];
+            weightSoFar += weights[i];
+        }
+        else
+        {
+            rightRank  = nObservations;
+            rightValue = sketch[_sketchMaximum];
+        }
+
+        if (rank <= rightRank)
+        {
+            if (rightRank <= leftRank) { return rightValue; }
+            return leftValue + (rightValue - leftValue) * (rank - leftRank) / (rightRank - leftRank);
+        }
+
+        leftRank  = rightRank;
+        leftValue = rightValue;
+    }
+    return sketch[_sketchMaximum];
+}
+
+/* Thread-local buffers of the sketch-based quantiles computation */
+template<CpuType cpu>
+struct SketchBuffers
+{
+    static SketchBuffers *create(size_t nValues, size_t nMerged)
+    {
+        SketchBuffers *buffers = new SketchBuffers();
+        buffers->values     = services::internal::service_malloc<double, cpu>(nValues);
+        buffers->bufMeans   = services::internal::service_malloc<double, cpu>(nMerged);
+        buffers->bufWeights = services::internal::service_malloc<double, cpu>(nMerged);
+        buffers->outMeans   = services::internal::service_malloc<double, cpu>(nMerged);
+        buffers->outWeights = services::internal::service_malloc<double, cpu>(nMerged);
+        if (!buffers->values || !buffers->bufMeans || !buffers->bufWeights || !buffers->outMeans || !buffers->outWeights)
+        {
+            destroy(buffers);
+            return 0;
+        }
+        return buffers;
+    }
+
+    static void destroy(SketchBuffers *buffers)
+    {
+        daal::services::daal_free(buffers->values);
+        daal::services::daal_free(buffers->bufMeans);
+        daal::services::daal_free(buffers->bufWeights);
+        daal::services::daal_free(buffers->outMeans);
+        daal::services::daal_free(buffers->outWeights);
+        delete buffers;
+    }
+
+    double *values;     /* nValues, values of one feature that are added to a sketch */
+    double *bufMeans;   /* nMerged, means of the centroids of the merged sketches */
+    double *bufWeights; /* nMerged, weights of the centroids of the merged sketches */
+    double *outMeans;   /* nMerged, means of the compressed centroids */
+    double *outWeights; /* nMerged, weights of the compressed centroids */
+
+private:
+    SketchBuffers() : values(0), bufMeans(0), bufWeights(0), outMeans(0), outWeights(0) {}
+};
+
+/**
+ *  \brief Merges several tables of sketches of all features into the table dst feature by feature in parallel.
+ *         The table dst may coincide with one of the merged tables
+ */
+template<CpuType cpu>
+void mergeSketchSets(size_t nSets, const double *const *sets, double *dst, size_t nFeatures, size_t sketchSize,
+                     double compression, services::SharedPtr<services::KernelErrorCollection> &_errors)
+{
+    const size_t capacity = (sketchSize - _sketchCentroids) / 2;
+
+    daal::tls<SketchBuffers<cpu> *> tls([ = ]()-> SketchBuffers<cpu> *
+    {
+        return SketchBuffers<cpu>::create(1, nSets * capacity);
+    } );
+
+    daal::threader_for(nFeatures, nFeatures, [ =, &tls](int j)
+    {
+        SketchBuffers<cpu> *buffers = tls.local();
+        if (!buffers) { return; }
+
+        mergeSketches<cpu>(nSets, sets, j * sketchSize, dst + j * sketchSize, capacity, compression,
+                           buffers->bufMeans, buffers->bufWeights, buffers->outMeans, buffers->outWeights);
+    } );
+
+    bool isAllocated = true;
+    tls.reduce([ =, &isAllocated](SketchBuffers<cpu> *buffers)
+    {
+        if (buffers) { SketchBuffers<cpu>::destroy(buffers); }
+        else         { isAllocated = false; }
+    } );
+
+    if (!isAllocated) { _errors->add(services::ErrorMemoryAllocationFailed); }
+}
+
+/**
+ *  \brief Adds the observations of a data table to the sketches of its features
+ *
+ *  Every feature is processed by its own tasks. If there are fewer features than threads,
+ *  the rows are split into groups that are summarized into separate sketches in parallel
+ *  and merged afterwards. The data is read by columns in chunks of _nValuesInSketchChunk values,
+ *  so the memory footprint does not depend on the number of observations
+ */
+template<typename algorithmFPType, CpuType cpu>
+void updateSketches(const NumericTable *dataTable, double *sketchData, size_t sketchSize, double compression,
+                    services::SharedPtr<services::KernelErrorCollection> &_errors)
+{
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+    const size_t capacity  = (sketchSize - _sketchCentroids) / 2;
+
+    if (nVectors == 0) { return; }
+
+    const size_t nThreads = daal::threader_get_threads_number();
+    const size_t nChunks  = (nVectors + _nValuesInSketchChunk - 1) / _nValuesInSketchChunk;
+
+    size_t nGroups = 1;
+    if (nFeatures < nThreads)
+    {
+        nGroups = (nThreads + nFeatures - 1) / nFeatures;
+        if (nGroups > nChunks) { nGroups = nChunks; }
+    }
+    const size_t nChunksInGroup = (nChunks + nGroups - 1) / nGroups;
+    nGroups = (nChunks + nChunksInGroup - 1) / nChunksInGroup;
+
+    double *groupSketches = 0;
+    if (nGroups > 1)
+    {
+        groupSketches = services::internal::service_calloc<double, cpu>(nGroups * nFeatures * sketchSize);
+        if (!groupSketches) { _errors->add(services::ErrorMemoryAllocationFailed); return; }
+    }
+
+    daal::tls<SketchBuffers<cpu> *> tls([ = ]()-> SketchBuffers<cpu> *
+    {
+        return SketchBuffers<cpu>::create(_nValuesInSketchChunk, capacity);
+    } );
+
+    NumericTable *ntData = const_cast<NumericTable *>(dataTable);
+
+    /* The first group of a feature continues its current sketch, the other groups start from empty sketches */
+    daal::threader_for(nFeatures * nGroups, nFeatures * nGroups, [ =, &tls](int iTask)
+    {
+        SketchBuffers<cpu> *buffers = tls.local();
+        if (!buffers) { return; }
+
+        const size_t j = iTask / nGroups;
+        const size_t g = iTask % nGroups;
+
+        double *sketch = (nGroups > 1 ? groupSketches + (g * nFeatures + j) * sketchSize : sketchData + j * sketchSize);
+        if (nGroups > 1 && g == 0)
+        {
+            const double *currentSketch = sketchData + j * sketchSize;
+            for (size_t i = 0; i < sketchSize; i++)
+            {
+                sketch[i] = currentSketch[i];
+            }
+        }
+
+        const size_t iStart = g * nChunksInGroup * _nValuesInSketchChunk;
+        const size_t iEnd   = (iStart + nChunksInGroup * _nValuesInSketchChunk < nVectors ?
+                               iStart + nChunksInGroup * _nValuesInSketchChunk : nVectors);
+
+        FeatureMicroTable<algorithmFPType, readOnly, cpu> dataMicroTable(ntData);
+
+        for (size_t chunkStart = iStart; chunkStart < iEnd; chunkStart += _nValuesInSketchChunk)
+        {
+            const size_t nValues = (chunkStart + _nValuesInSketchChunk < iEnd ? _nValuesInSketchChunk : iEnd - chunkStart);
+
+            algorithmFPType *column;
+            dataMicroTable.getBlockOfColumnValues(j, chunkStart, nValues, &column);
+
+            double *values = buffers->values;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < nValues; i++)
+            {
+                values[i] = (double)column[i];
+            }
+            dataMicroTable.release();
+
+            daal::algorithms::internal::qSort<double, cpu>(nValues, values);
+            addSortedValuesToSketch<cpu>(sketch, capacity, compression, nValues, values, buffers->outMeans, buffers->outWeights);
+        }
+    } );
+
+    bool isAllocated = true;
+    tls.reduce([ =, &isAllocated](SketchBuffers<cpu> *buffers)
+    {
+        if (buffers) { SketchBuffers<cpu>::destroy(buffers); }
+        else         { isAllocated = false; }
+    } );
+
+    if (!isAllocated)
+    {
+        _errors->add(services::ErrorMemoryAllocationFailed);
+    }
+    else if (nGroups > 1)
+    {
+        const double **sets = (const double **)daal::services::daal_malloc(nGroups * sizeof(double *));
+        if (!sets)
+        {
+            _errors->add(services::ErrorMemoryAllocationFailed);
+        }
+        else
+        {
+            for (size_t g = 0; g < nGroups; g++)
+            {
+                sets[g] = groupSketches + g * nFeatures * sketchSize;
+            }
+            mergeSketchSets<cpu>(nGroups, sets, sketchData, nFeatures, sketchSize, compression, _errors);
+            daal::services::daal_free(sets);
+        }
+    }
+
+    daal::services::daal_free(groupSketches);
+}
+
+/**
+ *  \brief Computes the quantiles of all features from their sketches
+ */
+template<typename algorithmFPType, CpuType cpu>
+void computeQuantilesFromSketches(const double *sketchData, size_t nFeatures, size_t sketchSize,
+                                  size_t nQuantileOrders, const algorithmFPType *quantileOrders, algorithmFPType *quants,
+                                  services::SharedPtr<services::KernelErrorCollection> &_errors)
+{
+    for (size_t k = 0; k < nQuantileOrders; k++)
+    {
+        if (!(quantileOrders[k] >= 0 && quantileOrders[k] <= 1))
+        {
+            _errors->add(services::ErrorQuantileOrderValueIsInvalid);
+            return;
+        }
+    }
+
+    const size_t capacity = (sketchSize - _sketchCentroids) / 2;
+
+    daal::threader_for(nFeatures, nFeatures, [ = ](int j)
+    {
+        const double *sketch = sketchData + j * sketchSize;
+        for (size_t k = 0; k < nQuantileOrders; k++)
+        {
+            quants[j * nQuantileOrders + k] = (algorithmFPType)getQuantileFromSketch<cpu>(sketch, capacity, (double)quantileOrders[k]);
+        }
+    } );
+}
+
+/**
+ *  \brief Computes the quantiles from a table of sketches
+ */
+template<typename algorithmFPType, CpuType cpu>
+void finalizeSketchQuantiles(const NumericTable *sketchTable, NumericTable *r, const Parameter *par,
+                             services::SharedPtr<services::KernelErrorCollection> &_errors)
+{
+    const size_t nFeatures       = sketchTable->getNumberOfRows();
+    const size_t sketchSize      = sketchTable->getNumberOfColumns();
+    const size_t nQuantileOrders = r->getNumberOfColumns();
+
+    BlockMicroTable<double, readOnly, cpu> sketchMicroTable(const_cast<NumericTable *>(sketchTable));
+    BlockMicroTable<algorithmFPType, readOnly, cpu> quantsOrderMicroTable(const_cast<NumericTable *>(par->quantileOrders.get()));
+    BlockMicroTable<algorithmFPType, writeOnly, cpu> rMicroTable(r);
+
+    double *sketchData;
+    algorithmFPType *quantileOrders, *quants;
+    if (sketchMicroTable.getBlockOfRows(0, nFeatures, &sketchData) != nFeatures ||
+        quantsOrderMicroTable.getBlockOfRows(0, 1, &quantileOrders) != 1 ||
+        rMicroTable.getBlockOfRows(0, nFeatures, &quants) != nFeatures)
+    {
+        _errors->add(services::ErrorMemoryAllocationFailed);
+    }
+    else
+    {
+        computeQuantilesFromSketches<algorithmFPType, cpu>(sketchData, nFeatures, sketchSize,
+                                                           nQuantileOrders, quantileOrders, quants, _errors);
+    }
+
+    sketchMicroTable.release();
+    quantsOrderMicroTable.release();
+    rMicroTable.release();
+}
+
+} // namespace daal::algorithms::quantiles::internal
+
+} // namespace daal::algorithms::quantiles
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,73 @@
+/* file: quantiles_sketch_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Sketch-based quantiles computation in the online processing mode
+//--
+*/
+
+#ifndef __QUANTILES_SKETCH_ONLINE_IMPL_I__
+#define __QUANTILES_SKETCH_ONLINE_IMPL_I__
+
+#include "quantiles_sketch_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantilesOnlineKernel<method, algorithmFPType, cpu>::compute(const NumericTable *a, NumericTable *sketchTable, const Parameter *par)
+{
+    const size_t nFeatures = a->getNumberOfColumns();
+
+    BlockMicroTable<double, readWrite, cpu> sketchMicroTable(sketchTable);
+
+    double *sketchData;
+    if (sketchMicroTable.getBlockOfRows(0, nFeatures, &sketchData) != nFeatures)
+    {
+        sketchMicroTable.release();
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    updateSketches<algorithmFPType, cpu>(a, sketchData, sketchTable->getNumberOfColumns(), par->getSketchCompression(), this->_errors);
+
+    sketchMicroTable.release();
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantilesOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(const NumericTable *sketchTable, NumericTable *r,
+                                                                          const Parameter *par)
+{
+    finalizeSketchQuantiles<algorithmFPType, cpu>(sketchTable, r, par, this->_errors);
+}
+
+} // namespace daal::algorithms::quantiles::internal
+
+} // namespace daal::algorithms::quantiles
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
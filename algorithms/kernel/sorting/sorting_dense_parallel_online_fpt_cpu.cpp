@@ -0,0 +1,51 @@
+/* file: sorting_dense_parallel_online_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Instantiation of parallel sorting algorithm kernels in the online processing mode.
+//--
+*/
+
+#include "sorting_online_container.h"
+#include "sorting_kernel.h"
+#include "sorting_online_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace sorting
+{
+namespace interface1
+{
+
+template class OnlineContainer<DAAL_FPTYPE, parallelDense, DAAL_CPU>;
+
+}
+namespace internal
+{
+
+template class SortingOnlineKernel<parallelDense, DAAL_FPTYPE, DAAL_CPU>;
+
+} // namespace daal::algorithms::sorting::internal
+
+} // namespace daal::algorithms::sorting
+
+} // namespace daal::algorithms
+
+} // namespace daal
@@ -28,6 +28,7 @@
 #include "service_memory.h"
 #include "service_math.h"
 #include "service_stat.h"
+#include "sorting_parallel_impl.i"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -41,11 +42,19 @@ namespace sorting
 namespace internal
 {
 template<Method method, typename AlgorithmFPType, CpuType cpu>
-void SortingKernel<method, AlgorithmFPType, cpu>::compute(const Input *input, Result *output)
+void SortingKernel<method, AlgorithmFPType, cpu>::compute(const Input *input, Result *output, const Parameter *par)
 {
     SharedPtr<NumericTable> inputTable = input->get(data);
     SharedPtr<NumericTable> outputTable = output->get(sortedData);
 
+    /* The radix sort of the default method does not return the permutation of the observations */
+    if (method == parallelDense || par->computeIndices)
+    {
+        NumericTable *indicesTable = (par->computeIndices ? output->get(sortedIndices).get() : 0);
+        sortFeaturesParallel<AlgorithmFPType, cpu>(inputTable.get(), outputTable.get(), indicesTable, 0, this->_errors);
+        return;
+    }
+
     size_t nFeatures = inputTable->getNumberOfColumns();
     size_t nVectors  = inputTable->getNumberOfRows();
 
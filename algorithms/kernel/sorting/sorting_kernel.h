@@ -25,7 +25,9 @@
 #define __SORTING_KERNEL_H__
 
 #include "numeric_table.h"
+#include "data_collection.h"
 #include "sorting_batch.h"
+#include "sorting_online.h"
 
 #include "service_defines.h"
 #include "service_micro_table.h"
@@ -45,7 +47,15 @@ template<Method method, typename algorithmFPType, CpuType cpu>
 struct SortingKernel : public Kernel
 {
     virtual ~SortingKernel() {}
-    void compute(const Input *input, Result *result);
+    void compute(const Input *input, Result *result, const Parameter *par);
+};
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct SortingOnlineKernel : public Kernel
+{
+    virtual ~SortingOnlineKernel() {}
+    void compute(const NumericTable *a, NumericTable *run, NumericTable *runIndices, size_t indexOffset, const Parameter *par);
+    void finalizeCompute(DataCollection *runs, DataCollection *runIndices, NumericTable *r, NumericTable *rIndices, const Parameter *par);
 };
 
 } // namespace daal::algorithms::sorting::internal
@@ -0,0 +1,130 @@
+/* file: sorting_online_container.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of sorting algorithm container in the online processing mode.
+//--
+*/
+
+#ifndef __SORTING_ONLINE_CONTAINER_H__
+#define __SORTING_ONLINE_CONTAINER_H__
+
+#include "sorting_online.h"
+#include "sorting_kernel.h"
+#include "kernel.h"
+#include "homogen_numeric_table.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace sorting
+{
+template<typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::OnlineContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INTIALIZE_KERNELS(internal::SortingOnlineKernel, method, algorithmFPType);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+OnlineContainer<algorithmFPType, method, cpu>::~OnlineContainer()
+{
+    __DAAL_DEINTIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void OnlineContainer<algorithmFPType, method, cpu>::compute()
+{
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Input *input   = static_cast<Input *>(_in);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    NumericTable *a = static_cast<NumericTable *>(input->get(data).get());
+
+    size_t nFeatures   = a->getNumberOfColumns();
+    size_t nVectors    = a->getNumberOfRows();
+    size_t indexOffset = partialResult->getNumberOfObservations();
+
+    /* Every block of observations becomes a new sorted run */
+    services::SharedPtr<NumericTable> run;
+    services::SharedPtr<NumericTable> runIndices;
+    if (par->storage)
+    {
+        run = par->storage->createRun(sortedRuns, nFeatures, nVectors);
+        if (par->computeIndices)
+        {
+            runIndices = par->storage->createRun(sortedRunIndices, nFeatures, nVectors);
+        }
+    }
+    else
+    {
+        run = services::SharedPtr<NumericTable>(new HomogenNumericTable<algorithmFPType>(nFeatures, nVectors, NumericTable::doAllocate));
+        if (par->computeIndices)
+        {
+            runIndices = services::SharedPtr<NumericTable>(new HomogenNumericTable<int>(nFeatures, nVectors, NumericTable::doAllocate));
+        }
+    }
+
+    if (!run || (par->computeIndices && !runIndices))
+    {
+        this->_errors->add(services::ErrorNullPartialResult);
+        return;
+    }
+    if (run->getNumberOfColumns() != nFeatures || run->getNumberOfRows() != nVectors ||
+        (runIndices && (runIndices->getNumberOfColumns() != nFeatures || runIndices->getNumberOfRows() != nVectors)))
+    {
+        this->_errors->add(services::ErrorIncorrectSizeOfOutputNumericTable);
+        return;
+    }
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::SortingOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute,
+                       a, run.get(), runIndices.get(), indexOffset, par);
+
+    partialResult->get(sortedRuns)->push_back(run);
+    if (par->computeIndices)
+    {
+        partialResult->get(sortedRunIndices)->push_back(runIndices);
+    }
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void OnlineContainer<algorithmFPType, method, cpu>::finalizeCompute()
+{
+    PartialResult *partialResult = static_cast<PartialResult *>(_pres);
+    Result *result = static_cast<Result *>(_res);
+    Parameter *par = static_cast<Parameter *>(_par);
+
+    DataCollection *runs       = partialResult->get(sortedRuns).get();
+    DataCollection *runIndices = partialResult->get(sortedRunIndices).get();
+
+    NumericTable *r        = static_cast<NumericTable *>(result->get(sortedData).get());
+    NumericTable *rIndices = (par->computeIndices ? static_cast<NumericTable *>(result->get(sortedIndices).get()) : 0);
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::SortingOnlineKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), finalizeCompute,
+                       runs, runIndices, r, rIndices, par);
+}
+
+} // namespace daal::algorithms::sorting
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
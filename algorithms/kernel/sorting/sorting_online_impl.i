@@ -0,0 +1,81 @@
+/* file: sorting_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Sorting observations algorithm implementation in the online processing mode
+//--
+*/
+
+#ifndef __SORTING_ONLINE_IMPL_I__
+#define __SORTING_ONLINE_IMPL_I__
+
+#include "sorting_parallel_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace sorting
+{
+namespace internal
+{
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void SortingOnlineKernel<method, algorithmFPType, cpu>::compute(const NumericTable *a, NumericTable *run, NumericTable *runIndices,
+                                                                size_t indexOffset, const Parameter *par)
+{
+    sortFeaturesParallel<algorithmFPType, cpu>(a, run, runIndices, indexOffset, this->_errors);
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void SortingOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(DataCollection *runs, DataCollection *runIndices,
+                                                                        NumericTable *r, NumericTable *rIndices, const Parameter *par)
+{
+    const size_t nRuns = runs->size();
+
+    NumericTable **runTables        = (NumericTable **)daal::services::daal_malloc(nRuns * sizeof(NumericTable *));
+    NumericTable **runIndicesTables = (NumericTable **)daal::services::daal_malloc(nRuns * sizeof(NumericTable *));
+    if (!runTables || !runIndicesTables)
+    {
+        daal::services::daal_free(runTables);
+        daal::services::daal_free(runIndicesTables);
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    for (size_t i = 0; i < nRuns; i++)
+    {
+        runTables[i]        = static_cast<NumericTable *>((*runs)[i].get());
+        runIndicesTables[i] = (rIndices ? static_cast<NumericTable *>((*runIndices)[i].get()) : 0);
+    }
+
+    mergeSortedRuns<algorithmFPType, cpu>(nRuns, runTables, runIndicesTables, r, rIndices, this->_errors);
+
+    daal::services::daal_free(runTables);
+    daal::services::daal_free(runIndicesTables);
+}
+
+} // namespace daal::algorithms::sorting::internal
+
+} // namespace daal::algorithms::sorting
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,516 @@
+/* file: sorting_parallel_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Parallel merge sort of the features of a data set and k-way merge of sorted runs
+//--
+*/
+
+#ifndef __SORTING_PARALLEL_IMPL_I__
+#define __SORTING_PARALLEL_IMPL_I__
+
+#include "service_micro_table.h"
+#include "service_memory.h"
+#include "service_sort.h"
+#include "threading.h"
+
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace sorting
+{
+namespace internal
+{
+
+/* Number of rows of one feature that are sorted by one task. The chunks are also the units of the parallel merge */
+const size_t _nRowsInSortChunk = 65536;
+
+/* Number of rows of one feature that are read from a sorted run or written to the result at once by the k-way merge */
+const size_t _nRowsInMergeBlock = 4096;
+
+/**
+ *  \brief Returns the number of elements of a among the first k elements of the stable merge of the sorted arrays a and b
+ */
+template<typename algorithmFPType, CpuType cpu>
+size_t getMergeSplit(size_t k, const algorithmFPType *a, size_t na, const algorithmFPType *b, size_t nb)
+{
+    size_t lo = (k > nb ? k - nb : 0);
+    size_t hi = (k < na ? k : na);
+    while (lo < hi)
+    {
+        const size_t mid = (lo + hi) / 2;
+        if (a[mid] <= b[k - mid - 1]) { lo = mid + 1; }
+        else                          { hi = mid; }
+    }
+    return lo;
+}
+
+/**
+ *  \brief Writes the elements [outBegin, outEnd) of the stable merge of the sorted arrays a and b to out.
+ *         The indices ia and ib are permuted together with the values if iout is not null
+ */
+template<typename algorithmFPType, CpuType cpu>
+void mergeSortedSegment(const algorithmFPType *a, const int *ia, size_t na, const algorithmFPType *b, const int *ib, size_t nb,
+                        size_t outBegin, size_t outEnd, algorithmFPType *out, int *iout)
+{
+    size_t i = getMergeSplit<algorithmFPType, cpu>(outBegin, a, na, b, nb);
+    size_t j = outBegin - i;
+
+    for (size_t k = outBegin; k < outEnd; k++)
+    {
+        if (j >= nb || (i < na && a[i] <= b[j]))
+        {
+            out[k] = a[i];
+            if (iout) { iout[k] = ia[i]; }
+            i++;
+        }
+        else
+        {
+            out[k] = b[j];
+            if (iout) { iout[k] = ib[j]; }
+            j++;
+        }
+    }
+}
+
+/**
+ *  \brief Sorts the indices of every group of equal values of the sorted array x in ascending order.
+ *         The quick sort is not stable, so the indices of equal values are put back in the order of the observations
+ */
+template<typename algorithmFPType, CpuType cpu>
+void sortIndicesOfEqualValues(size_t n, const algorithmFPType *x, int *ix)
+{
+    for (size_t begin = 0; begin < n;)
+    {
+        size_t end = begin + 1;
+        while (end < n && x[end] == x[begin]) { end++; }
+        if (end - begin > 1)
+        {
+            daal::algorithms::internal::qSort<int, cpu>(end - begin, ix + begin);
+        }
+        begin = end;
+    }
+}
+
+/**
+ *  \brief Sorts every feature of the data table and writes the sorted features to sortedTable.
+ *         If indicesTable is not null, it receives the indices of the observations in the sorted order
+ *         shifted by indexOffset. The indices of equal values are in the order of the observations.
+ *
+ *  The features are processed in groups of up to one feature per thread. Every feature of a group is split
+ *  into chunks of _nRowsInSortChunk rows sorted in parallel, then the sorted chunks are merged pairwise.
+ *  Every pairwise merge is split into segments of the output found by binary search, so all threads
+ *  stay busy until the last merge even for a single feature
+ */
+template<typename algorithmFPType, CpuType cpu>
+void sortFeaturesParallel(const NumericTable *dataTable, NumericTable *sortedTable, NumericTable *indicesTable, size_t indexOffset,
+                          services::SharedPtr<services::KernelErrorCollection> &_errors)
+{
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+
+    if (nVectors == 0) { return; }
+
+    const size_t nThreads = daal::threader_get_threads_number();
+    const size_t nChunks  = (nVectors + _nRowsInSortChunk - 1) / _nRowsInSortChunk;
+    const size_t nFeaturesInGroup = (nFeatures < nThreads ? nFeatures : (nThreads ? nThreads : 1));
+    const bool computeIndices = (indicesTable != 0);
+
+    algorithmFPType *values  = services::internal::service_malloc<algorithmFPType, cpu>(nFeaturesInGroup * nVectors);
+    algorithmFPType *buffer  = services::internal::service_malloc<algorithmFPType, cpu>(nFeaturesInGroup * nVectors);
+    int *indices       = (computeIndices ? services::internal::service_malloc<int, cpu>(nFeaturesInGroup * nVectors) : 0);
+    int *indicesBuffer = (computeIndices ? services::internal::service_malloc<int, cpu>(nFeaturesInGroup * nVectors) : 0);
+
+    if (!values || !buffer || (computeIndices && (!indices || !indicesBuffer)))
+    {
+        daal::services::daal_free(values);
+        daal::services::daal_free(buffer);
+        daal::services::daal_free(indices);
+        daal::services::daal_free(indicesBuffer);
+        _errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    NumericTable *ntData = const_cast<NumericTable *>(dataTable);
+
+    for (size_t firstFeature = 0; firstFeature < nFeatures; firstFeature += nFeaturesInGroup)
+    {
+        const size_t nGroupFeatures = (firstFeature + nFeaturesInGroup < nFeatures ? nFeaturesInGroup : nFeatures - firstFeature);
+
+        /* Read the chunks of the features and sort them */
+        daal::threader_for(nGroupFeatures * nChunks, nGroupFeatures * nChunks, [ = ](int iTask)
+        {
+            const size_t j     = iTask / nChunks;
+            const size_t begin = (iTask % nChunks) * _nRowsInSortChunk;
+            const size_t n     = (begin + _nRowsInSortChunk < nVectors ? _nRowsInSortChunk : nVectors - begin);
+
+            algorithmFPType *x = values + j * nVectors + begin;
+
+            FeatureMicroTable<algorithmFPType, readOnly, cpu> dataMicroTable(ntData);
+            algorithmFPType *column;
+            dataMicroTable.getBlockOfColumnValues(firstFeature + j, begin, n, &column);
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < n; i++)
+            {
+                x[i] = column[i];
+            }
+            dataMicroTable.release();
+
+            if (computeIndices)
+            {
+                int *ix = indices + j * nVectors + begin;
+                for (size_t i = 0; i < n; i++)
+                {
+                    ix[i] = (int)(indexOffset + begin + i);
+                }
+                daal::algorithms::internal::qSort<algorithmFPType, int, cpu>(n, x, ix);
+                sortIndicesOfEqualValues<algorithmFPType, cpu>(n, x, ix);
+            }
+            else
+            {
+                daal::algorithms::internal::qSort<algorithmFPType, cpu>(n, x);
+            }
+        } );
+
+        /* Merge the pairs of sorted runs of width rows, every task writes one chunk of the output */
+        algorithmFPType *src = values;
+        algorithmFPType *dst = buffer;
+        int *isrc = indices;
+        int *idst = indicesBuffer;
+        for (size_t width = _nRowsInSortChunk; width < nVectors; width *= 2)
+        {
+            const size_t nPairs = (nVectors + 2 * width - 1) / (2 * width);
+            const size_t nSegmentsInPair = 2 * width / _nRowsInSortChunk;
+            const size_t nTasks = nGroupFeatures * nPairs * nSegmentsInPair;
+
+            daal::threader_for(nTasks, nTasks, [ = ](int iTask)
+            {
+                const size_t j       = iTask / (nPairs * nSegmentsInPair);
+                const size_t iPair   = (iTask / nSegmentsInPair) % nPairs;
+                const size_t segment = iTask % nSegmentsInPair;
+
+                const size_t pairBegin = iPair * 2 * width;
+                const size_t pairMid   = (pairBegin + width < nVectors ? pairBegin + width : nVectors);
+                const size_t pairEnd   = (pairBegin + 2 * width < nVectors ? pairBegin + 2 * width : nVectors);
+
+                const size_t outBegin = pairBegin + segment * _nRowsInSortChunk;
+                if (outBegin >= pairEnd) { return; }
+                const size_t outEnd = (outBegin + _nRowsInSortChunk < pairEnd ? outBegin + _nRowsInSortChunk : pairEnd);
+
+                const size_t offset = j * nVectors;
+                mergeSortedSegment<algorithmFPType, cpu>(
+                    src + offset + pairBegin, (computeIndices ? isrc + offset + pairBegin : 0), pairMid - pairBegin,
+                    src + offset + pairMid,   (computeIndices ? isrc + offset + pairMid   : 0), pairEnd - pairMid,
+                    outBegin - pairBegin, outEnd - pairBegin,
+                    dst + offset + pairBegin, (computeIndices ? idst + offset + pairBegin : 0));
+            } );
+
+            algorithmFPType *tmp = src; src = dst; dst = tmp;
+            int *itmp = isrc; isrc = idst; idst = itmp;
+        }
+
+        /* Write the sorted features to the result */
+        daal::threader_for(nGroupFeatures * nChunks, nGroupFeatures * nChunks, [ = ](int iTask)
+        {
+            const size_t j     = iTask / nChunks;
+            const size_t begin = (iTask % nChunks) * _nRowsInSortChunk;
+            const size_t n     = (begin + _nRowsInSortChunk < nVectors ? _nRowsInSortChunk : nVectors - begin);
+
+            const algorithmFPType *x = src + j * nVectors + begin;
+
+            FeatureMicroTable<algorithmFPType, writeOnly, cpu> sortedMicroTable(sortedTable);
+            algorithmFPType *column;
+            sortedMicroTable.getBlockOfColumnValues(firstFeature + j, begin, n, &column);
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t i = 0; i < n; i++)
+            {
+                column[i] = x[i];
+            }
+            sortedMicroTable.release();
+
+            if (computeIndices)
+            {
+                const int *ix = isrc + j * nVectors + begin;
+
+                FeatureMicroTable<int, writeOnly, cpu> indicesMicroTable(indicesTable);
+                int *indicesColumn;
+                indicesMicroTable.getBlockOfColumnValues(firstFeature + j, begin, n, &indicesColumn);
+                for (size_t i = 0; i < n; i++)
+                {
+                    indicesColumn[i] = ix[i];
+                }
+                indicesMicroTable.release();
+            }
+        } );
+    }
+
+    daal::services::daal_free(values);
+    daal::services::daal_free(buffer);
+    daal::services::daal_free(indices);
+    daal::services::daal_free(indicesBuffer);
+}
+
+/* Thread-local buffers of the k-way merge of sorted runs */
+template<typename algorithmFPType, CpuType cpu>
+struct RunMergeBuffers
+{
+    static RunMergeBuffers *create(size_t nRuns, bool computeIndices)
+    {
+        RunMergeBuffers *buffers = new RunMergeBuffers();
+        buffers->values     = services::internal::service_malloc<algorithmFPType, cpu>(nRuns * _nRowsInMergeBlock);
+        buffers->outValues  = services::internal::service_malloc<algorithmFPType, cpu>(_nRowsInMergeBlock);
+        buffers->blockStart = services::internal::service_malloc<size_t, cpu>(nRuns);
+        buffers->blockSize  = services::internal::service_malloc<size_t, cpu>(nRuns);
+        buffers->position   = services::internal::service_malloc<size_t, cpu>(nRuns);
+        buffers->heap       = services::internal::service_malloc<size_t, cpu>(nRuns);
+        if (computeIndices)
+        {
+            buffers->indices    = services::internal::service_malloc<int, cpu>(nRuns * _nRowsInMergeBlock);
+            buffers->outIndices = services::internal::service_malloc<int, cpu>(_nRowsInMergeBlock);
+        }
+        if (!buffers->values || !buffers->outValues || !buffers->blockStart || !buffers->blockSize || !buffers->position ||
+            !buffers->heap || (computeIndices && (!buffers->indices || !buffers->outIndices)))
+        {
+            destroy(buffers);
+            return 0;
+        }
+        return buffers;
+    }
+
+    static void destroy(RunMergeBuffers *buffers)
+    {
+        daal::services::daal_free(buffers->values);
+        daal::services::daal_free(buffers->indices);
+        daal::services::daal_free(buffers->outValues);
+        daal::services::daal_free(buffers->outIndices);
+        daal::services::daal_free(buffers->blockStart);
+        daal::services::daal_free(buffers->blockSize);
+        daal::services::daal_free(buffers->position);
+        daal::services::daal_free(buffers->heap);
+        delete buffers;
+    }
+
+    algorithmFPType *values;    /* nRuns * _nRowsInMergeBlock, current blocks of the runs */
+    int *indices;               /* nRuns * _nRowsInMergeBlock, indices of the observations in the current blocks */
+    algorithmFPType *outValues; /* _nRowsInMergeBlock, block of the merged feature */
+    int *outIndices;            /* _nRowsInMergeBlock, indices of the observations in the block of the merged feature */
+    size_t *blockStart;         /* nRuns, first row of the current block of a run */
+    size_t *blockSize;          /* nRuns, number of rows in the current block of a run */
+    size_t *position;           /* nRuns, position of the head of a run in its current block */
+    size_t *heap;               /* nRuns, binary min-heap of the runs ordered by their heads */
+
+private:
+    RunMergeBuffers() : values(0), indices(0), outValues(0), outIndices(0), blockStart(0), blockSize(0), position(0), heap(0) {}
+};
+
+/**
+ *  \brief Reads the next block of a feature of the sorted run r into the merge buffers
+ */
+template<typename algorithmFPType, CpuType cpu>
+void readRunBlock(size_t r, size_t j, NumericTable *run, NumericTable *runIndices, RunMergeBuffers<algorithmFPType, cpu> *buffers)
+{
+    const size_t nRows = run->getNumberOfRows();
+    const size_t start = buffers->blockStart[r];
+    const size_t n     = (start + _nRowsInMergeBlock < nRows ? _nRowsInMergeBlock : (start < nRows ? nRows - start : 0));
+
+    buffers->blockSize[r] = n;
+    buffers->position[r]  = 0;
+    if (n == 0) { return; }
+
+    FeatureMicroTable<algorithmFPType, readOnly, cpu> runMicroTable(run);
+    algorithmFPType *column;
+    runMicroTable.getBlockOfColumnValues(j, start, n, &column);
+    algorithmFPType *values = buffers->values + r * _nRowsInMergeBlock;
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < n; i++)
+    {
+        values[i] = column[i];
+    }
+    runMicroTable.release();
+
+    if (runIndices)
+    {
+        FeatureMicroTable<int, readOnly, cpu> indicesMicroTable(runIndices);
+        int *indicesColumn;
+        indicesMicroTable.getBlockOfColumnValues(j, start, n, &indicesColumn);
+        int *indices = buffers->indices + r * _nRowsInMergeBlock;
+        for (size_t i = 0; i < n; i++)
+        {
+            indices[i] = indicesColumn[i];
+        }
+        indicesMicroTable.release();
+    }
+}
+
+/**
+ *  \brief Writes a block of the merged feature j to the result
+ */
+template<typename algorithmFPType, CpuType cpu>
+void writeMergedBlock(size_t j, size_t start, size_t n, NumericTable *sortedTable, NumericTable *indicesTable,
+                      const RunMergeBuffers<algorithmFPType, cpu> *buffers)
+{
+    FeatureMicroTable<algorithmFPType, writeOnly, cpu> sortedMicroTable(sortedTable);
+    algorithmFPType *column;
+    sortedMicroTable.getBlockOfColumnValues(j, start, n, &column);
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
+    for (size_t i = 0; i < n; i++)
+    {
+        column[i] = buffers->outValues[i];
+    }
+    sortedMicroTable.release();
+
+    if (indicesTable)
+    {
+        FeatureMicroTable<int, writeOnly, cpu> indicesMicroTable(indicesTable);
+        int *indicesColumn;
+        indicesMicroTable.getBlockOfColumnValues(j, start, n, &indicesColumn);
+        for (size_t i = 0; i < n; i++)
+        {
+            indicesColumn[i] = buffers->outIndices[i];
+        }
+        indicesMicroTable.release();
+    }
+}
+
+/**
+ *  \brief Restores the order of the heap of runs starting from the position i.
+ *         The runs are ordered by their heads, equal heads are ordered by the run number to keep the merge stable
+ */
+template<typename algorithmFPType, CpuType cpu>
+void siftDownRun(size_t i, size_t heapSize, RunMergeBuffers<algorithmFPType, cpu> *buffers)
+{
+    size_t *heap = buffers->heap;
+    const size_t r = heap[i];
+    const algorithmFPType value = buffers->values[r * _nRowsInMergeBlock + buffers->position[r]];
+
+    for (size_t child = 2 * i + 1; child < heapSize; child = 2 * i + 1)
+    {
+        size_t c = heap[child];
+        algorithmFPType childValue = buffers->values[c * _nRowsInMergeBlock + buffers->position[c]];
+        if (child + 1 < heapSize)
+        {
+            const size_t c2 = heap[child + 1];
+            const algorithmFPType value2 = buffers->values[c2 * _nRowsInMergeBlock + buffers->position[c2]];
+            if (value2 < childValue || (value2 == childValue && c2 < c))
+            {
+                child++;
+                c = c2;
+                childValue = value2;
+            }
+        }
+        if (value < childValue || (value == childValue && r < c)) { break; }
+        heap[i] = c;
+        i = child;
+    }
+    heap[i] = r;
+}
+
+/**
+ *  \brief Merges the sorted runs into the result feature by feature in parallel.
+ *
+ *  The runs and the result are accessed by blocks of _nRowsInMergeBlock values of one feature,
+ *  so the memory footprint of every thread is proportional to the number of runs and not to their length
+ */
+template<typename algorithmFPType, CpuType cpu>
+void mergeSortedRuns(size_t nRuns, NumericTable *const *runs, NumericTable *const *runIndices, NumericTable *sortedTable,
+                     NumericTable *indicesTable, services::SharedPtr<services::KernelErrorCollection> &_errors)
+{
+    const size_t nFeatures = sortedTable->getNumberOfColumns();
+    const bool computeIndices = (indicesTable != 0);
+
+    daal::tls<RunMergeBuffers<algorithmFPType, cpu> *> tls([ = ]()-> RunMergeBuffers<algorithmFPType, cpu> *
+    {
+        return RunMergeBuffers<algorithmFPType, cpu>::create(nRuns, computeIndices);
+    } );
+
+    daal::threader_for(nFeatures, nFeatures, [ =, &tls](int j)
+    {
+        RunMergeBuffers<algorithmFPType, cpu> *buffers = tls.local();
+        if (!buffers) { return; }
+
+        size_t heapSize = 0;
+        for (size_t r = 0; r < nRuns; r++)
+        {
+            buffers->blockStart[r] = 0;
+            readRunBlock<algorithmFPType, cpu>(r, j, runs[r], (computeIndices ? runIndices[r] : 0), buffers);
+            if (buffers->blockSize[r]) { buffers->heap[heapSize++] = r; }
+        }
+        for (size_t i = heapSize / 2; i-- > 0;)
+        {
+            siftDownRun<algorithmFPType, cpu>(i, heapSize, buffers);
+        }
+
+        size_t nOut = 0, outStart = 0;
+        while (heapSize)
+        {
+            const size_t r = buffers->heap[0];
+            const size_t head = r * _nRowsInMergeBlock + buffers->position[r];
+            buffers->outValues[nOut] = buffers->values[head];
+            if (computeIndices) { buffers->outIndices[nOut] = buffers->indices[head]; }
+            nOut++;
+
+            if (++buffers->position[r] == buffers->blockSize[r])
+            {
+                buffers->blockStart[r] += buffers->blockSize[r];
+                readRunBlock<algorithmFPType, cpu>(r, j, runs[r], (computeIndices ? runIndices[r] : 0), buffers);
+                if (buffers->blockSize[r] == 0)
+                {
+                    buffers->heap[0] = buffers->heap[--heapSize];
+                }
+            }
+            if (heapSize) { siftDownRun<algorithmFPType, cpu>(0, heapSize, buffers); }
+
+            if (nOut == _nRowsInMergeBlock)
+            {
+                writeMergedBlock<algorithmFPType, cpu>(j, outStart, nOut, sortedTable, indicesTable, buffers);
+                outStart += nOut;
+                nOut = 0;
+            }
+        }
+        if (nOut)
+        {
+            writeMergedBlock<algorithmFPType, cpu>(j, outStart, nOut, sortedTable, indicesTable, buffers);
+        }
+    } );
+
+    bool isAllocated = true;
+    tls.reduce([ =, &isAllocated](RunMergeBuffers<algorithmFPType, cpu> *buffers)
+    {
+        if (buffers) { RunMergeBuffers<algorithmFPType, cpu>::destroy(buffers); }
+        else         { isAllocated = false; }
+    } );
+
+    if (!isAllocated) { _errors->add(services::ErrorMemoryAllocationFailed); }
+}
+
+} // namespace daal::algorithms::sorting::internal
+
+} // namespace daal::algorithms::sorting
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
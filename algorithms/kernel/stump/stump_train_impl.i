@@ -29,6 +29,7 @@
 #include "service_utils.h"
 #include "service_data_utils.h"
 #include "service_memory.h"
+#include "service_sort.h"
 #include "stump_train_kernel.h"
 
 namespace daal
@@ -42,117 +43,56 @@ namespace training
 namespace internal
 {
 
+template <Method method, typename algorithmFPtype, CpuType cpu>
+StumpTrainKernel<method, algorithmFPtype, cpu>::StumpTrainKernel() :
+    _sortedIndices(NULL), _nSortedVectors(0), _nSortedFeatures(0)
+{}
+
+template <Method method, typename algorithmFPtype, CpuType cpu>
+StumpTrainKernel<method, algorithmFPtype, cpu>::~StumpTrainKernel()
+{
+    releaseSortedIndices();
+}
+
+template <Method method, typename algorithmFPtype, CpuType cpu>
+void StumpTrainKernel<method, algorithmFPtype, cpu>::releaseSortedIndices()
+{
+    if (_sortedIndices) { daal::services::daal_free(_sortedIndices); }
+    _sortedIndices = NULL;
+    _nSortedVectors = 0;
+    _nSortedFeatures = 0;
+}
+
 /**
- *  \brief Quick sort function that sorts array x and rearranges arrays w,z
- *         accordingly
+ *  \brief Prepares the arrays of the sorted indices of the observations for the data set of the given size.
+ *         The arrays are kept if the size of the data set is the same as in the previous call.
+ *         Otherwise each array is initialized with the identity permutation,
+ *         which is then validated and sorted if needed by stumpRegressionOrdered
  *
- *  \param n[in] Length of input arrays
- *  \param x     Array that is used as "key" when sorted
- *  \param w     Array that is used as "value" when sorted
- *  \param z     Array that is used as "value" when sorted
+ *  \param nVectors[in]   Number of observations
+ *  \param nFeatures[in]  Number of features
+ *  \return true if the memory for the arrays is available
  */
 template <Method method, typename algorithmFPtype, CpuType cpu>
-void StumpTrainKernel<method, algorithmFPtype, cpu>::StumpQSort( size_t n, algorithmFPtype *x, algorithmFPtype *w,
-                                                                 algorithmFPtype *z )
+bool StumpTrainKernel<method, algorithmFPtype, cpu>::initSortedIndices(size_t nVectors, size_t nFeatures)
 {
-    int i, ir, j, k, jstack = -1, l = 0;
-    algorithmFPtype a, b, c, tmp;
-    const int M = 7, NSTACK = 128;
-    algorithmFPtype istack[NSTACK];
+    if (_sortedIndices && _nSortedVectors == nVectors && _nSortedFeatures == nFeatures) { return true; }
 
-    ir = n - 1;
+    releaseSortedIndices();
+    _sortedIndices = (int *) daal::services::daal_malloc(nVectors * nFeatures * sizeof(int));
+    if (!_sortedIndices) { return false; }
 
-    for(;;)
+    for (size_t k = 0; k < nFeatures; k++)
     {
-        if(ir - l < M)
-        {
-            for(j = l + 1; j <= ir; j++)
-            {
-                a = x[j];
-                b = w[j];
-                c = z[j];
-
-                for(i = j - 1; i >= l; i--)
-                {
-                    if(x[i] <= a) { break; }
-                    x[i + 1] = x[i];
-                    w[i + 1] = w[i];
-                    z[i + 1] = z[i];
-                }
-
-                x[i + 1] = a;
-                w[i + 1] = b;
-                z[i + 1] = c;
-            }
-
-            if(jstack < 0) { break; }
-
-            ir = istack[jstack--];
-            l = istack[jstack--];
-        }
-        else
+        int *indices = _sortedIndices + k * nVectors;
+        for (size_t i = 0; i < nVectors; i++)
         {
-            k = (l + ir) >> 1;
-            daal::swap<algorithmFPtype, cpu>(x[k], x[l + 1]);
-            daal::swap<algorithmFPtype, cpu>(w[k], w[l + 1]);
-            daal::swap<algorithmFPtype, cpu>(z[k], z[l + 1]);
-            if(x[l] > x[ir])
-            {
-                daal::swap<algorithmFPtype, cpu>(x[l], x[ir]);
-                daal::swap<algorithmFPtype, cpu>(w[l], w[ir]);
-                daal::swap<algorithmFPtype, cpu>(z[l], z[ir]);
-            }
-            if(x[l + 1] > x[ir])
-            {
-                daal::swap<algorithmFPtype, cpu>(x[l + 1], x[ir]);
-                daal::swap<algorithmFPtype, cpu>(w[l + 1], w[ir]);
-                daal::swap<algorithmFPtype, cpu>(z[l + 1], z[ir]);
-            }
-            if(x[l] > x[l + 1])
-            {
-                daal::swap<algorithmFPtype, cpu>(x[l], x[l + 1]);
-                daal::swap<algorithmFPtype, cpu>(w[l], w[l + 1]);
-                daal::swap<algorithmFPtype, cpu>(z[l], z[l + 1]);
-            }
-            i = l + 1;
-            j = ir;
-            a = x[l + 1];
-            b = w[l + 1];
-            c = z[l + 1];
-            for(;;)
-            {
-                while(x[++i] < a);
-                while(x[--j] > a);
-                if(j < i) { break; }
-                daal::swap<algorithmFPtype, cpu>(x[i], x[j]);
-                daal::swap<algorithmFPtype, cpu>(w[i], w[j]);
-                daal::swap<algorithmFPtype, cpu>(z[i], z[j]);
-            }
-            x[l + 1] = x[j];
-            w[l + 1] = w[j];
-            z[l + 1] = z[j];
-
-            x[j] = a;
-            w[j] = b;
-            z[j] = c;
-            jstack += 2;
-
-            if(ir - i + 1 >= j - l)
-            {
-                istack[jstack  ] = ir ;
-                istack[jstack - 1] = i  ;
-                ir = j - 1;
-            }
-            else
-            {
-                istack[jstack  ] = j - 1;
-                istack[jstack - 1] = l  ;
-                l = i;
-            }
+            indices[i] = (int)i;
         }
     }
-
-    return;
+    _nSortedVectors = nVectors;
+    _nSortedFeatures = nFeatures;
+    return true;
 }
 
 /**
@@ -162,6 +102,8 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::StumpQSort( size_t n, algor
  *
  *  \param n[in]        Number of observations
  *  \param x[in]        Input data feature of size n
+ *  \param sortedIndices[in,out] Indices of the observations in ascending order of x.
+ *                      The array is sorted again only if the order does not match the data
  *  \param w[in]        Array of weights of size n
  *  \param z[in]        Array of weights of responses of size n
  *  \param sumW[in]     Total sum of weights
@@ -176,7 +118,8 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::StumpQSort( size_t n, algor
  */
 template <Method method, typename algorithmFPtype, CpuType cpu>
 void StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegressionOrdered(size_t nVectors,
-                                                                            algorithmFPtype *x, algorithmFPtype *w, algorithmFPtype *z,
+                                                                            const algorithmFPtype *x, int *sortedIndices,
+                                                                            const algorithmFPtype *w, const algorithmFPtype *z,
                                                                             algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
                                                                             algorithmFPtype *minSPtr, algorithmFPtype *splitPointPtr,
                                                                             algorithmFPtype *lMeanPtr, algorithmFPtype *rMeanPtr)
@@ -199,22 +142,32 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegressionOrdered(size
     algorithmFPtype lc, rc;  /* goal functions of the left and right regions
                       (see (9.13) in [2]) */
 
-    algorithmFPtype *xx, *ww, *zz;
-
-    /* Allocate memory for storing intermediate data */
-    xx = (algorithmFPtype *) daal::services::daal_malloc(nVectors * sizeof(algorithmFPtype));
-    ww = (algorithmFPtype *) daal::services::daal_malloc(nVectors * sizeof(algorithmFPtype));
-    zz = (algorithmFPtype *) daal::services::daal_malloc(nVectors * sizeof(algorithmFPtype));
-    if (!xx || !ww || !zz)
+    /* The indices are computed once for the data set and reused while the data does not change:
+       check the order in linear time and sort only if it is broken */
+    bool isSorted = true;
+    for (size_t k = 0; k < nVectors - 1; k++)
     {
-        this->_errors->add(services::ErrorMemoryAllocationFailed); return;
+        if (x[sortedIndices[k]] > x[sortedIndices[k + 1]]) { isSorted = false; break; }
     }
 
-    daal::services::daal_memcpy_s(ww, nVectors * sizeof(algorithmFPtype), w, nVectors * sizeof(algorithmFPtype));
-    daal::services::daal_memcpy_s(zz, nVectors * sizeof(algorithmFPtype), z, nVectors * sizeof(algorithmFPtype));
-    daal::services::daal_memcpy_s(xx, nVectors * sizeof(algorithmFPtype), x, nVectors * sizeof(algorithmFPtype));
+    if (!isSorted)
+    {
+        algorithmFPtype *xx = (algorithmFPtype *) daal::services::daal_malloc(nVectors * sizeof(algorithmFPtype));
+        if (!xx)
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed); return;
+        }
+
+        daal::services::daal_memcpy_s(xx, nVectors * sizeof(algorithmFPtype), x, nVectors * sizeof(algorithmFPtype));
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            sortedIndices[i] = (int)i;
+        }
 
-    StumpQSort(nVectors, xx, ww, zz);
+        daal::algorithms::internal::qSort<algorithmFPtype, int, cpu>(nVectors, xx, sortedIndices);
+
+        daal::services::daal_free(xx);
+    }
 
     lw = 0.0;
     lM = 0.0;
@@ -228,20 +181,22 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegressionOrdered(size
     {
         /* Move points one-by-one from the right regoin into the left
            and choose the optimal split */
-        algorithmFPtype wz = ww[k] * zz[k];
-        algorithmFPtype wzz = wz * zz[k];
+        int i = sortedIndices[k];
+        int iNext = sortedIndices[k + 1];
+        algorithmFPtype wz = w[i] * z[i];
+        algorithmFPtype wzz = wz * z[i];
 
-        lw += ww[k];
+        lw += w[i];
         lM += wz;
         ls += wzz;
-        rw -= ww[k];
+        rw -= w[i];
         rM -= wz;
         rs -= wzz;
 
-        if (xx[k] == xx[k + 1]) { continue; }
+        if (x[i] == x[iNext]) { continue; }
 
         /* Current split point */
-        curT = C05 * (xx[k] + xx[k + 1]);
+        curT = C05 * (x[i] + x[iNext]);
 
         /* Calculate weight; weighted mean and weighted sum of squares
            over points left to curT */
@@ -292,9 +247,6 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::stumpRegressionOrdered(size
     *lMeanPtr = lMean;
     *rMeanPtr = rMean;
 
-    daal::services::daal_free(xx);
-    daal::services::daal_free(ww);
-    daal::services::daal_free(zz);
     return;
 }
 
@@ -489,6 +441,11 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::doStumpRegression(size_t n,
     algorithmFPtype sumW, sumM, sumS;
     computeSums(n, w, z, &sumW, &sumM, &sumS);
 
+    if (!initSortedIndices(n, dim))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed); return;
+    }
+
     struct group_res
     {
         size_t groupSplitFeature;
@@ -505,7 +462,9 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::doStumpRegression(size_t n,
         return g;
     } );
 
-    daal::threader_for( dim, dim, [ = ](size_t k)
+    /* Stump is a weak learner often trained from within parallel loops of boosting
+       and multi-class classifiers: do not create nested parallel regions there */
+    daal::threader_for_optional( dim, dim, [ = ](size_t k)
     {
         algorithmFPtype localSplitPoint;
         algorithmFPtype localLMean;
@@ -531,7 +490,7 @@ void StumpTrainKernel<method, algorithmFPtype, cpu>::doStumpRegression(size_t n,
             BlockDescriptor<algorithmFPtype> block;
             x->getBlockOfColumnValues( k, (size_t)0, n, readOnly, block);
             x_data = block.getBlockPtr();
-            stumpRegressionOrdered(n, x_data, w, z, sumW, sumM, sumS,
+            stumpRegressionOrdered(n, x_data, _sortedIndices + k * n, w, z, sumW, sumM, sumS,
                                    &localMinS, &localSplitPoint, &localLMean, &localRMean);
             x->releaseBlockOfColumnValues( block );
         }
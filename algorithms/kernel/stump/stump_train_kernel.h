@@ -46,13 +46,14 @@ template <Method method, typename algorithmFPtype , CpuType cpu>
 class StumpTrainKernel : public Kernel
 {
 public:
+    StumpTrainKernel();
+    ~StumpTrainKernel();
+
     void compute(size_t n, const NumericTable *const *a, Model *r, const Parameter *par);
 
 private:
-    void StumpQSort( size_t n, algorithmFPtype *x, algorithmFPtype *w, algorithmFPtype *z );
-
     void stumpRegressionOrdered(size_t nVectors,
-                                algorithmFPtype *x, algorithmFPtype *w, algorithmFPtype *z,
+                                const algorithmFPtype *x, int *sortedIndices, const algorithmFPtype *w, const algorithmFPtype *z,
                                 algorithmFPtype sumW, algorithmFPtype sumM, algorithmFPtype sumS,
                                 algorithmFPtype *minSPtr, algorithmFPtype *splitPointPtr,
                                 algorithmFPtype *lMeanPtr, algorithmFPtype *rMeanPtr);
@@ -70,6 +71,16 @@ private:
                            algorithmFPtype *z,
                            size_t *splitFeature, algorithmFPtype *splitPoint,
                            algorithmFPtype *leftValue, algorithmFPtype *rightValue);
+
+    /* Boosting algorithms train the stump many times on the same data with different weights.
+     * The indices of the observations sorted by each feature are kept between the calls,
+     * so that the training needs only a linear scan per feature while the order remains valid */
+    bool initSortedIndices(size_t nVectors, size_t nFeatures);
+    void releaseSortedIndices();
+
+    int   *_sortedIndices;  /* Array of size nFeatures x nVectors */
+    size_t _nSortedVectors;
+    size_t _nSortedFeatures;
 };
 
 } // namespace daal::algorithms::stump::training::internal
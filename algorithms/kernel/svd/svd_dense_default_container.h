@@ -197,12 +197,15 @@ void DistributedContainer<step2Master, interm, method, cpu>::compute()
 
     size_t na = nBlocks;
     NumericTable **a = new NumericTable*[nBlocks];
-    size_t nr = nBlocks + 2;
-    NumericTable **r = new NumericTable*[nBlocks + 2];
+    size_t nr = nBlocks + 3;
+    NumericTable **r = new NumericTable*[nBlocks + 3];
 
     r[0] = static_cast<NumericTable *>(results->get(singularValues).get());
     r[1] = static_cast<NumericTable *>(results->get(rightSingularMatrix).get());
 
+    data_management::DataCollection *parentCollection = partialResult->get(outputOfStep2ForStep2).get();
+    r[nBlocks + 2] = (parentCollection && parentCollection->size() != 0) ? static_cast<NumericTable *>((*parentCollection)[0].get()) : 0;
+
     size_t iBlocks = 0;
     for( size_t i = 0; i < nNodes; i++ )
     {
@@ -234,7 +237,57 @@ void DistributedContainer<step2Master, interm, method, cpu>::compute()
 }
 
 template<typename interm, Method method, CpuType cpu>
-void DistributedContainer<step2Master, interm, method, cpu>::finalizeCompute() {}
+void DistributedContainer<step2Master, interm, method, cpu>::finalizeCompute()
+{
+    DistributedStep2Input *input = static_cast<DistributedStep2Input *>(_in);
+    DistributedPartialResult *partialResult = static_cast<DistributedPartialResult *>(_pres);
+    Parameter *svdPar = static_cast<Parameter *>(_par);
+
+    if( svdPar->leftSingularMatrix == notRequired ) { return; }
+
+    /* Nothing to apply on the root node of the reduction tree */
+    data_management::DataCollection *parentCollection = input ?
+        static_cast<data_management::DataCollection *>(input->get(inputOfStep2FromStep2).get()) : 0;
+    if( parentCollection == 0 || parentCollection->size() == 0 ) { return; }
+
+    data_management::KeyValueDataCollection *perNodePartials =
+        static_cast<data_management::KeyValueDataCollection *>(partialResult->get(outputOfStep2ForStep3).get());
+
+    size_t nNodes  = perNodePartials->size();
+    size_t nBlocks = 0;
+    for( size_t i = 0; i < nNodes; i++ )
+    {
+        nBlocks += static_cast<data_management::DataCollection *>((*perNodePartials).getValueByIndex(i).get())->size();
+    }
+
+    size_t na = 1;
+    NumericTable *a0 = static_cast<NumericTable *>((*parentCollection)[0].get());
+    NumericTable **a = &a0;
+    size_t nr = nBlocks;
+    NumericTable **r = new NumericTable*[nBlocks];
+
+    size_t iBlocks = 0;
+    for( size_t i = 0; i < nNodes; i++ )
+    {
+        data_management::DataCollection *nodePartials = static_cast<data_management::DataCollection *>((*perNodePartials).getValueByIndex(
+                                                                                                           i).get());
+        size_t nodeSize = nodePartials->size();
+
+        for( size_t j = 0 ; j < nodeSize ; j++ )
+        {
+            r[iBlocks + j] = static_cast<NumericTable *>((*nodePartials)[j].get());
+        }
+
+        iBlocks += nodeSize;
+    }
+
+    daal::algorithms::Parameter *par = _par;
+    daal::services::Environment::env &env = *_env;
+
+    __DAAL_CALL_KERNEL(env, internal::SVDDistributedStep2Kernel, __DAAL_KERNEL_ARGUMENTS(interm, method), finalizeCompute, na, a, nr, r, par);
+
+    delete[] r;
+}
 
 template<typename interm, Method method, CpuType cpu>
 DistributedContainer<step3Local, interm, method, cpu>::DistributedContainer(daal::services::Environment::env *daalEnv)
@@ -63,6 +63,8 @@ class SVDDistributedStep2Kernel : public Kernel
 public:
     void compute(const size_t na, const NumericTable *const *a,
                  const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par = 0);
+    void finalizeCompute(const size_t na, const NumericTable *const *a,
+                 const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par = 0);
 };
 
 template<typename interm, daal::algorithms::svd::Method method, CpuType cpu>
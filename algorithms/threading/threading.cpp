@@ -27,6 +27,51 @@
 #if defined(__DO_TBB_LAYER__)
     #include <tbb/tbb.h>
     #include <tbb/spin_mutex.h>
+    #include <tbb/task_arena.h>
+    #include <tbb/enumerable_thread_specific.h>
+#endif
+
+#if defined(__DO_TBB_LAYER__)
+namespace
+{
+
+/* Depth of the threading layer parallel regions executed by the calling thread */
+tbb::enumerable_thread_specific<int> &parallelRegionDepth()
+{
+    static tbb::enumerable_thread_specific<int> depth(0);
+    return depth;
+}
+
+/* Marks the calling thread as executing a body of a threading layer parallel loop */
+class ParallelRegionGuard
+{
+public:
+    ParallelRegionGuard() : _depth(parallelRegionDepth().local()) { ++_depth; }
+    ~ParallelRegionGuard() { --_depth; }
+
+private:
+    int &_depth;
+};
+
+/* Executes the loop either directly or inside the task arena restricted to threads_request threads.
+ * The arena is created only when the request really limits the parallelism of an outermost loop
+ * of n iterations */
+template<typename F>
+void executeWithThreadsRequest(size_t n, int threads_request, const F &loop)
+{
+    if(threads_request > 0 && (size_t)threads_request < n &&
+       threads_request < tbb::task_scheduler_init::default_num_threads() && !_daal_is_in_parallel())
+    {
+        tbb::task_arena arena(threads_request);
+        arena.execute(loop);
+    }
+    else
+    {
+        loop();
+    }
+}
+
+}
 #endif
 
 DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void** init)
@@ -50,13 +95,26 @@ DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void** init)
 DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void* a, daal::functype func)
 {
   #if defined(__DO_TBB_LAYER__)
-    tbb::parallel_for( tbb::blocked_range<int>(0,n,1), [&](tbb::blocked_range<int> r)
+    if(threads_request == 1 || n == 1)
     {
-        int i;
-        for( i = r.begin(); i < r.end(); i++ )
+        for( int i = 0; i < n; i++ )
         {
             func(i, a);
         }
+        return;
+    }
+
+    executeWithThreadsRequest(n, threads_request, [&]()
+    {
+        tbb::parallel_for( tbb::blocked_range<int>(0,n,1), [&](tbb::blocked_range<int> r)
+        {
+            ParallelRegionGuard guard;
+            int i;
+            for( i = r.begin(); i < r.end(); i++ )
+            {
+                func(i, a);
+            }
+        } );
     } );
   #elif defined(__DO_SEQ_LAYER__)
     int i;
@@ -70,15 +128,127 @@ DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void* a, d
 DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const void* a, daal::functype2 func)
 {
   #if defined(__DO_TBB_LAYER__)
-    tbb::parallel_for( tbb::blocked_range<int>(0,n,1), [&](tbb::blocked_range<int> r)
+    executeWithThreadsRequest(n, threads_request, [&]()
     {
-        func(r.begin(), r.end()-r.begin(), a);
+        tbb::parallel_for( tbb::blocked_range<int>(0,n,1), [&](tbb::blocked_range<int> r)
+        {
+            ParallelRegionGuard guard;
+            func(r.begin(), r.end()-r.begin(), a);
+        } );
     } );
   #elif defined(__DO_SEQ_LAYER__)
     func(0, n, a);
   #endif
 }
 
+DAAL_EXPORT void _daal_threader_for_blocked_size(size_t n, size_t block, int threads_request, const void* a,
+                                                 daal::functype_blocked_size func)
+{
+    if(n == 0) { return; }
+    if(block == 0 || block > n) { block = n; }
+
+    const size_t nBlocks = n / block + !!(n % block);
+
+  #if defined(__DO_TBB_LAYER__)
+    if(nBlocks == 1 || threads_request == 1)
+    {
+        for( size_t iBlock = 0; iBlock < nBlocks; iBlock++ )
+        {
+            const size_t first = iBlock * block;
+            func(first, (first + block < n ? first + block : n), a);
+        }
+        return;
+    }
+
+    executeWithThreadsRequest(nBlocks, threads_request, [&]()
+    {
+        tbb::parallel_for( tbb::blocked_range<size_t>(0, nBlocks, 1), [&](tbb::blocked_range<size_t> r)
+        {
+            ParallelRegionGuard guard;
+            for( size_t iBlock = r.begin(); iBlock < r.end(); iBlock++ )
+            {
+                const size_t first = iBlock * block;
+                func(first, (first + block < n ? first + block : n), a);
+            }
+        } );
+    } );
+  #elif defined(__DO_SEQ_LAYER__)
+    for( size_t iBlock = 0; iBlock < nBlocks; iBlock++ )
+    {
+        const size_t first = iBlock * block;
+        func(first, (first + block < n ? first + block : n), a);
+    }
+  #endif
+}
+
+DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const void* a, daal::functype func)
+{
+  #if defined(__DO_TBB_LAYER__)
+    if(_daal_is_in_parallel())
+    {
+        for( int i = 0; i < n; i++ )
+        {
+            func(i, a);
+        }
+        return;
+    }
+  #endif
+    _daal_threader_for(n, threads_request, a, func);
+}
+
+DAAL_EXPORT void _daal_static_threader_for(size_t n, int threads_request, const void* a, daal::functype_static func)
+{
+  #if defined(__DO_TBB_LAYER__)
+    size_t nThreads = tbb::task_scheduler_init::default_num_threads();
+    if(threads_request > 0 && (size_t)threads_request < nThreads) { nThreads = threads_request; }
+    if(_daal_is_in_parallel()) { nThreads = 1; }
+    const size_t nChunks = (n < nThreads ? n : nThreads);
+    if(nChunks <= 1)
+    {
+        for( size_t i = 0; i < n; i++ )
+        {
+            func(i, 0, a);
+        }
+        return;
+    }
+
+    const size_t chunkSize = n / nChunks;
+    const size_t nLargerChunks = n % nChunks;
+
+    /* Each chunk is a separate task: no work stealing inside a chunk, the chunk index serves as tid */
+    executeWithThreadsRequest(nChunks, threads_request, [&]()
+    {
+        tbb::parallel_for( tbb::blocked_range<size_t>(0, nChunks, 1), [&](tbb::blocked_range<size_t> r)
+        {
+            ParallelRegionGuard guard;
+            for( size_t tid = r.begin(); tid < r.end(); tid++ )
+            {
+                const size_t first = tid * chunkSize + (tid < nLargerChunks ? tid : nLargerChunks);
+                const size_t last  = first + chunkSize + (tid < nLargerChunks);
+                for( size_t i = first; i < last; i++ )
+                {
+                    func(i, tid, a);
+                }
+            }
+        }, tbb::simple_partitioner() );
+    } );
+  #elif defined(__DO_SEQ_LAYER__)
+    for( size_t i = 0; i < n; i++ )
+    {
+        func(i, 0, a);
+    }
+  #endif
+}
+
+DAAL_EXPORT bool _daal_is_in_parallel()
+{
+  #if defined(__DO_TBB_LAYER__)
+    return parallelRegionDepth().local() > 0;
+  #elif defined(__DO_SEQ_LAYER__)
+    return false;
+  #endif
+}
+
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
   #if defined(__DO_TBB_LAYER__)
@@ -134,3 +304,61 @@ DAAL_EXPORT void _daal_reduce_tls(void* tlsPtr, void* a, daal::tls_reduce_functy
     func( tlsPtr, a );
   #endif
 }
+
+DAAL_EXPORT void _daal_parallel_reduce_tls(void* tlsPtr, void* a, daal::tls_reduce_functype func)
+{
+  #if defined(__DO_TBB_LAYER__)
+    tbb::enumerable_thread_specific<void*> *p =
+        static_cast<tbb::enumerable_thread_specific<void*>*>(tlsPtr);
+
+    tbb::parallel_for( p->range(1), [&](tbb::enumerable_thread_specific<void*>::range_type r)
+    {
+        ParallelRegionGuard guard;
+        for( auto it = r.begin() ; it != r.end() ; ++it )
+        {
+            func( (*it), a );
+        }
+    } );
+  #elif defined(__DO_SEQ_LAYER__)
+    func( tlsPtr, a );
+  #endif
+}
+
+DAAL_EXPORT void* _daal_tree_reduce_tls(void* tlsPtr, void* a, daal::tls_merge_functype func)
+{
+  #if defined(__DO_TBB_LAYER__)
+    tbb::enumerable_thread_specific<void*> *p =
+        static_cast<tbb::enumerable_thread_specific<void*>*>(tlsPtr);
+
+    const size_t n = p->size();
+    if(n == 0) { return NULL; }
+
+    void **locals = new void*[n];
+    size_t i = 0;
+    for( auto it = p->begin() ; it != p->end() ; ++it, ++i )
+    {
+        locals[i] = *it;
+    }
+
+    /* On the level with the given stride, element i accumulates element i + stride for every i multiple of 2*stride */
+    for( size_t stride = 1; stride < n; stride *= 2 )
+    {
+        const size_t nPairs = (n - stride - 1) / (2 * stride) + 1;
+        tbb::parallel_for( tbb::blocked_range<size_t>(0, nPairs, 1), [&](tbb::blocked_range<size_t> r)
+        {
+            ParallelRegionGuard guard;
+            for( size_t iPair = r.begin(); iPair < r.end(); iPair++ )
+            {
+                const size_t iDst = iPair * 2 * stride;
+                func( locals[iDst], locals[iDst + stride], a );
+            }
+        }, tbb::simple_partitioner() );
+    }
+
+    void *result = locals[0];
+    delete[] locals;
+    return result;
+  #elif defined(__DO_SEQ_LAYER__)
+    return tlsPtr;
+  #endif
+}
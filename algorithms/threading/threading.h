@@ -31,8 +31,11 @@ namespace daal
 
 typedef void (*functype)(int i, const void *a);
 typedef void (*functype2)(int i, int n, const void *a);
+typedef void (*functype_blocked_size)(size_t first, size_t last, const void *a);
+typedef void (*functype_static)(size_t i, size_t tid, const void *a);
 typedef void *(*tls_functype)(const void *a);
 typedef void (*tls_reduce_functype)(void *p, const void *a);
+typedef void (*tls_merge_functype)(void *dst, void *src, const void *a);
 
 }
 
@@ -41,9 +44,16 @@ extern "C" {
     DAAL_EXPORT int   _daal_threader_get_max_threads();
     DAAL_EXPORT void  _daal_threader_for(int n, int threads_request, const void *a, daal::functype func);
     DAAL_EXPORT void  _daal_threader_for_blocked(int n, int threads_request, const void *a, daal::functype2 func);
+    DAAL_EXPORT void  _daal_threader_for_blocked_size(size_t n, size_t block, int threads_request, const void *a,
+                                                      daal::functype_blocked_size func);
+    DAAL_EXPORT void  _daal_threader_for_optional(int n, int threads_request, const void *a, daal::functype func);
+    DAAL_EXPORT void  _daal_static_threader_for(size_t n, int threads_request, const void *a, daal::functype_static func);
+    DAAL_EXPORT bool  _daal_is_in_parallel();
     DAAL_EXPORT void *_daal_get_tls_ptr( void *a, daal::tls_functype func );
     DAAL_EXPORT void *_daal_get_tls_local( void *tlsPtr );
     DAAL_EXPORT void  _daal_reduce_tls( void *tlsPtr, void *a, daal::tls_reduce_functype func );
+    DAAL_EXPORT void  _daal_parallel_reduce_tls( void *tlsPtr, void *a, daal::tls_reduce_functype func );
+    DAAL_EXPORT void *_daal_tree_reduce_tls( void *tlsPtr, void *a, daal::tls_merge_functype func );
     DAAL_EXPORT void  _daal_del_tls_ptr( void *tlsPtr );
 
     DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void **init);
@@ -76,6 +86,29 @@ inline void threader_func_b(int i0, int in, const void *a)
     lambda(i0, in);
 }
 
+template<typename F>
+inline void threader_func_blocked_size(size_t first, size_t last, const void *a)
+{
+    const F &lambda = *static_cast<const F *>(a);
+    lambda(first, last);
+}
+
+template<typename F>
+inline void static_threader_func(size_t i, size_t tid, const void *a)
+{
+    const F &lambda = *static_cast<const F *>(a);
+    lambda(i, tid);
+}
+
+inline bool threader_is_in_parallel()
+{
+    return _daal_is_in_parallel();
+}
+
+/**
+ * Calls lambda(i) for every i in [0, n) using dynamic (work-stealing) scheduling.
+ * If 0 < threads_request < n, at most threads_request threads execute the loop.
+ */
 template<typename F>
 inline void threader_for(int n, int threads_request, const F &lambda)
 {
@@ -92,6 +125,44 @@ inline void threader_for_blocked(int n, int threads_request, const F &lambda)
     _daal_threader_for_blocked(n, threads_request, a, threader_func_b<F>);
 }
 
+/**
+ * Splits [0, n) into consecutive blocks of size block (the last one may be smaller)
+ * and calls lambda(first, last) once per block. Block boundaries are always multiples
+ * of block, so lambda can derive the block index as first / block.
+ */
+template<typename F>
+inline void threader_for_blocked_size(size_t n, size_t block, int threads_request, const F &lambda)
+{
+    const void *a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_blocked_size(n, block, threads_request, a, threader_func_blocked_size<F>);
+}
+
+/**
+ * Same as threader_for, but runs sequentially in the calling thread when called
+ * from inside another parallel region of the threading layer.
+ */
+template<typename F>
+inline void threader_for_optional(int n, int threads_request, const F &lambda)
+{
+    const void *a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_optional(n, threads_request, a, threader_func<F>);
+}
+
+/**
+ * Statically partitions [0, n) into contiguous chunks, one per thread, and calls lambda(i, tid)
+ * where tid in [0, threader_get_threads_number()) identifies the chunk. Indices with the same tid
+ * are never processed concurrently, so tid may be used to address per-thread buffers.
+ */
+template<typename F>
+inline void static_threader_for(size_t n, int threads_request, const F &lambda)
+{
+    const void *a = static_cast<const void *>(&lambda);
+
+    _daal_static_threader_for(n, threads_request, a, static_threader_func<F>);
+}
+
 template<typename lambdaType>
 inline void *tls_func(const void *a)
 {
@@ -106,6 +177,13 @@ inline void tls_reduce_func(void *v, const void *a)
     lambda((F)v);
 }
 
+template<typename F, typename lambdaType>
+inline void tls_merge_func(void *dst, void *src, const void *a)
+{
+    const lambdaType &lambda = *static_cast<const lambdaType *>(a);
+    lambda((F)dst, (F)src);
+}
+
 struct tlsBase
 {
     virtual ~tlsBase() {}
@@ -166,6 +244,32 @@ public:
         _daal_reduce_tls( tlsPtr, a, tls_reduce_func<F, lambdaType> );
     }
 
+    /**
+     * Calls lambda(local) for every thread-local object concurrently.
+     * Intended for independent per-object work, e.g. resetting or releasing the buffers.
+     */
+    template<typename lambdaType>
+    void parallel_reduce(const lambdaType &lambda)
+    {
+        const void *ac = static_cast<const void *>(&lambda);
+        void *a = const_cast<void *>(ac);
+        _daal_parallel_reduce_tls( tlsPtr, a, tls_reduce_func<F, lambdaType> );
+    }
+
+    /**
+     * Merges thread-local objects pairwise along a binary tree: lambda(dst, src) must accumulate src into dst.
+     * Merges on the same level of the tree run concurrently.
+     * Returns the object that holds the result of the whole reduction or 0 if no thread-local objects exist.
+     * Thread-local objects stay allocated and can be reused by subsequent parallel loops.
+     */
+    template<typename lambdaType>
+    F tree_reduce(const lambdaType &lambda)
+    {
+        const void *ac = static_cast<const void *>(&lambda);
+        void *a = const_cast<void *>(ac);
+        return static_cast<F>(_daal_tree_reduce_tls( tlsPtr, a, tls_merge_func<F, lambdaType> ));
+    }
+
 private:
     void *tlsPtr;
     void *voidLambda;
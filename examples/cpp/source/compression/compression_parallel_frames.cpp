@@ -0,0 +1,116 @@
+/* file: compression_parallel_frames.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of compression and decompression of independent frames in
+!    parallel and of decompression that starts from an arbitrary frame
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-COMPRESSION_PARALLEL_FRAMES"></a>
+ * \example compression_parallel_frames.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace data_management;
+
+string datasetFileName  = "../data/online/logitboost_train.csv";
+
+const size_t frameSize = 65536; /* Size of the uncompressed data in a frame */
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Read data from a file */
+    byte *data;
+    size_t dataSize = readTextFile(datasetFileName, &data);
+
+    /* Create a compressor */
+    Compressor<zlib> compressor;
+    compressor.parameter.level = level9;
+
+    /* Create a stream that compresses frames of frameSize bytes in parallel */
+    CompressionStream compressionStream(&compressor, frameSize, parallelFrames);
+
+    /* Put the data to compressionStream */
+    compressionStream << DataBlock(data, dataSize);
+
+    /* Copy the compressed frames to a contiguous array */
+    size_t compressedSize = compressionStream.getCompressedDataSize();
+    byte *compressedData = new byte[compressedSize];
+    compressionStream.copyCompressedArray(compressedData, compressedSize);
+
+    /* Create a decompressor */
+    Decompressor<zlib> decompressor;
+
+    /* Create a stream that decompresses the frames in parallel */
+    DecompressionStream decompressionStream(&decompressor, frameSize, parallelFrames);
+
+    /* Write the compressed data to decompressionStream, the frames are decompressed only when they are read */
+    decompressionStream << DataBlock(compressedData, compressedSize);
+
+    size_t nFrames = decompressionStream.getNumberOfFrames();
+
+    /* Decompress all frames */
+    byte *decompressedData = new byte[dataSize];
+    size_t decompressedSize = decompressionStream.copyDecompressedArray(decompressedData, dataSize);
+
+    /* Move to the frame in the middle of the data and decompress it alone */
+    size_t frame = nFrames / 2;
+    decompressionStream.seekFrame(frame);
+    byte *frameData = new byte[frameSize];
+    size_t frameDataSize = decompressionStream.copyDecompressedArray(frameData, frameSize);
+
+    /* Compute checksums of the input data, of the decompressed data, and of the frame */
+    unsigned int crcData = getCRC32(data, 0, dataSize);
+    unsigned int crcDecompressedData = getCRC32(decompressedData, 0, decompressedSize);
+    unsigned int crcFrame = getCRC32(data + frame * frameSize, 0, frameDataSize);
+    unsigned int crcFrameData = getCRC32(frameData, 0, frameDataSize);
+
+    cout << endl << "Compression example program results:" << endl << endl;
+
+    cout << "Number of frames:            " << dec << nFrames << endl;
+    cout << "Input data checksum:         0x" << hex << crcData << endl;
+    cout << "Decompressed data checksum:  0x" << hex << crcDecompressedData << endl;
+    cout << "Frame read after seek:       " << dec << frame << endl;
+    cout << "Input frame checksum:        0x" << hex << crcFrame << endl;
+    cout << "Decompressed frame checksum: 0x" << hex << crcFrameData << endl;
+
+    bool isOk = (decompressedSize == dataSize && crcData == crcDecompressedData && frameDataSize > 0 && crcFrame == crcFrameData);
+    if (isOk)
+    {
+        cout << "OK: Decompressed data CRC matches with the input data CRC" << endl;
+    }
+    else
+    {
+        cout << "ERROR: Decompressed data CRC mismatches with the input data CRC" << endl;
+    }
+
+    delete [] frameData;
+    delete [] decompressedData;
+    delete [] compressedData;
+    delete [] data;
+
+    return (isOk ? 0 : -1);
+}
@@ -0,0 +1,115 @@
+/* file: covariance_dense_blocked_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense variance-covariance matrix computation in the batch
+!    processing mode with the blocked multithreaded accumulation of the
+!    cross-product
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-COVARIANCE_DENSE_BLOCKED_BATCH"></a>
+ * \example covariance_dense_blocked_batch.cpp
+ */
+
+#include <cmath>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const string datasetFileName = "../data/batch/covcormoments_dense.csv";
+
+services::SharedPtr<covariance::Result> computeCovariance(const services::SharedPtr<NumericTable> &data,
+                                                          covariance::CrossProductAccumulation accumulation);
+bool isEqual(const services::SharedPtr<NumericTable> &table1, const services::SharedPtr<NumericTable> &table2);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Compute a dense variance-covariance matrix with the cross-product computed by a single call to the math library */
+    services::SharedPtr<covariance::Result> defaultRes =
+        computeCovariance(dataSource.getNumericTable(), covariance::defaultAccumulation);
+
+    /* Compute a dense variance-covariance matrix with the rows of the data split between threads */
+    services::SharedPtr<covariance::Result> blockedRes =
+        computeCovariance(dataSource.getNumericTable(), covariance::blockedAccumulation);
+
+    printNumericTable(blockedRes->get(covariance::covariance), "Covariance matrix (blocked accumulation):");
+    printNumericTable(blockedRes->get(covariance::mean),       "Mean vector (blocked accumulation):");
+
+    /* The blocked accumulation changes only the order of the summation */
+    bool isOk = isEqual(blockedRes->get(covariance::covariance), defaultRes->get(covariance::covariance)) &&
+                isEqual(blockedRes->get(covariance::mean),       defaultRes->get(covariance::mean));
+    cout << "Results of the blocked accumulation are " << (isOk ? "equal" : "NOT equal") <<
+         " to results of the default accumulation" << endl;
+
+    return (isOk ? 0 : -1);
+}
+
+services::SharedPtr<covariance::Result> computeCovariance(const services::SharedPtr<NumericTable> &data,
+                                                          covariance::CrossProductAccumulation accumulation)
+{
+    /* Create an algorithm to compute a dense variance-covariance matrix using the default method */
+    covariance::Batch<> algorithm;
+    algorithm.input.set(covariance::data, data);
+
+    /* Select the way to accumulate the cross-product */
+    algorithm.parameter.crossProductAccumulation = accumulation;
+
+    /* Compute a dense variance-covariance matrix */
+    algorithm.compute();
+
+    /* Get the computed dense variance-covariance matrix */
+    return algorithm.getResult();
+}
+
+bool isEqual(const services::SharedPtr<NumericTable> &table1, const services::SharedPtr<NumericTable> &table2)
+{
+    const double eps = 1e-9;
+
+    size_t nRows = table1->getNumberOfRows();
+    size_t nCols = table1->getNumberOfColumns();
+    if (table2->getNumberOfRows() != nRows || table2->getNumberOfColumns() != nCols) { return false; }
+
+    BlockDescriptor<double> block1, block2;
+    table1->getBlockOfRows(0, nRows, readOnly, block1);
+    table2->getBlockOfRows(0, nRows, readOnly, block2);
+    double *data1 = block1.getBlockPtr();
+    double *data2 = block2.getBlockPtr();
+
+    bool isEqual = true;
+    for (size_t i = 0; i < nRows * nCols; i++)
+    {
+        if (fabs(data1[i] - data2[i]) > eps * (1.0 + fabs(data2[i]))) { isEqual = false; }
+    }
+
+    table1->releaseBlockOfRows(block1);
+    table2->releaseBlockOfRows(block2);
+    return isEqual;
+}
@@ -0,0 +1,118 @@
+/* file: datastructures_allocation_policy.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of numeric tables that allocate their data with a page size
+!    and NUMA placement policy of their own
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DATASTRUCTURES_ALLOCATION_POLICY">
+ * \example datastructures_allocation_policy.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace daal;
+
+typedef double dataFPType;
+
+/* The tables are large enough for the policies to apply to their data */
+const size_t nFeatures     = 256;
+const size_t nObservations = 4096;
+const dataFPType constValue = 0.5;
+
+bool hasValue(NumericTable &table, dataFPType value);
+
+int main()
+{
+    std::cout << "Allocation policy of numeric tables example" << std::endl << std::endl;
+
+    /* Huge pages interleaved across the NUMA nodes for a table read by all threads */
+    services::AllocationPolicy interleavedPolicy(services::hugePageSize, services::interleavedPlacement);
+
+    /* Pages placed on the nodes of the threads that process them for a table split between the threads */
+    services::AllocationPolicy firstTouchPolicy(services::defaultPageSize, services::parallelFirstTouchPlacement);
+
+    /* Construct the tables with the policies that override the default policy of the library */
+    HomogenNumericTable<dataFPType> homogenTable(nFeatures, nObservations, NumericTable::doAllocate, constValue,
+                                                 interleavedPolicy);
+    Matrix<dataFPType> matrix(nFeatures, nObservations, NumericTable::doAllocate, constValue, firstTouchPolicy);
+    PackedSymmetricMatrix<NumericTableIface::upperPackedSymmetricMatrix, dataFPType> symmetricMatrix(
+        nFeatures, NumericTable::doAllocate, constValue, interleavedPolicy);
+
+    /* Construct a structure of arrays and set the policy before its arrays are allocated */
+    NumericTableDictionary dictionary(nFeatures);
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        dictionary.setFeature<dataFPType>(i);
+    }
+    SOANumericTable soaTable(&dictionary, nObservations, NumericTable::doAllocate, firstTouchPolicy);
+
+    /* Construct a table that uses the default policy of the library */
+    HomogenNumericTable<dataFPType> defaultTable(nFeatures, nObservations, NumericTable::doAllocate, constValue);
+
+    /* Fill the structure of arrays with the constant */
+    BlockDescriptor<dataFPType> block;
+    soaTable.getBlockOfRows(0, nObservations, writeOnly, block);
+    dataFPType *soaData = block.getBlockPtr();
+    for (size_t i = 0; i < nFeatures * nObservations; i++)
+    {
+        soaData[i] = constValue;
+    }
+    soaTable.releaseBlockOfRows(block);
+
+    /* The policies change only the pages of the tables, not their contents */
+    bool isHomogenOk   = hasValue(homogenTable, constValue);
+    bool isMatrixOk    = hasValue(matrix, constValue);
+    bool isSymmetricOk = hasValue(symmetricMatrix, constValue);
+    bool isSOAOk       = hasValue(soaTable, constValue);
+    bool isDefaultOk   = hasValue(defaultTable, constValue);
+
+    std::cout << "Homogen table with interleaved huge pages:      " << (isHomogenOk   ? "OK" : "ERROR") << std::endl;
+    std::cout << "Matrix with parallel first touch:               " << (isMatrixOk    ? "OK" : "ERROR") << std::endl;
+    std::cout << "Packed symmetric matrix with interleaved pages: " << (isSymmetricOk ? "OK" : "ERROR") << std::endl;
+    std::cout << "SOA table with parallel first touch:            " << (isSOAOk       ? "OK" : "ERROR") << std::endl;
+    std::cout << "Homogen table with the default policy:          " << (isDefaultOk   ? "OK" : "ERROR") << std::endl;
+
+    bool isOk = isHomogenOk && isMatrixOk && isSymmetricOk && isSOAOk && isDefaultOk;
+
+    return (isOk ? 0 : -1);
+}
+
+bool hasValue(NumericTable &table, dataFPType value)
+{
+    if (table.getErrors()->size() != 0) { return false; }
+
+    const size_t nRows = table.getNumberOfRows();
+    const size_t nCols = table.getNumberOfColumns();
+
+    BlockDescriptor<dataFPType> block;
+    table.getBlockOfRows(0, nRows, readOnly, block);
+    dataFPType *data = block.getBlockPtr();
+
+    bool isEqual = (block.getNumberOfRows() == nRows);
+    for (size_t i = 0; isEqual && i < nRows * nCols; i++)
+    {
+        isEqual = (data[i] == value);
+    }
+    table.releaseBlockOfRows(block);
+
+    return isEqual;
+}
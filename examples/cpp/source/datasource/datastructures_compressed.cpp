@@ -0,0 +1,73 @@
+/* file: datastructures_compressed.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of using a numeric table that keeps the data compressed in memory
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DATASTRUCTURES_COMPRESSED">
+ * \example datastructures_compressed.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/covcormoments_dense.csv";
+
+const size_t nRowsInBlock = 1000;
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+    services::SharedPtr<NumericTable> data = dataSource.getNumericTable();
+
+    /* Compress the data by blocks of rows with the zlib method */
+    services::SharedPtr<CompressedNumericTable<double> > compressedData(
+        new CompressedNumericTable<double>(data, zlib, nRowsInBlock, level6));
+
+    std::cout << "Size of the data: " << data->getNumberOfRows() * data->getNumberOfColumns() * sizeof(double) << std::endl;
+    std::cout << "Size of the compressed data: " << compressedData->getCompressedDataSize() << std::endl << std::endl;
+
+    /* Only the blocks that contain the requested rows are decompressed */
+    printNumericTable(compressedData, "First rows of the compressed table:", 5);
+
+    /* Compute low order moments on the compressed data */
+    low_order_moments::Batch<> algorithm;
+    algorithm.input.set(low_order_moments::data, compressedData);
+    algorithm.compute();
+
+    services::SharedPtr<low_order_moments::Result> res = algorithm.getResult();
+    printNumericTable(res->get(low_order_moments::mean),     "Mean:");
+    printNumericTable(res->get(low_order_moments::variance), "Variance:");
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+/* file: datastructures_mmap.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of using memory-mapped binary data files
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DATASTRUCTURES_MMAP">
+ * \example datastructures_mmap.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/kmeans_dense.csv";
+string binaryFileName  = "kmeans_dense.bin";
+
+const size_t nRowsInBlock = 4000;
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> csvDataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                    DataSource::doDictionaryFromContext);
+
+    /* Parse the text data once */
+    csvDataSource.loadDataBlock();
+
+    /* Store the data in the binary file */
+    MmapFileWriter writer;
+    writer.write(csvDataSource.getNumericTable().get(), binaryFileName);
+
+    /* Map the binary file into memory. The data is used without parsing and copying */
+    MmapDataSource mmapDataSource(binaryFileName);
+
+    std::cout << "Number of rows in the binary file: " << mmapDataSource.getNumberOfAvailableRows() << std::endl;
+    std::cout << "Number of columns in the binary file: " << mmapDataSource.getNumberOfColumns() << std::endl << std::endl;
+
+    /* Read the data by blocks of rows */
+    while (mmapDataSource.getStatus() == DataSourceIface::readyForLoad)
+    {
+        size_t nRows = mmapDataSource.loadDataBlock(nRowsInBlock);
+        std::cout << nRows << " rows are mapped" << std::endl;
+        printNumericTable(mmapDataSource.getNumericTable(), "First rows of the block:", 3);
+    }
+
+    return 0;
+}
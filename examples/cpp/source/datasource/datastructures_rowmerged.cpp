@@ -0,0 +1,92 @@
+/* file: datastructures_rowmerged.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Row merged data structures example.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-DATASTRUCTURES_ROWMERGED">
+ * \example datastructures_rowmerged.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace daal;
+
+int main()
+{
+    std::cout << "Row merged numeric table example" << std::endl << std::endl;
+
+    const size_t nFeatures = 5;
+    const size_t nObservations1 = 3;
+    const size_t nObservations2 = 4;
+    const size_t firstReadRow = 2;
+    const size_t nRead = 3;
+
+    double data1[nFeatures * nObservations1] =
+    {
+        0.0, 0.1, 0.2, 0.3, 0.4,
+        1.0, 1.1, 1.2, 1.3, 1.4,
+        2.0, 2.1, 2.2, 2.3, 2.4,
+    };
+    double data2[nFeatures * nObservations2] =
+    {
+        3.0, 3.1, 3.2, 3.3, 3.4,
+        4.0, 4.1, 4.2, 4.3, 4.4,
+        5.0, 5.1, 5.2, 5.3, 5.4,
+        6.0, 6.1, 6.2, 6.3, 6.4,
+    };
+
+    /* Create two homogen numeric tables from data arrays */
+    services::SharedPtr<HomogenNumericTable<double> > dataTable1(new HomogenNumericTable<double>(data1, nFeatures, nObservations1));
+    services::SharedPtr<HomogenNumericTable<double> > dataTable2(new HomogenNumericTable<double>(data2, nFeatures, nObservations2));
+
+    /* Create row merged numeric table consisting of two homogen numeric tables. The data is not copied */
+    RowMergedNumericTable dataTable;
+    dataTable.addNumericTable(dataTable1);
+    dataTable.addNumericTable(dataTable2);
+
+    BlockDescriptor<double> block;
+
+    /* Read rows from both tables */
+    dataTable.getBlockOfRows(firstReadRow, nRead, readWrite, block);
+    printArray<double>(block.getBlockPtr(), nFeatures, block.getNumberOfRows(), "Print 3 rows from row merged numeric table as double:");
+
+    /* Modify rows of the row merged numeric table */
+    double *rows = block.getBlockPtr();
+    for (size_t i = 0; i < nFeatures * block.getNumberOfRows(); i++) rows[i] *= rows[i];
+    dataTable.releaseBlockOfRows(block);
+
+    /* Read the modified rows from homogen numeric tables */
+    dataTable1->getBlockOfRows(firstReadRow, 1, readOnly, block);
+    printArray<double>(block.getBlockPtr(), nFeatures, block.getNumberOfRows(), "Print last row from first homogen numeric table as double:");
+    dataTable1->releaseBlockOfRows(block);
+
+    dataTable2->getBlockOfRows(0, nRead - 1, readOnly, block);
+    printArray<double>(block.getBlockPtr(), nFeatures, block.getNumberOfRows(), "Print first rows from second homogen numeric table as double:");
+    dataTable2->releaseBlockOfRows(block);
+
+    /* Rows that belong to one table are accessed without copying */
+    dataTable.getBlockOfRows(nObservations1, nObservations2, readOnly, block);
+    std::cout << "Rows of the second table are accessed in place: " << (block.getBlockPtr() == data2 ? "yes" : "no") << std::endl;
+    dataTable.releaseBlockOfRows(block);
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+/* file: gbt_cls_dense_distr.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees classification in the distributed processing mode.
+!
+!    The local nodes and the master node exchange the partial results until the master node
+!    reports the training completed. Every feature of the data set takes few distinct values,
+!    so the borders of the bins and the trees are the same as in the batch processing mode.
+!    The program checks that both models assign the same classes to the observations.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_CLS_DENSE_DISTR"></a>
+ * \example gbt_cls_dense_distr.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::gbt::classification;
+
+const size_t nBlocks         = 4;
+const size_t nVectorsInBlock = 2500;
+const size_t nFeatures       = 3;
+const size_t nClasses        = 3;
+
+/* Gradient boosted trees parameters */
+const size_t maxIterations = 10;
+const size_t maxTreeDepth  = 4;
+
+services::SharedPtr<NumericTable> predict(const services::SharedPtr<NumericTable> &data,
+                                          const services::SharedPtr<gbt::classification::Model> &model)
+{
+    prediction::Batch<> algorithm(nClasses);
+    algorithm.input.set(classifier::prediction::data, data);
+    algorithm.input.set(classifier::prediction::model, model);
+    algorithm.compute();
+    return algorithm.getResult()->get(classifier::prediction::prediction);
+}
+
+int main(int argc, char *argv[])
+{
+    const size_t nVectors = nBlocks * nVectorsInBlock;
+
+    /* Generate the data set: the features take 20 different values each */
+    services::SharedPtr<HomogenNumericTable<double> > data(new HomogenNumericTable<double>(nFeatures, nVectors,
+                                                                                            NumericTable::doAllocate));
+    services::SharedPtr<HomogenNumericTable<double> > labels(new HomogenNumericTable<double>(1, nVectors, NumericTable::doAllocate));
+    double *x = data->getArray();
+    double *y = labels->getArray();
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        x[i * nFeatures]     = (double)((i * 7) % 20) / 10.0;
+        x[i * nFeatures + 1] = (double)((i * 13) % 19) / 10.0;
+        x[i * nFeatures + 2] = (double)((i * 29) % 17) / 10.0;
+        const double z = x[i * nFeatures] * x[i * nFeatures + 1] - x[i * nFeatures + 2];
+        y[i] = (z < 0.0 ? 0.0 : (z < 1.0 ? 1.0 : 2.0));
+    }
+
+    /* Create the algorithms for the local nodes and for the master node */
+    training::Distributed<step1Local> localAlgorithms[nBlocks];
+    training::Distributed<step2Master> masterAlgorithm(nClasses);
+
+    masterAlgorithm.parameter.maxIterations = maxIterations;
+    masterAlgorithm.parameter.maxTreeDepth  = maxTreeDepth;
+    for (size_t b = 0; b < nBlocks; b++)
+    {
+        services::SharedPtr<NumericTable> blockData(new HomogenNumericTable<double>(x + b * nVectorsInBlock * nFeatures,
+                                                                                    nFeatures, nVectorsInBlock));
+        services::SharedPtr<NumericTable> blockLabels(new HomogenNumericTable<double>(y + b * nVectorsInBlock,
+                                                                                                 1, nVectorsInBlock));
+        localAlgorithms[b].input.set(classifier::training::data, blockData);
+        localAlgorithms[b].input.set(classifier::training::labels, blockLabels);
+        localAlgorithms[b].parameter = masterAlgorithm.parameter;
+    }
+
+    /* The local nodes compute the statistics requested by the master node until the training is completed.
+     * The borders of the bins and the training state are not set on the first call */
+    services::SharedPtr<gbt::training::DistributedPartialResult> masterPartialResult;
+    do
+    {
+        for (size_t b = 0; b < nBlocks; b++)
+        {
+            localAlgorithms[b].compute();
+            masterAlgorithm.input.add(gbt::training::partialResults, localAlgorithms[b].getPartialResult());
+        }
+
+        masterAlgorithm.compute();
+        masterPartialResult = masterAlgorithm.getPartialResult();
+
+        for (size_t b = 0; b < nBlocks; b++)
+        {
+            localAlgorithms[b].input.set(training::inputBinBorders, masterPartialResult->get(gbt::training::binBorders));
+            localAlgorithms[b].input.set(training::inputTrainingState, masterPartialResult->get(gbt::training::trainingState));
+        }
+    }
+    while (!masterPartialResult->isCompleted());
+
+    masterAlgorithm.finalizeCompute();
+    services::SharedPtr<gbt::classification::Model> distributedModel = masterAlgorithm.getResult()->get(classifier::training::model);
+
+    /* Train the model on the whole data set in the batch processing mode */
+    training::Batch<> batchAlgorithm(nClasses);
+    batchAlgorithm.input.set(classifier::training::data, data);
+    batchAlgorithm.input.set(classifier::training::labels, labels);
+    batchAlgorithm.parameter = masterAlgorithm.parameter;
+    batchAlgorithm.compute();
+    services::SharedPtr<gbt::classification::Model> batchModel = batchAlgorithm.getResult()->get(classifier::training::model);
+
+    services::SharedPtr<NumericTable> distributedPrediction = predict(data, distributedModel);
+    services::SharedPtr<NumericTable> batchPrediction = predict(data, batchModel);
+    printNumericTables<int, int>(labels.get(), distributedPrediction.get(), "Ground truth", "Classification results",
+                                 "Gradient boosted trees classification results (first 20 observations):", 20);
+
+    BlockDescriptor<int> distributedBlock, batchBlock;
+    distributedPrediction->getBlockOfRows(0, nVectors, readOnly, distributedBlock);
+    batchPrediction->getBlockOfRows(0, nVectors, readOnly, batchBlock);
+    size_t nDifferent = 0;
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        if (distributedBlock.getBlockPtr()[i] != batchBlock.getBlockPtr()[i]) { nDifferent++; }
+    }
+    distributedPrediction->releaseBlockOfRows(distributedBlock);
+    batchPrediction->releaseBlockOfRows(batchBlock);
+
+    std::cout << "Number of trees: " << distributedModel->getNumberOfTrees() << std::endl;
+    std::cout << "Number of observations classified differently in the batch processing mode: " << nDifferent << std::endl;
+
+    return (distributedModel->getNumberOfTrees() == batchModel->getNumberOfTrees() && nDifferent == 0) ? 0 : -1;
+}
@@ -0,0 +1,131 @@
+/* file: gbt_reg_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression in the batch processing mode.
+!
+!    The program trains the gradient boosted trees model on a training data set
+!    and then predicts the first dependent variable of previously unseen data.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_DENSE_BATCH"></a>
+ * \example gbt_reg_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::gbt::regression;
+
+/* Input data set parameters */
+string trainDatasetFileName            = "../data/batch/linear_regression_train.csv";
+string testDatasetFileName             = "../data/batch/linear_regression_test.csv";
+
+const size_t nFeatures           = 10;
+const size_t nDependentVariables = 2;
+
+/* Gradient boosted trees parameters */
+const size_t maxIterations = 100;
+
+void trainModel();
+void testModel();
+
+services::SharedPtr<training::Result> trainingResult;
+services::SharedPtr<prediction::Result> predictionResult;
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 2, &trainDatasetFileName, &testDatasetFileName);
+
+    trainModel();
+    testModel();
+
+    return 0;
+}
+
+void trainModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName,
+                                                      DataSource::notAllocateNumericTable,
+                                                      DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and dependent variables.
+     * Only the first dependent variable is used for the training */
+    services::SharedPtr<NumericTable> trainData(new HomogenNumericTable<double>(nFeatures, 0, NumericTable::notAllocate));
+    services::SharedPtr<NumericTable> trainDependentVariable(new HomogenNumericTable<double>(1, 0, NumericTable::notAllocate));
+    services::SharedPtr<NumericTable> trainUnused(new HomogenNumericTable<double>(nDependentVariables - 1, 0, NumericTable::notAllocate));
+    services::SharedPtr<MergedNumericTable> mergedData(new MergedNumericTable(trainData, trainDependentVariable));
+    mergedData->addNumericTable(trainUnused);
+
+    /* Retrieve the data from input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    /* Create an algorithm object to train the gradient boosted trees regression model */
+    training::Batch<> algorithm;
+
+    /* Pass a training data set and dependent values to the algorithm */
+    algorithm.input.set(training::data, trainData);
+    algorithm.input.set(training::dependentVariable, trainDependentVariable);
+
+    algorithm.parameter.maxIterations = maxIterations;
+
+    /* Build the gradient boosted trees regression model */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    trainingResult = algorithm.getResult();
+    std::cout << "Number of trees in the model: " << trainingResult->get(training::model)->getNumberOfTrees() << std::endl;
+}
+
+void testModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the test data from a .csv file */
+    FileDataSource<CSVFeatureManager> testDataSource(testDatasetFileName,
+                                                     DataSource::notAllocateNumericTable,
+                                                     DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for testing data and ground truth values */
+    services::SharedPtr<NumericTable> testData(new HomogenNumericTable<double>(nFeatures, 0, NumericTable::notAllocate));
+    services::SharedPtr<NumericTable> testGroundTruth(new HomogenNumericTable<double>(1, 0, NumericTable::notAllocate));
+    services::SharedPtr<NumericTable> testUnused(new HomogenNumericTable<double>(nDependentVariables - 1, 0, NumericTable::notAllocate));
+    services::SharedPtr<MergedNumericTable> mergedData(new MergedNumericTable(testData, testGroundTruth));
+    mergedData->addNumericTable(testUnused);
+
+    /* Load the data from the data file */
+    testDataSource.loadDataBlock(mergedData.get());
+
+    /* Create an algorithm object to predict values of gradient boosted trees regression */
+    prediction::Batch<> algorithm;
+
+    /* Pass a testing data set and the trained model to the algorithm */
+    algorithm.input.set(prediction::data, testData);
+    algorithm.input.set(prediction::model, trainingResult->get(training::model));
+
+    /* Predict values of gradient boosted trees regression */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    predictionResult = algorithm.getResult();
+    printNumericTable(predictionResult->get(prediction::prediction),
+        "Gradient boosted trees prediction results (first 10 rows):", 10);
+    printNumericTable(testGroundTruth, "Ground truth (first 10 rows):", 10);
+}
@@ -0,0 +1,104 @@
+/* file: gbt_reg_unbalanced_split_dense_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of gradient boosted trees regression in the batch processing mode
+!    on the data set where the first split isolates a small group of observations.
+!
+!    The small child of the root cannot be split because it has less than
+!    2 * minObservationsInLeafNode observations, the large child must still be
+!    split on the second feature. The program checks the prediction error.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-GBT_REG_UNBALANCED_SPLIT_DENSE_BATCH"></a>
+ * \example gbt_reg_unbalanced_split_dense_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms::gbt::regression;
+
+const size_t nObservations = 2000;
+const size_t nOutliers     = 60;
+const size_t nFeatures     = 2;
+
+/* Gradient boosted trees parameters */
+const size_t maxIterations             = 1;
+const size_t maxTreeDepth              = 3;
+const size_t minObservationsInLeafNode = 50;
+
+int main(int argc, char *argv[])
+{
+    /* Generate the data set: the outliers have the large value of the first feature and of the response,
+     * the response of the other observations is defined by the sign of the second feature */
+    services::SharedPtr<HomogenNumericTable<double> > data(new HomogenNumericTable<double>(nFeatures, nObservations,
+                                                                                            NumericTable::doAllocate));
+    services::SharedPtr<HomogenNumericTable<double> > dependentVariable(new HomogenNumericTable<double>(1, nObservations,
+                                                                                                         NumericTable::doAllocate));
+    double *x = data->getArray();
+    double *y = dependentVariable->getArray();
+    for (size_t i = 0; i < nObservations; i++)
+    {
+        x[i * nFeatures]     = (i < nOutliers ? 10.0 : (double)((i * 37) % 101) / 100.0);
+        x[i * nFeatures + 1] = (double)((i * 53) % 199) / 99.0 - 1.0;
+        y[i] = (i < nOutliers ? 100.0 : (x[i * nFeatures + 1] > 0.0 ? 1.0 : -1.0));
+    }
+
+    /* Train the gradient boosted trees regression model */
+    training::Batch<> trainAlgorithm;
+    trainAlgorithm.input.set(training::data, data);
+    trainAlgorithm.input.set(training::dependentVariable, dependentVariable);
+
+    trainAlgorithm.parameter.maxIterations             = maxIterations;
+    trainAlgorithm.parameter.maxTreeDepth              = maxTreeDepth;
+    trainAlgorithm.parameter.minObservationsInLeafNode = minObservationsInLeafNode;
+    trainAlgorithm.parameter.shrinkage                 = 1.0;
+    trainAlgorithm.parameter.lambda                    = 0.0;
+
+    trainAlgorithm.compute();
+
+    /* Predict the responses on the training data set */
+    prediction::Batch<> predictAlgorithm;
+    predictAlgorithm.input.set(prediction::data, data);
+    predictAlgorithm.input.set(prediction::model, trainAlgorithm.getResult()->get(training::model));
+
+    predictAlgorithm.compute();
+
+    services::SharedPtr<NumericTable> predictionTable = predictAlgorithm.getResult()->get(prediction::prediction);
+    printNumericTable(predictionTable, "Gradient boosted trees prediction results (first 10 rows):", 10);
+
+    /* The observations of the large child of the root must be separated by the second feature */
+    BlockDescriptor<double> block;
+    predictionTable->getBlockOfRows(0, nObservations, readOnly, block);
+    double *prediction = block.getBlockPtr();
+    double mse = 0.0;
+    for (size_t i = nOutliers; i < nObservations; i++)
+    {
+        mse += (prediction[i] - y[i]) * (prediction[i] - y[i]);
+    }
+    mse /= (double)(nObservations - nOutliers);
+    predictionTable->releaseBlockOfRows(block);
+
+    std::cout << "Mean squared error on the observations that are not outliers: " << mse << std::endl;
+
+    return (mse < 0.1) ? 0 : -1;
+}
@@ -0,0 +1,143 @@
+/* file: kmeans_dense_elkan_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of dense K-Means clustering accelerated with the triangle
+!    inequality in the batch processing mode. The results are compared with
+!    the results of the Lloyd method on the data set with categorical features
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-KMEANS_DENSE_ELKAN_BATCH"></a>
+ * \example kmeans_dense_elkan_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+string datasetFileName     = "../data/batch/kmeans_dense.csv";
+
+/* K-Means algorithm parameters */
+const size_t nClusters   = 20;
+const size_t nIterations = 5;
+
+/* Number of trailing features that are marked as categorical */
+const size_t nCategoricalFeatures = 2;
+
+template <kmeans::Method method>
+services::SharedPtr<kmeans::Result> computeKMeans(services::SharedPtr<NumericTable> data,
+                                                   services::SharedPtr<NumericTable> centroids, double gamma)
+{
+    kmeans::Batch<double, method> algorithm(nClusters, nIterations);
+
+    algorithm.input.set(kmeans::data,           data);
+    algorithm.input.set(kmeans::inputCentroids, centroids);
+    algorithm.parameter.gamma = gamma;
+
+    algorithm.compute();
+
+    return algorithm.getResult();
+}
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    services::SharedPtr<NumericTable> data = dataSource.getNumericTable();
+
+    /* Mark the last features as categorical */
+    NumericTableDictionary *pDictionary = data->getDictionary();
+    size_t nFeatures = pDictionary->getNumberOfFeatures();
+    for(size_t i = nFeatures - nCategoricalFeatures; i < nFeatures; i++)
+    {
+        (*pDictionary)[i].featureType = data_feature_utils::DAAL_CATEGORICAL;
+    }
+
+    /* Get initial clusters for the K-Means algorithm */
+    kmeans::init::Batch<double,kmeans::init::randomDense> init(nClusters);
+
+    init.input.set(kmeans::init::data, data);
+    init.compute();
+
+    services::SharedPtr<NumericTable> centroids = init.getResult()->get(kmeans::init::centroids);
+
+    /* Cluster the data with the Lloyd method and with the triangle inequality bounds */
+    services::SharedPtr<kmeans::Result> lloydResult = computeKMeans<kmeans::lloydDense>     (data, centroids, 1.0);
+    services::SharedPtr<kmeans::Result> elkanResult = computeKMeans<kmeans::lloydElkanDense>(data, centroids, 1.0);
+
+    /* Print the clusterization results */
+    printNumericTable(elkanResult->get(kmeans::assignments), "First 10 cluster assignments:", 10);
+    printNumericTable(elkanResult->get(kmeans::centroids  ), "First 10 dimensions of centroids:", 20, 10);
+    printNumericTable(elkanResult->get(kmeans::goalFunction), "Goal function value:");
+
+    /* Compare the results of the methods */
+    services::SharedPtr<NumericTable> lloydAssignments = lloydResult->get(kmeans::assignments);
+    services::SharedPtr<NumericTable> elkanAssignments = elkanResult->get(kmeans::assignments);
+    services::SharedPtr<NumericTable> lloydCentroids   = lloydResult->get(kmeans::centroids);
+    services::SharedPtr<NumericTable> elkanCentroids   = elkanResult->get(kmeans::centroids);
+
+    size_t nRows = lloydAssignments->getNumberOfRows();
+    BlockDescriptor<int> lloydAssignBlock, elkanAssignBlock;
+    lloydAssignments->getBlockOfRows(0, nRows, readOnly, lloydAssignBlock);
+    elkanAssignments->getBlockOfRows(0, nRows, readOnly, elkanAssignBlock);
+
+    size_t nMismatches = 0;
+    for(size_t i = 0; i < nRows; i++)
+    {
+        if(lloydAssignBlock.getBlockPtr()[i] != elkanAssignBlock.getBlockPtr()[i]) { nMismatches++; }
+    }
+
+    lloydAssignments->releaseBlockOfRows(lloydAssignBlock);
+    elkanAssignments->releaseBlockOfRows(elkanAssignBlock);
+
+    BlockDescriptor<double> lloydCentroidsBlock, elkanCentroidsBlock;
+    lloydCentroids->getBlockOfRows(0, nClusters, readOnly, lloydCentroidsBlock);
+    elkanCentroids->getBlockOfRows(0, nClusters, readOnly, elkanCentroidsBlock);
+
+    double maxDiff = 0.0;
+    for(size_t i = 0; i < nClusters * nFeatures; i++)
+    {
+        double diff = lloydCentroidsBlock.getBlockPtr()[i] - elkanCentroidsBlock.getBlockPtr()[i];
+        if(diff < 0.0) { diff = -diff; }
+        if(diff > maxDiff) { maxDiff = diff; }
+    }
+
+    lloydCentroids->releaseBlockOfRows(lloydCentroidsBlock);
+    elkanCentroids->releaseBlockOfRows(elkanCentroidsBlock);
+
+    std::cout << "Assignments different from the Lloyd method: " << nMismatches << std::endl;
+    std::cout << "Maximal difference of the centroids: " << maxDiff << std::endl << std::endl;
+
+    /* Decrease the weight of the categorical features in the distance */
+    services::SharedPtr<kmeans::Result> weightedResult = computeKMeans<kmeans::lloydElkanDense>(data, centroids, 0.25);
+    printNumericTable(weightedResult->get(kmeans::goalFunction), "Goal function value with categorical features weighted by 0.25:");
+
+    return (nMismatches == 0 && maxDiff < 1e-6) ? 0 : -1;
+}
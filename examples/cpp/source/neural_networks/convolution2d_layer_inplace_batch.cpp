@@ -0,0 +1,155 @@
+/* file: convolution2d_layer_inplace_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of backward two-dimensional convolution layer that writes
+!    the gradient into the tensor with the input data of the forward layer.
+!    The derivatives are compared with the derivatives computed directly
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-CONVOLUTION2D_LAYER_INPLACE_BATCH"></a>
+ * \example convolution2d_layer_inplace_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::neural_networks::layers;
+using namespace daal::data_management;
+using namespace daal::services;
+
+const size_t nObservations = 2;
+const size_t nChannels     = 2;
+const size_t nRows         = 8;
+const size_t nCols         = 8;
+const size_t nKernels      = 3;
+const size_t kernelSize    = 2;
+
+float maxDifference(const SharedPtr<Tensor> &tensor, const float *expected)
+{
+    float *actual = static_cast<HomogenTensor<float> *>(tensor.get())->getArray();
+    size_t size = tensor->getSize();
+    float maxDiff = 0.0f;
+    for (size_t i = 0; i < size; i++)
+    {
+        float diff = actual[i] - expected[i];
+        if (diff < 0.0f) { diff = -diff; }
+        if (diff > maxDiff) { maxDiff = diff; }
+    }
+    return maxDiff;
+}
+
+int main(int argc, char *argv[])
+{
+    /* Create the input data tensor */
+    Collection<size_t> inDims;
+    inDims.push_back(nObservations);
+    inDims.push_back(nChannels);
+    inDims.push_back(nRows);
+    inDims.push_back(nCols);
+    SharedPtr<Tensor> tensorData = SharedPtr<Tensor>(new HomogenTensor<float>(inDims, Tensor::doAllocate));
+    float *x = static_cast<HomogenTensor<float> *>(tensorData.get())->getArray();
+    size_t xSize = tensorData->getSize();
+    for (size_t i = 0; i < xSize; i++)
+    {
+        x[i] = (float)(i % 7) * 0.1f - 0.3f;
+    }
+    float *xCopy = new float[xSize];
+    for (size_t i = 0; i < xSize; i++) { xCopy[i] = x[i]; }
+
+    /* Compute forward two-dimensional convolution layer results */
+    convolution2d::forward::Batch<> convolution2dLayerForward;
+    convolution2dLayerForward.parameter.nKernels = nKernels;
+    convolution2dLayerForward.input.set(forward::data, tensorData);
+    convolution2dLayerForward.compute();
+
+    SharedPtr<convolution2d::forward::Result> forwardResult = convolution2dLayerForward.getResult();
+    float *w = static_cast<HomogenTensor<float> *>(forwardResult->get(convolution2d::auxWeights).get())->getArray();
+
+    /* Create input gradient tensor for backward two-dimensional convolution layer */
+    const Collection<size_t> &gDims = forwardResult->get(forward::value)->getDimensions();
+    SharedPtr<Tensor> tensorDataBack = SharedPtr<Tensor>(new HomogenTensor<float>(gDims, Tensor::doAllocate));
+    float *g = static_cast<HomogenTensor<float> *>(tensorDataBack.get())->getArray();
+    for (size_t i = 0; i < tensorDataBack->getSize(); i++)
+    {
+        g[i] = (float)(i % 5) * 0.01f;
+    }
+
+    /* Compute the derivatives directly */
+    size_t gRows = gDims[2], gCols = gDims[3];
+    float *wDerExpected = new float[nKernels * nChannels * kernelSize * kernelSize];
+    float *bDerExpected = new float[nKernels];
+    float *gradExpected = new float[xSize];
+    for (size_t i = 0; i < nKernels * nChannels * kernelSize * kernelSize; i++) { wDerExpected[i] = 0.0f; }
+    for (size_t i = 0; i < nKernels; i++) { bDerExpected[i] = 0.0f; }
+    for (size_t i = 0; i < xSize; i++) { gradExpected[i] = 0.0f; }
+
+    for (size_t n = 0; n < nObservations; n++)
+    for (size_t k = 0; k < nKernels; k++)
+    for (size_t r = 0; r < gRows; r++)
+    for (size_t c = 0; c < gCols; c++)
+    {
+        float gValue = g[((n * nKernels + k) * gRows + r) * gCols + c];
+        bDerExpected[k] += gValue;
+        for (size_t ch = 0; ch < nChannels; ch++)
+        for (size_t i = 0; i < kernelSize; i++)
+        for (size_t j = 0; j < kernelSize; j++)
+        {
+            size_t wIndex = ((k * nChannels + ch) * kernelSize + i) * kernelSize + j;
+            size_t xIndex = ((n * nChannels + ch) * nRows + r + i) * nCols + c + j;
+            wDerExpected[wIndex] += gValue * xCopy[xIndex];
+            gradExpected[xIndex] += gValue * w[wIndex];
+        }
+    }
+
+    /* Compute backward two-dimensional convolution layer results into the forward input tensor */
+    convolution2d::backward::Batch<> convolution2dLayerBackward;
+    convolution2dLayerBackward.parameter.nKernels = nKernels;
+    convolution2dLayerBackward.input.set(backward::inputGradient, tensorDataBack);
+    convolution2dLayerBackward.input.set(backward::inputFromForward, forwardResult->get(forward::resultForBackward));
+
+    SharedPtr<convolution2d::backward::Result> backwardResult(new convolution2d::backward::Result());
+    backwardResult->allocate<float>(&(convolution2dLayerBackward.input), &(convolution2dLayerBackward.parameter), 0);
+    backwardResult->set(backward::gradient, tensorData);
+    convolution2dLayerBackward.setResult(backwardResult);
+
+    convolution2dLayerBackward.compute();
+
+    printTensor(backwardResult->get(backward::weightDerivatives),
+                "Two-dimensional convolution layer backpropagation weightDerivative result (first 5 rows):", 5, 15);
+
+    float wDerDiff = maxDifference(backwardResult->get(backward::weightDerivatives), wDerExpected);
+    float bDerDiff = maxDifference(backwardResult->get(backward::biasDerivatives),   bDerExpected);
+    float gradDiff = maxDifference(backwardResult->get(backward::gradient),          gradExpected);
+
+    std::cout << "Maximal difference of the weight derivatives: " << wDerDiff << std::endl;
+    std::cout << "Maximal difference of the bias derivatives:   " << bDerDiff << std::endl;
+    std::cout << "Maximal difference of the gradient:           " << gradDiff << std::endl;
+
+    delete[] xCopy;
+    delete[] wDerExpected;
+    delete[] bDerExpected;
+    delete[] gradExpected;
+
+    return (wDerDiff < 1e-4f && bDerDiff < 1e-4f && gradDiff < 1e-4f) ? 0 : -1;
+}
@@ -60,7 +60,7 @@ int main(int argc, char *argv[])
     services::SharedPtr<maximum_pooling1d::forward::Result> forwardResult = forwardLayer.getResult();
 
     printTensor(forwardResult->get(forward::value), "Forward one-dimensional maximum pooling layer result (first 5 rows):", 5);
-    printTensor(forwardResult->get(maximum_pooling1d::auxMask), "Forward one-dimensional maximum pooling layer mask (first 5 rows):", 5);
+    printTensor(forwardResult->get(maximum_pooling1d::auxSelectedIndices), "Forward one-dimensional maximum pooling layer selected indices (first 5 rows):", 5);
 
     /* Create an algorithm to compute backward one-dimensional maximum pooling layer results using default method */
     maximum_pooling1d::backward::Batch<> backwardLayer(nDim);
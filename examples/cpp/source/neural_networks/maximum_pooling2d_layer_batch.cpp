@@ -60,7 +60,7 @@ int main(int argc, char *argv[])
     services::SharedPtr<maximum_pooling2d::forward::Result> forwardResult = forwardLayer.getResult();
 
     printTensor(forwardResult->get(forward::value), "Forward two-dimensional maximum pooling layer result (first 5 rows):", 5);
-    printTensor(forwardResult->get(maximum_pooling2d::auxMask), "Forward two-dimensional maximum pooling layer mask (first 10 rows):", 10);
+    printTensor(forwardResult->get(maximum_pooling2d::auxSelectedIndices), "Forward two-dimensional maximum pooling layer selected indices (first 10 rows):", 10);
 
     /* Create an algorithm to compute backward two-dimensional maximum pooling layer results using default method */
     maximum_pooling2d::backward::Batch<> backwardLayer(nDim);
@@ -63,8 +63,8 @@ int main(int argc, char *argv[])
 
     printTensor3d(forwardResult->get(forward::value),
         "Forward maximum pooling layer result:");
-    printTensor3d(forwardResult->get(maximum_pooling3d::auxMask),
-        "Forward maximum pooling layer mask:");
+    printTensor3d(forwardResult->get(maximum_pooling3d::auxSelectedIndices),
+        "Forward maximum pooling layer selected indices:");
 
     /* Create an algorithm to compute backward pooling layer results using maximum method */
     maximum_pooling3d::backward::Batch<> backwardLayer(nDim);
@@ -0,0 +1,183 @@
+/* file: neural_network_layout_propagation_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of neural network training and prediction with two adjacent
+!    two-dimensional convolution layers that pass their results to each other
+!    in the internal layout. The predictions are compared with the predictions
+!    of the same network trained and run without the layout propagation
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-NEURAL_NETWORK_LAYOUT_PROPAGATION_BATCH"></a>
+ * \example neural_network_layout_propagation_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::neural_networks;
+using namespace daal::algorithms::neural_networks::layers;
+using namespace daal::data_management;
+using namespace daal::services;
+
+const size_t nObservations = 40;
+const size_t nChannels     = 2;
+const size_t nRows         = 8;
+const size_t nCols         = 8;
+const size_t nKernels      = 4;
+const size_t batchSize     = 10;
+
+enum LayerIndex
+{
+    conv1 = 0,
+    conv2 = 1,
+    fc1   = 2,
+    sm1   = 3
+};
+
+Collection<LayerDescriptor> configureNet()
+{
+    /* Create two-dimensional convolution layers that follow one another */
+    SharedPtr<convolution2d::Batch<> > convolution2dLayer1(new convolution2d::Batch<>());
+    convolution2dLayer1->parameter.nKernels = nKernels;
+
+    SharedPtr<convolution2d::Batch<> > convolution2dLayer2(new convolution2d::Batch<>());
+    convolution2dLayer2->parameter.nKernels = nKernels;
+
+    /* Create fully-connected layer and initialize layer parameters */
+    SharedPtr<fullyconnected::Batch<> > fullyConnectedLayer(new fullyconnected::Batch<>(2));
+
+    fullyConnectedLayer->parameter.weightsInitializer = services::SharedPtr<initializers::uniform::Batch<> >(
+                                                            new initializers::uniform::Batch<>(-0.01, 0.01));
+
+    /* Create softmax layer and initialize layer parameters */
+    SharedPtr<loss::softmax_cross::Batch<> > softmaxCrossEntropyLayer(new loss::softmax_cross::Batch<>());
+
+    /* Create configuration of the neural network */
+    Collection<LayerDescriptor> configuration;
+
+    configuration.push_back(LayerDescriptor(conv1, convolution2dLayer1, NextLayers(conv2)));
+    configuration.push_back(LayerDescriptor(conv2, convolution2dLayer2, NextLayers(fc1)));
+    configuration.push_back(LayerDescriptor(fc1, fullyConnectedLayer, NextLayers(sm1)));
+    configuration.push_back(LayerDescriptor(sm1, softmaxCrossEntropyLayer, NextLayers()));
+
+    return configuration;
+}
+
+SharedPtr<prediction::Model> trainModel(const SharedPtr<Tensor> &trainingData,
+                                        const SharedPtr<Tensor> &trainingGroundTruth, bool layoutPropagation)
+{
+    /* Create an algorithm to train neural network */
+    training::Batch<> net;
+
+    net.parameter.batchSize = batchSize;
+
+    /* Keep the results of the convolution layers in the internal layout */
+    net.parameter.layoutPropagation = layoutPropagation;
+
+    /* Configure the neural network */
+    Collection<LayerDescriptor> layersConfiguration = configureNet();
+    net.initialize(trainingData->getDimensions(), layersConfiguration);
+
+    /* Pass a training data set and dependent values to the algorithm */
+    net.input.set(training::data, trainingData);
+    net.input.set(training::groundTruth, trainingGroundTruth);
+
+    SharedPtr<optimization_solver::sgd::Batch<float> > sgdAlgorithm(new optimization_solver::sgd::Batch<float>());
+
+    float learningRate = 0.001f;
+    sgdAlgorithm->parameter.learningRateSequence = services::SharedPtr<NumericTable>(new HomogenNumericTable<double>(1, 1, NumericTable::doAllocate, learningRate));
+
+    net.parameter.optimizationSolver = sgdAlgorithm;
+
+    /* Run the neural network training */
+    net.compute();
+
+    return net.getResult()->get(training::model)->getPredictionModel<float>();
+}
+
+SharedPtr<Tensor> testModel(const SharedPtr<prediction::Model> &predictionModel,
+                            const SharedPtr<Tensor> &predictionData, bool layoutPropagation)
+{
+    /* Create an algorithm to compute the neural network predictions */
+    prediction::Batch<> net;
+
+    net.parameter.layoutPropagation = layoutPropagation;
+
+    net.input.set(prediction::model, predictionModel);
+    net.input.set(prediction::data, predictionData);
+
+    /* Run the neural network prediction */
+    net.compute();
+
+    return net.getResult()->get(prediction::prediction);
+}
+
+int main(int argc, char *argv[])
+{
+    /* Create the input data tensor */
+    Collection<size_t> dataDims;
+    dataDims.push_back(nObservations);
+    dataDims.push_back(nChannels);
+    dataDims.push_back(nRows);
+    dataDims.push_back(nCols);
+    SharedPtr<Tensor> data(new HomogenTensor<float>(dataDims, Tensor::doAllocate));
+    float *x = static_cast<HomogenTensor<float> *>(data.get())->getArray();
+    size_t dataSize = data->getSize();
+    for (size_t i = 0; i < dataSize; i++)
+    {
+        x[i] = (float)(i % 11) * 0.1f - 0.5f;
+    }
+
+    /* Create the tensor with the class labels */
+    Collection<size_t> groundTruthDims;
+    groundTruthDims.push_back(nObservations);
+    groundTruthDims.push_back(1);
+    SharedPtr<Tensor> groundTruth(new HomogenTensor<float>(groundTruthDims, Tensor::doAllocate));
+    float *y = static_cast<HomogenTensor<float> *>(groundTruth.get())->getArray();
+    for (size_t i = 0; i < nObservations; i++)
+    {
+        y[i] = (float)(i % 2);
+    }
+
+    /* Train and run the same network with and without the layout propagation */
+    SharedPtr<Tensor> expected = testModel(trainModel(data, groundTruth, false), data, false);
+    SharedPtr<Tensor> actual   = testModel(trainModel(data, groundTruth, true),  data, true);
+
+    printTensor(actual, "Neural network predictions with the layout propagation (first 10 observations):", 10);
+
+    float *expectedArray = static_cast<HomogenTensor<float> *>(expected.get())->getArray();
+    float *actualArray   = static_cast<HomogenTensor<float> *>(actual.get())->getArray();
+    size_t size = actual->getSize();
+    float maxDiff = 0.0f;
+    for (size_t i = 0; i < size; i++)
+    {
+        float diff = actualArray[i] - expectedArray[i];
+        if (diff < 0.0f) { diff = -diff; }
+        if (diff > maxDiff) { maxDiff = diff; }
+    }
+
+    std::cout << "Maximal difference of the predictions: " << maxDiff << std::endl;
+
+    return (maxDiff < 1e-3f) ? 0 : -1;
+}
@@ -0,0 +1,247 @@
+/* file: qr_distributed_tree.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of QR decomposition in the distributed
+!    processing mode with the second step run as a binary reduction tree
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-QR_DISTRIBUTED_TREE"></a>
+ * \example qr_distributed_tree.cpp
+ */
+
+#include <cmath>
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+
+/* Input data set parameters */
+const size_t nBlocks      = 4;
+const size_t nMergeNodes  = nBlocks / 2;
+
+const string datasetFileNames[] =
+{
+    "../data/distributed/qr_1.csv",
+    "../data/distributed/qr_2.csv",
+    "../data/distributed/qr_3.csv",
+    "../data/distributed/qr_4.csv"
+};
+
+void computestep1Local(size_t block);
+void computeOnMergeNode(size_t node);
+void computeOnRootNode();
+void finalizeComputeOnMergeNode(size_t node);
+void finalizeComputestep1Local(size_t block);
+services::SharedPtr<NumericTable> computeOnFlatMaster();
+bool isEqualUpToSign(const services::SharedPtr<NumericTable> &table1, const services::SharedPtr<NumericTable> &table2);
+
+services::SharedPtr<data_management::DataCollection> dataFromStep1ForStep2[nBlocks];
+services::SharedPtr<data_management::DataCollection> dataFromStep1ForStep3[nBlocks];
+services::SharedPtr<data_management::DataCollection> dataFromStep2ForStep3[nBlocks];
+services::SharedPtr<data_management::DataCollection> dataFromMergeNodeForRoot[nMergeNodes];
+services::SharedPtr<data_management::DataCollection> dataFromRootForMergeNode[nMergeNodes];
+services::SharedPtr<qr::Distributed<step2Master> > mergeNodeAlgorithms[nMergeNodes];
+services::SharedPtr<NumericTable> R;
+services::SharedPtr<NumericTable> Qi[nBlocks];
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 4, &datasetFileNames[0], &datasetFileNames[1], &datasetFileNames[2], &datasetFileNames[3]);
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        computestep1Local(i);
+    }
+
+    /* Each merge node combines the partial results of two local nodes */
+    for (size_t i = 0; i < nMergeNodes; i++)
+    {
+        computeOnMergeNode(i);
+    }
+
+    computeOnRootNode();
+
+    /* Pass the results of the root node back down the tree */
+    for (size_t i = 0; i < nMergeNodes; i++)
+    {
+        finalizeComputeOnMergeNode(i);
+    }
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        finalizeComputestep1Local(i);
+    }
+
+    /* Compute R on one master node from the partial results of all local nodes */
+    services::SharedPtr<NumericTable> flatR = computeOnFlatMaster();
+
+    /* Print the results */
+    printNumericTable(Qi[0], "Part of orthogonal matrix Q from 1st node:", 10);
+    printNumericTable(R    , "Triangular matrix R:");
+
+    /* The rows of R are unique up to the sign */
+    bool isOk = isEqualUpToSign(R, flatR);
+    cout << "R of the reduction tree is " << (isOk ? "equal" : "NOT equal") << " to R of the flat second step" << endl;
+
+    return (isOk ? 0 : -1);
+}
+
+void computestep1Local(size_t block)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileNames[block], DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the input data */
+    dataSource.loadDataBlock();
+
+    /* Create an algorithm to compute QR decomposition on the local node */
+    qr::Distributed<step1Local> algorithm;
+
+    algorithm.input.set( qr::data, dataSource.getNumericTable() );
+
+    /* Compute QR decomposition */
+    algorithm.compute();
+
+    dataFromStep1ForStep2[block] = algorithm.getPartialResult()->get( qr::outputOfStep1ForStep2 );
+    dataFromStep1ForStep3[block] = algorithm.getPartialResult()->get( qr::outputOfStep1ForStep3 );
+}
+
+void computeOnMergeNode(size_t node)
+{
+    /* Create an algorithm to merge the partial results of two local nodes */
+    mergeNodeAlgorithms[node] = services::SharedPtr<qr::Distributed<step2Master> >(new qr::Distributed<step2Master>());
+    qr::Distributed<step2Master> &algorithm = *mergeNodeAlgorithms[node];
+
+    for (size_t i = 2 * node; i < 2 * node + 2; i++)
+    {
+        algorithm.input.add( qr::inputOfStep2FromStep1, i, dataFromStep1ForStep2[i] );
+    }
+
+    /* Compute QR decomposition of the subtree */
+    algorithm.compute();
+
+    dataFromMergeNodeForRoot[node] = algorithm.getPartialResult()->get( qr::outputOfStep2ForStep2 );
+}
+
+void computeOnRootNode()
+{
+    /* Create an algorithm to compute QR decomposition on the root node of the tree */
+    qr::Distributed<step2Master> algorithm;
+
+    for (size_t i = 0; i < nMergeNodes; i++)
+    {
+        algorithm.input.add( qr::inputOfStep2FromStep1, i, dataFromMergeNodeForRoot[i] );
+    }
+
+    /* Compute QR decomposition */
+    algorithm.compute();
+
+    services::SharedPtr<qr::DistributedPartialResult> pres = algorithm.getPartialResult();
+    services::SharedPtr<KeyValueDataCollection> inputForMergeNodes = pres->get( qr::outputOfStep2ForStep3 );
+
+    for (size_t i = 0; i < nMergeNodes; i++)
+    {
+        dataFromRootForMergeNode[i] = services::staticPointerCast<data_management::DataCollection, SerializationIface>((*inputForMergeNodes)[i]);
+    }
+
+    services::SharedPtr<qr::Result> res = algorithm.getResult();
+
+    R = res->get(qr::matrixR);
+}
+
+void finalizeComputeOnMergeNode(size_t node)
+{
+    qr::Distributed<step2Master> &algorithm = *mergeNodeAlgorithms[node];
+
+    algorithm.input.set( qr::inputOfStep2FromStep2, dataFromRootForMergeNode[node] );
+
+    /* Apply the result of the root node to the partial results of the subtree */
+    algorithm.finalizeCompute();
+
+    services::SharedPtr<KeyValueDataCollection> inputForStep3FromStep2 = algorithm.getPartialResult()->get( qr::outputOfStep2ForStep3 );
+
+    for (size_t i = 2 * node; i < 2 * node + 2; i++)
+    {
+        dataFromStep2ForStep3[i] = services::staticPointerCast<data_management::DataCollection, SerializationIface>((*inputForStep3FromStep2)[i]);
+    }
+}
+
+void finalizeComputestep1Local(size_t block)
+{
+    /* Create an algorithm to compute QR decomposition on the local node */
+    qr::Distributed<step3Local> algorithm;
+
+    algorithm.input.set( qr::inputOfStep3FromStep1, dataFromStep1ForStep3[block] );
+    algorithm.input.set( qr::inputOfStep3FromStep2, dataFromStep2ForStep3[block] );
+
+    /* Compute QR decomposition */
+    algorithm.compute();
+
+    algorithm.finalizeCompute();
+
+    services::SharedPtr<qr::Result> res = algorithm.getResult();
+
+    Qi[block] = res->get(qr::matrixQ);
+}
+
+services::SharedPtr<NumericTable> computeOnFlatMaster()
+{
+    /* Create an algorithm to compute QR decomposition on the master node */
+    qr::Distributed<step2Master> algorithm;
+
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        algorithm.input.add( qr::inputOfStep2FromStep1, i, dataFromStep1ForStep2[i] );
+    }
+
+    /* Compute QR decomposition */
+    algorithm.compute();
+
+    return algorithm.getResult()->get(qr::matrixR);
+}
+
+bool isEqualUpToSign(const services::SharedPtr<NumericTable> &table1, const services::SharedPtr<NumericTable> &table2)
+{
+    const double eps = 1e-9;
+
+    size_t nRows = table1->getNumberOfRows();
+    size_t nCols = table1->getNumberOfColumns();
+    if (table2->getNumberOfRows() != nRows || table2->getNumberOfColumns() != nCols) { return false; }
+
+    BlockDescriptor<double> block1, block2;
+    table1->getBlockOfRows(0, nRows, readOnly, block1);
+    table2->getBlockOfRows(0, nRows, readOnly, block2);
+    double *data1 = block1.getBlockPtr();
+    double *data2 = block2.getBlockPtr();
+
+    bool isEqual = true;
+    for (size_t i = 0; i < nRows * nCols; i++)
+    {
+        double diff = fabs(data1[i]) - fabs(data2[i]);
+        if (fabs(diff) > eps * (1.0 + fabs(data2[i]))) { isEqual = false; }
+    }
+
+    table1->releaseBlockOfRows(block1);
+    table2->releaseBlockOfRows(block2);
+    return isEqual;
+}
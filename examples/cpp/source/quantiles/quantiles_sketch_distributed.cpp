@@ -0,0 +1,121 @@
+/* file: quantiles_sketch_distributed.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing approximate quantiles in the distributed processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-QUANTILES_SKETCH_DISTRIBUTED"></a>
+ * \example quantiles_sketch_distributed.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+
+/* Input data set parameters */
+const size_t nBlocks = 4;
+
+const string datasetFileNames[] =
+{
+    "../data/distributed/covcormoments_dense_1.csv",
+    "../data/distributed/covcormoments_dense_2.csv",
+    "../data/distributed/covcormoments_dense_3.csv",
+    "../data/distributed/covcormoments_dense_4.csv"
+};
+
+/* Quantile orders and the target accuracy of the sketches */
+const size_t nQuantileOrders = 5;
+double quantileOrders[nQuantileOrders] = {0.1, 0.25, 0.5, 0.75, 0.9};
+const double accuracy = 0.01;
+
+services::SharedPtr<quantiles::PartialResult> partialResult[nBlocks];
+services::SharedPtr<quantiles::Result> result;
+
+void computestep1Local(size_t i);
+void computeOnMasterNode();
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 4, &datasetFileNames[0], &datasetFileNames[1], &datasetFileNames[2], &datasetFileNames[3]);
+
+    for(size_t i = 0; i < nBlocks; i++)
+    {
+        computestep1Local(i);
+    }
+
+    computeOnMasterNode();
+
+    printNumericTable(result->get(quantiles::quantiles), "Quantiles");
+
+    return 0;
+}
+
+void computestep1Local(size_t block)
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileNames[block], DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Create an algorithm to build the sketches of the features on a local node */
+    quantiles::Distributed<step1Local, double, quantiles::sketchDense> algorithm;
+
+    algorithm.parameter.accuracy = accuracy;
+
+    /* Set input objects for the algorithm */
+    algorithm.input.set(quantiles::data, dataSource.getNumericTable());
+
+    /* Compute the sketches on a local node */
+    algorithm.compute();
+
+    /* Get the computed sketches */
+    partialResult[block] = algorithm.getPartialResult();
+}
+
+void computeOnMasterNode()
+{
+    /* Create an algorithm to merge the sketches and compute quantiles on the master node */
+    quantiles::Distributed<step2Master, double, quantiles::sketchDense> algorithm;
+
+    algorithm.parameter.quantileOrders = services::SharedPtr<NumericTable>(
+        new HomogenNumericTable<double>(quantileOrders, nQuantileOrders, 1));
+    algorithm.parameter.accuracy = accuracy;
+
+    /* Set input objects for the algorithm */
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        algorithm.input.add(quantiles::partialResults, partialResult[i]);
+    }
+
+    /* Merge the sketches computed on local nodes */
+    algorithm.compute();
+
+    /* Finalize the result in the distributed processing mode */
+    algorithm.finalizeCompute();
+
+    /* Get the computed quantiles */
+    result = algorithm.getResult();
+}
@@ -0,0 +1,77 @@
+/* file: quantiles_sketch_online.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing approximate quantiles in the online processing mode
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-QUANTILES_SKETCH_ONLINE"></a>
+ * \example quantiles_sketch_online.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace std;
+
+/* Input data set parameters */
+string datasetFileName = "../data/online/covcormoments_dense.csv";
+const size_t nVectorsInBlock = 50;
+
+/* Quantile orders and the target accuracy of the sketches */
+const size_t nQuantileOrders = 5;
+double quantileOrders[nQuantileOrders] = {0.1, 0.25, 0.5, 0.75, 0.9};
+const double accuracy = 0.01;
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create an algorithm to compute approximate quantiles in the online processing mode using the sketch method */
+    quantiles::Online<double, quantiles::sketchDense> algorithm;
+
+    algorithm.parameter.quantileOrders = services::SharedPtr<NumericTable>(
+        new HomogenNumericTable<double>(quantileOrders, nQuantileOrders, 1));
+    algorithm.parameter.accuracy = accuracy;
+
+    while(dataSource.loadDataBlock(nVectorsInBlock) == nVectorsInBlock)
+    {
+        /* Set input objects for the algorithm */
+        algorithm.input.set(quantiles::data, dataSource.getNumericTable());
+
+        /* Update the sketches of the features with the new block of observations */
+        algorithm.compute();
+    }
+
+    /* Finalize the result in the online processing mode */
+    algorithm.finalizeCompute();
+
+    /* Get the computed quantiles */
+    services::SharedPtr<quantiles::Result> res = algorithm.getResult();
+
+    printNumericTable(res->get(quantiles::quantiles), "Quantiles");
+
+    return 0;
+}
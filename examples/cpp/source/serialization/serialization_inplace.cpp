@@ -0,0 +1,150 @@
+/* file: serialization_inplace.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of numeric table serialization into the segments of the data
+!    archive that refer to the memory of the table and of deserialization that
+!    uses the memory of the archive as the storage of the restored table
+!
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SERIALIZATION_INPLACE"></a>
+ * \example serialization_inplace.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+
+typedef double  dataFPType;          /* Data floating-point type */
+
+/* Input data set parameters */
+const string datasetFileName = "../data/batch/serialization.csv";
+
+/* Arrays of at least this size in bytes are not copied into the archive */
+const size_t minReferencedArraySize = 1024;
+
+services::SharedPtr<byte> serializeNumericTable(services::SharedPtr<NumericTable> dataTable, size_t *length,
+                                                size_t *nReferencedSegments);
+services::SharedPtr<NumericTable> deserializeNumericTable(const services::SharedPtr<byte> &buffer, size_t length);
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable,
+                                                 DataSource::doDictionaryFromContext);
+
+    /* Retrieve the data from the input file */
+    dataSource.loadDataBlock();
+
+    /* Retrieve a numeric table */
+    services::SharedPtr<NumericTable> dataTable = dataSource.getNumericTable();
+
+    /* Print the original data */
+    printNumericTable(dataTable, "Data before serialization:");
+
+    /* Serialize the numeric table and gather the segments of the archive into the memory buffer */
+    size_t length, nReferencedSegments;
+    services::SharedPtr<byte> buffer = serializeNumericTable(dataTable, &length, &nReferencedSegments);
+
+    /* Deserialize the numeric table from the memory buffer without copying the data */
+    services::SharedPtr<NumericTable> restoredDataTable = deserializeNumericTable(buffer, length);
+
+    /* Print the restored data */
+    printNumericTable(restoredDataTable, "Data after deserialization:");
+
+    /* Check that the restored table refers to the memory of the archive */
+    dataFPType *restoredData = static_cast<HomogenNumericTable<dataFPType> *>(restoredDataTable.get())->getArray();
+    bool isInPlace = ((byte *)restoredData >= buffer.get() && (byte *)restoredData < buffer.get() + length);
+
+    /* Check that the restored table contains the original data */
+    BlockDescriptor<dataFPType> block, restoredBlock;
+    size_t nRows = dataTable->getNumberOfRows();
+    size_t nCols = dataTable->getNumberOfColumns();
+    bool isEqual = (restoredDataTable->getNumberOfRows() == nRows && restoredDataTable->getNumberOfColumns() == nCols);
+    if (isEqual)
+    {
+        dataTable->getBlockOfRows(0, nRows, readOnly, block);
+        restoredDataTable->getBlockOfRows(0, nRows, readOnly, restoredBlock);
+        for (size_t i = 0; i < nRows * nCols; i++)
+        {
+            if (block.getBlockPtr()[i] != restoredBlock.getBlockPtr()[i]) { isEqual = false; }
+        }
+        restoredDataTable->releaseBlockOfRows(restoredBlock);
+        dataTable->releaseBlockOfRows(block);
+    }
+
+    std::cout << "Number of segments that refer to the table: " << nReferencedSegments << std::endl;
+    std::cout << "Restored table uses the archive memory:     " << (isInPlace ? "yes" : "no") << std::endl;
+    std::cout << "Restored table is equal to the original:    " << (isEqual ? "yes" : "no") << std::endl;
+
+    return (nReferencedSegments > 0 && isInPlace && isEqual) ? 0 : -1;
+}
+
+services::SharedPtr<byte> serializeNumericTable(services::SharedPtr<NumericTable> dataTable, size_t *length,
+                                                size_t *nReferencedSegments)
+{
+    /* Create a data archive to serialize the numeric table */
+    InputDataArchive dataArch;
+
+    /* Store large arrays of the numeric table in the archive by reference */
+    dataArch.setMinReferencedArraySize(minReferencedArraySize);
+
+    /* Serialize the numeric table into the data archive */
+    dataTable->serialize(dataArch);
+
+    /* Get the length of the serialized data in bytes */
+    *length = dataArch.getSizeOfArchive();
+
+    /* Gather the segments of the archive into one buffer as a scatter/gather send would do */
+    dataFPType *tableData = static_cast<HomogenNumericTable<dataFPType> *>(dataTable.get())->getArray();
+    services::SharedPtr<byte> buffer(new byte[*length], services::ArrayDeleter<byte>());
+    size_t offset = 0;
+    *nReferencedSegments = 0;
+    for (size_t i = 0; i < dataArch.getNumberOfSegments(); i++)
+    {
+        const byte *segment;
+        size_t segmentSize;
+        dataArch.getArchiveSegment(i, &segment, &segmentSize);
+        if (segment == (const byte *)tableData) { (*nReferencedSegments)++; }
+
+        memcpy(buffer.get() + offset, segment, segmentSize);
+        offset += segmentSize;
+    }
+
+    return buffer;
+}
+
+services::SharedPtr<NumericTable> deserializeNumericTable(const services::SharedPtr<byte> &buffer, size_t length)
+{
+    /* Create a data archive that shares the memory buffer with the deserialized objects */
+    OutputDataArchive dataArch(buffer, length);
+
+    /* Create a numeric table object */
+    services::SharedPtr<NumericTable> dataTable = services::SharedPtr<NumericTable>( new HomogenNumericTable<dataFPType>() );
+
+    /* Deserialize the numeric table from the data archive */
+    dataTable->deserialize(dataArch);
+
+    return dataTable;
+}
@@ -0,0 +1,236 @@
+/* file: sorting_online.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of sorting the observations matrix in the online processing mode.
+!    The sorted runs and the results are stored in files
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SORTING_ONLINE"></a>
+ * \example sorting_online.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace std;
+
+/* Input data set parameters */
+string datasetFileName = "../data/batch/sorting.csv";
+const size_t nVectorsInBlock = 5;
+
+/*
+ * Numeric table that stores the values of the features one after another in a binary file.
+ * The sorting algorithm accesses the sorted runs and the results by blocks of column values,
+ * so only these blocks are read into memory. The blocks can be accessed by several threads at once,
+ * so every access opens its own stream of the file
+ */
+class FileNumericTable : public NumericTable
+{
+public:
+    FileNumericTable(const string &fileName, size_t nColumns, size_t nRows) : NumericTable(nColumns, nRows), _fileName(fileName)
+    {
+        ofstream file(fileName.c_str(), ios::out | ios::binary | ios::trunc);
+        if (!file.is_open()) { this->_errors->add(services::ErrorOnFileOpen); return; }
+
+        NumericTableFeature feature;
+        feature.setType<double>();
+        _ddict->setAllFeatures(feature);
+        _memStatus = internallyAllocated;
+    }
+
+    ~FileNumericTable()
+    {
+        remove(_fileName.c_str());
+    }
+
+    int getSerializationTag() DAAL_C11_OVERRIDE { return 0; }
+
+    void getBlockOfRows(size_t idx, size_t n, ReadWriteMode rwFlag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    { getTBlock<double>(idx, n, rwFlag, block); }
+    void getBlockOfRows(size_t idx, size_t n, ReadWriteMode rwFlag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    { getTBlock<float>(idx, n, rwFlag, block); }
+    void getBlockOfRows(size_t idx, size_t n, ReadWriteMode rwFlag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    { getTBlock<int>(idx, n, rwFlag, block); }
+
+    void releaseBlockOfRows(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE { releaseTBlock<double>(block); }
+    void releaseBlockOfRows(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE { releaseTBlock<float>(block); }
+    void releaseBlockOfRows(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE { releaseTBlock<int>(block); }
+
+    void getBlockOfColumnValues(size_t j, size_t idx, size_t n, ReadWriteMode rwFlag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    { getTFeature<double>(j, idx, n, rwFlag, block); }
+    void getBlockOfColumnValues(size_t j, size_t idx, size_t n, ReadWriteMode rwFlag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    { getTFeature<float>(j, idx, n, rwFlag, block); }
+    void getBlockOfColumnValues(size_t j, size_t idx, size_t n, ReadWriteMode rwFlag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    { getTFeature<int>(j, idx, n, rwFlag, block); }
+
+    void releaseBlockOfColumnValues(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE { releaseTFeature<double>(block); }
+    void releaseBlockOfColumnValues(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE { releaseTFeature<float>(block); }
+    void releaseBlockOfColumnValues(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE { releaseTFeature<int>(block); }
+
+protected:
+    void allocateDataMemory() DAAL_C11_OVERRIDE {}
+    void freeDataMemory() DAAL_C11_OVERRIDE {}
+
+    void serializeImpl  (InputDataArchive  *archive) DAAL_C11_OVERRIDE { this->_errors->add(services::ErrorMethodNotSupported); }
+    void deserializeImpl(OutputDataArchive *archive) DAAL_C11_OVERRIDE { this->_errors->add(services::ErrorMethodNotSupported); }
+
+private:
+    string _fileName;
+
+    /* Reads or writes n values of the feature j starting from the observation idx */
+    template <typename T>
+    void transfer(size_t j, size_t idx, size_t n, T *values, size_t stride, bool isWrite)
+    {
+        vector<double> buffer(n);
+        size_t offset = (j * getNumberOfRows() + idx) * sizeof(double);
+        fstream file(_fileName.c_str(), ios::in | ios::out | ios::binary);
+        if (isWrite)
+        {
+            for (size_t i = 0; i < n; i++) { buffer[i] = (double)values[i * stride]; }
+            file.seekp(offset);
+            file.write((const char *)&buffer[0], n * sizeof(double));
+        }
+        else
+        {
+            file.seekg(offset);
+            file.read((char *)&buffer[0], n * sizeof(double));
+            for (size_t i = 0; i < n; i++) { values[i * stride] = (T)buffer[i]; }
+        }
+        if (!file)
+        {
+            this->_errors->add(isWrite ? services::ErrorOnFileWrite : services::ErrorIncorrectDataFileFormat);
+        }
+    }
+
+    template <typename T>
+    void getTBlock(size_t idx, size_t n, ReadWriteMode rwFlag, BlockDescriptor<T> &block)
+    {
+        size_t nColumns = getNumberOfColumns();
+        n = (idx + n < getNumberOfRows() ? n : (idx < getNumberOfRows() ? getNumberOfRows() - idx : 0));
+        block.setDetails(0, idx, rwFlag);
+        if (!block.resizeBuffer(nColumns, n)) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+        if (n == 0 || !(rwFlag & (int)readOnly)) { return; }
+        for (size_t j = 0; j < nColumns; j++)
+        {
+            transfer<T>(j, idx, n, block.getBlockPtr() + j, nColumns, false);
+        }
+    }
+
+    template <typename T>
+    void releaseTBlock(BlockDescriptor<T> &block)
+    {
+        size_t nColumns = block.getNumberOfColumns();
+        if ((block.getRWFlag() & (int)writeOnly) && block.getNumberOfRows())
+        {
+            for (size_t j = 0; j < nColumns; j++)
+            {
+                transfer<T>(j, block.getRowsOffset(), block.getNumberOfRows(), block.getBlockPtr() + j, nColumns, true);
+            }
+        }
+        block.setDetails(0, 0, 0);
+    }
+
+    template <typename T>
+    void getTFeature(size_t j, size_t idx, size_t n, ReadWriteMode rwFlag, BlockDescriptor<T> &block)
+    {
+        n = (idx + n < getNumberOfRows() ? n : (idx < getNumberOfRows() ? getNumberOfRows() - idx : 0));
+        block.setDetails(j, idx, rwFlag);
+        if (!block.resizeBuffer(1, n)) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+        if (n == 0 || !(rwFlag & (int)readOnly)) { return; }
+        transfer<T>(j, idx, n, block.getBlockPtr(), 1, false);
+    }
+
+    template <typename T>
+    void releaseTFeature(BlockDescriptor<T> &block)
+    {
+        if ((block.getRWFlag() & (int)writeOnly) && block.getNumberOfRows())
+        {
+            transfer<T>(block.getColumnsOffset(), block.getRowsOffset(), block.getNumberOfRows(), block.getBlockPtr(), 1, true);
+        }
+        block.setDetails(0, 0, 0);
+    }
+};
+
+/* Storage that creates the sorted runs and the results of the sorting algorithm in files */
+class FileStorage : public sorting::StorageIface
+{
+public:
+    FileStorage() : _nTables(0) {}
+
+    services::SharedPtr<NumericTable> createRun(sorting::PartialResultId id, size_t nFeatures, size_t nObservations) DAAL_C11_OVERRIDE
+    {
+        return createTable(nFeatures, nObservations);
+    }
+
+    services::SharedPtr<NumericTable> createResult(sorting::ResultId id, size_t nFeatures, size_t nObservations) DAAL_C11_OVERRIDE
+    {
+        return createTable(nFeatures, nObservations);
+    }
+
+private:
+    size_t _nTables;
+
+    services::SharedPtr<NumericTable> createTable(size_t nFeatures, size_t nObservations)
+    {
+        ostringstream fileName;
+        fileName << "sorting_online_" << _nTables++ << ".bin";
+        return services::SharedPtr<NumericTable>(new FileNumericTable(fileName.str(), nFeatures, nObservations));
+    }
+};
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &datasetFileName);
+
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> dataSource(datasetFileName, DataSource::doAllocateNumericTable, DataSource::doDictionaryFromContext);
+
+    /* Create an algorithm to sort data in the online processing mode using the parallel method */
+    sorting::Online<> algorithm;
+
+    /* Compute the indices of the observations in the sorted order */
+    algorithm.parameter.computeIndices = true;
+
+    /* Keep the sorted runs and the results in files instead of memory */
+    algorithm.parameter.storage = services::SharedPtr<sorting::StorageIface>(new FileStorage());
+
+    while(dataSource.loadDataBlock(nVectorsInBlock) == nVectorsInBlock)
+    {
+        /* Set input objects for the algorithm */
+        algorithm.input.set(sorting::data, dataSource.getNumericTable());
+
+        /* Sort the block of observations into a separate sorted run */
+        algorithm.compute();
+    }
+
+    /* Merge the sorted runs */
+    algorithm.finalizeCompute();
+
+    /* Get the sorting result */
+    services::SharedPtr<sorting::Result> res = algorithm.getResult();
+
+    printNumericTable(res->get(sorting::sortedData), "Sorted matrix of observations:");
+    printNumericTable(res->get(sorting::sortedIndices), "Indices of the sorted observations:");
+
+    return 0;
+}
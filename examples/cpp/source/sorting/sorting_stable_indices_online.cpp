@@ -0,0 +1,106 @@
+/* file: sorting_stable_indices_online.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of computing the indices of the sorted observations in the online
+!    processing mode on the data set with many equal values.
+!
+!    The indices of equal values must be in the order of the observations.
+!    The program checks the order across the chunks of the blocks and across the blocks
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-SORTING_STABLE_INDICES_ONLINE"></a>
+ * \example sorting_stable_indices_online.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::data_management;
+using namespace std;
+
+const size_t nBlocks         = 3;
+const size_t nVectorsInBlock = 100000;
+const size_t nFeatures       = 2;
+
+int main(int argc, char *argv[])
+{
+    const size_t nVectors = nBlocks * nVectorsInBlock;
+
+    /* Generate the data set: the first feature takes 5 different values, all values of the second feature are equal */
+    services::SharedPtr<HomogenNumericTable<double> > data(new HomogenNumericTable<double>(nFeatures, nVectors,
+                                                                                           NumericTable::doAllocate));
+    double *x = data->getArray();
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        x[i * nFeatures]     = (double)((i * 7919) % 5);
+        x[i * nFeatures + 1] = 1.0;
+    }
+
+    /* Create an algorithm to sort data in the online processing mode and compute the indices of the sorted observations */
+    sorting::Online<> algorithm;
+    algorithm.parameter.computeIndices = true;
+
+    for (size_t b = 0; b < nBlocks; b++)
+    {
+        services::SharedPtr<NumericTable> block(new HomogenNumericTable<double>(x + b * nVectorsInBlock * nFeatures,
+                                                                                nFeatures, nVectorsInBlock));
+        algorithm.input.set(sorting::data, block);
+        algorithm.compute();
+    }
+
+    algorithm.finalizeCompute();
+
+    services::SharedPtr<sorting::Result> res = algorithm.getResult();
+    printNumericTable(res->get(sorting::sortedData), "Sorted matrix of observations (first 10 rows):", 10);
+    printNumericTable(res->get(sorting::sortedIndices), "Indices of the sorted observations (first 10 rows):", 10);
+
+    /* Check that the values are sorted and the indices of equal values are increasing */
+    BlockDescriptor<double> sortedBlock;
+    BlockDescriptor<int> indicesBlock;
+    res->get(sorting::sortedData)->getBlockOfRows(0, nVectors, readOnly, sortedBlock);
+    res->get(sorting::sortedIndices)->getBlockOfRows(0, nVectors, readOnly, indicesBlock);
+    const double *sorted = sortedBlock.getBlockPtr();
+    const int *indices = indicesBlock.getBlockPtr();
+
+    size_t nErrors = 0;
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            const double value = sorted[i * nFeatures + j];
+            const int index = indices[i * nFeatures + j];
+            if (index < 0 || (size_t)index >= nVectors || x[index * nFeatures + j] != value) { nErrors++; continue; }
+            if (i == 0) { continue; }
+
+            const double previousValue = sorted[(i - 1) * nFeatures + j];
+            const int previousIndex = indices[(i - 1) * nFeatures + j];
+            if (previousValue > value || (previousValue == value && previousIndex >= index)) { nErrors++; }
+        }
+    }
+
+    res->get(sorting::sortedData)->releaseBlockOfRows(sortedBlock);
+    res->get(sorting::sortedIndices)->releaseBlockOfRows(indicesBlock);
+
+    std::cout << "Number of observations out of order: " << nErrors << std::endl;
+
+    return (nErrors == 0) ? 0 : -1;
+}
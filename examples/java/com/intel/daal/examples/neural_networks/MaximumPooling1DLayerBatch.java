@@ -61,7 +61,7 @@ class MaximumPooling1DLayerBatch {
 
         /* Print the results of the forward one-dimensional maximum pooling layer */
         Service.printTensor("Forward one-dimensional pooling result (first 5 rows):", forwardResult.get(ForwardResultId.value), 5, 0);
-        Service.printTensor("Forward one-dimensional maximum pooling layer mask (first 5 rows):", forwardResult.get(LayerDataId.auxMask), 5, 0);
+        Service.printTensor("Forward one-dimensional maximum pooling layer selected indices (first 5 rows):", forwardResult.get(LayerDataId.auxSelectedIndices), 5, 0);
 
         /* Create an algorithm to compute backward one-dimensional pooling layer results using maximum method */
         BackwardBatch maximumPooling1DLayerBackward = new BackwardBatch(context, Double.class, Method.defaultDense, nDim);
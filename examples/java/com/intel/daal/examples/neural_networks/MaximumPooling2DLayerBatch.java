@@ -63,8 +63,8 @@ class MaximumPooling2DLayerBatch {
 
         /* Print the results of the forward two-dimensional pooling */
         Service.printTensor("Forward two-dimensional maximum pooling result (first 5 rows):", forwardResult.get(ForwardResultId.value), 5, 0);
-        Service.printTensor("Forward two-dimensional maximum pooling layer mask:",
-                            forwardResult.get(LayerDataId.auxMask), 10, 0);
+        Service.printTensor("Forward two-dimensional maximum pooling layer selected indices:",
+                            forwardResult.get(LayerDataId.auxSelectedIndices), 10, 0);
 
         /* Create an algorithm to compute backward two-dimensional pooling results using default method */
         BackwardBatch maximumPooling2DLayerBackward = new BackwardBatch(context, Double.class, Method.defaultDense, nDim);
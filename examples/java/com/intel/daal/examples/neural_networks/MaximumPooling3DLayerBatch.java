@@ -71,8 +71,8 @@ class MaximumPooling3DLayerBatch {
 
         /* Print the results of the forward three-dimensional pooling */
         Service.printTensor("Forward three-dimensional maximum pooling result:", forwardResult.get(ForwardResultId.value), 0, 0);
-        Service.printTensor("Forward three-dimensional maximum pooling layer mask:",
-                            forwardResult.get(LayerDataId.auxMask), 0, 0);
+        Service.printTensor("Forward three-dimensional maximum pooling layer selected indices:",
+                            forwardResult.get(LayerDataId.auxSelectedIndices), 0, 0);
 
         /* Create an algorithm to compute backward three-dimensional pooling results using default method */
         BackwardBatch maximumPooling3DLayerBackward = new BackwardBatch(context, Double.class, Method.defaultDense, nDim);
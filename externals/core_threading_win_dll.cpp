@@ -89,20 +89,32 @@ FARPROC load_daal_thr_func(char *ordinal)
 
 typedef void (* _daal_threader_for_t)(int , int , const void *, daal::functype );
 typedef void (* _daal_threader_for_blocked_t)(int , int , const void *, daal::functype2 );
+typedef void (* _daal_threader_for_blocked_size_t)(size_t , size_t , int , const void *, daal::functype_blocked_size );
+typedef void (* _daal_threader_for_optional_t)(int , int , const void *, daal::functype );
+typedef void (* _daal_static_threader_for_t)(size_t , int , const void *, daal::functype_static );
+typedef bool (* _daal_is_in_parallel_t)(void);
 typedef int (* _daal_threader_get_max_threads_t)(void);
 typedef void *(* _daal_get_tls_ptr_t)(void *, daal::tls_functype );
 typedef void (* _daal_del_tls_ptr_t)(void *);
 typedef void *(* _daal_get_tls_local_t)(void *);
 typedef void (* _daal_reduce_tls_t)(void *, void *, daal::tls_reduce_functype );
+typedef void (* _daal_parallel_reduce_tls_t)(void *, void *, daal::tls_reduce_functype );
+typedef void *(* _daal_tree_reduce_tls_t)(void *, void *, daal::tls_merge_functype );
 typedef size_t (* _setNumberOfThreads_t)(const size_t, void**);
 
 static _daal_threader_for_t _daal_threader_for_ptr = NULL;
 static _daal_threader_for_blocked_t _daal_threader_for_blocked_ptr = NULL;
+static _daal_threader_for_blocked_size_t _daal_threader_for_blocked_size_ptr = NULL;
+static _daal_threader_for_optional_t _daal_threader_for_optional_ptr = NULL;
+static _daal_static_threader_for_t _daal_static_threader_for_ptr = NULL;
+static _daal_is_in_parallel_t _daal_is_in_parallel_ptr = NULL;
 static _daal_threader_get_max_threads_t _daal_threader_get_max_threads_ptr = NULL;
 static _daal_get_tls_ptr_t _daal_get_tls_ptr_ptr = NULL;
 static _daal_del_tls_ptr_t _daal_del_tls_ptr_ptr = NULL;
 static _daal_get_tls_local_t _daal_get_tls_local_ptr = NULL;
 static _daal_reduce_tls_t _daal_reduce_tls_ptr = NULL;
+static _daal_parallel_reduce_tls_t _daal_parallel_reduce_tls_ptr = NULL;
+static _daal_tree_reduce_tls_t _daal_tree_reduce_tls_ptr = NULL;
 static _setNumberOfThreads_t _setNumberOfThreads_ptr = NULL;
 
 DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void *a, daal::functype func)
@@ -123,6 +135,46 @@ DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const vo
     _daal_threader_for_blocked_ptr(n, threads_request, a, func);
 }
 
+DAAL_EXPORT void _daal_threader_for_blocked_size(size_t n, size_t block, int threads_request, const void *a,
+                                                 daal::functype_blocked_size func)
+{
+    load_daal_thr_dll();
+    if(_daal_threader_for_blocked_size_ptr == NULL)
+    {
+        _daal_threader_for_blocked_size_ptr
+            = (_daal_threader_for_blocked_size_t)load_daal_thr_func("_daal_threader_for_blocked_size");
+    }
+    _daal_threader_for_blocked_size_ptr(n, block, threads_request, a, func);
+}
+
+DAAL_EXPORT void _daal_threader_for_optional(int n, int threads_request, const void *a, daal::functype func)
+{
+    load_daal_thr_dll();
+    if(_daal_threader_for_optional_ptr == NULL)
+    {
+        _daal_threader_for_optional_ptr
+            = (_daal_threader_for_optional_t)load_daal_thr_func("_daal_threader_for_optional");
+    }
+    _daal_threader_for_optional_ptr(n, threads_request, a, func);
+}
+
+DAAL_EXPORT void _daal_static_threader_for(size_t n, int threads_request, const void *a, daal::functype_static func)
+{
+    load_daal_thr_dll();
+    if(_daal_static_threader_for_ptr == NULL)
+    {
+        _daal_static_threader_for_ptr = (_daal_static_threader_for_t)load_daal_thr_func("_daal_static_threader_for");
+    }
+    _daal_static_threader_for_ptr(n, threads_request, a, func);
+}
+
+DAAL_EXPORT bool _daal_is_in_parallel()
+{
+    load_daal_thr_dll();
+    if(_daal_is_in_parallel_ptr == NULL) { _daal_is_in_parallel_ptr = (_daal_is_in_parallel_t)load_daal_thr_func("_daal_is_in_parallel"); }
+    return _daal_is_in_parallel_ptr();
+}
+
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
     load_daal_thr_dll();
@@ -162,6 +214,26 @@ DAAL_EXPORT void _daal_reduce_tls(void *tlsPtr, void *a, daal::tls_reduce_functy
     _daal_reduce_tls_ptr(tlsPtr, a, func);
 }
 
+DAAL_EXPORT void _daal_parallel_reduce_tls(void *tlsPtr, void *a, daal::tls_reduce_functype func)
+{
+    load_daal_thr_dll();
+    if(_daal_parallel_reduce_tls_ptr == NULL)
+    {
+        _daal_parallel_reduce_tls_ptr = (_daal_parallel_reduce_tls_t)load_daal_thr_func("_daal_parallel_reduce_tls");
+    }
+    _daal_parallel_reduce_tls_ptr(tlsPtr, a, func);
+}
+
+DAAL_EXPORT void *_daal_tree_reduce_tls(void *tlsPtr, void *a, daal::tls_merge_functype func)
+{
+    load_daal_thr_dll();
+    if(_daal_tree_reduce_tls_ptr == NULL)
+    {
+        _daal_tree_reduce_tls_ptr = (_daal_tree_reduce_tls_t)load_daal_thr_func("_daal_tree_reduce_tls");
+    }
+    return _daal_tree_reduce_tls_ptr(tlsPtr, a, func);
+}
+
 DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void** init)
 {
     load_daal_thr_dll();
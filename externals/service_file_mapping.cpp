@@ -0,0 +1,97 @@
+/* file: service_file_mapping.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the mapping of files into memory used by MmapDataSource
+//--
+*/
+
+#include "mmap_data_source.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+
+services::ErrorID mapFile(const char *fileName, char **data, size_t *size)
+{
+    *data = 0;
+    *size = 0;
+
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE fileHandle = CreateFileA( fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+    if( fileHandle == INVALID_HANDLE_VALUE ) { return services::ErrorOnFileOpen; }
+
+    LARGE_INTEGER fileSize;
+    if( !GetFileSizeEx( fileHandle, &fileSize ) ) { CloseHandle( fileHandle ); return services::ErrorOnFileOpen; }
+    if( fileSize.QuadPart == 0 ) { CloseHandle( fileHandle ); return services::ErrorIncorrectDataFileFormat; }
+
+    HANDLE mappingHandle = CreateFileMappingA( fileHandle, NULL, PAGE_WRITECOPY, 0, 0, NULL );
+    CloseHandle( fileHandle );
+    if( mappingHandle == NULL ) { return services::ErrorOnFileMapping; }
+
+    /* The view keeps the mapping object alive until it is unmapped */
+    void *view = MapViewOfFile( mappingHandle, FILE_MAP_COPY, 0, 0, 0 );
+    CloseHandle( mappingHandle );
+    if( view == NULL ) { return services::ErrorOnFileMapping; }
+
+    *data = (char *)view;
+    *size = (size_t)fileSize.QuadPart;
+#else
+    int fd = open( fileName, O_RDONLY );
+    if( fd < 0 ) { return services::ErrorOnFileOpen; }
+
+    struct stat fileStat;
+    if( fstat( fd, &fileStat ) != 0 ) { close( fd ); return services::ErrorOnFileOpen; }
+    if( fileStat.st_size == 0 ) { close( fd ); return services::ErrorIncorrectDataFileFormat; }
+
+    /* Private mapping keeps the file unchanged if the Numeric Tables are modified */
+    void *view = mmap( NULL, (size_t)fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if( view == MAP_FAILED ) { return services::ErrorOnFileMapping; }
+
+    *data = (char *)view;
+    *size = (size_t)fileStat.st_size;
+#endif
+    return services::NoErrorMessageFound;
+}
+
+void unmapFile(char *data, size_t size)
+{
+    if( data == 0 ) { return; }
+#if defined(_WIN32) || defined(_WIN64)
+    UnmapViewOfFile( data );
+#else
+    munmap( data, size );
+#endif
+}
+
+} // namespace internal
+} // namespace data_management
+} // namespace daal
@@ -23,17 +23,200 @@
 
 #include "mkl_daal.h"
 #include "service_memory.h"
+#include "threading.h"
+
+#if defined(__linux__)
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+#endif
+
+namespace
+{
+
+daal::services::AllocationPolicy defaultAllocationPolicy;
+
+size_t getPageSize()
+{
+#if defined(__linux__)
+    const long sysPageSize = sysconf(_SC_PAGESIZE);
+    if(sysPageSize > 0) { return (size_t)sysPageSize; }
+#endif
+    return 4096;
+}
+
+#if defined(__linux__)
+
+const size_t hugePageAlignment = 2 * 1024 * 1024;
+
+/* Memory policy constants of the Linux kernel */
+const int mpolInterleave     = 3;
+const int mpolFMemsAllowed   = 1 << 2;
+const size_t maxNumaNodes    = 1024;
+const size_t bitsPerLong     = 8 * sizeof(unsigned long);
+
+/*
+ * Blocks allocated with an allocation policy are mapped separately from the heap, so that the policy applies
+ * only to their pages and is discarded when the block is unmapped. The header of a block is stored in the
+ * first page of its mapping, the headers form the list daal_free looks the blocks up in
+ */
+struct MappedBlock
+{
+    void *data;
+    void *base;
+    size_t mapSize;
+    MappedBlock *next;
+};
+
+MappedBlock *mappedBlocks = 0;
+volatile int mappedBlocksLock = 0;
+
+/* The lock only guards insertion to and removal from the list */
+void lockMappedBlocks()
+{
+    while(__sync_lock_test_and_set(&mappedBlocksLock, 1)) {}
+}
+
+void unlockMappedBlocks()
+{
+    __sync_lock_release(&mappedBlocksLock);
+}
+
+/* Interleaves the pages in [begin, begin + size) across the NUMA nodes the process is allowed to use */
+void interleavePages(char *begin, size_t size)
+{
+#if defined(SYS_mbind) && defined(SYS_get_mempolicy)
+    unsigned long nodeMask[maxNumaNodes / bitsPerLong];
+    int mode = 0;
+    if(syscall(SYS_get_mempolicy, &mode, nodeMask, maxNumaNodes, 0, mpolFMemsAllowed) != 0) { return; }
+    syscall(SYS_mbind, begin, size, mpolInterleave, nodeMask, maxNumaNodes, 0);
+#endif
+}
+
+void *mapBlock(size_t size, size_t alignment, const daal::services::AllocationPolicy &policy)
+{
+    const size_t pageSize = getPageSize();
+
+    /* Blocks smaller than a huge page keep the page alignment */
+    const bool useHugePages = (policy.pageSize == daal::services::hugePageSize && size >= hugePageAlignment);
+    size_t boundary = (useHugePages ? hugePageAlignment : pageSize);
+    if(boundary < alignment) { boundary = alignment; }
+
+    /* The data starts at the first boundary after the header, the pages of the data are not touched here */
+    const size_t dataSize = (size + pageSize - 1) / pageSize * pageSize;
+    const size_t mapSize = boundary + dataSize;
+    void *base = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(base == MAP_FAILED) { return 0; }
+
+    char *data = (char *)(((size_t)base + sizeof(MappedBlock) + boundary - 1) / boundary * boundary);
+
+#if defined(MADV_HUGEPAGE)
+    if(useHugePages)
+    {
+        madvise(data, dataSize, MADV_HUGEPAGE);
+    }
+#endif
+    if(policy.placement == daal::services::interleavedPlacement)
+    {
+        interleavePages(data, dataSize);
+    }
+
+    MappedBlock *block = (MappedBlock *)base;
+    block->data    = data;
+    block->base    = base;
+    block->mapSize = mapSize;
+
+    lockMappedBlocks();
+    block->next  = mappedBlocks;
+    mappedBlocks = block;
+    unlockMappedBlocks();
+
+    return data;
+}
+
+/* Unmaps the block if it was allocated by mapBlock, returns false otherwise */
+bool unmapBlock(void *ptr)
+{
+    if(__atomic_load_n(&mappedBlocks, __ATOMIC_ACQUIRE) == 0) { return false; }
+
+    MappedBlock *block = 0;
+    lockMappedBlocks();
+    for(MappedBlock **link = &mappedBlocks; *link; link = &(*link)->next)
+    {
+        if((*link)->data == ptr)
+        {
+            block = *link;
+            *link = block->next;
+            break;
+        }
+    }
+    unlockMappedBlocks();
+
+    if(!block) { return false; }
+    munmap(block->base, block->mapSize);
+    return true;
+}
+
+#endif
+
+} // namespace
+
+void daal::services::setDefaultAllocationPolicy(const AllocationPolicy &policy)
+{
+    defaultAllocationPolicy = policy;
+}
+
+daal::services::AllocationPolicy daal::services::getDefaultAllocationPolicy()
+{
+    return defaultAllocationPolicy;
+}
 
 void *daal::services::daal_malloc(size_t size, size_t alignment)
 {
+    return daal_malloc(size, alignment, defaultAllocationPolicy);
+}
+
+void *daal::services::daal_malloc(size_t size, size_t alignment, const AllocationPolicy &policy)
+{
+#if defined(__linux__)
+    if(size >= policy.minBlockSize && size > 0 && (policy.pageSize != defaultPageSize || policy.placement != defaultPlacement))
+    {
+        void *ptr = mapBlock(size, alignment, policy);
+        if(ptr) { return ptr; }
+    }
+#endif
     return fpk_serv_malloc(size, alignment);
 }
 
 void daal::services::daal_free(void *ptr)
 {
+#if defined(__linux__)
+    if(ptr && unmapBlock(ptr)) { return; }
+#endif
     fpk_serv_free(ptr);
 }
 
+void daal::services::daal_touch_pages(void *ptr, size_t size)
+{
+    if(!ptr || size == 0) { return; }
+
+    char *begin = (char *)ptr;
+    const size_t pageSize = getPageSize();
+    const size_t nPages = (size + pageSize - 1) / pageSize;
+    const size_t pagesInChunk = 64;
+    const size_t nChunks = (nPages + pagesInChunk - 1) / pagesInChunk;
+    daal::threader_for(nChunks, nChunks, [ = ](int iChunk)
+    {
+        const size_t first = iChunk * pagesInChunk;
+        const size_t last = (first + pagesInChunk < nPages ? first + pagesInChunk : nPages);
+        for(size_t i = first; i < last; i++)
+        {
+            volatile char *page = begin + i * pageSize;
+            *page = *page;
+        }
+    } );
+}
+
 void daal::services::daal_memcpy_s(void *dest, size_t destSize, const void *src, size_t srcSize)
 {
     size_t copySize = srcSize;
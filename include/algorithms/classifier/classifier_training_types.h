@@ -144,6 +144,7 @@ public:
     }
 
 protected:
+    Input(size_t nElements) : InputIface(nElements) {}
 
     void checkImpl(const daal::algorithms::Parameter *parameter) const
     {
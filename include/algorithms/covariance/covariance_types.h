@@ -94,6 +94,20 @@ enum OutputMatrixType
     correlationMatrix = 1           /*!< Correlation matrix */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__COVARIANCE__CROSSPRODUCTACCUMULATION"></a>
+ * Available ways to accumulate the cross-product of dense input data
+ */
+enum CrossProductAccumulation
+{
+    defaultAccumulation       = 0,  /*!< Cross-product of an input block is computed with a single call to the math library */
+    blockedAccumulation       = 1,  /*!< Rows of an input block are split between threads, each thread accumulates its own packed
+                                         triangle of the cross-product, and the triangles are merged by a parallel reduction.
+                                         Used for input blocks with at least as many rows as columns */
+    blockedDoubleAccumulation = 2   /*!< Same as blockedAccumulation with the thread-local triangles accumulated in double precision
+                                         regardless of the algorithm floating-point type */
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__COVARIANCE__MASTERNODEINPUTID"></a>
  * \brief Available identifiers of master node input arguments of the Covariance algorithm
@@ -349,8 +363,9 @@ protected:
 struct Parameter : public daal::algorithms::Parameter
 {
     /** Default constructor */
-    Parameter() : daal::algorithms::Parameter(), outputMatrixType(covarianceMatrix) {}
-    OutputMatrixType outputMatrixType;      /*!< Type of the computed matrix */
+    Parameter() : daal::algorithms::Parameter(), outputMatrixType(covarianceMatrix), crossProductAccumulation(defaultAccumulation) {}
+    OutputMatrixType outputMatrixType;                  /*!< Type of the computed matrix */
+    CrossProductAccumulation crossProductAccumulation;  /*!< Way to accumulate the cross-product of dense input data */
 };
 
 /**
@@ -0,0 +1,159 @@
+/* file: gbt_classification_predict.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for gradient boosted trees classification model-based prediction
+//--
+*/
+
+#ifndef __GBT_CLASSIFICATION_PREDICT_H__
+#define __GBT_CLASSIFICATION_PREDICT_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "algorithms/classifier/classifier_predict.h"
+#include "algorithms/gbt/gbt_classification_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace prediction
+{
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__PREDICTION__PREDICTIONCONTAINER"></a>
+ * \brief Provides methods to run implementations of the gradient boosted trees classification prediction algorithm
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Gradient boosted trees model-based prediction method, \ref Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT PredictionContainer : public PredictionContainerIface
+{
+public:
+    /**
+     * Constructs a container for gradient boosted trees classification model-based prediction with a specified environment
+     * \param[in] daalEnv   Environment object
+     */
+    PredictionContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~PredictionContainer();
+    /**
+     * Computes the result of gradient boosted trees classification model-based prediction
+     */
+    void compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__PREDICTION__BATCH"></a>
+ * \brief %Algorithm class for making predictions based on the gradient boosted trees classification model.
+ *        The observations are processed in blocks in parallel, the predicted label is the class with the largest score
+ *
+ * \par Enumerations
+ *      - \ref Method                                       Prediction methods
+ *      - \ref classifier::prediction::NumericTableInputId  Identifiers of input Numeric Table objects
+ *      - \ref classifier::prediction::ModelInputId         Identifiers of input Model objects
+ *      - \ref classifier::prediction::ResultId             Identifiers of prediction results
+ *
+ * \par References
+ *      - \ref gbt::classification::interface1::Model "gbt::classification::Model" class
+ *      - \ref training::interface1::Batch "training::Batch" class
+ */
+template<typename algorithmFPType = double, Method method = defaultDense>
+class Batch : public classifier::prediction::Batch
+{
+public:
+    /**
+     * Constructs the gradient boosted trees classification prediction algorithm
+     * \param[in] nClasses  Number of classes the model was trained for
+     */
+    Batch(size_t nClasses = 2) : parameter(nClasses)
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the gradient boosted trees classification prediction algorithm by copying input objects and parameters
+     * of another gradient boosted trees classification prediction algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other) : classifier::prediction::Batch(other)
+    {
+        initialize();
+        parameter = other.parameter;
+    }
+
+    virtual ~Batch() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    classifier::Parameter parameter;    /*!< Parameters of the algorithm */
+
+    /**
+     * Returns a pointer to the newly allocated gradient boosted trees classification prediction algorithm with a copy
+     * of input objects and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(&input, 0, 0);
+        _res = _result.get();
+    }
+
+    void initialize()
+    {
+        _ac  = new __DAAL_ALGORITHM_CONTAINER(batch, PredictionContainer, algorithmFPType, method)(&_env);
+        _par = &parameter;
+    }
+};
+} // namespace interface1
+using interface1::PredictionContainer;
+using interface1::Batch;
+
+} // namespace prediction
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,191 @@
+/* file: gbt_classification_training_batch.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for gradient boosted trees classification model-based training
+//  in the batch processing mode
+//--
+*/
+
+#ifndef __GBT_CLASSIFICATION_TRAINING_BATCH_H__
+#define __GBT_CLASSIFICATION_TRAINING_BATCH_H__
+
+#include "algorithms/algorithm.h"
+#include "algorithms/classifier/classifier_training_batch.h"
+#include "algorithms/gbt/gbt_classification_training_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+namespace training
+{
+
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__BATCHCONTAINER"></a>
+ * \brief Class containing methods to train the gradient boosted trees classification model
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Gradient boosted trees training method, \ref Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT BatchContainer : public TrainingContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for gradient boosted trees classification model-based training with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~BatchContainer();
+    /**
+     * Computes the result of gradient boosted trees classification model-based training in the batch processing mode
+     */
+    void compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__BATCH"></a>
+ * \brief Trains the gradient boosted trees classification model.
+ *        The values of each feature are quantized into at most maxBins bins once per compute() call,
+ *        the trees are grown level by level from per-node histograms of gradient statistics
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Gradient boosted trees training method, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref classifier::training::InputId  Identifiers of input objects
+ *      - \ref classifier::training::ResultId Identifiers of training results
+ *      - \ref Method                         Training methods
+ *
+ * \par References
+ *      - \ref interface1::Parameter "Parameter" class
+ *      - \ref gbt::classification::interface1::Model "gbt::classification::Model" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+template<typename algorithmFPType = double, Method method = defaultDense>
+class DAAL_EXPORT Batch : public classifier::training::Batch
+{
+public:
+    /**
+     * Constructs the gradient boosted trees classification training algorithm
+     * \param[in] nClasses  Number of classes
+     */
+    Batch(size_t nClasses = 2) : parameter(nClasses)
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the gradient boosted trees classification training algorithm by copying input objects and parameters
+     * of another gradient boosted trees classification training algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other) : classifier::training::Batch(other)
+    {
+        initialize();
+        parameter = other.parameter;
+    }
+
+    virtual ~Batch() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Registers user-allocated memory to store results of the gradient boosted trees classification training algorithm
+     * \param[in] result    Structure to store results of the algorithm
+     */
+    void setResult(const services::SharedPtr<Result>& result)
+    {
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains results of the gradient boosted trees classification training algorithm
+     * \return Structure that contains results of the algorithm
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return services::staticPointerCast<Result, classifier::training::Result>(_result);
+    }
+
+    /**
+     * Resets the training results of the classification algorithm
+     */
+    void resetResult() DAAL_C11_OVERRIDE
+    {
+        _result = services::SharedPtr<Result>(new Result());
+        _res = NULL;
+    }
+
+    /**
+     * Returns a pointer to the newly allocated gradient boosted trees classification training algorithm with a copy
+     * of input objects and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+    Parameter parameter;        /*!< Parameters of the algorithm */
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    void allocateResult() DAAL_C11_OVERRIDE
+    {
+        services::SharedPtr<Result> res = services::staticPointerCast<Result, classifier::training::Result>(_result);
+        res->template allocate<algorithmFPType>(&input, _par, (int) method);
+        _res = _result.get();
+    }
+
+    void initialize()
+    {
+        _ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _par = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+    }
+};
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace training
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
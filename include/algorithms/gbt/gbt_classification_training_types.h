@@ -0,0 +1,253 @@
+/* file: gbt_classification_training_types.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees classification training algorithm interface.
+//--
+*/
+
+#ifndef __GBT_CLASSIFICATION_TRAINING_TYPES_H__
+#define __GBT_CLASSIFICATION_TRAINING_TYPES_H__
+
+#include "algorithms/classifier/classifier_training_types.h"
+#include "algorithms/gbt/gbt_training_parameter.h"
+#include "algorithms/gbt/gbt_training_distributed_types.h"
+#include "algorithms/gbt/gbt_classification_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace classification
+{
+/**
+ * \brief Contains classes to train the gradient boosted trees classification model
+ */
+namespace training
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__METHOD"></a>
+ * Available methods to train the gradient boosted trees classification model
+ */
+enum Method
+{
+    defaultDense = 0    /*!< Histogram-based method on quantized feature values */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__DISTRIBUTED_STEP1_LOCAL_INPUT_ID"></a>
+ * \brief Available identifiers of the input objects computed by the master node for gradient boosted trees
+ *        classification training in the first step of the distributed processing mode
+ */
+enum DistributedStep1LocalInputId
+{
+    inputBinBorders = 3,    /*!< Borders of the bins, \ref gbt::training::binBorders. Not set on the first call */
+    inputTrainingState = 4  /*!< Training state, \ref gbt::training::trainingState. Not set on the first call */
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__PARAMETER"></a>
+ * \brief Parameters of the gradient boosted trees classification training algorithm.
+ *        Binary classification minimizes the logistic loss with one tree per iteration,
+ *        multi-class classification minimizes the softmax cross-entropy with nClasses trees per iteration.
+ *        Class labels are expected to be integers in [0, nClasses)
+ *
+ * \snippet gbt/gbt_classification_training_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct Parameter : public classifier::Parameter, public daal::algorithms::gbt::training::Parameter
+{
+    Parameter(size_t nClasses = 2) : classifier::Parameter(nClasses), daal::algorithms::gbt::training::Parameter() {}
+
+    /**
+     * Checks the correctness of the parameter
+     */
+    virtual void check() const
+    {
+        daal::algorithms::gbt::training::Parameter::checkImpl(this->_errors);
+    }
+};
+/* [Parameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__DISTRIBUTEDINPUT"></a>
+ * \brief %Input objects for gradient boosted trees classification training in the distributed processing mode
+ */
+template<ComputeStep step>
+class DistributedInput {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__DISTRIBUTEDINPUT_STEP1LOCAL"></a>
+ * \brief %Input objects for gradient boosted trees classification training
+ *        in the first step of the distributed processing mode: the local data set and
+ *        the borders of the bins and the training state computed by the master node on the previous call
+ */
+template<>
+class DistributedInput<step1Local> : public classifier::training::Input
+{
+public:
+    DistributedInput() : classifier::training::Input(5) {}
+
+    virtual ~DistributedInput() {}
+
+    using classifier::training::Input::get;
+    using classifier::training::Input::set;
+
+    /**
+     * Returns an input object computed by the master node
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(DistributedStep1LocalInputId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets an input object computed by the master node
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Pointer to the object
+     */
+    void set(DistributedStep1LocalInputId id, const services::SharedPtr<data_management::NumericTable> &value)
+    {
+        Argument::set(id, value);
+    }
+
+    /**
+    * Checks the input objects of gradient boosted trees classification training in the first step of the distributed processing mode
+    * \param[in] parameter Algorithm parameter
+    * \param[in] method    Computation method
+    */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE
+    {
+        if(Argument::size() != 5) { this->_errors->add(services::ErrorIncorrectNumberOfInputNumericTables); return; }
+        checkImpl(parameter);
+        if(!this->_errors->isEmpty()) { return; }
+
+        services::SharedPtr<data_management::NumericTable> bordersTable = get(inputBinBorders);
+        services::SharedPtr<data_management::NumericTable> stateTable = get(inputTrainingState);
+        if(!bordersTable && !stateTable) { return; }
+        if(!bordersTable || !stateTable) { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        if(bordersTable->getNumberOfRows() != getNumberOfFeatures())
+        { this->_errors->add(services::ErrorIncorrectNumberOfRowsInInputNumericTable); return; }
+        if(stateTable->getNumberOfColumns() != 4)
+        { this->_errors->add(services::ErrorIncorrectNumberOfColumnsInInputNumericTable); return; }
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__CLASSIFICATION__TRAINING__RESULT"></a>
+ * \brief Provides methods to access final results obtained with the compute() method of the
+ *        gradient boosted trees classification training algorithm in the batch processing mode
+ */
+class Result : public classifier::training::Result
+{
+public:
+    Result() : classifier::training::Result() {}
+
+    virtual ~Result() {}
+
+    /**
+     * Returns the model trained with the gradient boosted trees algorithm
+     * \param[in] id    Identifier of the result, \ref classifier::training::ResultId
+     * \return          Model trained with the gradient boosted trees algorithm
+     */
+    services::SharedPtr<daal::algorithms::gbt::classification::Model> get(classifier::training::ResultId id) const
+    {
+        return services::staticPointerCast<daal::algorithms::gbt::classification::Model,
+               data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Allocates memory for storing the gradient boosted trees classification training results
+     * \param[in] input     Pointer to input structure
+     * \param[in] parameter Pointer to parameter structure
+     * \param[in] method    Algorithm method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        const classifier::training::Input *algInput = static_cast<const classifier::training::Input *>(input);
+        const Parameter *algParameter = static_cast<const Parameter *>(parameter);
+
+        algorithmFPType dummy = 1.0;
+        set(classifier::training::model, services::SharedPtr<gbt::classification::Model>(
+                new gbt::classification::Model(algInput->get(classifier::training::data)->getNumberOfColumns(),
+                                               algParameter->nClasses, dummy)));
+    }
+
+    /**
+     * Allocates memory for storing the gradient boosted trees classification training results
+     * in the second step of the distributed processing mode
+     * \param[in] partialResult Pointer to the partial result of the master node
+     * \param[in] parameter     Pointer to parameter structure
+     * \param[in] method        Algorithm method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        const gbt::training::DistributedPartialResult *pres = static_cast<const gbt::training::DistributedPartialResult *>(partialResult);
+        const Parameter *algParameter = static_cast<const Parameter *>(parameter);
+
+        algorithmFPType dummy = 1.0;
+        set(classifier::training::model, services::SharedPtr<gbt::classification::Model>(
+                new gbt::classification::Model(pres->getNumberOfFeatures(), algParameter->nClasses, dummy)));
+    }
+
+    int getSerializationTag() DAAL_C11_OVERRIDE  { return SERIALIZATION_GBT_CLASSIFICATION_TRAINING_RESULT_ID; }
+
+    /**
+    *  Serializes the object
+    *  \param[in]  arch  Storage for the serialized object or data structure
+    */
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    /**
+    *  Deserializes the object
+    *  \param[in]  arch  Storage for the deserialized object or data structure
+    */
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+} // namespace interface1
+using interface1::Parameter;
+using interface1::DistributedInput;
+using interface1::Result;
+
+} // namespace training
+} // namespace classification
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
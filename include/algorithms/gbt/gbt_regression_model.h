@@ -0,0 +1,158 @@
+/* file: gbt_regression_model.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the class defining the gradient boosted trees regression model.
+//--
+*/
+
+#ifndef __GBT_REGRESSION_MODEL_H__
+#define __GBT_REGRESSION_MODEL_H__
+
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/data_collection.h"
+#include "algorithms/model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+/**
+ * \brief Contains classes of the gradient boosted trees regression algorithm
+ */
+namespace regression
+{
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__MODEL"></a>
+ * \brief %Model trained by the gbt::regression::training::Batch algorithm.
+ *        Contains the collection of regression trees constructed during the training.
+ *        Each tree is stored as a numeric table with one row per node and three columns:
+ *        index of the split feature (-1 for a leaf), split value (response for a leaf),
+ *        and index of the left child. The right child immediately follows the left one.
+ *        The prediction is the sum of the responses of all trees
+ *
+ * \par References
+ *      - \ref training::interface1::Batch "training::Batch" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+class Model : public daal::algorithms::Model
+{
+public:
+    /**
+     * Constructs the gradient boosted trees regression model
+     * \tparam modelFPType  Data type to store the trees, double or float
+     * \param[in] nFeatures Number of features in the training data set
+     * \param[in] dummy     Dummy variable for the templated constructor
+     */
+    template<typename modelFPType>
+    Model(size_t nFeatures, modelFPType dummy) :
+        daal::algorithms::Model(), _nFeatures(nFeatures), _trees(new data_management::DataCollection()) {}
+
+    /**
+     * Empty constructor for deserialization
+     */
+    Model() : daal::algorithms::Model(), _nFeatures(0), _trees(new data_management::DataCollection()) {}
+
+    virtual ~Model() {}
+
+    /**
+     * Returns the number of features in the training data set
+     * \return Number of features
+     */
+    size_t getNumberOfFeatures() const { return _nFeatures; }
+
+    /**
+     * Returns the number of trees in the model
+     * \return Number of trees
+     */
+    size_t getNumberOfTrees() const { return _trees->size(); }
+
+    /**
+     * Returns the tree constructed during the training
+     * \param[in] idx  Index of the tree in the collection
+     * \return Numeric table that contains the nodes of the tree
+     */
+    services::SharedPtr<data_management::NumericTable> getTree(size_t idx) const
+    {
+        if(idx < _trees->size())
+        {
+            return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>((*_trees)[idx]);
+        }
+        return services::SharedPtr<data_management::NumericTable>();
+    }
+
+    /**
+     * Adds the tree into the model
+     * \param[in] tree  Numeric table that contains the nodes of the tree
+     */
+    void addTree(const services::SharedPtr<data_management::NumericTable> &tree)
+    {
+        (*_trees) << tree;
+    }
+
+    /**
+     * Removes all trees from the model
+     */
+    void clearTrees()
+    {
+        _trees->clear();
+    }
+
+    int getSerializationTag() DAAL_C11_OVERRIDE  { return SERIALIZATION_GBT_REGRESSION_MODEL_ID; }
+    /**
+     *  Serializes the model object
+     *  \param[in]  archive  Storage for the serialized object or data structure
+     */
+    void serializeImpl(data_management::InputDataArchive *archive) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(archive);}
+
+    /**
+     *  Deserializes the model object
+     *  \param[in]  archive  Storage for the deserialized object or data structure
+     */
+    void deserializeImpl(data_management::OutputDataArchive *archive) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(archive);}
+
+protected:
+    size_t _nFeatures;                                              /*!< \private Number of features */
+    services::SharedPtr<data_management::DataCollection> _trees;    /*!< \private Collection of trees */
+
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::Model::serialImpl<Archive, onDeserialize>(arch);
+
+        arch->set(_nFeatures);
+        arch->setSharedPtrObj(_trees);
+    }
+};
+} // namespace interface1
+using interface1::Model;
+
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
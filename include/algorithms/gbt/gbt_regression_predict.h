@@ -0,0 +1,170 @@
+/* file: gbt_regression_predict.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for gradient boosted trees regression model-based prediction
+//--
+*/
+
+#ifndef __GBT_REGRESSION_PREDICT_H__
+#define __GBT_REGRESSION_PREDICT_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/gbt/gbt_regression_predict_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace prediction
+{
+
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__PREDICTION__BATCHCONTAINER"></a>
+ * \brief Class containing computation methods for gradient boosted trees regression model-based prediction
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT BatchContainer : public PredictionContainerIface
+{
+public:
+    /**
+     * Constructs a container for gradient boosted trees regression model-based prediction with a specified environment
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    ~BatchContainer();
+    /**
+     *  Computes the result of gradient boosted trees regression model-based prediction
+     */
+    void compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__PREDICTION__BATCH"></a>
+ * \brief Provides methods to run implementations of the gradient boosted trees regression model-based prediction.
+ *        The observations are processed in blocks in parallel
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Computation method in the batch processing mode, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method               Computation methods
+ *      - \ref NumericTableInputId  Identifiers of input numeric tables
+ *      - \ref ModelInputId         Identifiers of input models
+ *      - \ref ResultId             Identifiers of prediction results
+ *
+ * \par References
+ *      - \ref gbt::regression::interface1::Model "gbt::regression::Model" class
+ *      - \ref training::interface1::Batch "training::Batch" class
+ */
+template<typename algorithmFPType = double, Method method = defaultDense>
+class Batch : public daal::algorithms::Prediction
+{
+public:
+    /** Default constructor */
+    Batch()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the gradient boosted trees regression prediction algorithm by copying input objects
+     * of another gradient boosted trees regression prediction algorithm
+     * \param[in] other Algorithm to use as the source to initialize the input objects of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(data,  other.input.get(data));
+        input.set(model, other.input.get(model));
+    }
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Registers user-allocated memory to store the result of gradient boosted trees regression model-based prediction
+     * \param[in] res    Structure to store the result
+     */
+    void setResult(const services::SharedPtr<Result>& res)
+    {
+        _result = res;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains the result of gradient boosted trees regression model-based prediction
+     * \return Structure that contains the result
+     */
+    services::SharedPtr<Result> getResult() { return _result; }
+
+    /**
+     * Returns a pointer to a newly allocated gradient boosted trees regression prediction algorithm
+     * with a copy of the input objects of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+    Input input; /*!< %Input data structure */
+
+protected:
+    services::SharedPtr<Result> _result;
+
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_in, 0, 0);
+        _res = _result.get();
+    }
+
+    void initialize()
+    {
+        _ac  = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = NULL;
+        _result = services::SharedPtr<Result>(new Result());
+    }
+};
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace prediction
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,258 @@
+/* file: gbt_regression_predict_types.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees regression prediction algorithm interface.
+//--
+*/
+
+#ifndef __GBT_REGRESSION_PREDICT_TYPES_H__
+#define __GBT_REGRESSION_PREDICT_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/data_serialize.h"
+#include "services/daal_defines.h"
+#include "algorithms/gbt/gbt_regression_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+/**
+ * \brief Contains classes for making gradient boosted trees regression model-based prediction
+ */
+namespace prediction
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__PREDICTION__METHOD"></a>
+ * \brief Available methods for making gradient boosted trees regression model-based prediction
+ */
+enum Method
+{
+    defaultDense = 0    /*!< Default gradient boosted trees model-based prediction method */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__PREDICTION__NUMERIC_TABLE_INPUT_ID"></a>
+ * \brief Available identifiers of input numeric tables for making gradient boosted trees regression model-based prediction
+ */
+enum NumericTableInputId
+{
+    data = 0    /*!< Input data table */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__PREDICTION__MODEL_INPUT_ID"></a>
+ * \brief Available identifiers of input models for making gradient boosted trees regression model-based prediction
+ */
+enum ModelInputId
+{
+    model = 1   /*!< Trained gradient boosted trees regression model */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__PREDICTION__RESULT_ID"></a>
+ * \brief Available identifiers of the result for making gradient boosted trees regression model-based prediction
+ */
+enum ResultId
+{
+    prediction = 0  /*!< Result of gradient boosted trees regression model-based prediction */
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__PREDICTION__INPUT"></a>
+ * \brief Provides an interface for input objects for making gradient boosted trees regression model-based prediction
+ */
+class Input : public daal::algorithms::Input
+{
+public:
+    /** Default constructor */
+    Input() : daal::algorithms::Input(2) {};
+
+    /**
+     * Returns an input object for making gradient boosted trees regression model-based prediction
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(NumericTableInputId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Returns an input object for making gradient boosted trees regression model-based prediction
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    services::SharedPtr<gbt::regression::Model> get(ModelInputId id) const
+    {
+        return services::staticPointerCast<gbt::regression::Model, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets an input object for making gradient boosted trees regression model-based prediction
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   %Input object
+     */
+    void set(NumericTableInputId id, const services::SharedPtr<data_management::NumericTable> &value)
+    {
+        Argument::set(id, value);
+    }
+
+    /**
+     * Sets an input object for making gradient boosted trees regression model-based prediction
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   %Input object
+     */
+    void set(ModelInputId id, const services::SharedPtr<gbt::regression::Model> &value)
+    {
+        Argument::set(id, value);
+    }
+
+    /**
+     * Checks an input object for making gradient boosted trees regression model-based prediction
+     */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE
+    {
+        if(Argument::size() != 2) { this->_errors->add(services::ErrorIncorrectNumberOfInputNumericTables); return; }
+
+        services::SharedPtr<data_management::NumericTable> dataTable = get(data);
+        if(dataTable.get() == 0)                 { this->_errors->add(services::ErrorNullInputNumericTable); return;         }
+        if(dataTable->getNumberOfRows() == 0)    { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+        if(dataTable->getNumberOfColumns() == 0) { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return;     }
+
+        services::SharedPtr<gbt::regression::Model> m = get(model);
+        if(!m) { this->_errors->add(services::ErrorNullModel); return; }
+        if(m->getNumberOfFeatures() != dataTable->getNumberOfColumns())
+        { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return; }
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__PREDICTION__RESULT"></a>
+ * \brief Provides interface for the result of gradient boosted trees regression model-based prediction
+ */
+class Result : public daal::algorithms::Result
+{
+public:
+    Result() : daal::algorithms::Result(1) {};
+
+    /**
+     * Returns the result of gradient boosted trees regression model-based prediction
+     * \param[in] id    Identifier of the result
+     * \return          Result that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(ResultId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets the result of gradient boosted trees regression model-based prediction
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   %Input object
+     */
+    void set(ResultId id, const services::SharedPtr<data_management::NumericTable> &value)
+    {
+        Argument::set(id, value);
+    }
+
+    /**
+     * Allocates memory to store the result of gradient boosted trees regression model-based prediction
+     * \param[in] input   %Input object
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Algorithm method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, const int method)
+    {
+        size_t nVectors = (static_cast<const Input *>(input))->get(data)->getNumberOfRows();
+        Argument::set(prediction,
+                      services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>
+                          (1, nVectors, data_management::NumericTableIface::doAllocate)));
+    }
+
+    /**
+     * Checks the result of gradient boosted trees regression model-based prediction
+     * \param[in] input   %Input object
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Computation method
+     */
+    void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        if(Argument::size() != 1) { this->_errors->add(services::ErrorIncorrectNumberOfOutputNumericTables); return; }
+
+        services::SharedPtr<data_management::NumericTable> predictionTable = get(prediction);
+        if(predictionTable.get() == 0)
+        { this->_errors->add(services::ErrorNullOutputNumericTable); return; }
+        if(predictionTable->getNumberOfRows() != (static_cast<const Input *>(input))->get(data)->getNumberOfRows())
+        { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+        if(predictionTable->getNumberOfColumns() != 1)
+        { this->_errors->add(services::ErrorIncorrectNumberOfColumnsInOutputNumericTable); return; }
+    }
+
+    /**
+     * Returns the serialization tag of the gradient boosted trees regression model-based prediction result
+     * \return         Serialization tag of the gradient boosted trees regression model-based prediction result
+     */
+    int getSerializationTag() DAAL_C11_OVERRIDE  { return SERIALIZATION_GBT_REGRESSION_PREDICTION_RESULT_ID; }
+
+    /**
+    *  Serializes an object
+    *  \param[in]  arch  Storage for a serialized object or data structure
+    */
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    /**
+    *  Deserializes an object
+    *  \param[in]  arch  Storage for a deserialized object or data structure
+    */
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+} // namespace interface1
+using interface1::Input;
+using interface1::Result;
+
+} // namespace prediction
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
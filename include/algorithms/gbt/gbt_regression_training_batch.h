@@ -0,0 +1,180 @@
+/* file: gbt_regression_training_batch.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for gradient boosted trees regression model-based training
+//  in the batch processing mode
+//--
+*/
+
+#ifndef __GBT_REGRESSION_TRAINING_BATCH_H__
+#define __GBT_REGRESSION_TRAINING_BATCH_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/gbt/gbt_regression_training_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__BATCHCONTAINER"></a>
+ * \brief Class containing methods for gradient boosted trees regression model-based training
+ *        using algorithmFPType precision arithmetic
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT BatchContainer : public TrainingContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for gradient boosted trees regression model-based training with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~BatchContainer();
+    /**
+     * Computes the result of gradient boosted trees regression model-based training in the batch processing mode
+     */
+    void compute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__BATCH"></a>
+ * \brief Trains the gradient boosted trees regression model.
+ *        The values of each feature are quantized into at most maxBins bins once per compute() call,
+ *        the trees are grown level by level from per-node histograms of gradient statistics
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Gradient boosted trees training method, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method   Computation methods
+ *      - \ref InputId  Identifiers of input objects
+ *      - \ref ResultId Identifiers of training results
+ *
+ * \par References
+ *      - \ref interface1::Parameter "Parameter" class
+ *      - \ref gbt::regression::interface1::Model "gbt::regression::Model" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+template<typename algorithmFPType = double, Method method = defaultDense>
+class DAAL_EXPORT Batch : public Training<batch>
+{
+public:
+    /** Default constructor */
+    Batch()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the gradient boosted trees regression training algorithm by copying input objects
+     * and parameters of another gradient boosted trees regression training algorithm
+     * \param[in] other Algorithm to use as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(data,              other.input.get(data));
+        input.set(dependentVariable, other.input.get(dependentVariable));
+        parameter = other.parameter;
+    }
+
+    ~Batch() {}
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Registers user-allocated memory to store the result of gradient boosted trees regression model-based training
+     * \param[in] res    Structure to store the result
+     */
+    void setResult(const services::SharedPtr<Result>& res)
+    {
+        _result = res;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains the result of gradient boosted trees regression model-based training
+     * \return Structure that contains the result
+     */
+    services::SharedPtr<Result> getResult() { return _result; }
+
+    Input input;            /*!< %Input data structure */
+    Parameter parameter;    /*!< Training parameters */
+
+    /**
+     * Returns a pointer to a newly allocated gradient boosted trees regression training algorithm
+     * with a copy of the input objects and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    services::SharedPtr<Result> _result;
+
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(&input, &parameter, method);
+        _res = _result.get();
+    }
+
+    void initialize()
+    {
+        _ac  = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+    }
+};
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,364 @@
+/* file: gbt_regression_training_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/*
+//++
+//  Implementation of the interface for gradient boosted trees regression model-based training
+//  in the distributed processing mode
+//--
+*/
+
+#ifndef __GBT_REGRESSION_TRAINING_DISTRIBUTED_H__
+#define __GBT_REGRESSION_TRAINING_DISTRIBUTED_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/gbt/gbt_regression_training_types.h"
+#include "algorithms/gbt/gbt_training_distributed_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+namespace training
+{
+
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDCONTAINER"></a>
+ * \brief Class containing methods for gradient boosted trees regression model-based training in the distributed processing mode
+ */
+template<ComputeStep step, typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer;
+
+/**
+ * \brief Class containing methods for gradient boosted trees regression model-based training
+ *        in the first step of the distributed processing mode
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step1Local, algorithmFPType, method, cpu> : public TrainingContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for gradient boosted trees regression model-based training with a specified environment
+     * in the first step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~DistributedContainer();
+    /**
+     * Computes the statistics of the local data set requested by the master node
+     */
+    void compute() DAAL_C11_OVERRIDE;
+    /**
+     * Does nothing, the model is obtained on the master node
+     */
+    void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * \brief Class containing methods for gradient boosted trees regression model-based training
+ *        in the second step of the distributed processing mode
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step2Master, algorithmFPType, method, cpu> : public TrainingContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for gradient boosted trees regression model-based training with a specified environment
+     * in the second step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~DistributedContainer();
+    /**
+     * Merges the statistics of the local nodes, grows the trees and computes the request to the local nodes
+     */
+    void compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the model from the trees built by the master node
+     */
+    void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTED"></a>
+ * \brief Trains the gradient boosted trees regression model in the distributed processing mode.
+ *        The local nodes and the master node exchange the partial results until the master node reports
+ *        the training completed, see \ref gbt::training::DistributedPartialResult::isCompleted().
+ *        On the first call the local nodes compute the candidates for the borders of the bins,
+ *        on the next calls they compute the histograms of the tree nodes requested by the master node,
+ *        the master node sums the histograms and finds the splits
+ *
+ * \tparam step             Step of the algorithm in the distributed processing mode, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Gradient boosted trees training method, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method                        Computation methods
+ *      - \ref InputId                       Identifiers of input objects
+ *      - \ref DistributedStep1LocalInputId  Identifiers of input objects computed by the master node
+ *      - \ref ResultId                      Identifiers of training results
+ *
+ * \par References
+ *      - \ref interface1::Parameter "Parameter" class
+ *      - \ref gbt::regression::interface1::Model "gbt::regression::Model" class
+ *      - \ref prediction::interface1::Batch "prediction::Batch" class
+ */
+template<ComputeStep step, typename algorithmFPType = double, Method method = defaultDense>
+class DAAL_EXPORT Distributed : public Training<distributed> {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTED_STEP1LOCAL"></a>
+ * \brief Computes the statistics of the local data set for gradient boosted trees regression model-based training
+ *        in the first step of the distributed processing mode.
+ *        The quantized data set and the scores of the observations are kept between the compute() calls
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Gradient boosted trees training method, \ref Method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public Training<distributed>
+{
+public:
+    /** Default constructor */
+    Distributed()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the gradient boosted trees regression training algorithm in the first step of the distributed processing mode
+     * by copying input objects and parameters of another gradient boosted trees regression training algorithm
+     * \param[in] other Algorithm to use as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step1Local, algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(data,               other.input.get(data));
+        input.set(dependentVariable,  other.input.get(dependentVariable));
+        input.set(inputBinBorders,    other.input.get(inputBinBorders));
+        input.set(inputTrainingState, other.input.get(inputTrainingState));
+        parameter = other.parameter;
+    }
+
+    ~Distributed() {}
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Registers user-allocated memory to store the partial result of gradient boosted trees regression model-based training
+     * \param[in] partialResult    Structure to store the partial result
+     */
+    void setPartialResult(const services::SharedPtr<gbt::training::PartialResult>& partialResult)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+    }
+
+    /**
+     * Returns the structure that contains the partial result of gradient boosted trees regression model-based training
+     * \return Structure that contains the partial result
+     */
+    services::SharedPtr<gbt::training::PartialResult> getPartialResult() { return _partialResult; }
+
+    /**
+     * Validates the parameters of the finalizeCompute() method
+     */
+    void checkFinalizeComputeParams() DAAL_C11_OVERRIDE {}
+
+    /**
+     * Returns a pointer to a newly allocated gradient boosted trees regression training algorithm
+     * with a copy of the input objects and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step1Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+    DistributedInput<step1Local> input;    /*!< %Input data structure */
+    Parameter parameter;                    /*!< Training parameters, the same on all nodes */
+
+protected:
+    services::SharedPtr<gbt::training::PartialResult> _partialResult;
+
+    virtual Distributed<step1Local, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step1Local, algorithmFPType, method>(*this);
+    }
+
+    void allocateResult() DAAL_C11_OVERRIDE {}
+
+    void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate<algorithmFPType>(&input, &parameter, method);
+        _pres = _partialResult.get();
+    }
+
+    void initializePartialResult() DAAL_C11_OVERRIDE {}
+
+    void initialize()
+    {
+        _ac  = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step1Local, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _partialResult = services::SharedPtr<gbt::training::PartialResult>(new gbt::training::PartialResult());
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTED_STEP2MASTER"></a>
+ * \brief Merges the statistics of the local nodes and grows the trees of gradient boosted trees regression
+ *        in the second step of the distributed processing mode.
+ *        The collection of the partial results of the local nodes is cleared after every compute() call
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations, double or float
+ * \tparam method           Gradient boosted trees training method, \ref Method
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public Training<distributed>
+{
+public:
+    /** Default constructor */
+    Distributed()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the gradient boosted trees regression training algorithm in the second step of the distributed processing mode
+     * by copying input objects and parameters of another gradient boosted trees regression training algorithm
+     * \param[in] other Algorithm to use as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(gbt::training::partialResults, other.input.get(gbt::training::partialResults));
+        parameter = other.parameter;
+    }
+
+    ~Distributed() {}
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Registers user-allocated memory to store the partial result of gradient boosted trees regression model-based training
+     * \param[in] partialResult    Structure to store the partial result
+     */
+    void setPartialResult(const services::SharedPtr<gbt::training::DistributedPartialResult>& partialResult)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+    }
+
+    /**
+     * Returns the structure that contains the partial result of gradient boosted trees regression model-based training
+     * \return Structure that contains the partial result
+     */
+    services::SharedPtr<gbt::training::DistributedPartialResult> getPartialResult() { return _partialResult; }
+
+    /**
+     * Registers user-allocated memory to store the result of gradient boosted trees regression model-based training
+     * \param[in] res    Structure to store the result
+     */
+    void setResult(const services::SharedPtr<Result>& res)
+    {
+        _result = res;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains the result of gradient boosted trees regression model-based training
+     * \return Structure that contains the result
+     */
+    services::SharedPtr<Result> getResult() { return _result; }
+
+    /**
+     * Returns a pointer to a newly allocated gradient boosted trees regression training algorithm
+     * with a copy of the input objects and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, method> >(cloneImpl());
+    }
+
+    gbt::training::DistributedStep2MasterInput input;  /*!< %Input data structure */
+    Parameter parameter;                                /*!< Training parameters, the same on all nodes */
+
+protected:
+    services::SharedPtr<gbt::training::DistributedPartialResult> _partialResult;
+    services::SharedPtr<Result> _result;
+
+    virtual Distributed<step2Master, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, method>(*this);
+    }
+
+    void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_pres, &parameter, method);
+        _res = _result.get();
+    }
+
+    void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate<algorithmFPType>(&input, &parameter, method);
+        _pres = _partialResult.get();
+    }
+
+    void initializePartialResult() DAAL_C11_OVERRIDE {}
+
+    void initialize()
+    {
+        _ac  = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _partialResult = services::SharedPtr<gbt::training::DistributedPartialResult>(new gbt::training::DistributedPartialResult());
+        _result = services::SharedPtr<Result>(new Result());
+    }
+};
+} // namespace interface1
+using interface1::DistributedContainer;
+using interface1::Distributed;
+
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
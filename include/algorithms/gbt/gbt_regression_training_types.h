@@ -0,0 +1,367 @@
+/* file: gbt_regression_training_types.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the gradient boosted trees regression training algorithm interface.
+//--
+*/
+
+#ifndef __GBT_REGRESSION_TRAINING_TYPES_H__
+#define __GBT_REGRESSION_TRAINING_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/data_serialize.h"
+#include "services/daal_defines.h"
+#include "algorithms/gbt/gbt_training_parameter.h"
+#include "algorithms/gbt/gbt_training_distributed_types.h"
+#include "algorithms/gbt/gbt_regression_model.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace regression
+{
+/**
+ * \brief Contains classes to train the gradient boosted trees regression model
+ */
+namespace training
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__METHOD"></a>
+ * \brief Computation methods for gradient boosted trees regression model-based training
+ */
+enum Method
+{
+    defaultDense = 0    /*!< Histogram-based method on quantized feature values */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__INPUT_ID"></a>
+ * \brief Available identifiers of input objects for gradient boosted trees regression model-based training
+ */
+enum InputId
+{
+    data = 0,               /*!< %Input data table */
+    dependentVariable = 1   /*!< Values of the dependent variable for the input data */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTED_STEP1_LOCAL_INPUT_ID"></a>
+ * \brief Available identifiers of the input objects computed by the master node for gradient boosted trees
+ *        regression model-based training in the first step of the distributed processing mode
+ */
+enum DistributedStep1LocalInputId
+{
+    inputBinBorders = 2,    /*!< Borders of the bins, \ref gbt::training::binBorders. Not set on the first call */
+    inputTrainingState = 3  /*!< Training state, \ref gbt::training::trainingState. Not set on the first call */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__REGRESSION__TRAINING__RESULT_ID"></a>
+ * \brief Available identifiers of the result of gradient boosted trees regression model-based training
+ */
+enum ResultId
+{
+    model = 0   /*!< Gradient boosted trees regression model */
+};
+
+/**
+ * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__PARAMETER"></a>
+ * \brief Parameters of the gradient boosted trees regression training algorithm.
+ *        The algorithm minimizes the squared loss
+ *
+ * \snippet gbt/gbt_regression_training_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct Parameter : public daal::algorithms::Parameter, public daal::algorithms::gbt::training::Parameter
+{
+    Parameter() : daal::algorithms::Parameter(), daal::algorithms::gbt::training::Parameter() {}
+
+    /**
+     * Checks the correctness of the parameter
+     */
+    virtual void check() const
+    {
+        daal::algorithms::gbt::training::Parameter::checkImpl(this->_errors);
+    }
+};
+/* [Parameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__INPUT"></a>
+ * \brief %Input objects for gradient boosted trees regression model-based training
+ */
+class Input : public daal::algorithms::Input
+{
+public:
+    /** Default constructor */
+    Input() : daal::algorithms::Input(2) {};
+
+    virtual ~Input() {};
+
+    /**
+     * Returns an input object for gradient boosted trees regression model-based training
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(InputId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets an input object for gradient boosted trees regression model-based training
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Pointer to the object
+     */
+    void set(InputId id, const services::SharedPtr<data_management::NumericTable> &value)
+    {
+        Argument::set(id, value);
+    }
+
+    /**
+     * Returns the number of columns in the input data set
+     * \return Number of columns in the input data set
+     */
+    size_t getNFeatures() const { return get(data)->getNumberOfColumns(); }
+
+    /**
+    * Checks an input object for the gradient boosted trees regression algorithm
+    * \param[in] par     Algorithm parameter
+    * \param[in] method  Computation method
+    */
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        if(Argument::size() != 2) { this->_errors->add(services::ErrorIncorrectNumberOfInputNumericTables); return; }
+        checkImpl();
+    }
+
+protected:
+    Input(size_t nElements) : daal::algorithms::Input(nElements) {}
+
+    void checkImpl() const
+    {
+        services::SharedPtr<data_management::NumericTable> dataTable = get(data);
+        if(!dataTable) { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+
+        size_t nRowsInData = dataTable->getNumberOfRows();
+        if(nRowsInData == 0)                     { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+        if(dataTable->getNumberOfColumns() == 0) { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return;     }
+
+        services::SharedPtr<data_management::NumericTable> dependentVariableTable = get(dependentVariable);
+        if(!dependentVariableTable) { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        if(dependentVariableTable->getNumberOfColumns() != 1)
+        { this->_errors->add(services::ErrorIncorrectNumberOfColumnsInInputNumericTable); return; }
+        if(dependentVariableTable->getNumberOfRows() != nRowsInData)
+        { this->_errors->add(services::ErrorInconsistentNumberOfRows); return; }
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDINPUT"></a>
+ * \brief %Input objects for gradient boosted trees regression model-based training in the distributed processing mode
+ */
+template<ComputeStep step>
+class DistributedInput {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__DISTRIBUTEDINPUT_STEP1LOCAL"></a>
+ * \brief %Input objects for gradient boosted trees regression model-based training
+ *        in the first step of the distributed processing mode: the local data set and
+ *        the borders of the bins and the training state computed by the master node on the previous call
+ */
+template<>
+class DistributedInput<step1Local> : public Input
+{
+public:
+    DistributedInput() : Input(4) {}
+
+    virtual ~DistributedInput() {}
+
+    using Input::get;
+    using Input::set;
+
+    /**
+     * Returns an input object computed by the master node
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(DistributedStep1LocalInputId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets an input object computed by the master node
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Pointer to the object
+     */
+    void set(DistributedStep1LocalInputId id, const services::SharedPtr<data_management::NumericTable> &value)
+    {
+        Argument::set(id, value);
+    }
+
+    /**
+    * Checks the input objects of gradient boosted trees regression training in the first step of the distributed processing mode
+    * \param[in] par     Algorithm parameter
+    * \param[in] method  Computation method
+    */
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        if(Argument::size() != 4) { this->_errors->add(services::ErrorIncorrectNumberOfInputNumericTables); return; }
+        checkImpl();
+        if(!this->_errors->isEmpty()) { return; }
+
+        services::SharedPtr<data_management::NumericTable> bordersTable = get(inputBinBorders);
+        services::SharedPtr<data_management::NumericTable> stateTable = get(inputTrainingState);
+        if(!bordersTable && !stateTable) { return; }
+        if(!bordersTable || !stateTable) { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        if(bordersTable->getNumberOfRows() != get(data)->getNumberOfColumns())
+        { this->_errors->add(services::ErrorIncorrectNumberOfRowsInInputNumericTable); return; }
+        if(stateTable->getNumberOfColumns() != 4)
+        { this->_errors->add(services::ErrorIncorrectNumberOfColumnsInInputNumericTable); return; }
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__REGRESSION__TRAINING__RESULT"></a>
+ * \brief Provides methods to access the result obtained with the compute() method
+ *        of gradient boosted trees regression model-based training
+ */
+class Result : public daal::algorithms::Result
+{
+public:
+    Result() : daal::algorithms::Result(1) {};
+
+    /**
+     * Returns the result of gradient boosted trees regression model-based training
+     * \param[in] id    Identifier of the result
+     * \return          Result that corresponds to the given identifier
+     */
+    services::SharedPtr<daal::algorithms::gbt::regression::Model> get(ResultId id) const
+    {
+        return services::staticPointerCast<daal::algorithms::gbt::regression::Model,
+               data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets the result of gradient boosted trees regression model-based training
+     * \param[in] id      Identifier of the result
+     * \param[in] value   Result
+     */
+    void set(ResultId id, const services::SharedPtr<daal::algorithms::gbt::regression::Model> &value)
+    {
+        Argument::set(id, value);
+    }
+
+    /**
+     * Allocates memory to store the result of gradient boosted trees regression model-based training
+     * \param[in] input     Pointer to an object containing the input data
+     * \param[in] parameter %Parameter of gradient boosted trees regression model-based training
+     * \param[in] method    Computation method for the algorithm
+     */
+    template<typename algorithmFPType>
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        const Input *in = static_cast<const Input *>(input);
+
+        algorithmFPType dummy = 1.0;
+        set(model, services::SharedPtr<daal::algorithms::gbt::regression::Model>(
+                new daal::algorithms::gbt::regression::Model(in->getNFeatures(), dummy)));
+    }
+
+    /**
+     * Allocates memory to store the result of gradient boosted trees regression model-based training
+     * in the second step of the distributed processing mode
+     * \param[in] partialResult Pointer to the partial result of the master node
+     * \param[in] parameter     %Parameter of gradient boosted trees regression model-based training
+     * \param[in] method        Computation method for the algorithm
+     */
+    template<typename algorithmFPType>
+    void allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        const gbt::training::DistributedPartialResult *pres = static_cast<const gbt::training::DistributedPartialResult *>(partialResult);
+
+        algorithmFPType dummy = 1.0;
+        set(model, services::SharedPtr<daal::algorithms::gbt::regression::Model>(
+                new daal::algorithms::gbt::regression::Model(pres->getNumberOfFeatures(), dummy)));
+    }
+
+    /**
+     * Checks the result of gradient boosted trees regression model-based training
+     * \param[in] input   %Input object for the algorithm
+     * \param[in] par     %Parameter of the algorithm
+     * \param[in] method  Computation method
+     */
+    void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        if(Argument::size() != 1) { this->_errors->add(services::ErrorIncorrectNumberOfOutputNumericTables); return; }
+
+        services::SharedPtr<daal::algorithms::gbt::regression::Model> m = get(model);
+        if(!m) { this->_errors->add(services::ErrorNullModel); return; }
+    }
+
+    /**
+     * Returns the serialization tag of the gradient boosted trees regression model-based training result
+     * \return         Serialization tag of the gradient boosted trees regression model-based training result
+     */
+    int getSerializationTag() DAAL_C11_OVERRIDE  { return SERIALIZATION_GBT_REGRESSION_TRAINING_RESULT_ID; }
+
+    /**
+    *  Serializes an object
+    *  \param[in]  arch  Storage for a serialized object or data structure
+    */
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    /**
+    *  Deserializes an object
+    *  \param[in]  arch  Storage for a deserialized object or data structure
+    */
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Input;
+using interface1::DistributedInput;
+using interface1::Result;
+
+} // namespace training
+} // namespace regression
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -0,0 +1,374 @@
+/* file: gbt_training_distributed_types.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/*
+//++
+//  Implementation of the partial results and of the input of the master step shared by
+//  the gradient boosted trees training algorithms in the distributed processing mode.
+//--
+*/
+
+#ifndef __GBT_TRAINING_DISTRIBUTED_TYPES_H__
+#define __GBT_TRAINING_DISTRIBUTED_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/data_collection.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace gbt
+{
+namespace training
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__TRAINING__PARTIAL_RESULT_ID"></a>
+ * \brief Available identifiers of partial results of gradient boosted trees training
+ *        in the first step of the distributed processing mode
+ */
+enum PartialResultId
+{
+    partialStatistics = 0   /*!< Statistics of the local data set requested by the master node: the candidates for the borders
+                                 of the bins on the first call, the histograms of the gradient statistics of the tree nodes
+                                 on the next calls */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__TRAINING__MASTER_INPUT_ID"></a>
+ * \brief Available identifiers of input objects of gradient boosted trees training
+ *        in the second step of the distributed processing mode
+ */
+enum MasterInputId
+{
+    partialResults = 0      /*!< Collection of the partial results computed on the local nodes */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__TRAINING__DISTRIBUTED_PARTIAL_RESULT_ID"></a>
+ * \brief Available identifiers of partial results of gradient boosted trees training
+ *        in the second step of the distributed processing mode
+ */
+enum DistributedPartialResultId
+{
+    binBorders = 0,         /*!< Borders of the bins of the features, one row per feature:
+                                 the number of the borders followed by the borders in ascending order */
+    trainingState = 1       /*!< Splits and leaves of the tree nodes found by the master node and the request
+                                 for the next histograms, to be passed to the local nodes */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__GBT__TRAINING__DISTRIBUTED_PARTIAL_RESULT_COLLECTION_ID"></a>
+ * \brief Available identifiers of partial results of gradient boosted trees training
+ *        stored in the DataCollection object in the second step of the distributed processing mode
+ */
+enum DistributedPartialResultCollectionId
+{
+    trees = 2               /*!< Trees completed by the master node in the format of the model */
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__TRAINING__PARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of
+ *        gradient boosted trees training in the first step of the distributed processing mode
+ */
+class PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    PartialResult() : daal::algorithms::PartialResult(1) {}
+
+    virtual ~PartialResult() {}
+
+    /**
+     * Allocates memory to store partial results of gradient boosted trees training.
+     * The size of the statistics depends on the request of the master node, so the table is created by compute()
+     * \param[in] input     Pointer to the structure of the input objects
+     * \param[in] parameter Pointer to the structure of the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method) {}
+
+    /**
+     * Returns a partial result of gradient boosted trees training
+     * \param[in] id    Identifier of the partial result
+     * \return          Partial result that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(PartialResultId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets a partial result of gradient boosted trees training
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(PartialResultId id, const services::SharedPtr<data_management::NumericTable> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
+    /**
+     * Returns the serialization tag of the partial result
+     * \return         Serialization tag of the partial result
+     */
+    int getSerializationTag() DAAL_C11_OVERRIDE  { return SERIALIZATION_GBT_TRAINING_PARTIAL_RESULT_ID; }
+
+    /**
+    *  Serializes an object
+    *  \param[in]  arch  Storage for a serialized object or data structure
+    */
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    /**
+    *  Deserializes an object
+    *  \param[in]  arch  Storage for a deserialized object or data structure
+    */
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__TRAINING__DISTRIBUTEDSTEP2MASTERINPUT"></a>
+ * \brief %Input objects of gradient boosted trees training in the second step of the distributed processing mode
+ */
+class DistributedStep2MasterInput : public daal::algorithms::Input
+{
+public:
+    DistributedStep2MasterInput() : daal::algorithms::Input(1)
+    {
+        Argument::set(partialResults, services::SharedPtr<data_management::DataCollection>(new data_management::DataCollection()));
+    }
+
+    virtual ~DistributedStep2MasterInput() {}
+
+    /**
+    * Returns an input object of gradient boosted trees training in the second step of the distributed processing mode
+    * \param[in] id    Identifier of the input object
+    * \return          %Input object that corresponds to the given identifier
+    */
+    services::SharedPtr<data_management::DataCollection> get(MasterInputId id) const
+    {
+        return services::staticPointerCast<data_management::DataCollection, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+    * Sets an input object of gradient boosted trees training in the second step of the distributed processing mode
+    * \param[in] id    Identifier of the input object
+    * \param[in] ptr   Pointer to the object
+    */
+    void set(MasterInputId id, const services::SharedPtr<data_management::DataCollection> &ptr)
+    {
+        Argument::set(id, services::staticPointerCast<data_management::SerializationIface, data_management::DataCollection>(ptr));
+    }
+
+    /**
+     * Adds the partial result computed on a local node to the input of gradient boosted trees training
+     * in the second step of the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \param[in] value Pointer to the object
+     */
+    void add(MasterInputId id, const services::SharedPtr<PartialResult> &value)
+    {
+        services::SharedPtr<data_management::DataCollection> collection = get(id);
+        collection->push_back(value);
+    }
+
+    /**
+    * Checks the input objects of gradient boosted trees training in the second step of the distributed processing mode
+    * \param[in] par     Algorithm parameter
+    * \param[in] method  Computation method
+    */
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        if(Argument::size() != 1) { this->_errors->add(services::ErrorIncorrectNumberOfInputNumericTables); return; }
+
+        services::SharedPtr<data_management::DataCollection> collection = get(partialResults);
+        if(!collection) { this->_errors->add(services::ErrorNullInput); return; }
+
+        const size_t n = collection->size();
+        if(n == 0) { this->_errors->add(services::ErrorIncorrectNumberOfInputNumericTables); return; }
+
+        for(size_t i = 0; i < n; i++)
+        {
+            services::SharedPtr<PartialResult> pres =
+                services::staticPointerCast<PartialResult, data_management::SerializationIface>((*collection)[i]);
+            if(!pres) { this->_errors->add(services::ErrorNullPartialResult); return; }
+            if(!pres->get(partialStatistics)) { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        }
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__TRAINING__DISTRIBUTEDPARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of
+ *        gradient boosted trees training in the second step of the distributed processing mode.
+ *        The borders of the bins and the training state are passed to every local node before its next compute() call
+ */
+class DistributedPartialResult : public daal::algorithms::PartialResult
+{
+public:
+    DistributedPartialResult() : daal::algorithms::PartialResult(3) {}
+
+    virtual ~DistributedPartialResult() {}
+
+    /**
+     * Allocates memory to store partial results of gradient boosted trees training.
+     * The borders of the bins and the training state are created by compute()
+     * \param[in] input     Pointer to the structure of the input objects
+     * \param[in] parameter Pointer to the structure of the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        Argument::set(trees, services::SharedPtr<data_management::DataCollection>(new data_management::DataCollection()));
+    }
+
+    /**
+     * Returns a partial result of gradient boosted trees training
+     * \param[in] id    Identifier of the partial result
+     * \return          Partial result that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(DistributedPartialResultId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Returns a partial result of gradient boosted trees training stored in the DataCollection object
+     * \param[in] id    Identifier of the partial result
+     * \return          Partial result that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::DataCollection> get(DistributedPartialResultCollectionId id) const
+    {
+        return services::staticPointerCast<data_management::DataCollection, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets a partial result of gradient boosted trees training
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(DistributedPartialResultId id, const services::SharedPtr<data_management::NumericTable> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
+    /**
+     * Sets a partial result of gradient boosted trees training stored in the DataCollection object
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(DistributedPartialResultCollectionId id, const services::SharedPtr<data_management::DataCollection> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
+    /**
+     * Returns the number of features of the data set, known after the first compute() call
+     * \return Number of features of the data set
+     */
+    size_t getNumberOfFeatures() const
+    {
+        services::SharedPtr<data_management::NumericTable> bordersTable = get(binBorders);
+        return (bordersTable ? bordersTable->getNumberOfRows() : 0);
+    }
+
+    /**
+     * Returns true when all trees are built and the model can be obtained with the finalizeCompute() method
+     * \return Flag of the completed training
+     */
+    bool isCompleted() const
+    {
+        services::SharedPtr<data_management::NumericTable> stateTable = get(trainingState);
+        if(!stateTable) { return false; }
+
+        data_management::BlockDescriptor<int> block;
+        stateTable->getBlockOfRows(0, 1, data_management::readOnly, block);
+        const bool bCompleted = (block.getBlockPtr()[3] == -2);
+        stateTable->releaseBlockOfRows(block);
+        return bCompleted;
+    }
+
+    /**
+    * Checks partial results of gradient boosted trees training in the second step of the distributed processing mode
+    * \param[in] par     Algorithm parameter
+    * \param[in] method  Computation method
+    */
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        if(Argument::size() != 3) { this->_errors->add(services::ErrorIncorrectNumberOfOutputNumericTables); return; }
+        if(!get(trees)) { this->_errors->add(services::ErrorNullPartialResult); return; }
+    }
+
+    /**
+     * Returns the serialization tag of the partial result
+     * \return         Serialization tag of the partial result
+     */
+    int getSerializationTag() DAAL_C11_OVERRIDE  { return SERIALIZATION_GBT_TRAINING_DISTRIBUTED_PARTIAL_RESULT_ID; }
+
+    /**
+    *  Serializes an object
+    *  \param[in]  arch  Storage for a serialized object or data structure
+    */
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    /**
+    *  Deserializes an object
+    *  \param[in]  arch  Storage for a deserialized object or data structure
+    */
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+} // namespace interface1
+using interface1::PartialResult;
+using interface1::DistributedStep2MasterInput;
+using interface1::DistributedPartialResult;
+
+} // namespace training
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
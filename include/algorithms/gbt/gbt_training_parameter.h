@@ -0,0 +1,110 @@
+/* file: gbt_training_parameter.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the parameters common for the gradient boosted trees training algorithms.
+//--
+*/
+
+#ifndef __GBT_TRAINING_PARAMETER_H__
+#define __GBT_TRAINING_PARAMETER_H__
+
+#include "services/daal_defines.h"
+#include "services/error_handling.h"
+
+namespace daal
+{
+namespace algorithms
+{
+/**
+ * \brief Contains classes of the gradient boosted trees algorithms
+ */
+namespace gbt
+{
+/**
+ * \brief Contains classes common for the gradient boosted trees training algorithms
+ */
+namespace training
+{
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__GBT__TRAINING__PARAMETER"></a>
+ * \brief Parameters of the gradient boosted trees training shared by the classification and regression algorithms
+ *
+ * \snippet gbt/gbt_training_parameter.h Parameter source code
+ */
+/* [Parameter source code] */
+struct Parameter
+{
+    Parameter(size_t maxIterations = 50,
+              size_t maxTreeDepth = 6,
+              double shrinkage = 0.3,
+              size_t minObservationsInLeafNode = 5,
+              double lambda = 1.0,
+              double minSplitLoss = 0.0,
+              size_t maxBins = 256) :
+        maxIterations(maxIterations), maxTreeDepth(maxTreeDepth), shrinkage(shrinkage),
+        minObservationsInLeafNode(minObservationsInLeafNode), lambda(lambda), minSplitLoss(minSplitLoss),
+        maxBins(maxBins) {}
+
+    size_t maxIterations;               /*!< Number of boosting iterations */
+    size_t maxTreeDepth;                /*!< Maximal depth of a tree. The root node has depth 0 */
+    double shrinkage;                   /*!< Learning rate the leaf responses are multiplied by, in (0, 1] */
+    size_t minObservationsInLeafNode;   /*!< Minimal number of observations in a leaf node */
+    double lambda;                      /*!< L2 regularization term on the leaf responses */
+    double minSplitLoss;                /*!< Minimal loss reduction required to split a node */
+    size_t maxBins;                     /*!< Maximal number of bins the values of a feature are quantized into,
+                                             in [2, 65536] */
+
+protected:
+    /**
+     * Checks the values of the parameters
+     * \param[in] errors  Collection the detected errors are added to
+     */
+    void checkImpl(const services::ErrorCollectionPtr &errors) const
+    {
+        const char *name = 0;
+        if(maxIterations == 0)                              { name = "maxIterations"; }
+        else if(maxTreeDepth == 0)                          { name = "maxTreeDepth"; }
+        else if(!(shrinkage > 0.0 && shrinkage <= 1.0))     { name = "shrinkage"; }
+        else if(minObservationsInLeafNode == 0)             { name = "minObservationsInLeafNode"; }
+        else if(!(lambda >= 0.0))                           { name = "lambda"; }
+        else if(!(minSplitLoss >= 0.0))                     { name = "minSplitLoss"; }
+        else if(maxBins < 2 || maxBins > 65536)             { name = "maxBins"; }
+        if(name)
+        {
+            services::SharedPtr<services::Error> error(new services::Error(services::ErrorIncorrectParameter));
+            error->addStringDetail(services::ArgumentName, name);
+            errors->add(error);
+        }
+    }
+};
+/* [Parameter source code] */
+
+} // namespace interface1
+using interface1::Parameter;
+
+} // namespace training
+} // namespace gbt
+} // namespace algorithms
+} // namespace daal
+#endif
@@ -48,7 +48,10 @@ enum Method
     defaultDense       = 0, /*!< Synonym of deterministicDense */
     randomDense        = 1, /*!< Uses random nClusters points as initial clusters */
     deterministicCSR   = 2, /*!< Uses first nClusters points as initial clusters for data in a CSR numeric table */
-    randomCSR          = 3  /*!< Uses random nClusters points as initial clusters for data in a CSR numeric table */
+    randomCSR          = 3, /*!< Uses random nClusters points as initial clusters for data in a CSR numeric table */
+    plusPlusDense      = 4, /*!< Chooses initial clusters with the k-means++ algorithm */
+    plusPlusCSR        = 5, /*!< Chooses initial clusters with the k-means++ algorithm for data in a CSR numeric table */
+    parallelPlusDense  = 6  /*!< Chooses initial clusters with the scalable k-means++ (k-means||) algorithm */
 };
 
 /**
@@ -76,7 +79,9 @@ enum DistributedStep2MasterInputId
 enum PartialResultId
 {
     partialClustersNumber = 0, /*!< Table with the number of observations assigned to centroids */
-    partialClusters       = 1  /*!< Table with the sum of observations assigned to centroids */
+    partialClusters       = 1, /*!< Table with the sum of observations assigned to centroids */
+    partialClustersWeights = 2 /*!< Table with the numbers of observations closest to candidate centroids,
+                                    used with the parallelPlusDense method only */
 };
 
 /**
@@ -108,19 +113,47 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
      *  \param[in] _offset        Offset in the total data set specifying the start of a block stored on a given local node
      *  \param[in] seed           Seed for generating random numbers for the initialization
      */
-    Parameter(size_t _nClusters, size_t _offset = 0, size_t seed = 777777) : nClusters(_nClusters), offset(_offset), nRowsTotal(0), seed(seed) {}
+    Parameter(size_t _nClusters, size_t _offset = 0, size_t seed = 777777) : nClusters(_nClusters), offset(_offset), nRowsTotal(0), seed(seed),
+        oversamplingFactor(0.5), nRounds(5) {}
 
     /**
      * Constructs parameters of the algorithm that computes initial clusters for the K-Means algorithm
      * by copying another parameters object
      * \param[in] other    Parameters of the K-Means algorithm
      */
-    Parameter(const Parameter &other) : nClusters(other.nClusters), offset(other.offset), nRowsTotal(other.nRowsTotal), seed(other.seed) {}
+    Parameter(const Parameter &other) : nClusters(other.nClusters), offset(other.offset), nRowsTotal(other.nRowsTotal), seed(other.seed),
+        oversamplingFactor(other.oversamplingFactor), nRounds(other.nRounds) {}
 
     size_t nClusters;     /*!< Number of clusters */
     size_t nRowsTotal;    /*!< Total number of rows in the data set  */
     size_t offset;        /*!< Offset in the total data set specifying the start of a block stored on a given local node */
     size_t seed;          /*!< Seed for generating random numbers for the initialization */
+    double oversamplingFactor; /*!< Fraction of nClusters sampled as candidates in every round of the parallelPlusDense method */
+    size_t nRounds;       /*!< Number of candidate sampling rounds of the parallelPlusDense method */
+
+    /**
+     * Returns the number of candidate centroids sampled in one round of the parallelPlusDense method
+     * \return Number of candidate centroids sampled in one round
+     */
+    size_t getNumberOfCandidatesPerRound() const
+    {
+        size_t nPerRound = (size_t)(oversamplingFactor * nClusters);
+        if((double)nPerRound < oversamplingFactor * nClusters) { nPerRound++; }
+        return (nPerRound > 0 ? nPerRound : 1);
+    }
+
+    /**
+     * Returns the number of candidate centroids computed on a local node by the given method
+     * \param[in] method  Computation method of the algorithm
+     * \return Number of rows in the partialClusters table
+     */
+    size_t getNumberOfCandidates(int method) const
+    {
+        if(method != parallelPlusDense) { return nClusters; }
+
+        size_t nCandidates = 1 + nRounds * getNumberOfCandidatesPerRound();
+        return (nCandidates > nClusters ? nCandidates : nClusters);
+    }
 };
 /* [Parameter source code] */
 
@@ -200,7 +233,7 @@ public:
 class PartialResult : public daal::algorithms::PartialResult
 {
 public:
-    PartialResult() : daal::algorithms::PartialResult(2) {}
+    PartialResult() : daal::algorithms::PartialResult(3) {}
 
     virtual ~PartialResult() {};
 
@@ -216,13 +249,20 @@ public:
         const Parameter *kmPar = static_cast<const Parameter *>(parameter);
 
         size_t nFeatures = static_cast<const InputIface *>(input)->getNumberOfFeatures();
-        size_t nClusters = kmPar->nClusters;
+        size_t nCandidates = kmPar->getNumberOfCandidates(method);
 
         Argument::set(partialClusters, services::SharedPtr<data_management::SerializationIface>(
-                          new data_management::HomogenNumericTable<algorithmFPType>(nFeatures, nClusters,
+                          new data_management::HomogenNumericTable<algorithmFPType>(nFeatures, nCandidates,
                                                                                     data_management::NumericTable::doAllocate)));
         Argument::set(partialClustersNumber, services::SharedPtr<data_management::SerializationIface>(
                           new data_management::HomogenNumericTable<int>( 1, 1, data_management::NumericTable::doAllocate)));
+
+        if(method == parallelPlusDense)
+        {
+            Argument::set(partialClustersWeights, services::SharedPtr<data_management::SerializationIface>(
+                              new data_management::HomogenNumericTable<algorithmFPType>(1, nCandidates,
+                                                                                        data_management::NumericTable::doAllocate)));
+        }
     }
 
     /**
@@ -264,21 +304,24 @@ public:
     void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par,
                int method) const DAAL_C11_OVERRIDE
     {
-        if(Argument::size() != 2)
+        if(Argument::size() != 3)
         { this->_errors->add(services::ErrorIncorrectNumberOfOutputNumericTables); return; }
 
         size_t inputFeatures = static_cast<const InputIface *>(input)->getNumberOfFeatures();
         const Parameter *kmPar = static_cast<const Parameter *>(par);
+        size_t nCandidates = kmPar->getNumberOfCandidates(method);
 
         services::SharedPtr<data_management::NumericTable> pClusters = get(partialClusters);
         if(pClusters.get() == 0)                             { this->_errors->add(services::ErrorNullOutputNumericTable); return;        }
-        if(pClusters->getNumberOfRows() != kmPar->nClusters) { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+        if(pClusters->getNumberOfRows() != nCandidates)      { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
         if(pClusters->getNumberOfColumns() != inputFeatures) { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return;     }
 
         services::SharedPtr<data_management::NumericTable> pClustersNumber = get(partialClustersNumber);
         if(pClustersNumber.get() == 0)                 { this->_errors->add(services::ErrorNullOutputNumericTable); return;        }
         if(pClustersNumber->getNumberOfRows() != 1)    { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
         if(pClustersNumber->getNumberOfColumns() != 1) { this->_errors->add(services::ErrorInconsistentNumberOfColumns); return;   }
+
+        checkWeights(nCandidates, method);
     }
 
     /**
@@ -288,20 +331,23 @@ public:
     */
     void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
     {
-        if(Argument::size() != 2)
+        if(Argument::size() != 3)
         { this->_errors->add(services::ErrorIncorrectNumberOfOutputNumericTables); return; }
 
         const Parameter *kmPar = static_cast<const Parameter *>(par);
+        size_t nCandidates = kmPar->getNumberOfCandidates(method);
 
         services::SharedPtr<data_management::NumericTable> pClusters = get(partialClusters);
         if(pClusters.get() == 0)                             { this->_errors->add(services::ErrorNullOutputNumericTable); return;        }
-        if(pClusters->getNumberOfRows() != kmPar->nClusters) { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+        if(pClusters->getNumberOfRows() != nCandidates)      { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
         if(pClusters->getNumberOfColumns() == 0)             { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return;     }
 
         services::SharedPtr<data_management::NumericTable> pClustersNumber = get(partialClustersNumber);
         if(pClustersNumber.get() == 0)                 { this->_errors->add(services::ErrorNullOutputNumericTable); return;        }
         if(pClustersNumber->getNumberOfRows() != 1)    { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
         if(pClustersNumber->getNumberOfColumns() != 1) { this->_errors->add(services::ErrorInconsistentNumberOfColumns); return;   }
+
+        checkWeights(nCandidates, method);
     }
 
      /**
@@ -331,6 +377,17 @@ protected:
     {
         daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
     }
+
+    /** \private */
+    void checkWeights(size_t nCandidates, int method) const
+    {
+        if(method != parallelPlusDense) { return; }
+
+        services::SharedPtr<data_management::NumericTable> pWeights = get(partialClustersWeights);
+        if(pWeights.get() == 0)                     { this->_errors->add(services::ErrorNullOutputNumericTable); return;        }
+        if(pWeights->getNumberOfRows() != nCandidates) { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+        if(pWeights->getNumberOfColumns() != 1)     { this->_errors->add(services::ErrorInconsistentNumberOfColumns); return;   }
+    }
 };
 
 /**
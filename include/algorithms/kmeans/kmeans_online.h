@@ -0,0 +1,243 @@
+/* file: kmeans_online.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the K-Means algorithm in the online
+//  processing mode
+//--
+*/
+
+#ifndef __KMEANS_ONLINE_H__
+#define __KMEANS_ONLINE_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/kmeans/kmeans_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace kmeans
+{
+
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__ONLINECONTAINER"></a>
+ * \brief Provides methods to run implementations of the K-Means algorithm.
+ *        This class is associated with the daal::algorithms::kmeans::Online class
+ *        and supports the method of K-Means computation in the online processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of K-Means, double or float
+ * \tparam method           Computation method of the algorithm, \ref daal::algorithms::kmeans::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT OnlineContainer : public daal::algorithms::AnalysisContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for the K-Means algorithm with a specified environment
+     * in the online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~OnlineContainer();
+    /**
+     * Updates the centroids of the K-Means algorithm with a block of data in the online processing mode
+     */
+    virtual void compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of the K-Means algorithm in the online processing mode
+     */
+    virtual void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__KMEANS__ONLINE"></a>
+ * \brief Computes the results of the K-Means algorithm in the online processing mode.
+ *        Every call of compute() assigns a block of observations to the nearest centroids
+ *        and moves each centroid towards the mean of its observations with the learning rate
+ *        equal to the reciprocal of the number of observations assigned to it so far (mini-batch K-Means).
+ *        The memory footprint and the cost of a call do not depend on the number of processed blocks
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of K-Means, double or float
+ * \tparam method           Computation method of the algorithm, \ref Method
+ *
+ * \par Enumerations
+ *      - \ref Method                   Computation methods for the K-Means algorithm
+ *      - \ref InputId                  Identifiers of input objects for the K-Means algorithm
+ *      - \ref OnlinePartialResultId    Identifiers of partial results of the K-Means algorithm in the online processing mode
+ *      - \ref ResultId                 Identifiers of results of the K-Means algorithm
+ *
+ * \par References
+ *      - <a href="DAAL-REF-KMEANS-ALGORITHM">K-Means algorithm description and usage models</a>
+ *      - Input class
+ *      - OnlinePartialResult class
+ *      - Result class
+ */
+template<typename algorithmFPType = double, Method method = lloydDense>
+class DAAL_EXPORT Online : public daal::algorithms::Analysis<online>
+{
+public:
+    typedef OnlinePartialResult PartialResult;
+
+    /**
+     *  Main constructor
+     *  \param[in] nClusters   Number of clusters
+     */
+    Online(size_t nClusters) : parameter(nClusters, 1)
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs a K-Means algorithm by copying input objects and parameters
+     * of another K-Means algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Online(const Online<algorithmFPType, method> &other) : parameter(other.parameter)
+    {
+        initialize();
+        input.set(data, other.input.get(data));
+        input.set(inputCentroids, other.input.get(inputCentroids));
+    }
+
+    /**
+    * Returns the method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int) method; }
+
+    /**
+     * Returns the structure that contains the results of the K-Means algorithm
+     * \return Structure that contains the results of the K-Means algorithm
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store the results of the K-Means algorithm
+     * \param[in] result  Structure to store the results of the K-Means algorithm
+     */
+    void setResult(const services::SharedPtr<Result>& result)
+    {
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the K-Means algorithm
+     * \return Structure that contains partial results of the K-Means algorithm
+     */
+    services::SharedPtr<PartialResult> getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store partial results of the K-Means algorithm
+     * \param[in] partialResult Structure to store partial results of the K-Means algorithm
+     * \param[in] initFlag      Flag that specifies whether the partial results are initialized,
+     *                          set it to resume the computations from a restored partial result
+     */
+    void setPartialResult(const services::SharedPtr<PartialResult>& partialResult, bool initFlag = false)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(initFlag);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated K-Means algorithm with a copy of input objects
+     * and parameters of this K-Means algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Online<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Online<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Online<algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result = services::SharedPtr<Result>(new Result());
+        _result->allocate<algorithmFPType>(_in, _par, (int) method);
+        _res = _result.get();
+    }
+
+    virtual void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult = services::SharedPtr<PartialResult>(new PartialResult());
+        _partialResult->allocate<algorithmFPType>(_in, _par, (int) method);
+        _pres = _partialResult.get();
+    }
+
+    virtual void initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->initialize<algorithmFPType>(_in);
+    }
+
+    /* The result is checked against the last data block, the assignments are computed for it */
+    virtual void checkFinalizeComputeParams() DAAL_C11_OVERRIDE
+    {
+        if(_res)
+        {
+            _res->check(_in, _par, getMethod());
+        }
+
+        if(_errors->size() != 0)
+        {
+            throwIfPossible();
+            return;
+        }
+    }
+
+    void initialize()
+    {
+        Analysis<online>::_ac = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+    }
+
+public:
+    Input input;            /*!< %Input data structure */
+    Parameter parameter;    /*!< K-Means parameters structure */
+
+private:
+    services::SharedPtr<PartialResult> _partialResult;
+    services::SharedPtr<Result> _result;
+};
+} // namespace interface1
+using interface1::OnlineContainer;
+using interface1::Online;
+
+} // namespace daal::algorithms::kmeans
+} // namespace daal::algorithms
+} // namespace daal
+#endif
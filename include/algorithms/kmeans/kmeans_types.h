@@ -44,7 +44,10 @@ enum Method
 {
     lloydDense = 0,     /*!< Default: performance-oriented method, synonym of defaultDense */
     defaultDense = 0,   /*!< Default: performance-oriented method, synonym of lloydDense */
-    lloydCSR = 1        /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    lloydCSR = 1,       /*!< Implementation of the Lloyd algorithm for CSR numeric tables */
+    lloydElkanDense = 2 /*!< Lloyd algorithm for dense data accelerated with the triangle inequality:
+                             per-observation distance bounds and centroid drifts let the algorithm skip
+                             most distance computations once the clusters stabilize */
 };
 
 /**
@@ -87,6 +90,18 @@ enum PartialResultId
     partialAssignments  = 3   /*!< Table containing assignments of observations to particular clusters */
 };
 
+/**
+ * <a name="DAAL-ENUM-KMEANS__ONLINEPARTIALRESULTID"></a>
+ * \brief Available identifiers of partial results of the K-Means algorithm in the online processing mode
+ */
+enum OnlinePartialResultId
+{
+    currentCentroids  = 0,  /*!< Table containing centroids updated with the data blocks processed so far */
+    clusterCounts     = 1,  /*!< Table containing the number of observations assigned to centroids so far */
+    blockGoalFunction = 2,  /*!< Table containing a goal function value for the last processed data block */
+    nProcessedBlocks  = 3   /*!< Table containing the number of processed data blocks */
+};
+
 /**
  * <a name="DAAL-ENUM-KMEANS__RESULTID"></a>
  * \brief Available identifiers of results of the K-Means algorithm
@@ -402,6 +417,205 @@ protected:
     }
 };
 
+/**
+ * <a name="DAAL-CLASS-KMEANS__ONLINEPARTIALRESULT"></a>
+ * \brief Partial results obtained with the compute() method of the K-Means algorithm in the online processing mode.
+ *        Each data block moves the centroids towards the means of the observations assigned to them
+ *        with per-centroid learning rates equal to the reciprocal of the running cluster counts
+ */
+class OnlinePartialResult : public daal::algorithms::PartialResult
+{
+public:
+    OnlinePartialResult() : daal::algorithms::PartialResult(4) {}
+
+    virtual ~OnlinePartialResult() {};
+
+    /**
+     * Allocates memory to store partial results of the K-Means algorithm in the online processing mode
+     * \param[in] input        Pointer to the structure of the input objects
+     * \param[in] parameter    Pointer to the structure of the algorithm parameters
+     * \param[in] method       Computation method of the algorithm
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        const Parameter *kmPar = static_cast<const Parameter *>(parameter);
+
+        size_t nFeatures = static_cast<const InputIface *>(input)->getNumberOfFeatures();
+        size_t nClusters = kmPar->nClusters;
+
+        Argument::set(currentCentroids, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(nFeatures, nClusters,
+                                                                                    data_management::NumericTable::doAllocate)));
+        Argument::set(clusterCounts, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(1, nClusters, data_management::NumericTable::doAllocate)));
+        Argument::set(blockGoalFunction, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(1, 1, data_management::NumericTable::doAllocate)));
+        Argument::set(nProcessedBlocks, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<int>(1, 1, data_management::NumericTable::doAllocate)));
+    }
+
+    /**
+     * Initializes partial results of the K-Means algorithm in the online processing mode:
+     * copies the initial centroids from the input and resets the counters
+     * \param[in] input        Pointer to the structure of the input objects
+     */
+    template <typename algorithmFPType>
+    void initialize(const daal::algorithms::Input *input)
+    {
+        const Input *algInput = static_cast<const Input *>(input);
+        data_management::NumericTable *inCentroids = algInput->get(inputCentroids).get();
+        data_management::NumericTable *centroidsTable = get(currentCentroids).get();
+
+        size_t nRows = centroidsTable->getNumberOfRows();
+        size_t nCols = centroidsTable->getNumberOfColumns();
+
+        data_management::BlockDescriptor<algorithmFPType> inBlock, outBlock;
+        inCentroids->getBlockOfRows(0, nRows, data_management::readOnly, inBlock);
+        centroidsTable->getBlockOfRows(0, nRows, data_management::writeOnly, outBlock);
+
+        const algorithmFPType *inData = inBlock.getBlockPtr();
+        algorithmFPType *outData = outBlock.getBlockPtr();
+        for(size_t i = 0; i < nCols * nRows; i++)
+        {
+            outData[i] = inData[i];
+        }
+
+        centroidsTable->releaseBlockOfRows(outBlock);
+        inCentroids->releaseBlockOfRows(inBlock);
+
+        setToZero<algorithmFPType>(get(clusterCounts).get());
+        setToZero<algorithmFPType>(get(blockGoalFunction).get());
+        setToZero<int>(get(nProcessedBlocks).get());
+    }
+
+    /**
+     * Returns a partial result of the K-Means algorithm in the online processing mode
+     * \param[in] id   Identifier of the partial result
+     * \return         Partial result that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(OnlinePartialResultId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets a partial result of the K-Means algorithm in the online processing mode
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the object
+     */
+    void set(OnlinePartialResultId id, const services::SharedPtr<data_management::NumericTable> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
+    /**
+    * Returns the number of features in the Input data table
+    * \return Number of features in the Input data table
+    */
+    size_t getNumberOfFeatures() const
+    {
+        services::SharedPtr<data_management::NumericTable> centroidsTable = get(currentCentroids);
+        return centroidsTable->getNumberOfColumns();
+    }
+
+    /**
+    * Checks partial results of the K-Means algorithm in the online processing mode
+    * \param[in] input   %Input object of the algorithm
+    * \param[in] par     Algorithm parameter
+    * \param[in] method  Computation method
+    */
+    void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par,
+               int method) const DAAL_C11_OVERRIDE
+    {
+        check(par, method);
+        if(this->_errors->size() != 0) { return; }
+
+        size_t inputFeatures = static_cast<const InputIface *>(input)->getNumberOfFeatures();
+        if(getNumberOfFeatures() != inputFeatures) { this->_errors->add(services::ErrorInconsistentNumberOfColumns); return; }
+    }
+
+    /**
+    * Checks partial results of the K-Means algorithm in the online processing mode
+    * \param[in] par     Algorithm parameter
+    * \param[in] method  Computation method
+    */
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        if(Argument::size() != 4)
+        { this->_errors->add(services::ErrorIncorrectNumberOfOutputNumericTables); return; }
+
+        const Parameter *kmPar = static_cast<const Parameter *>(par);
+
+        services::SharedPtr<data_management::NumericTable> pCentroids = get(currentCentroids);
+        if(pCentroids.get() == 0)                             { this->_errors->add(services::ErrorNullOutputNumericTable); return;        }
+        if(pCentroids->getNumberOfRows() != kmPar->nClusters) { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+        if(pCentroids->getNumberOfColumns() == 0)             { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return;     }
+
+        services::SharedPtr<data_management::NumericTable> pCounts = get(clusterCounts);
+        if(pCounts.get() == 0)                             { this->_errors->add(services::ErrorNullOutputNumericTable); return;        }
+        if(pCounts->getNumberOfRows() != kmPar->nClusters) { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+        if(pCounts->getNumberOfColumns() != 1)             { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return;     }
+
+        services::SharedPtr<data_management::NumericTable> pGoal = get(blockGoalFunction);
+        if(pGoal.get() == 0)                 { this->_errors->add(services::ErrorNullOutputNumericTable); return;        }
+        if(pGoal->getNumberOfRows() != 1)    { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+        if(pGoal->getNumberOfColumns() != 1) { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return;     }
+
+        services::SharedPtr<data_management::NumericTable> pBlocks = get(nProcessedBlocks);
+        if(pBlocks.get() == 0)                 { this->_errors->add(services::ErrorNullOutputNumericTable); return;        }
+        if(pBlocks->getNumberOfRows() != 1)    { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+        if(pBlocks->getNumberOfColumns() != 1) { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return;     }
+    }
+
+     /**
+     * Returns the serialization tag of a partial result
+     * \return         Serialization tag of the partial result
+     */
+    int getSerializationTag() DAAL_C11_OVERRIDE  { return SERIALIZATION_KMEANS_ONLINE_PARTIAL_RESULT_ID; }
+
+    /**
+    *  Serializes an object
+    *  \param[in]  arch  Storage for a serialized object or data structure
+    */
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    /**
+    *  Deserializes an object
+    *  \param[in]  arch  Storage for a deserialized object or data structure
+    */
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    /** \private */
+    template<typename T>
+    void setToZero(data_management::NumericTable *table)
+    {
+        data_management::BlockDescriptor<T> block;
+        size_t nCols = table->getNumberOfColumns();
+        size_t nRows = table->getNumberOfRows();
+
+        table->getBlockOfRows(0, nRows, data_management::writeOnly, block);
+        T *tableData = block.getBlockPtr();
+
+        for(size_t i = 0; i < nCols * nRows; i++)
+        {
+            tableData[i] = 0;
+        }
+
+        table->releaseBlockOfRows(block);
+    }
+};
+
 /**
  * <a name="DAAL-CLASS-KMEANS__RESULT"></a>
  * \brief Results obtained with the compute() method of the K-Means algorithm in the batch processing mode
@@ -677,6 +891,7 @@ using interface1::Parameter;
 using interface1::InputIface;
 using interface1::Input;
 using interface1::PartialResult;
+using interface1::OnlinePartialResult;
 using interface1::Result;
 using interface1::DistributedStep2MasterInput;
 
@@ -128,7 +128,8 @@ public:
     /**
      *  Default constructor
      */
-    Parameter() : groupDimension(1), spatialDimensions(2, 3), kernelSize(2, 2), stride(1, 1), padding(0, 0), nKernels(1), nGroups(1) {}
+    Parameter() : groupDimension(1), spatialDimensions(2, 3), kernelSize(2, 2), stride(1, 1), padding(0, 0), nKernels(1), nGroups(1),
+        predictionStage(false) {}
 
     SpatialDimensions spatialDimensions; /*!< Data structure representing the dimension for convolution kernels. (2,3) is supported now */
     size_t groupDimension; /*!< Dimension for which the grouping is applied. groupDimension=1 is supported now */
@@ -137,6 +138,9 @@ public:
     Padding padding;       /*!< Data structure representing the number of data to be implicitly added to the subtensor */
     size_t nKernels;       /*!< Number of kernels applied to the input layer data */
     size_t nGroups;        /*!< Number of groups which the input data is split in groupDimension dimension */
+    bool predictionStage;  /*!< Flag that specifies whether the layer is used for the prediction stage or not.
+                                At the prediction stage weights and biases converted to the internal layout
+                                are reused until the layer gets other weights or biases tensors */
 };
 
 } // namespace interface1
@@ -27,6 +27,7 @@
 #include "algorithms/algorithm.h"
 #include "data_management/data/tensor.h"
 #include "data_management/data/homogen_tensor.h"
+#include "data_management/data/homogen_numeric_table.h"
 #include "services/daal_defines.h"
 #include "algorithms/neural_networks/layers/layer_backward_types.h"
 #include "algorithms/neural_networks/layers/pooling1d/pooling1d_layer_backward_types.h"
@@ -94,6 +95,28 @@ public:
         (*inputData)[id] = ptr;
     }
 
+    /**
+     * Returns an input object for backward maximum 1D pooling layer
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(LayerDataNumericTableId id) const
+    {
+        services::SharedPtr<layers::LayerData> inputData = get(layers::backward::inputFromForward);
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>((*inputData)[id]);
+    }
+
+    /**
+     * Sets an input object for the backward maximum 1D pooling layer
+     * \param[in] id  Identifier of the input object
+     * \param[in] ptr Pointer to the object
+     */
+    void set(LayerDataNumericTableId id, const services::SharedPtr<data_management::NumericTable> &ptr)
+    {
+        services::SharedPtr<layers::LayerData> inputData = get(layers::backward::inputFromForward);
+        (*inputData)[id] = ptr;
+    }
+
     /**
      * Checks an input object for the backward maximum 1D pooling layer
      * \param[in] parameter Algorithm parameter
@@ -102,6 +125,11 @@ public:
     void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE
     {
         pooling1d::backward::Input::check(parameter, method);
+        if( this->_errors->size() > 0 ) { return; }
+
+        const services::Collection<size_t> &inputGradientDims = get(layers::backward::inputGradient)->getDimensions();
+        if (!data_management::checkTensor(get(auxSelectedIndices).get(), this->_errors.get(), strAuxSelectedIndices(),
+                                          &inputGradientDims)) { return; }
     }
 
     /**
@@ -110,8 +138,20 @@ public:
      */
     virtual services::Collection<size_t> getGradientSize() const DAAL_C11_OVERRIDE
     {
-        if (!data_management::checkTensor(get(auxMask).get(), this->_errors.get(), strAuxMask())) { return services::Collection<size_t>(); }
-        return get(auxMask)->getDimensions();
+        services::Collection<size_t> dims;
+        services::SharedPtr<data_management::NumericTable> inputDims = get(auxInputDimensions);
+        if (!inputDims)
+        { this->_errors->add(services::ErrorNullInputNumericTable); return dims; }
+
+        data_management::BlockDescriptor<int> block;
+        inputDims->getBlockOfRows(0, 1, data_management::readOnly, block);
+        int *inputDimsArray = block.getBlockPtr();
+        for(size_t i = 0; i < inputDims->getNumberOfColumns(); i++)
+        {
+            dims.push_back((size_t) inputDimsArray[i]);
+        }
+        inputDims->releaseBlockOfRows(block);
+        return dims;
     }
 
 protected:
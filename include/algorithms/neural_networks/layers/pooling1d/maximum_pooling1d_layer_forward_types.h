@@ -27,6 +27,7 @@
 #include "algorithms/algorithm.h"
 #include "data_management/data/tensor.h"
 #include "data_management/data/homogen_tensor.h"
+#include "data_management/data/homogen_numeric_table.h"
 #include "services/daal_defines.h"
 #include "algorithms/neural_networks/layers/pooling1d/maximum_pooling1d_layer_types.h"
 #include "algorithms/neural_networks/layers/pooling1d/pooling1d_layer_forward_types.h"
@@ -92,8 +93,11 @@ public:
         const Input *in = static_cast<const Input *>(input);
 
         const services::Collection<size_t> &dataDims = in->get(layers::forward::data)->getDimensions();
-        set(auxMask, services::SharedPtr<data_management::Tensor>(
-                new data_management::HomogenTensor<algorithmFPType>(dataDims, data_management::Tensor::doAllocate)));
+        const services::Collection<size_t> &valueDims = get(layers::forward::value)->getDimensions();
+        set(auxSelectedIndices, services::SharedPtr<data_management::Tensor>(
+                new data_management::HomogenTensor<int>(valueDims, data_management::Tensor::doAllocate)));
+        set(auxInputDimensions, services::SharedPtr<data_management::NumericTable>(
+                new data_management::HomogenNumericTable<int>(dataDims.size(), 1, data_management::NumericTableIface::doAllocate, 0)));
     }
 
     /**
@@ -118,6 +122,28 @@ public:
         (*layerData)[id] = ptr;
     }
 
+    /**
+     * Returns the result of the forward maximum 1D pooling layer
+     * \param[in] id    Identifier of the result
+     * \return          Result that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(LayerDataNumericTableId id) const
+    {
+        services::SharedPtr<layers::LayerData> layerData = get(layers::forward::resultForBackward);
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>((*layerData)[id]);
+    }
+
+    /**
+     * Sets the result of the forward maximum 1D pooling layer
+     * \param[in] id Identifier of the result
+     * \param[in] ptr Result
+     */
+    void set(LayerDataNumericTableId id, const services::SharedPtr<data_management::NumericTable> &ptr)
+    {
+        services::SharedPtr<layers::LayerData> layerData = get(layers::forward::resultForBackward);
+        (*layerData)[id] = ptr;
+    }
+
     /**
      * Checks the result of the forward maximum 1D pooling layer
      * \param[in] input     %Input of the layer
@@ -54,7 +54,17 @@ enum Method
  */
 enum LayerDataId
 {
-    auxMask = 0         /*!< p-dimensional tensor that stores forward maximum pooling layer results */
+    auxSelectedIndices = 0  /*!< p-dimensional tensor of the size of the forward layer result that stores the positions
+                                 of the maximum elements selected in the input data tensor, -1 if the padding is selected */
+};
+
+/**
+ * \brief Identifiers of input numeric tables for the backward maximum 3D pooling layer
+ *        and results for the forward maximum 3D pooling layer
+ */
+enum LayerDataNumericTableId
+{
+    auxInputDimensions = 1  /*!< Numeric table of size 1 x p that stores the sizes of the dimensions of input data tensor */
 };
 
 /**
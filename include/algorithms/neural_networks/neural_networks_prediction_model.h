@@ -54,7 +54,19 @@ namespace interface1
  *  \brief Class representing the parameters of neural network prediction
  */
 class Parameter : public daal::algorithms::Parameter
-{};
+{
+public:
+    /**
+     * Constructs the parameters of neural network prediction
+     * \param[in] layoutPropagation_  Flag. If true, the tensors passed between the adjacent layers that use
+     *                                the same internal data layout are kept in that layout
+     */
+    Parameter(bool layoutPropagation_ = false) : layoutPropagation(layoutPropagation_) {}
+
+    bool layoutPropagation; /*!< Flag. If true, the tensors passed between the adjacent layers that use the same
+                                 internal data layout are kept in that layout and converted only on access
+                                 by other layers */
+};
 
 /**
 * <a name="DAAL-CLASS-ALGORITHMS__NEURAL_NETWORKS__PREDICTION__MODEL"></a>
@@ -65,15 +65,22 @@ public:
      * Constructs the parameters of neural network algorithm
      * \param[in] batchSize_                  Size of the batch to be processed by the neural network
      * \param[in] optimizationSolver_         Optimization solver used in the neural network
+     * \param[in] layoutPropagation_          Flag. If true, the tensors passed between the adjacent layers that use
+     *                                        the same internal data layout are kept in that layout
      */
     Parameter(size_t batchSize_ = 1,
               services::SharedPtr<optimization_solver::iterative_solver::Batch > optimizationSolver_ =
-                  services::SharedPtr<optimization_solver::iterative_solver::Batch>(new optimization_solver::sgd::Batch<float>())) :
-        batchSize(batchSize_), optimizationSolver(optimizationSolver_) {};
+                  services::SharedPtr<optimization_solver::iterative_solver::Batch>(new optimization_solver::sgd::Batch<float>()),
+              bool layoutPropagation_ = false) :
+        batchSize(batchSize_), optimizationSolver(optimizationSolver_), layoutPropagation(layoutPropagation_) {};
 
     size_t batchSize; /*!< Size of the batch to be processed by the neural network. */
 
     services::SharedPtr<optimization_solver::iterative_solver::Batch>  optimizationSolver; /*!< Optimization solver used in the neural network*/
+
+    bool layoutPropagation; /*!< Flag. If true, the tensors passed between the adjacent layers that use the same
+                                 internal data layout are kept in that layout and converted only on access
+                                 by other layers */
 };
 
 /**
@@ -85,6 +85,26 @@ public:
     void compute() DAAL_C11_OVERRIDE;
 };
 
+/**
+ * \brief Class containing methods to compute the results of the PCA algorithm */
+template<typename algorithmFPType, CpuType cpu>
+class DAAL_EXPORT BatchContainer<algorithmFPType, randomizedDense, cpu> : public AnalysisContainerIface<batch>
+{
+public:
+    /**
+     * Constructs a container for the PCA algorithm with a specified environment
+     * in the batch processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~BatchContainer();
+    /**
+     * Computes the result of the PCA algorithm in the batch processing mode
+     */
+    void compute() DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__PCA__OFFLINE"></a>
  * \brief Computes the results of the PCA algorithm
@@ -130,6 +130,47 @@ public:
     void finalizeCompute() DAAL_C11_OVERRIDE;
 };
 
+/**
+ * \brief Class containing methods to compute the results of the PCA algorithm on the local node
+ */
+template<typename algorithmFPType, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step1Local, algorithmFPType, randomizedDense, cpu> : public
+    OnlineContainer<algorithmFPType, randomizedDense, cpu>
+{
+public:
+    /** \brief Constructor */
+    DistributedContainer(daal::services::Environment::env *daalEnv) : OnlineContainer<algorithmFPType, randomizedDense, cpu>(daalEnv) {};
+    virtual ~DistributedContainer() {}
+};
+
+/**
+ * \brief Class containing methods to compute the results of the PCA algorithm on the master node
+ */
+template<typename algorithmFPType, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step2Master, algorithmFPType, randomizedDense, cpu> : public AnalysisContainerIface<distributed>
+{
+public:
+    /**
+     * Constructs a container for the PCA algorithm with a specified environment
+     * in the second step of the distributed processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    ~DistributedContainer();
+
+    /**
+     * Computes a partial result of the PCA algorithm in the second step
+     * of the distributed processing mode
+     */
+    void compute() DAAL_C11_OVERRIDE;
+    /**
+     * Computes the result of the PCA algorithm in the second step
+     * of the distributed processing mode
+     */
+    void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTED"></a>
  * \brief Computes the result of the PCA algorithm
@@ -445,6 +486,136 @@ protected:
         _result = services::SharedPtr<Result>(new Result());
     }
 };
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTED_RANDOMIZEDDENSE"></a>
+ * \brief Computes the result of the PCA randomized algorithm on the master node
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the PCA algorithm, double or float
+ *
+ * \par References
+ *      - <a href="DAAL-REF-PCA-ALGORITHM">PCA algorithm description and usage models</a>
+ *      - \ref interface1::DistributedParameter class
+ */
+template<typename algorithmFPType>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, randomizedDense> : public Analysis<distributed>
+{
+public:
+    /** Default constructor */
+    Distributed()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs a PCA algorithm by copying input objects and parameters of another PCA algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, randomizedDense> &other)
+    {
+        initialize();
+        input.set(partialResults, other.input.get(partialResults));
+        parameter = other.parameter;
+    }
+
+    ~Distributed() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)randomizedDense; }
+
+    /**
+     * Registers user-allocated memory to store  partial results of the PCA algorithm
+     * \param[in] partialResult    Structure for storing partial results of the PCA algorithm
+     */
+    void setPartialResult(const services::SharedPtr<PartialResultImpl<algorithmFPType, randomizedDense> >& partialResult)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+    }
+
+    /**
+     * Returns structure that contains computed partial results of the PCA algorithm
+     * \return Structure that contains partial results of the PCA algorithm
+     */
+    services::SharedPtr<PartialResultImpl<algorithmFPType, randomizedDense> > getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store the results of the PCA algorithm
+     * \param[in] res    Structure to store the results of the PCA algorithm
+     */
+    void setResult(const services::SharedPtr<Result>& res)
+    {
+        _result = res;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains the results of the PCA algorithm
+     * \return Structure that contains the results of the PCA algorithm
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Returns a pointer to the newly allocated PCA algorithm
+     * with a copy of input objects and parameters of this PCA algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, randomizedDense> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, randomizedDense> >(cloneImpl());
+    }
+
+    DistributedInput<randomizedDense> input; /*!< Input object */
+    DistributedParameter<step2Master, algorithmFPType, randomizedDense> parameter; /*!< Parameters */
+
+protected:
+    services::SharedPtr<PartialResultImpl<algorithmFPType, randomizedDense> > _partialResult;
+    services::SharedPtr<Result> _result;
+
+    virtual Distributed<step2Master, algorithmFPType, randomizedDense> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, randomizedDense>(*this);
+    }
+
+    void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_pres, &parameter, randomizedDense);
+        _res = _result.get();
+    }
+
+    void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate(&input, &parameter, randomizedDense);
+        _pres = _partialResult.get();
+    }
+
+    void initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        services::SharedPtr<PartialResult<randomizedDense> > pres
+        = services::staticPointerCast<PartialResult<randomizedDense>, PartialResultImpl<algorithmFPType, randomizedDense> >(_partialResult);
+        (*parameter.initializationProcedure)(Input(), pres);
+    }
+
+    void initialize()
+    {
+        _ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, randomizedDense)(&_env);
+        _in = &input;
+        _par = &parameter;
+        _partialResult = services::SharedPtr<PartialResultImpl<algorithmFPType, randomizedDense> >(
+                new PartialResultImpl<algorithmFPType, randomizedDense>());
+        _result = services::SharedPtr<Result>(new Result());
+    }
+};
 } // namespace interface1
 using interface1::DistributedContainer;
 using interface1::Distributed;
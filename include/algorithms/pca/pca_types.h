@@ -49,7 +49,8 @@ enum Method
 {
     correlationDense = 0, /*!< PCA Correlation method */
     defaultDense = 0, /*!< PCA Default method */
-    svdDense = 1 /*!< PCA SVD method */
+    svdDense = 1, /*!< PCA SVD method */
+    randomizedDense = 2 /*!< PCA randomized method: range finder applied to a sketch of the correlation matrix */
 };
 
 /**
@@ -111,6 +112,19 @@ enum PartialSVDCollectionResultId
     distributedInputs = 4 /*!< Auxiliary data of the PCA SVD method on the second step in the distributed processing mode */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__PCA__PARTIAL_RANDOMIZED_RESULT_ID"></a>
+ * Available identifiers of partial results of the PCA randomized algorithm
+ */
+enum PartialRandomizedResultId
+{
+    nObservationsRandomized = 0, /* Number of processed observations */
+    sumRandomized = 1, /* Feature sums of the processed data */
+    sumSquaresRandomized = 2, /* Feature sums of squares of the processed data */
+    sketchRandomized = 3 /* Cross-product of the processed data multiplied by the random test matrix,
+                            one row per test vector */
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__PCA__PARTIAL_SVD_TABLE_RESULT_ID"></a>
  * Available identifiers of the results of the PCA algorithm
@@ -126,6 +140,29 @@ enum ResultId
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__PARAMETERBASE"></a>
+ * \brief Class that specifies the parameters common for all methods and computation modes of the PCA algorithm
+ */
+class ParameterBase : public daal::algorithms::Parameter
+{
+public:
+    /** Constructs PCA parameters */
+    ParameterBase() : nComponents(0) {};
+
+    /**
+     * Returns the number of principal components to compute for the data set with the given number of features
+     * \param[in] nFeatures  Number of features in the data set
+     * \return Number of principal components
+     */
+    size_t getNumberOfComponents(size_t nFeatures) const
+    {
+        return (nComponents == 0 || nComponents > nFeatures) ? nFeatures : nComponents;
+    }
+
+    size_t nComponents; /*!< Number of principal components to compute. If 0, all the components are computed */
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__PCA__INPUT_IFACE"></a>
  * \brief Abstract class that specifies interface for classes that declare input of the PCA algorithm */
@@ -224,6 +261,8 @@ public:
         { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
         if(inTable->getNumberOfColumns() == 0)
         { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return; }
+        if(par != 0 && static_cast<const ParameterBase *>(par)->nComponents > inTable->getNumberOfColumns())
+        { this->_errors->add(services::ErrorPCAIncorrectNumberOfComponents); return; }
     }
 };
 
@@ -555,6 +594,133 @@ protected:
     }
 };
 
+/**
+ * <a name="DAAL-CLASS-PCA__PARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of the PCA randomized algorithm
+ *         in the online or distributed processing mode
+ */
+template<> class PartialResult<randomizedDense> : public PartialResultBase
+{
+public:
+    PartialResult() : PartialResultBase(4) {};
+
+    virtual ~PartialResult() {};
+
+    /**
+     * Gets partial results of the PCA randomized algorithm
+     * \param[in] id    Identifier of the partial result
+     * \return          Partial result that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(PartialRandomizedResultId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    virtual size_t getNFeatures() const DAAL_C11_OVERRIDE { return get(sumRandomized)->getNumberOfColumns(); }
+
+    /**
+     * Sets partial result of the PCA randomized algorithm
+     * \param[in] id      Identifier of the partial result
+     * \param[in] value   Pointer to the object
+     */
+    void set(PartialRandomizedResultId id, const services::SharedPtr<data_management::NumericTable> &value)
+    {
+        Argument::set(id, value);
+    }
+
+    /**
+    * Checks partial results of the PCA randomized algorithm
+    * \param[in] input      %Input object of the algorithm
+    * \param[in] parameter  Algorithm %parameter
+    * \param[in] method     Computation method
+    */
+    void check(const daal::algorithms::Input *input,
+               const daal::algorithms::Parameter *parameter,
+               int method) const DAAL_C11_OVERRIDE
+    {
+        size_t nFeatures = (static_cast<const InputIface *>(input))->getNFeatures();
+        checkTables(nFeatures, parameter);
+    }
+
+    /**
+    * Checks partial results of the PCA randomized algorithm
+    * \param[in] par        %Parameter of algorithm
+    * \param[in] method     Computation method
+    */
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        services::SharedPtr<data_management::NumericTable> sumRandomized = get(pca::sumRandomized);
+        if(sumRandomized.get() == 0)
+        { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        checkTables(sumRandomized->getNumberOfColumns(), par);
+    }
+
+    int getSerializationTag() DAAL_C11_OVERRIDE  { return SERIALIZATION_PCA_PARTIAL_RESULT_RANDOMIZED_ID; }
+
+    /**
+    *  Serializes the object
+    *  \param[in]  arch  Storage for the serialized object or data structure
+    */
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    /**
+    *  Deserializes the object
+    *  \param[in]  arch  Storage for the deserialized object or data structure
+    */
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    /** \private */
+    void checkTables(size_t nFeatures, const daal::algorithms::Parameter *parameter) const
+    {
+        services::SharedPtr<data_management::NumericTable> nObservationsRandomized = get(pca::nObservationsRandomized);
+        if(nObservationsRandomized.get() == 0)
+        { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        if(nObservationsRandomized->getNumberOfColumns() != 1)
+        { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return; }
+        if(nObservationsRandomized->getNumberOfRows() != 1)
+        { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+
+        services::SharedPtr<data_management::NumericTable> sumRandomized = get(pca::sumRandomized);
+        if(sumRandomized.get() == 0)
+        { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        if(sumRandomized->getNumberOfColumns() != nFeatures)
+        { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return; }
+        if(sumRandomized->getNumberOfRows() != 1)
+        { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+
+        services::SharedPtr<data_management::NumericTable> sumSquaresRandomized = get(pca::sumSquaresRandomized);
+        if(sumSquaresRandomized.get() == 0)
+        { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        if(sumSquaresRandomized->getNumberOfColumns() != nFeatures)
+        { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return; }
+        if(sumSquaresRandomized->getNumberOfRows() != 1)
+        { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+
+        services::SharedPtr<data_management::NumericTable> sketchRandomized = get(pca::sketchRandomized);
+        if(sketchRandomized.get() == 0)
+        { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        if(sketchRandomized->getNumberOfColumns() != nFeatures)
+        { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return; }
+
+        size_t nComponents = (parameter ? static_cast<const ParameterBase *>(parameter)->getNumberOfComponents(nFeatures) : 1);
+        if(sketchRandomized->getNumberOfRows() < nComponents || sketchRandomized->getNumberOfRows() > nFeatures)
+        { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+    }
+};
+
+template<typename algorithmFPType, Method method = correlationDense>
+class BaseParameter;
+
 /**
  * <a name="DAAL-CLASS-PCA__PARTIALRESULTIMPL"></a>
  * \brief Provides methods to allocate partial results obtained with the compute() method of the PCA SVD algorithm
@@ -630,6 +796,42 @@ public:
     };
 };
 
+/**
+ * <a name="DAAL-CLASS-PCA__PARTIALRESULTIMPL"></a>
+ * \brief Provides methods to allocate partial results obtained with the compute() method of the PCA randomized algorithm
+ *         in the online or distributed processing mode
+ */
+template<typename algorithmFPType> class PartialResultImpl<algorithmFPType, randomizedDense> : public PartialResult<randomizedDense>
+{
+public:
+    PartialResultImpl<algorithmFPType, randomizedDense>() {};
+
+    /**
+     * Allocates memory for storing partial results of the PCA randomized algorithm
+     * \param[in] input     Pointer to an object containing input data
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        size_t nFeatures = (static_cast<const InputIface *>(input))->getNFeatures();
+        size_t nSketch = (static_cast<const BaseParameter<algorithmFPType, randomizedDense> *>(parameter))->getSketchSize(nFeatures);
+
+        set(nObservationsRandomized,
+            services::SharedPtr<data_management::NumericTable>(
+                new data_management::HomogenNumericTable<double>(1, 1, data_management::NumericTableIface::doAllocate, 0)));
+        set(sumRandomized,
+            services::SharedPtr<data_management::NumericTable>(
+                new data_management::HomogenNumericTable<double>(nFeatures, 1, data_management::NumericTableIface::doAllocate, 0)));
+        set(sumSquaresRandomized,
+            services::SharedPtr<data_management::NumericTable>(
+                new data_management::HomogenNumericTable<double>(nFeatures, 1, data_management::NumericTableIface::doAllocate, 0)));
+        set(sketchRandomized,
+            services::SharedPtr<data_management::NumericTable>(
+                new data_management::HomogenNumericTable<double>(nFeatures, nSketch, data_management::NumericTableIface::doAllocate, 0)));
+    };
+};
+
 /**
  * <a name="DAAL-CLASS-CLASS-PCA__PARTIALRESULTINITIFACE"></a>
  * \brief Abstract interface class for partial results initialization
@@ -718,12 +920,35 @@ template<> struct DefaultPartialResultsInit<svdDense> : public PartialResultsIni
     };
 };
 
+/**
+ * <a name="DAAL-CLASS-CLASS-PCA__DEFAULTPARTIALRESULTSINIT"></a>
+ * \brief Class that specifies the default method for partial results initialization
+ */
+template<> struct DefaultPartialResultsInit<randomizedDense> : public PartialResultsInitIface<randomizedDense>
+{
+    virtual ~DefaultPartialResultsInit() {}
+
+    /**
+     * Initialize partial results
+     * \param[in]       input     Input objects for the PCA algorithm
+     * \param[in,out]   pres      Partial results of the PCA algorithm
+     * \return                    Initialized partial results
+     */
+    void operator()(const Input &input, services::SharedPtr<PartialResult<randomizedDense> > &pres)
+    {
+        setToZero(pres->get(pca::nObservationsRandomized).get());
+        setToZero(pres->get(pca::sumRandomized).get());
+        setToZero(pres->get(pca::sumSquaresRandomized).get());
+        setToZero(pres->get(pca::sketchRandomized).get());
+    };
+};
+
 /**
  * <a name="DAAL-CLASS-CLASS-PCABASEPARAMETER__"></a>
  * \brief Class that specifies the common parameters of the PCA algorithm
  */
-template<typename algorithmFPType, Method method = correlationDense>
-class BaseParameter : public daal::algorithms::Parameter
+template<typename algorithmFPType, Method method>
+class BaseParameter : public ParameterBase
 {
 public:
     /** Constructs PCA parameters */
@@ -734,6 +959,38 @@ public:
     services::SharedPtr<PartialResultsInitIface<method> > initializationProcedure; /**< Functor for partial results initialization */
 };
 
+/**
+ * <a name="DAAL-CLASS-CLASS-PCABASEPARAMETER__"></a>
+ * \brief Class that specifies the common parameters of the PCA randomized algorithm
+ */
+template<typename algorithmFPType>
+class BaseParameter<algorithmFPType, randomizedDense> : public ParameterBase
+{
+public:
+    /** Constructs PCA parameters */
+    BaseParameter() :
+        initializationProcedure(services::SharedPtr<PartialResultsInitIface<randomizedDense> >(new DefaultPartialResultsInit<randomizedDense>())),
+        nOversamples(10), nPowerIterations(2), seed(777)
+    {};
+
+    /**
+     * Returns the number of random test vectors used to sketch the correlation matrix
+     * \param[in] nFeatures  Number of features in the data set
+     * \return Number of random test vectors
+     */
+    size_t getSketchSize(size_t nFeatures) const
+    {
+        size_t nSketch = getNumberOfComponents(nFeatures) + nOversamples;
+        return (nSketch > nFeatures ? nFeatures : nSketch);
+    }
+
+    services::SharedPtr<PartialResultsInitIface<randomizedDense> > initializationProcedure; /**< Functor for partial results initialization */
+    size_t nOversamples;     /*!< Number of random test vectors used in addition to the number of components */
+    size_t nPowerIterations; /*!< Number of power iterations. Each iteration makes one more pass over the data,
+                                  so it is used in the batch processing mode only */
+    int seed;                /*!< Seed of the random test matrix. Must be the same on all nodes in the distributed processing mode */
+};
+
 /**
  * <a name="DAAL-CLASS-CLASS-PCA__BATCHPARAMETER"></a>
  * \brief Class that specifies the parameters of the PCA algorithm in the batch computing mode
@@ -1058,6 +1315,123 @@ public:
     }
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__PCA__DISTRIBUTED_INPUT"></a>
+ * \brief Input objects of the PCA randomized algorithm in the distributed processing mode
+ */
+template<> class DistributedInput<randomizedDense> : public InputIface
+{
+public:
+    DistributedInput() : InputIface(1)
+    {
+        Argument::set(partialResults, services::SharedPtr<data_management::DataCollection>(new data_management::DataCollection()));
+    };
+
+    /**
+     * Sets input objects for the PCA on the second step in the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Input object that corresponds to the given identifier
+     */
+    void set(Step2MasterInputId id, const services::SharedPtr<data_management::DataCollection> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
+    /**
+     * Gets input objects for the PCA algorithm on the second step in the distributed processing mode
+     * \param[in] id    Identifier of the input object
+     * \return          Input object that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::DataCollection> get(Step2MasterInputId id) const
+    {
+        return services::staticPointerCast<data_management::DataCollection, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Adds input objects of the PCA algorithm on the second step in the distributed processing mode
+     * \param[in] id      Identifier of the input object
+     * \param[in] value   Pointer to the input object
+     */
+    void add(Step2MasterInputId id, const services::SharedPtr<PartialResult<randomizedDense> > &value)
+    {
+        services::SharedPtr<data_management::DataCollection> collection = get(id);
+        collection->push_back(value);
+    }
+
+    /**
+     * Retrieves specific partial result from the input objects of the PCA algorithm on the second step in the distributed processing mode
+     * \param[in] id      Identifier of the partial result
+     */
+    services::SharedPtr<PartialResult<randomizedDense> > getPartialResult(size_t id) const
+    {
+        services::SharedPtr<data_management::DataCollection> partialResultsCollection = get(partialResults);
+        if(partialResultsCollection->size() <= id)
+        {
+            return services::SharedPtr<PartialResult<randomizedDense> >();
+        }
+        return services::staticPointerCast<PartialResult<randomizedDense>, data_management::SerializationIface>((*partialResultsCollection)[id]);
+    }
+
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE
+    {
+        services::SharedPtr<data_management::DataCollection> collection = get(partialResults);
+        size_t nBlocks = collection->size();
+        if(nBlocks == 0)
+        { this->_errors->add(services::ErrorIncorrectNumberOfInputNumericTables); return; }
+
+        services::SharedPtr<PartialResult<randomizedDense> > firstPartialResult = getPartialResult(0);
+        if(firstPartialResult.get() == 0 || firstPartialResult->get(pca::sketchRandomized).get() == 0)
+        { this->_errors->add(services::ErrorNullPartialResult); return; }
+
+        size_t nFeatures = firstPartialResult->get(pca::sketchRandomized)->getNumberOfColumns();
+        size_t nSketch = firstPartialResult->get(pca::sketchRandomized)->getNumberOfRows();
+        if(nFeatures == 0)
+        { this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable); return; }
+        if(parameter != 0 && nSketch < static_cast<const ParameterBase *>(parameter)->getNumberOfComponents(nFeatures))
+        { this->_errors->add(services::ErrorPCAIncorrectNumberOfComponents); return; }
+
+        for(size_t j = 0; j < nBlocks; j++)
+        {
+            services::SharedPtr<PartialResult<randomizedDense> > partialResult = getPartialResult(j);
+            if(partialResult.get() == 0)
+            { this->_errors->add(services::ErrorNullPartialResult); return; }
+
+            services::SharedPtr<data_management::NumericTable> nObservationsRandomized = partialResult->get(pca::nObservationsRandomized);
+            if(nObservationsRandomized.get() == 0)
+            { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+            if((nObservationsRandomized->getNumberOfRows() != 1) || (nObservationsRandomized->getNumberOfColumns() != 1))
+            { this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable); return; }
+
+            services::SharedPtr<data_management::NumericTable> sumRandomized = partialResult->get(pca::sumRandomized);
+            if(sumRandomized.get() == 0)
+            { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+            if((sumRandomized->getNumberOfRows() != 1) || (sumRandomized->getNumberOfColumns() != nFeatures))
+            { this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable); return; }
+
+            services::SharedPtr<data_management::NumericTable> sumSquaresRandomized = partialResult->get(pca::sumSquaresRandomized);
+            if(sumSquaresRandomized.get() == 0)
+            { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+            if((sumSquaresRandomized->getNumberOfRows() != 1) || (sumSquaresRandomized->getNumberOfColumns() != nFeatures))
+            { this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable); return; }
+
+            services::SharedPtr<data_management::NumericTable> sketchRandomized = partialResult->get(pca::sketchRandomized);
+            if(sketchRandomized.get() == 0)
+            { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+            if((sketchRandomized->getNumberOfRows() != nSketch) || (sketchRandomized->getNumberOfColumns() != nFeatures))
+            { this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable); return; }
+        }
+    }
+
+    /**
+     * Returns the number of columns in the input data set
+     * \return Number of columns in the input data set
+     */
+    size_t getNFeatures() const DAAL_C11_OVERRIDE
+    {
+        return getPartialResult(0)->get(pca::sumRandomized)->getNumberOfColumns();
+    }
+};
+
 /**
  * <a name="DAAL-CLASS-PCA__RESULT"></a>
  * \brief Provides methods to access results obtained with the PCA algorithm
@@ -1100,13 +1474,14 @@ public:
     {
         const InputIface *in = static_cast<const InputIface *>(input);
         size_t nFeatures = in->getNFeatures();
+        size_t nComponents = static_cast<const ParameterBase *>(parameter)->getNumberOfComponents(nFeatures);
 
         set(eigenvalues,
             services::SharedPtr<data_management::NumericTable>(new data_management::HomogenNumericTable<algorithmFPType>
-                                                               (nFeatures, 1, data_management::NumericTableIface::doAllocate, 0)));
+                                                               (nComponents, 1, data_management::NumericTableIface::doAllocate, 0)));
         set(eigenvectors,
             services::SharedPtr<data_management::NumericTable>(new data_management::HomogenNumericTable<algorithmFPType>
-                                                               (nFeatures, nFeatures, data_management::NumericTableIface::doAllocate, 0)));
+                                                               (nFeatures, nComponents, data_management::NumericTableIface::doAllocate, 0)));
     }
 
     /**
@@ -1119,15 +1494,16 @@ public:
     {
         const PartialResultBase *partialRes = static_cast<const PartialResultBase *>(partialResult);
         size_t nFeatures = partialRes->getNFeatures();
+        size_t nComponents = static_cast<const ParameterBase *>(parameter)->getNumberOfComponents(nFeatures);
 
         set(eigenvalues,
             services::SharedPtr<data_management::NumericTable>(new data_management::HomogenNumericTable<algorithmFPType>
-                                                               (nFeatures, 1,
+                                                               (nComponents, 1,
                                                                 data_management::NumericTableIface::doAllocate, 0)));
         set(eigenvectors,
             services::SharedPtr<data_management::NumericTable>(new data_management::HomogenNumericTable<algorithmFPType>
                                                                (nFeatures,
-                                                                nFeatures, data_management::NumericTableIface::doAllocate, 0)));
+                                                                nComponents, data_management::NumericTableIface::doAllocate, 0)));
     }
 
     /**
@@ -1140,24 +1516,7 @@ public:
                int method) const DAAL_C11_OVERRIDE
     {
         const InputIface *input = static_cast<const InputIface *>(_input);
-        if(Argument::size() != 2)
-        { this->_errors->add(services::ErrorIncorrectNumberOfOutputNumericTables); return; }
-
-        services::SharedPtr<data_management::NumericTable> eigenvaluesTable = get(eigenvalues);
-        if(eigenvaluesTable.get() == 0)
-        { this->_errors->add(services::ErrorNullInputNumericTable); return; }
-        if(eigenvaluesTable->getNumberOfColumns() != input->getNFeatures())
-        { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return; }
-        if(eigenvaluesTable->getNumberOfRows() != 1)
-        { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
-
-        services::SharedPtr<data_management::NumericTable> eigenvectorsTable = get(eigenvectors);
-        if(eigenvectorsTable.get() == 0)
-        { this->_errors->add(services::ErrorNullInputNumericTable); return; }
-        if(eigenvectorsTable->getNumberOfColumns() != input->getNFeatures())
-        { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return; }
-        if(eigenvectorsTable->getNumberOfRows() != input->getNFeatures())
-        { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+        checkTables(input->getNFeatures(), par);
     }
 
     /**
@@ -1168,24 +1527,7 @@ public:
     */
     void check(const daal::algorithms::PartialResult *pr, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE
     {
-        if(Argument::size() != 2)
-        { this->_errors->add(services::ErrorIncorrectNumberOfOutputNumericTables); return; }
-
-        services::SharedPtr<data_management::NumericTable> eigenvaluesTable = get(eigenvalues);
-        if(eigenvaluesTable.get() == 0)
-        { this->_errors->add(services::ErrorNullInputNumericTable); return; }
-
-        size_t nFeatures = eigenvaluesTable->getNumberOfColumns();
-        if(eigenvaluesTable->getNumberOfRows() != 1)
-        { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
-
-        services::SharedPtr<data_management::NumericTable> eigenvectorsTable = get(eigenvectors);
-        if(eigenvectorsTable.get() == 0)
-        { this->_errors->add(services::ErrorNullInputNumericTable); return; }
-        if(eigenvectorsTable->getNumberOfColumns() != nFeatures)
-        { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return; }
-        if(eigenvectorsTable->getNumberOfRows() != nFeatures)
-        { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+        checkTables(static_cast<const PartialResultBase *>(pr)->getNFeatures(), parameter);
     }
 
     int getSerializationTag() DAAL_C11_OVERRIDE  { return SERIALIZATION_PCA_RESULT_ID; }
@@ -1211,8 +1553,34 @@ protected:
     {
         daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
     }
+
+    /** \private */
+    void checkTables(size_t nFeatures, const daal::algorithms::Parameter *parameter) const
+    {
+        if(Argument::size() != 2)
+        { this->_errors->add(services::ErrorIncorrectNumberOfOutputNumericTables); return; }
+
+        size_t nComponents = (parameter ? static_cast<const ParameterBase *>(parameter)->getNumberOfComponents(nFeatures) : nFeatures);
+
+        services::SharedPtr<data_management::NumericTable> eigenvaluesTable = get(eigenvalues);
+        if(eigenvaluesTable.get() == 0)
+        { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        if(eigenvaluesTable->getNumberOfColumns() != nComponents)
+        { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return; }
+        if(eigenvaluesTable->getNumberOfRows() != 1)
+        { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+
+        services::SharedPtr<data_management::NumericTable> eigenvectorsTable = get(eigenvectors);
+        if(eigenvectorsTable.get() == 0)
+        { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        if(eigenvectorsTable->getNumberOfColumns() != nFeatures)
+        { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return; }
+        if(eigenvectorsTable->getNumberOfRows() != nComponents)
+        { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+    }
 };
 } // namespace interface1
+using interface1::ParameterBase;
 using interface1::InputIface;
 using interface1::Input;
 using interface1::PartialResultBase;
@@ -1220,6 +1588,7 @@ using interface1::PartialResult;
 using interface1::PartialResultImpl;
 using interface1::PartialResultsInitIface;
 using interface1::DefaultPartialResultsInit;
+using interface1::BaseParameter;
 using interface1::BatchParameter;
 using interface1::OnlineParameter;
 using interface1::DistributedParameter;
@@ -238,6 +238,7 @@ public:
     {
         initialize();
         input.set(inputOfStep2FromStep1, other.input.get(inputOfStep2FromStep1));
+        input.set(inputOfStep2FromStep2, other.input.get(inputOfStep2FromStep2));
         parameter = other.parameter;
     }
 
@@ -290,6 +291,12 @@ public:
             _errors->add(services::ErrorNullResult);
             return;
         }
+
+        services::SharedPtr<Result> result = _partialResult->get(finalResultFromStep2Master);
+        if(result && result->get(matrixR))
+        {
+            input.checkInputFromParent(result->get(matrixR)->getNumberOfColumns());
+        }
     }
 
     /**
@@ -98,6 +98,17 @@ enum DistributedPartialResultId
     finalResultFromStep2Master = 1 /*!< Result object with R matrix */
 };
 
+/**
+ * <a name="DAAL-ENUM-QR__DISTRIBUTEDPARTIALRESULTTREEID"></a>
+ * Available types of partial results of the second step of the QR decomposition algorithm in the distributed processing mode
+ * when the second step is run as an intermediate node of the reduction tree
+ */
+enum DistributedPartialResultTreeId
+{
+    outputOfStep2ForStep2 = 2    /*!< Partial results of the QR decomposition algorithms to be transferred to the second step on the parent
+                                    * node of the reduction tree */
+};
+
 /**
  * <a name="DAAL-ENUM-QR__DISTRIBUTEDPARTIALRESULTSTEP3ID"></a>
  * Available types of partial results of the second step of the QR decomposition algorithm stored in Result object in the distributed processing mode
@@ -117,6 +128,16 @@ enum MasterInputId
                                   * second step in the distributed processing mode */
 };
 
+/**
+ * <a name="DAAL-ENUM-QR__MASTERINPUTTREEID"></a>
+ * Partial results from the parent node of the reduction tree required to finalize the second distributed step run as an intermediate node
+ */
+enum MasterInputTreeId
+{
+    inputOfStep2FromStep2 = 1  /*!< Partial results of the QR decomposition algorithms computed on the second step on the parent node of the
+                                  * reduction tree */
+};
+
 /**
  * <a name="DAAL-ENUM-QR__FINALIZEONLOCALINPUTID"></a>
  * Partial results from the previous steps in the distributed processing mode required by the third distributed step
@@ -188,7 +209,7 @@ class DistributedStep2Input : public daal::algorithms::Input
 {
 public:
     /** Default constructor */
-    DistributedStep2Input() : daal::algorithms::Input(1)
+    DistributedStep2Input() : daal::algorithms::Input(2)
     {
         Argument::set(inputOfStep2FromStep1,
                       services::SharedPtr<data_management::KeyValueDataCollection>(new data_management::KeyValueDataCollection()));
@@ -214,6 +235,26 @@ public:
         return services::staticPointerCast<data_management::KeyValueDataCollection, data_management::SerializationIface>(Argument::get(id));
     }
 
+    /**
+     * Sets input object received from the parent node of the reduction tree
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Input object that corresponds to the given identifier
+     */
+    void set(MasterInputTreeId id, const services::SharedPtr<data_management::DataCollection> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
+    /**
+     * Returns input object received from the parent node of the reduction tree
+     * \param[in] id    Identifier of the input object
+     * \return          Input object that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::DataCollection> get(MasterInputTreeId id) const
+    {
+        return services::staticPointerCast<data_management::DataCollection, data_management::SerializationIface>(Argument::get(id));
+    }
+
     /**
      * Adds input object to KeyValueDataCollection  of the QR decomposition algorithm
      * \param[in] id    Identifier of input object
@@ -295,6 +336,23 @@ public:
 
         if(nBlocks == 0) { this->_errors->add(services::ErrorIncorrectNumberOfElementsInInputCollection); return; }
     }
+
+    /**
+    * Checks the input object received from the parent node of the reduction tree
+    * \param[in] m  Number of columns in the input data set
+    */
+    void checkInputFromParent(size_t m) const
+    {
+        services::SharedPtr<data_management::DataCollection> parentDC = get(inputOfStep2FromStep2);
+        if(!parentDC || parentDC->size() == 0) { return; }
+        if(parentDC->size() != 1) { this->_errors->add(services::ErrorIncorrectNumberOfElementsInInputCollection); return; }
+
+        services::SharedPtr<data_management::NumericTable> mNT =
+            services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>((*parentDC)[0]);
+        if(!mNT) { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        if(mNT->getNumberOfRows() != m || mNT->getNumberOfColumns() != m)
+        { this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable); return; }
+    }
 };
 
 /**
@@ -699,7 +757,7 @@ class DistributedPartialResult : public daal::algorithms::PartialResult
 {
 public:
     /** Default constructor */
-    DistributedPartialResult() : daal::algorithms::PartialResult(2) {}
+    DistributedPartialResult() : daal::algorithms::PartialResult(3) {}
     /** Default destructor */
     virtual ~DistributedPartialResult() {}
 
@@ -715,6 +773,7 @@ public:
         Argument::set(outputOfStep2ForStep3,
                       services::SharedPtr<data_management::KeyValueDataCollection>(new data_management::KeyValueDataCollection()));
         Argument::set(finalResultFromStep2Master, services::SharedPtr<Result>(new Result()));
+        Argument::set(outputOfStep2ForStep2, services::SharedPtr<data_management::DataCollection>(new data_management::DataCollection()));
 
         services::SharedPtr<data_management::KeyValueDataCollection> inCollection = static_cast<const DistributedStep2Input *>(input)->get(
                                                                                         inputOfStep2FromStep1);
@@ -755,6 +814,19 @@ public:
             result->allocateImpl<algorithmFPType>(m, 0);
         }
 
+        /* The parent node of the reduction tree receives the R factor of this subtree */
+        services::SharedPtr<data_management::DataCollection> parentCollection =
+            services::staticPointerCast<data_management::DataCollection, data_management::SerializationIface>(Argument::get(outputOfStep2ForStep2));
+        if(!parentCollection)
+        {
+            parentCollection = services::SharedPtr<data_management::DataCollection>(new data_management::DataCollection());
+            Argument::set(outputOfStep2ForStep2, parentCollection);
+        }
+        if(parentCollection->size() == 0)
+        {
+            parentCollection->push_back(result->get(matrixR));
+        }
+
         nBlocks = 0;
         for(size_t i = 0 ; i < inSize ; i++)
         {
@@ -799,6 +871,26 @@ public:
         return services::staticPointerCast<Result, data_management::SerializationIface>(Argument::get(id));
     }
 
+    /**
+     * Returns partial result of the QR decomposition algorithm to be transferred to the parent node of the reduction tree
+     * \param[in] id    Identifier of the partial result
+     * \return          Partial result that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::DataCollection> get(DistributedPartialResultTreeId id) const
+    {
+        return services::staticPointerCast<data_management::DataCollection, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets DataCollection to store partial result of the QR decomposition algorithm to be transferred to the parent node of the reduction tree
+     * \param[in] id    Identifier of partial result
+     * \param[in] value Pointer to the DataCollection object
+     */
+    void set(DistributedPartialResultTreeId id, const services::SharedPtr<data_management::DataCollection> &value)
+    {
+        Argument::set(id, value);
+    }
+
     /**
      * Sets KeyValueDataCollection to store partial result of the QR decomposition algorithm
      * \param[in] id    Identifier of partial result
@@ -826,7 +918,7 @@ public:
     */
     void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE
     {
-        if(Argument::size() != 2)
+        if(Argument::size() != 3)
         { this->_errors->add(services::ErrorIncorrectNumberOfOutputNumericTables); return; }
     }
 
@@ -852,6 +944,12 @@ protected:
     void serialImpl(Archive *arch)
     {
         daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+
+        /* Partial results serialized before the reduction tree was supported have no outputOfStep2ForStep2 */
+        if(onDeserialize && Argument::size() == (size_t)outputOfStep2ForStep2)
+        {
+            Argument::operator <<(services::SharedPtr<data_management::DataCollection>(new data_management::DataCollection()));
+        }
     }
 };
 
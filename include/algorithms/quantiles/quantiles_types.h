@@ -24,7 +24,9 @@
 #ifndef __QUANTILES_TYPES_H__
 #define __QUANTILES_TYPES_H__
 
+#include "algorithms/algorithm.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/data_collection.h"
 
 namespace daal
 {
@@ -41,7 +43,9 @@ namespace quantiles
  */
 enum Method
 {
-    defaultDense = 0    /*!< Default: performance-oriented method. Works with all types of input numeric tables */
+    defaultDense = 0,   /*!< Default: performance-oriented method. Works with all types of input numeric tables */
+    sketchDense  = 1    /*!< Approximate quantiles computed in a single pass from a mergeable sketch of each feature.
+                             Supports batch, online, and distributed processing modes */
 };
 
 /**
@@ -62,6 +66,24 @@ enum ResultId
     quantiles = 0       /*!< Values of quantiles */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILES__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the quantiles algorithm computed with the sketchDense method
+ */
+enum PartialResultId
+{
+    sketches = 0        /*!< Table that contains the sketch of the distribution of each feature in the corresponding row */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILES__MASTERINPUTID"></a>
+ * Available identifiers of input objects for the quantiles algorithm on the master node
+ */
+enum MasterInputId
+{
+    partialResults = 0  /*!< Collection of partial results computed on local nodes */
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -73,8 +95,9 @@ namespace interface1
  */
 struct Parameter : public daal::algorithms::Parameter
 {
-    Parameter(const services::SharedPtr<data_management::NumericTable> quantileOrders = services::SharedPtr<data_management::NumericTable>())
-        : daal::algorithms::Parameter(), quantileOrders(quantileOrders)
+    Parameter(const services::SharedPtr<data_management::NumericTable> quantileOrders = services::SharedPtr<data_management::NumericTable>(),
+              double accuracy = 0.01)
+        : daal::algorithms::Parameter(), quantileOrders(quantileOrders), accuracy(accuracy)
     {
         if(quantileOrders.get() == NULL)
         {
@@ -84,6 +107,44 @@ struct Parameter : public daal::algorithms::Parameter
     }
 
     services::SharedPtr<data_management::NumericTable> quantileOrders;    /*!< Numeric table with quantile orders. Default value is 0.5 (median) */
+    double accuracy;    /*!< Target bound on the rank error of the quantiles computed with the sketchDense method,
+                             as a fraction of the number of observations. The sketch of a feature keeps O(1 / accuracy) values */
+
+    /**
+     * Returns the compression of the sketches used by the sketchDense method
+     * \return Compression of the sketches
+     */
+    double getSketchCompression() const
+    {
+        return 1.5 / accuracy;
+    }
+
+    /**
+     * Returns the maximal number of centroids in the sketch of one feature
+     * \return Maximal number of centroids in the sketch of one feature
+     */
+    size_t getSketchCapacity() const
+    {
+        return (size_t)getSketchCompression() + 3;
+    }
+
+    /**
+     * Returns the number of columns in the table of sketches: the number of observations, the minimum,
+     * the maximum and the number of centroids, followed by the means and the weights of the centroids
+     * \return Number of columns in the table of sketches
+     */
+    size_t getSketchSize() const
+    {
+        return 4 + 2 * getSketchCapacity();
+    }
+
+    /**
+     * Check the correctness of the %Parameter object
+     */
+    void check() const DAAL_C11_OVERRIDE
+    {
+        if(!(accuracy > 0.0 && accuracy < 1.0)) { this->_errors->add(services::ErrorIncorrectParameter); return; }
+    }
 };
 
 /**
@@ -134,6 +195,153 @@ public:
     }
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__PARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of the
+ *        quantiles algorithm in the online or distributed processing mode.
+ *        Each row of the table of sketches summarizes the distribution of one feature with at most
+ *        Parameter::getSketchCapacity() weighted centroids, so partial results from different blocks of data
+ *        are merged without access to the data. The sketches are stored in double precision
+ */
+class PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    PartialResult() : daal::algorithms::PartialResult(1)
+    {}
+
+    virtual ~PartialResult() {};
+
+    /**
+     * Allocates memory to store partial results of the quantiles algorithm
+     * \param[in] input     %Input objects for the quantiles algorithm
+     * \param[in] parameter Parameters of the quantiles algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method);
+
+    /**
+     * Initializes the sketches with empty ones
+     */
+    void initialize()
+    {
+        data_management::NumericTable *sketchTable = get(sketches).get();
+        size_t nRows = sketchTable->getNumberOfRows();
+        size_t nCols = sketchTable->getNumberOfColumns();
+
+        data_management::BlockDescriptor<double> block;
+        sketchTable->getBlockOfRows(0, nRows, data_management::writeOnly, block);
+        double *sketchData = block.getBlockPtr();
+        for(size_t i = 0; i < nRows * nCols; i++)
+        {
+            sketchData[i] = 0.0;
+        }
+        sketchTable->releaseBlockOfRows(block);
+    }
+
+    /**
+     * Returns the partial result of the quantiles algorithm
+     * \param[in] id   Identifier of the partial result, \ref PartialResultId
+     * \return         Partial result that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(PartialResultId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets the partial result of the quantiles algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(PartialResultId id, const services::SharedPtr<data_management::NumericTable> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
+    /**
+     * Returns the number of features summarized by the partial result
+     * \return Number of features
+     */
+    size_t getNumberOfFeatures() const
+    {
+        services::SharedPtr<data_management::NumericTable> sketchTable = get(sketches);
+        return (sketchTable ? sketchTable->getNumberOfRows() : 0);
+    }
+
+    /**
+     * Checks the partial results of the quantiles algorithm
+     * \param[in] input     %Input object of the algorithm
+     * \param[in] par       Algorithm parameter
+     * \param[in] method    Computation method
+     */
+    void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        check(par, method);
+        if(this->_errors->size() != 0) { return; }
+
+        const Input *algInput = static_cast<const Input *>(input);
+        if(getNumberOfFeatures() != algInput->get(data)->getNumberOfColumns())
+        { this->_errors->add(services::ErrorInconsistentNumberOfColumns); return; }
+    }
+
+    /**
+     * Checks the partial results of the quantiles algorithm
+     * \param[in] par       Algorithm parameter
+     * \param[in] method    Computation method
+     */
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        const Parameter *parameter = static_cast<const Parameter *>(par);
+
+        int unexpectedLayouts = (int)data_management::NumericTableIface::csrArray |
+                                (int)data_management::NumericTableIface::upperPackedTriangularMatrix |
+                                (int)data_management::NumericTableIface::lowerPackedTriangularMatrix |
+                                (int)data_management::NumericTableIface::upperPackedSymmetricMatrix |
+                                (int)data_management::NumericTableIface::lowerPackedSymmetricMatrix;
+
+        if (!data_management::checkNumericTable(get(sketches).get(), this->_errors.get(),
+            strSketches(), unexpectedLayouts, 0, parameter->getSketchSize())) { return; }
+    }
+
+    int getSerializationTag() DAAL_C11_OVERRIDE  { return SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID; }
+
+    /**
+    *  Serializes the object
+    *  \param[in]  arch  Storage for the serialized object or data structure
+    */
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    /**
+    *  Deserializes the object
+    *  \param[in]  arch  Storage for the deserialized object or data structure
+    */
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+
+template <typename algorithmFPType>
+void PartialResult::allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+{
+    const Input *in = static_cast<const Input *>(input);
+    const Parameter *par = static_cast<const Parameter *>(parameter);
+
+    size_t nFeatures = in->get(data)->getNumberOfColumns();
+
+    Argument::set(sketches, services::SharedPtr<data_management::SerializationIface>(
+                      new data_management::HomogenNumericTable<double>(par->getSketchSize(), nFeatures,
+                                                                       data_management::NumericTable::doAllocate)));
+}
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__RESULT"></a>
  * \brief Provides methods to access final results obtained with the compute() method of the
@@ -167,6 +375,26 @@ public:
                                                                                     data_management::NumericTable::doAllocate)));
     }
 
+    /**
+     * Allocates memory to store final results of the quantile algorithms
+     * \param[in] partialResult Partial results of the quantiles algorithm
+     * \param[in] parameter     Parameters of the quantiles algorithm
+     * \param[in] method        Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        const PartialResult *pres = static_cast<const PartialResult *>(partialResult);
+        const Parameter *par = static_cast<const Parameter *>(parameter);
+
+        size_t nFeatures = pres->getNumberOfFeatures();
+        size_t nQuantileOrders = par->quantileOrders->getNumberOfColumns();
+
+        Argument::set(quantiles, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(nQuantileOrders, nFeatures,
+                                                                                    data_management::NumericTable::doAllocate)));
+    }
+
     /**
      * Returns the final result of the quantiles algorithm
      * \param[in] id   Identifier of the final result, \ref ResultId
@@ -214,6 +442,33 @@ public:
             strQuantiles(), unexpectedLayouts, 0, nFeatures, nVectors)) { return; }
     }
 
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] partialResult Pointer to the partial results
+     * \param[in] par           Pointer to the parameters structure
+     * \param[in] method        Algorithm computation method
+     */
+    void check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        const PartialResult *pres = static_cast<const PartialResult *>(partialResult);
+        const Parameter *parameter = static_cast<const Parameter *>(par);
+
+        if (!data_management::checkNumericTable(parameter->quantileOrders.get(), this->_errors.get(),
+            strQuantileOrders(), 0, 0, 0, 1)) { return; }
+
+        size_t nFeatures = pres->getNumberOfFeatures();
+        size_t nQuantileOrders = parameter->quantileOrders->getNumberOfColumns();
+
+        int unexpectedLayouts = (int)data_management::NumericTableIface::csrArray |
+                                (int)data_management::NumericTableIface::upperPackedTriangularMatrix |
+                                (int)data_management::NumericTableIface::lowerPackedTriangularMatrix |
+                                (int)data_management::NumericTableIface::upperPackedSymmetricMatrix |
+                                (int)data_management::NumericTableIface::lowerPackedSymmetricMatrix;
+
+        if (!data_management::checkNumericTable(get(quantiles).get(), this->_errors.get(),
+            strQuantiles(), unexpectedLayouts, 0, nQuantileOrders, nFeatures)) { return; }
+    }
+
     int getSerializationTag() DAAL_C11_OVERRIDE  { return SERIALIZATION_QUANTILES_RESULT_ID; }
 
     /**
@@ -238,10 +493,125 @@ protected:
         daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
     }
 };
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDINPUT"></a>
+ * \brief %Input objects for the quantiles algorithm in the distributed processing mode
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ */
+template<ComputeStep step>
+class DistributedInput {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDINPUT_STEP1LOCAL"></a>
+ * \brief Local-node input objects for the quantiles algorithm in the distributed processing mode
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step1Local> : public Input
+{
+public:
+    DistributedInput() : Input()
+    {}
+
+    virtual ~DistributedInput()
+    {}
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDINPUT_STEP2MASTER"></a>
+ * \brief %Input objects for the quantiles algorithm in the distributed processing mode on the master node
+ */
+template<>
+class DAAL_EXPORT DistributedInput<step2Master> : public daal::algorithms::Input
+{
+public:
+    DistributedInput() : daal::algorithms::Input(1)
+    {
+        Argument::set(partialResults, services::SharedPtr<data_management::DataCollection>(new data_management::DataCollection()));
+    }
+
+    virtual ~DistributedInput() {}
+
+    /**
+     * Returns the number of features summarized by the partial results on local nodes
+     * \return Number of features
+     */
+    size_t getNumberOfFeatures() const
+    {
+        services::SharedPtr<data_management::DataCollection> collection = get(partialResults);
+        if(collection->size() == 0) { return 0; }
+
+        services::SharedPtr<PartialResult> partialResult =
+            services::dynamicPointerCast<PartialResult, data_management::SerializationIface>((*collection)[0]);
+        return (partialResult ? partialResult->getNumberOfFeatures() : 0);
+    }
+
+    /**
+     * Adds partial result to the collection of input objects for the quantiles algorithm in the distributed processing mode
+     * \param[in] id            Identifier of the input object
+     * \param[in] partialResult Partial result obtained in the first step of the distributed algorithm
+     */
+    void add(MasterInputId id, const services::SharedPtr<PartialResult> &partialResult)
+    {
+        services::SharedPtr<data_management::DataCollection> collection = get(id);
+        collection->push_back(services::staticPointerCast<data_management::SerializationIface, PartialResult>(partialResult));
+    }
+
+    /**
+     * Sets input object for the quantiles algorithm in the distributed processing mode
+     * \param[in] id  Identifier of the input object
+     * \param[in] ptr Pointer to the input object
+     */
+    void set(MasterInputId id, const services::SharedPtr<data_management::DataCollection> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
+    /**
+     * Returns the collection of input objects
+     * \param[in] id   Identifier of the input object, \ref MasterInputId
+     * \return Collection of distributed input objects
+     */
+    services::SharedPtr<data_management::DataCollection> get(MasterInputId id) const
+    {
+        return services::staticPointerCast<data_management::DataCollection, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Checks the input objects of the quantiles algorithm on the master node
+     * \param[in] parameter Pointer to the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE
+    {
+        services::SharedPtr<data_management::DataCollection> collection = get(partialResults);
+        if(!collection) { this->_errors->add(services::ErrorNullInputDataCollection); return; }
+
+        size_t nBlocks = collection->size();
+        if(nBlocks == 0) { this->_errors->add(services::ErrorIncorrectNumberOfInputNumericTables); return; }
+
+        const Parameter *par = static_cast<const Parameter *>(parameter);
+        size_t nFeatures = getNumberOfFeatures();
+        if(nFeatures == 0) { this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable); return; }
+
+        for(size_t i = 0; i < nBlocks; i++)
+        {
+            services::SharedPtr<PartialResult> partialResult =
+                services::dynamicPointerCast<PartialResult, data_management::SerializationIface>((*collection)[i]);
+            if(!partialResult) { this->_errors->add(services::ErrorNullPartialResult); return; }
+
+            if (!data_management::checkNumericTable(partialResult->get(sketches).get(), this->_errors.get(),
+                strSketches(), 0, 0, par->getSketchSize(), nFeatures)) { return; }
+        }
+    }
+};
 } // namespace interface1
 using interface1::Parameter;
 using interface1::Input;
+using interface1::PartialResult;
 using interface1::Result;
+using interface1::DistributedInput;
 
 } // namespace daal::algorithms::quantiles
 } // namespace daal::algorithms
@@ -0,0 +1,225 @@
+/* file: sorting_online.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface for the observation sorting algorithm in the online processing mode
+//--
+*/
+
+#ifndef __SORTING_ONLINE_H__
+#define __SORTING_ONLINE_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/sorting/sorting_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace sorting
+{
+
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__SORTING__ONLINECONTAINER"></a>
+ * \brief Provides methods to run implementations of the sorting algorithm.
+ *        It is associated with the daal::algorithms::sorting::Online class
+ *        and supports methods of sorting computation in the online processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the sorting algorithms, double or float
+ * \tparam method           Sorting computation method, \ref daal::algorithms::sorting::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT OnlineContainer : public daal::algorithms::AnalysisContainerIface<online>
+{
+public:
+    /**
+     * Constructs a container for the sorting algorithm with a specified environment
+     * in the online processing mode
+     * \param[in] daalEnv   Environment object
+     */
+    OnlineContainer(daal::services::Environment::env *daalEnv);
+    /** Default destructor */
+    virtual ~OnlineContainer();
+    /**
+     * Sorts a block of data and stores it as a sorted run in the online processing mode
+     */
+    virtual void compute() DAAL_C11_OVERRIDE;
+    /**
+     * Merges the sorted runs into the result of the sorting algorithm in the online processing mode
+     */
+    virtual void finalizeCompute() DAAL_C11_OVERRIDE;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__SORTING__ONLINE"></a>
+ * \brief Sorts the datasets by components of the random vector in the online processing mode.
+ *        Every call of compute() sorts a block of observations into a separate sorted run,
+ *        finalizeCompute() merges the runs block by block, so the runs and the result
+ *        can be stored in numeric tables that keep the data out of memory
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the sorting algorithms, double or float
+ * \tparam method           Sorting computation method, \ref daal::algorithms::sorting::Method.
+ *                          Only the parallelDense method is supported in the online processing mode
+ *
+ * \par Enumerations
+ *      - \ref Method           Sorting computation methods
+ *      - \ref InputId          Identifiers of sorting input objects
+ *      - \ref PartialResultId  Identifiers of sorting partial results
+ *      - \ref ResultId         Identifiers of sorting results
+ *
+ * \par References
+ *      - <a href="DAAL-REF-SORTING-ALGORITHM">Sorting algorithm description and usage models</a>
+ *      - Input class
+ *      - Parameter class
+ *      - PartialResult class
+ *      - Result class
+ */
+template<typename algorithmFPType = double, Method method = parallelDense>
+class DAAL_EXPORT Online : public daal::algorithms::Analysis<online>
+{
+public:
+    Input input;                    /*!< %Input data structure */
+    Parameter parameter;            /*!< Sorting parameters structure */
+
+    /** Default constructor */
+    Online()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs an algorithm that sorts data by copying input objects and parameters
+     * of another algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Online(const Online<algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(data, other.input.get(data));
+        parameter = other.parameter;
+    }
+
+    virtual ~Online() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains computed results of the sorting algorithms
+     * \return Structure that contains computed results of the sorting algorithms
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store results of the sorting algorithms
+     * \param[in] result Structure to store results of the sorting algorithms
+     */
+    void setResult(const services::SharedPtr<Result> &result)
+    {
+        if(!result) { this->_errors->add(services::ErrorNullResult); return; }
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains partial results of the sorting algorithms
+     * \return Structure that contains partial results of the sorting algorithms
+     */
+    services::SharedPtr<PartialResult> getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store partial results of the sorting algorithms
+     * \param[in] partialResult Structure to store partial results of the sorting algorithms
+     * \param[in] initFlag      Flag that specifies whether the partial results are initialized,
+     *                          set it to resume the computations from a restored partial result
+     */
+    void setPartialResult(const services::SharedPtr<PartialResult> &partialResult, bool initFlag = false)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(initFlag);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm that sorts data
+     * with a copy of input objects and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Online<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Online<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Online<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Online<algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_partialResult.get(), &parameter, method);
+        _res = _result.get();
+        _pres = _partialResult.get();
+    }
+
+    virtual void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate<algorithmFPType>(&input, &parameter, method);
+        _pres = _partialResult.get();
+    }
+
+    virtual void initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->initialize();
+    }
+
+    void initialize()
+    {
+        Analysis<online>::_ac = new __DAAL_ALGORITHM_CONTAINER(online, OnlineContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+        _partialResult = services::SharedPtr<PartialResult>(new PartialResult());
+    }
+
+    services::SharedPtr<PartialResult> _partialResult;
+    services::SharedPtr<Result> _result;
+};
+} // namespace interface1
+using interface1::OnlineContainer;
+using interface1::Online;
+
+} // namespace daal::algorithms::sorting
+} // namespace daal::algorithms
+} // namespace daal
+#endif
@@ -24,7 +24,9 @@
 #ifndef __SORTING_TYPES_H__
 #define __SORTING_TYPES_H__
 
+#include "algorithms/algorithm.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/data_collection.h"
 
 namespace daal
 {
@@ -41,7 +43,9 @@ namespace sorting
  */
 enum Method
 {
-    defaultDense = 0      /*!< Default: radix method for sorting a data set */
+    defaultDense  = 0,    /*!< Default: radix method for sorting a data set */
+    parallelDense = 1     /*!< Parallel merge sort method: sorts the features and the chunks of long features
+                               in parallel and merges the sorted chunks */
 };
 
 /**
@@ -59,7 +63,21 @@ enum InputId
  */
 enum ResultId
 {
-    sortedData = 0       /*!< observation sorting results */
+    sortedData    = 0,   /*!< observation sorting results */
+    sortedIndices = 1    /*!< Indices of the observations in the order that sorts every feature, computed
+                              if Parameter::computeIndices is set */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__SORTING__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the sorting algorithm
+ */
+enum PartialResultId
+{
+    sortedRuns       = 0,    /*!< Collection of sorted runs, the blocks of observations processed in the online
+                                  processing mode with every feature sorted */
+    sortedRunIndices = 1     /*!< Collection of indices of the observations in the sorted runs, computed
+                                  if Parameter::computeIndices is set */
 };
 
 /**
@@ -67,6 +85,55 @@ enum ResultId
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__SORTING__STORAGEIFACE"></a>
+ * \brief Abstract interface of the storage that creates the numeric tables for the sorted runs and the results
+ *        of the sorting algorithm in the online processing mode.
+ *        The algorithm accesses the tables only by blocks of column values, so the tables can keep the data
+ *        out of memory, for example in files
+ */
+class StorageIface
+{
+public:
+    virtual ~StorageIface() {}
+
+    /**
+     * Creates the numeric table that stores a sorted run or the indices of the observations in it
+     * \param[in] id             Identifier of the partial result the table is added to, \ref PartialResultId
+     * \param[in] nFeatures      Number of features in the run
+     * \param[in] nObservations  Number of observations in the run
+     * \return Numeric table of nFeatures columns and nObservations rows
+     */
+    virtual services::SharedPtr<data_management::NumericTable> createRun(PartialResultId id, size_t nFeatures,
+                                                                         size_t nObservations) = 0;
+
+    /**
+     * Creates the numeric table that stores a final result of the algorithm
+     * \param[in] id             Identifier of the result, \ref ResultId
+     * \param[in] nFeatures      Number of features
+     * \param[in] nObservations  Total number of observations in the sorted runs
+     * \return Numeric table of nFeatures columns and nObservations rows
+     */
+    virtual services::SharedPtr<data_management::NumericTable> createResult(ResultId id, size_t nFeatures,
+                                                                            size_t nObservations) = 0;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__SORTING__PARAMETER"></a>
+ * \brief Parameters of the sorting algorithm
+ */
+struct Parameter : public daal::algorithms::Parameter
+{
+    Parameter(bool computeIndices = false) : daal::algorithms::Parameter(), computeIndices(computeIndices)
+    {}
+
+    bool computeIndices;    /*!< Flag that specifies whether the indices of the sorted observations are computed.
+                                 The indices are stored as int values, the indices of equal values
+                                 are in the order of the observations */
+    services::SharedPtr<StorageIface> storage;  /*!< Storage of the sorted runs and the results in the online processing mode.
+                                                     If not set, the tables are allocated in memory */
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__SORTING__INPUT"></a>
  * \brief %Input objects for the sorting algorithm
@@ -104,22 +171,206 @@ public:
      * \param[in] method    Algorithm computation method
      * \param[in] par       Pointer to the parameters of the algorithm
      */
-    void check(const Parameter *par, int method) const DAAL_C11_OVERRIDE
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
     {
         int unexpectedLayouts = data_management::packed_mask;
         if (!data_management::checkNumericTable(get(data).get(), this->_errors.get(), strData(), unexpectedLayouts)) { return; }
     }
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__SORTING__PARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of the
+ *        sorting algorithm in the online processing mode.
+ *        Every block of observations is stored as a separate sorted run. The tables of the runs are created
+ *        by Parameter::storage if it is set, otherwise they are allocated in memory
+ */
+class PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    PartialResult() : daal::algorithms::PartialResult(2)
+    {}
+
+    virtual ~PartialResult() {};
+
+    /**
+     * Allocates memory to store partial results of the sorting algorithm
+     * \param[in] input     %Input objects for the sorting algorithm
+     * \param[in] parameter Parameters of the sorting algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        Argument::set(sortedRuns, services::SharedPtr<data_management::SerializationIface>(new data_management::DataCollection()));
+        Argument::set(sortedRunIndices, services::SharedPtr<data_management::SerializationIface>(new data_management::DataCollection()));
+    }
+
+    /**
+     * Removes all sorted runs from the partial result
+     */
+    void initialize()
+    {
+        get(sortedRuns)->clear();
+        get(sortedRunIndices)->clear();
+    }
+
+    /**
+     * Returns the collection of partial results of the sorting algorithm
+     * \param[in] id   Identifier of the partial result, \ref PartialResultId
+     * \return         Partial result that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::DataCollection> get(PartialResultId id) const
+    {
+        return services::staticPointerCast<data_management::DataCollection, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Returns the element of the collection of partial results of the sorting algorithm
+     * \param[in] id            Identifier of the partial result, \ref PartialResultId
+     * \param[in] elementId     Index of the element in the collection
+     * \return                  Numeric table that corresponds to the given identifier and index
+     */
+    services::SharedPtr<data_management::NumericTable> get(PartialResultId id, size_t elementId) const
+    {
+        services::SharedPtr<data_management::DataCollection> collection = get(id);
+        if(elementId >= collection->size())
+        {
+            return services::SharedPtr<data_management::NumericTable>();
+        }
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>((*collection)[elementId]);
+    }
+
+    /**
+     * Sets the collection of partial results of the sorting algorithm
+     * \param[in] id        Identifier of the partial result
+     * \param[in] value     Pointer to the collection
+     */
+    void set(PartialResultId id, const services::SharedPtr<data_management::DataCollection> &value)
+    {
+        Argument::set(id, services::staticPointerCast<data_management::SerializationIface, data_management::DataCollection>(value));
+    }
+
+    /**
+     * Returns the number of sorted runs
+     * \return Number of sorted runs
+     */
+    size_t getNumberOfRuns() const
+    {
+        return get(sortedRuns)->size();
+    }
+
+    /**
+     * Returns the number of features in the sorted runs
+     * \return Number of features in the sorted runs
+     */
+    size_t getNumberOfFeatures() const
+    {
+        return (getNumberOfRuns() ? get(sortedRuns, 0)->getNumberOfColumns() : 0);
+    }
+
+    /**
+     * Returns the total number of observations in the sorted runs
+     * \return Total number of observations in the sorted runs
+     */
+    size_t getNumberOfObservations() const
+    {
+        size_t nObservations = 0;
+        for(size_t i = 0; i < getNumberOfRuns(); i++)
+        {
+            nObservations += get(sortedRuns, i)->getNumberOfRows();
+        }
+        return nObservations;
+    }
+
+    /**
+     * Checks the correctness of the PartialResult object
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] par       Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        if(!checkCollections()) { return; }
+
+        const Input *in = static_cast<const Input *>(input);
+        checkRuns(in->get(data)->getNumberOfColumns(), static_cast<const Parameter *>(par));
+    }
+
+    /**
+     * Checks the correctness of the PartialResult object
+     * \param[in] par       Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        if(!checkCollections()) { return; }
+        if(getNumberOfRuns() == 0) { this->_errors->add(services::ErrorIncorrectNumberOfElementsInResultCollection); return; }
+
+        checkRuns(getNumberOfFeatures(), static_cast<const Parameter *>(par));
+    }
+
+    int getSerializationTag() DAAL_C11_OVERRIDE  { return SERIALIZATION_SORTING_PARTIAL_RESULT_ID; }
+
+    /**
+    *  Serializes the object
+    *  \param[in]  arch  Storage for the serialized object or data structure
+    */
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    /**
+    *  Deserializes the object
+    *  \param[in]  arch  Storage for the deserialized object or data structure
+    */
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    bool checkCollections() const
+    {
+        if(!get(sortedRuns) || !get(sortedRunIndices)) { this->_errors->add(services::ErrorNullPartialResult); return false; }
+        return true;
+    }
+
+    void checkRuns(size_t nFeatures, const Parameter *parameter) const
+    {
+        int unexpectedLayouts = data_management::packed_mask;
+        size_t nRuns = getNumberOfRuns();
+        bool computeIndices = (parameter && parameter->computeIndices);
+
+        if(computeIndices && get(sortedRunIndices)->size() != nRuns)
+        { this->_errors->add(services::ErrorIncorrectNumberOfElementsInResultCollection); return; }
+
+        for(size_t i = 0; i < nRuns; i++)
+        {
+            data_management::NumericTable *run = get(sortedRuns, i).get();
+            if (!data_management::checkNumericTable(run, this->_errors.get(), strSortedRuns(), unexpectedLayouts, 0, nFeatures)) { return; }
+            if(computeIndices)
+            {
+                if (!data_management::checkNumericTable(get(sortedRunIndices, i).get(), this->_errors.get(), strSortedRunIndices(),
+                                                        unexpectedLayouts, 0, nFeatures, run->getNumberOfRows())) { return; }
+            }
+        }
+    }
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__SORTING__RESULT"></a>
  * \brief Provides methods to access final results obtained with the compute() method of the
- *        sorting algorithm in the batch processing mode
+ *        sorting algorithm in the batch processing mode or finalizeCompute() method in the online processing mode
  */
 class Result : public daal::algorithms::Result
 {
 public:
-    Result() : daal::algorithms::Result(1)
+    Result() : daal::algorithms::Result(2)
     {}
 
     virtual ~Result() {};
@@ -131,15 +382,45 @@ public:
      */
     template <typename algorithmFPType>
     void allocate(const daal::algorithms::Input *input, const int method)
+    {
+        allocate<algorithmFPType>(input, NULL, method);
+    }
+
+    /**
+     * Allocates memory to store final results of the sorting algorithms
+     * \param[in] input     Input objects for the sorting algorithm
+     * \param[in] parameter Parameters of the sorting algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
     {
         const Input *in = static_cast<const Input *>(input);
 
         size_t nFeatures = in->get(data)->getNumberOfColumns();
         size_t nVectors = in->get(data)->getNumberOfRows();
 
-        Argument::set(sortedData, services::SharedPtr<data_management::SerializationIface>(
-                          new data_management::HomogenNumericTable<algorithmFPType>(nFeatures, nVectors,
-                                                                                    data_management::NumericTable::doAllocate)));
+        allocateTables<algorithmFPType>(nFeatures, nVectors, static_cast<const Parameter *>(parameter));
+    }
+
+    /**
+     * Allocates memory to store final results of the sorting algorithms
+     * \param[in] partialResult Partial results of the sorting algorithm
+     * \param[in] parameter     Parameters of the sorting algorithm
+     * \param[in] method        Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        const PartialResult *pres = static_cast<const PartialResult *>(partialResult);
+        const Parameter *par = static_cast<const Parameter *>(parameter);
+
+        if(par && par->storage)
+        {
+            allocateTables(pres->getNumberOfFeatures(), pres->getNumberOfObservations(), par, par->storage.get());
+            return;
+        }
+        allocateTables<algorithmFPType>(pres->getNumberOfFeatures(), pres->getNumberOfObservations(), par);
     }
 
     /**
@@ -168,15 +449,28 @@ public:
      * \param[in] par     %Parameter of algorithm
      * \param[in] method Algorithm computation method
      */
-    void check(const daal::algorithms::Input *in, const Parameter *par, int method) const DAAL_C11_OVERRIDE
+    void check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
     {
         const Input *input = static_cast<const Input *>(in);
 
         size_t nFeatures = input->get(data)->getNumberOfColumns();
         size_t nVectors  = input->get(data)->getNumberOfRows();
-        int unexpectedLayouts = data_management::packed_mask;
 
-        if (!data_management::checkNumericTable(get(sortedData).get(), this->_errors.get(), strSortedData(), unexpectedLayouts, 0, nFeatures, nVectors)) { return; }
+        checkTables(nFeatures, nVectors, static_cast<const Parameter *>(par));
+    }
+
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] pres   Pointer to the partial results structure
+     * \param[in] par    %Parameter of algorithm
+     * \param[in] method Algorithm computation method
+     */
+    void check(const daal::algorithms::PartialResult *pres, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        const PartialResult *partialResult = static_cast<const PartialResult *>(pres);
+
+        checkTables(partialResult->getNumberOfFeatures(), partialResult->getNumberOfObservations(),
+                    static_cast<const Parameter *>(par));
     }
 
     int getSerializationTag() DAAL_C11_OVERRIDE  { return SERIALIZATION_SORTING_RESULT_ID; }
@@ -202,9 +496,48 @@ protected:
     {
         daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
     }
+
+    template <typename algorithmFPType>
+    void allocateTables(size_t nFeatures, size_t nVectors, const Parameter *parameter)
+    {
+        Argument::set(sortedData, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(nFeatures, nVectors,
+                                                                                    data_management::NumericTable::doAllocate)));
+        if(parameter && parameter->computeIndices)
+        {
+            Argument::set(sortedIndices, services::SharedPtr<data_management::SerializationIface>(
+                              new data_management::HomogenNumericTable<int>(nFeatures, nVectors,
+                                                                            data_management::NumericTable::doAllocate)));
+        }
+    }
+
+    void allocateTables(size_t nFeatures, size_t nVectors, const Parameter *parameter, StorageIface *storage)
+    {
+        set(sortedData, storage->createResult(sortedData, nFeatures, nVectors));
+        if(parameter->computeIndices)
+        {
+            set(sortedIndices, storage->createResult(sortedIndices, nFeatures, nVectors));
+        }
+    }
+
+    void checkTables(size_t nFeatures, size_t nVectors, const Parameter *parameter) const
+    {
+        int unexpectedLayouts = data_management::packed_mask;
+
+        if (!data_management::checkNumericTable(get(sortedData).get(), this->_errors.get(), strSortedData(), unexpectedLayouts, 0, nFeatures, nVectors)) { return; }
+
+        if(parameter && parameter->computeIndices)
+        {
+            if (!data_management::checkNumericTable(get(sortedIndices).get(), this->_errors.get(), strSortedIndices(), unexpectedLayouts, 0,
+                                                    nFeatures, nVectors)) { return; }
+        }
+    }
 };
 } // namespace interface1
+using interface1::StorageIface;
+using interface1::Parameter;
 using interface1::Input;
+using interface1::PartialResult;
 using interface1::Result;
 
 } // namespace daal::algorithms::sorting
@@ -237,6 +237,7 @@ public:
     {
         initialize();
         input.set(inputOfStep2FromStep1, other.input.get(inputOfStep2FromStep1));
+        input.set(inputOfStep2FromStep2, other.input.get(inputOfStep2FromStep2));
         parameter = other.parameter;
     }
 
@@ -288,6 +289,12 @@ public:
             _errors->add(services::ErrorNullResult);
             return;
         }
+
+        services::SharedPtr<Result> result = _partialResult->get(finalResultFromStep2Master);
+        if(result && result->get(rightSingularMatrix))
+        {
+            input.checkInputFromParent(result->get(rightSingularMatrix)->getNumberOfColumns());
+        }
     }
 
     /**
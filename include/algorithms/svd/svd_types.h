@@ -108,6 +108,17 @@ enum DistributedPartialResultId
     finalResultFromStep2Master = 1 /*!< Result object with singular values and the right orthogonal matrix */
 };
 
+/**
+ * <a name="DAAL-ENUM-SVD__DISTRIBUTEDPARTIALRESULTTREEID"></a>
+ * \brief Available types of partial results obtained in the second step of the SVD algorithm in the distributed processing mode
+ * when the second step is run as an intermediate node of the reduction tree
+ */
+enum DistributedPartialResultTreeId
+{
+    outputOfStep2ForStep2 = 2    /*!< DataCollection with the matrix to be transferred to the second step on the parent node of the reduction
+                                    * tree */
+};
+
 /**
  * <a name="DAAL-ENUM-SVD__DISTRIBUTEDPARTIALRESULTSTEP3ID"></a>
  * \brief Available types of partial results obtained in the third step of the SVD algorithm in the distributed processing mode, stored in the
@@ -127,6 +138,15 @@ enum MasterInputId
     inputOfStep2FromStep1 = 0  /*!< DataCollection with data transferred from the first step to the second step in the distributed processing mode*/
 };
 
+/**
+ * <a name="DAAL-ENUM-SVD__MASTERINPUTTREEID"></a>
+ * \brief Partial results from the parent node of the reduction tree, required to finalize the second step run as an intermediate node
+ */
+enum MasterInputTreeId
+{
+    inputOfStep2FromStep2 = 1  /*!< DataCollection with data transferred from the second step on the parent node of the reduction tree */
+};
+
 /**
  * <a name="DAAL-ENUM-SVD__FINALIZEONLOCALINPUTID"></a>
  * \brief Partial results from previous steps in the distributed processing mode, required by the third step
@@ -219,7 +239,7 @@ class DistributedStep2Input : public daal::algorithms::Input
 {
 public:
     /** Default constructor */
-    DistributedStep2Input() : daal::algorithms::Input(1)
+    DistributedStep2Input() : daal::algorithms::Input(2)
     {
         Argument::set(inputOfStep2FromStep1,
                       services::SharedPtr<data_management::KeyValueDataCollection>(new data_management::KeyValueDataCollection()));
@@ -245,6 +265,26 @@ public:
         return services::staticPointerCast<data_management::KeyValueDataCollection, data_management::SerializationIface>(Argument::get(id));
     }
 
+    /**
+     * Sets an input object received from the parent node of the reduction tree
+     * \param[in] id   Identifier of the input object
+     * \param[in] ptr  Input object that corresponds to the given identifier
+     */
+    void set(MasterInputTreeId id, const services::SharedPtr<data_management::DataCollection> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
+    /**
+     * Returns an input object received from the parent node of the reduction tree
+     * \param[in] id   Identifier of the input object
+     * \return          Input object that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::DataCollection> get(MasterInputTreeId id) const
+    {
+        return services::staticPointerCast<data_management::DataCollection, data_management::SerializationIface>(Argument::get(id));
+    }
+
     /**
      * Adds the value to KeyValueDataCollection of the input object for the SVD algorithm
      * \param[in] id    Identifier of the input object
@@ -323,6 +363,23 @@ public:
 
         if(nBlocks == 0) { this->_errors->add(services::ErrorIncorrectNumberOfElementsInInputCollection); return; }
     }
+
+    /**
+     * Checks the input object received from the parent node of the reduction tree
+     * \param[in] m  Number of columns in the input data set
+     */
+    void checkInputFromParent(size_t m) const
+    {
+        services::SharedPtr<data_management::DataCollection> parentDC = get(inputOfStep2FromStep2);
+        if(!parentDC || parentDC->size() == 0) { return; }
+        if(parentDC->size() != 1) { this->_errors->add(services::ErrorIncorrectNumberOfElementsInInputCollection); return; }
+
+        services::SharedPtr<data_management::NumericTable> mNT =
+            services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>((*parentDC)[0]);
+        if(!mNT) { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+        if(mNT->getNumberOfRows() != m || mNT->getNumberOfColumns() != m)
+        { this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable); return; }
+    }
 };
 
 /**
@@ -694,7 +751,7 @@ class DistributedPartialResult : public daal::algorithms::PartialResult
 {
 public:
     /** Default constructor */
-    DistributedPartialResult() : daal::algorithms::PartialResult(2) {}
+    DistributedPartialResult() : daal::algorithms::PartialResult(3) {}
     /** Default destructor */
     virtual ~DistributedPartialResult() {}
 
@@ -707,6 +764,7 @@ public:
         Argument::set(outputOfStep2ForStep3,
                       services::SharedPtr<data_management::KeyValueDataCollection>(new data_management::KeyValueDataCollection()));
         Argument::set(finalResultFromStep2Master, services::SharedPtr<Result>(new Result()));
+        Argument::set(outputOfStep2ForStep2, services::SharedPtr<data_management::DataCollection>(new data_management::DataCollection()));
 
         services::SharedPtr<data_management::KeyValueDataCollection> inCollection = static_cast<const DistributedStep2Input *>(input)->get(
                                                                                         inputOfStep2FromStep1);
@@ -748,6 +806,20 @@ public:
             result->allocateImpl<algorithmFPType>(m, 0);
         }
 
+        /* The parent node of the reduction tree receives Sigma * V^T of this subtree */
+        services::SharedPtr<data_management::DataCollection> parentCollection =
+            services::staticPointerCast<data_management::DataCollection, data_management::SerializationIface>(Argument::get(outputOfStep2ForStep2));
+        if(!parentCollection)
+        {
+            parentCollection = services::SharedPtr<data_management::DataCollection>(new data_management::DataCollection());
+            Argument::set(outputOfStep2ForStep2, parentCollection);
+        }
+        if(parentCollection->size() == 0)
+        {
+            parentCollection->push_back(services::SharedPtr<data_management::SerializationIface>(
+                                            new data_management::HomogenNumericTable<algorithmFPType>(m, m, data_management::NumericTable::doAllocate)));
+        }
+
         nBlocks = 0;
         for(size_t i = 0 ; i < inSize ; i++)
         {
@@ -792,6 +864,26 @@ public:
         return services::staticPointerCast<Result, data_management::SerializationIface>(Argument::get(id));
     }
 
+    /**
+     * Returns the partial result of the SVD algorithm to be transferred to the parent node of the reduction tree
+     * \param[in] id    Identifier of the partial result
+     * \return          Value that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::DataCollection> get(DistributedPartialResultTreeId id) const
+    {
+        return services::staticPointerCast<data_management::DataCollection, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets DataCollection to store the partial result of the SVD algorithm to be transferred to the parent node of the reduction tree
+     * \param[in] id    Identifier of the partial result
+     * \param[in] value Value that corresponds to the given identifier
+     */
+    void set(DistributedPartialResultTreeId id, const services::SharedPtr<data_management::DataCollection> &value)
+    {
+        Argument::set(id, value);
+    }
+
     /**
      * Sets KeyValueDataCollection to store partial results of the SVD algorithm
      * \param[in] id    Identifier of the partial result
@@ -820,7 +912,7 @@ public:
 
     void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE
     {
-        if(Argument::size() != 2)
+        if(Argument::size() != 3)
         { this->_errors->add(services::ErrorIncorrectNumberOfOutputNumericTables); return; }
     }
 
@@ -846,6 +938,12 @@ protected:
     void serialImpl(Archive *arch)
     {
         daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+
+        /* Partial results serialized before the reduction tree was supported have no outputOfStep2ForStep2 */
+        if(onDeserialize && Argument::size() == (size_t)outputOfStep2ForStep2)
+        {
+            Argument::operator <<(services::SharedPtr<data_management::DataCollection>(new data_management::DataCollection()));
+        }
     }
 };
 
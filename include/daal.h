@@ -32,9 +32,11 @@
 #include "data_management/data_source/data_source.h"
 #include "data_management/data_source/data_source_utils.h"
 #include "data_management/data_source/file_data_source.h"
+#include "data_management/data_source/mmap_data_source.h"
 #include "data_management/data_source/string_data_source.h"
 #include "data_management/data/aos_numeric_table.h"
 #include "data_management/data/csr_numeric_table.h"
+#include "data_management/data/compressed_numeric_table.h"
 #include "data_management/data/data_archive.h"
 #include "services/collection.h"
 #include "data_management/data/data_block.h"
@@ -47,6 +49,7 @@
 #include "data_management/data/homogen_tensor.h"
 #include "data_management/data/homogen_numeric_table.h"
 #include "data_management/data/merged_numeric_table.h"
+#include "data_management/data/row_merged_numeric_table.h"
 #include "data_management/data/matrix.h"
 #include "data_management/data/numeric_table.h"
 #include "data_management/data/soa_numeric_table.h"
@@ -58,6 +61,7 @@
 #include "algorithms/classifier/classifier_model.h"
 #include "algorithms/kmeans/kmeans_types.h"
 #include "algorithms/kmeans/kmeans_batch.h"
+#include "algorithms/kmeans/kmeans_online.h"
 #include "algorithms/kmeans/kmeans_distributed.h"
 #include "algorithms/kmeans/kmeans_init_types.h"
 #include "algorithms/kmeans/kmeans_init_batch.h"
@@ -125,6 +129,20 @@
 #include "algorithms/svm/svm_predict.h"
 #include "algorithms/svm/svm_quality_metric_set_batch.h"
 #include "algorithms/svm/svm_quality_metric_set_types.h"
+#include "algorithms/gbt/gbt_training_parameter.h"
+#include "algorithms/gbt/gbt_training_distributed_types.h"
+#include "algorithms/gbt/gbt_classification_model.h"
+#include "algorithms/gbt/gbt_classification_training_types.h"
+#include "algorithms/gbt/gbt_classification_training_batch.h"
+#include "algorithms/gbt/gbt_classification_training_distributed.h"
+#include "algorithms/gbt/gbt_classification_predict_types.h"
+#include "algorithms/gbt/gbt_classification_predict.h"
+#include "algorithms/gbt/gbt_regression_model.h"
+#include "algorithms/gbt/gbt_regression_training_types.h"
+#include "algorithms/gbt/gbt_regression_training_batch.h"
+#include "algorithms/gbt/gbt_regression_training_distributed.h"
+#include "algorithms/gbt/gbt_regression_predict_types.h"
+#include "algorithms/gbt/gbt_regression_predict.h"
 #include "algorithms/em/em_gmm.h"
 #include "algorithms/em/em_gmm_types.h"
 #include "algorithms/em/em_gmm_init_batch.h"
@@ -171,6 +189,8 @@
 #include "algorithms/boosting/boosting_training_batch.h"
 #include "algorithms/quantiles/quantiles_types.h"
 #include "algorithms/quantiles/quantiles_batch.h"
+#include "algorithms/quantiles/quantiles_online.h"
+#include "algorithms/quantiles/quantiles_distributed.h"
 #include "algorithms/implicit_als/implicit_als_model.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_batch.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_distributed.h"
@@ -259,6 +279,7 @@
 #include "algorithms/math/softmax_types.h"
 #include "algorithms/sorting/sorting_types.h"
 #include "algorithms/sorting/sorting_batch.h"
+#include "algorithms/sorting/sorting_online.h"
 #include "algorithms/math/logistic.h"
 #include "algorithms/math/logistic_types.h"
 #include "algorithms/math/tanh.h"
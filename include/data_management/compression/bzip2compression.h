@@ -107,6 +107,17 @@ public:
         run( outBlock.getPtr(), outBlock.getSize(), 0 );
     }
 
+    /**
+     * Creates a Compressor<bzip2> with the same parameters
+     * \return Pointer to the new compressor
+     */
+    CompressorImpl *clone() const DAAL_C11_OVERRIDE
+    {
+        Compressor<bzip2> *compr = new Compressor<bzip2>();
+        compr->parameter = parameter;
+        return compr;
+    }
+
     Bzip2CompressionParameter parameter; /*!< Bzip2 compression parameters structure */
 
 protected:
@@ -175,6 +186,17 @@ public:
         run( outBlock.getPtr(), outBlock.getSize(), 0 );
     }
 
+    /**
+     * Creates a Decompressor<bzip2> with the same parameters
+     * \return Pointer to the new decompressor
+     */
+    DecompressorImpl *clone() const DAAL_C11_OVERRIDE
+    {
+        Decompressor<bzip2> *decompr = new Decompressor<bzip2>();
+        decompr->parameter = parameter;
+        return decompr;
+    }
+
     Bzip2CompressionParameter parameter; /*!< Bzip2 compression parameters structure */
 
 protected:
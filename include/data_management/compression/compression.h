@@ -309,11 +309,83 @@ public:
     virtual ~Decompressor() {}
 };
 } // namespace interface1
+
+namespace interface2
+{
+/**
+ * <a name="DAAL-CLASS-COMPRESSORIMPL"></a>
+ * \brief %Base class for the Compressor that can be copied to compress independent data blocks in parallel
+ *
+ * \par References
+ *      - <a href="DAAL-REF-COMPRESSION">Data compression usage model</a>
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - CompressionParameter structure
+ */
+class DAAL_EXPORT CompressorImpl : public interface1::CompressorImpl
+{
+public:
+    /**
+     * \brief %Compressor constructor
+     */
+    CompressorImpl() : interface1::CompressorImpl() {}
+    virtual ~CompressorImpl() {}
+
+    /**
+     * Creates a compressor of the same type with the same parameters
+     * \return Pointer to the new compressor or NULL if the compressor cannot be copied
+     */
+    virtual CompressorImpl *clone() const { return NULL; }
+};
+
+/**
+ * <a name="DAAL-CLASS-DECOMPRESSORIMPL"></a>
+ * \brief %Base class for the Decompressor that can be copied to decompress independent data blocks in parallel
+ *
+ * \par References
+ *      - <a href="DAAL-REF-COMPRESSION">Data compression usage model</a>
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - CompressionParameter structure
+ */
+class DAAL_EXPORT DecompressorImpl : public interface1::DecompressorImpl
+{
+public:
+    /**
+     * \brief %Decompressor constructor
+     */
+    DecompressorImpl() : interface1::DecompressorImpl() {}
+    virtual ~DecompressorImpl() {}
+
+    /**
+     * Creates a decompressor of the same type with the same parameters
+     * \return Pointer to the new decompressor or NULL if the decompressor cannot be copied
+     */
+    virtual DecompressorImpl *clone() const { return NULL; }
+};
+} // namespace interface2
+
+namespace internal
+{
+/**
+ * Compresses or decompresses the whole input data block and writes the results to the output block starting from the offset
+ * \param[in]     processor          Compressor or decompressor
+ * \param[in]     in                 Pointer to the input data block
+ * \param[in]     inSize             Size of the input data block in bytes
+ * \param[in,out] out                Pointer to the output data block allocated with daal_malloc
+ * \param[in,out] outSize            Size of the output data block in bytes
+ * \param[in]     offset             Offset in the output data block to start writing from
+ * \param[out]    usedSize           Size of the used part of the output data block in bytes, including the offset
+ * \param[in]     allowReallocation  Flag that allows the output data block to grow when it is full
+ * \return true if the whole input is processed, false otherwise
+ */
+DAAL_EXPORT bool processDataBlock(interface1::Compression *processor, byte *in, size_t inSize, byte **out, size_t *outSize,
+                                  size_t offset, size_t *usedSize, bool allowReallocation);
+} // namespace internal
+
 using interface1::CompressionParameter;
 using interface1::CompressionIface;
 using interface1::Compression;
-using interface1::CompressorImpl;
-using interface1::DecompressorImpl;
+using interface2::CompressorImpl;
+using interface2::DecompressorImpl;
 using interface1::Compressor;
 using interface1::Decompressor;
 
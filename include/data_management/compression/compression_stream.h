@@ -39,6 +39,18 @@ namespace data_management
  */
 typedef services::Collection<services::SharedPtr<DataBlock> > DataBlockCollection;
 
+/**
+ * <a name="DAAL-ENUM-COMPRESSIONSTREAMMODE"></a>
+ * \brief Modes of compression and decompression streams
+ */
+enum CompressionStreamMode
+{
+    sequentialBlocks = 0, /*!< Data blocks are compressed one after another by a single compressor */
+    parallelFrames   = 1  /*!< Data is split into independent frames of the minimal block size. Every frame is stored
+                               with a header that contains its compressed and decompressed sizes, which lets frames
+                               be compressed and decompressed in parallel and decompression start from any frame */
+};
+
 namespace interface1
 {
 /**
@@ -217,8 +229,129 @@ private:
     services::SharedPtr<services::ErrorCollection> _errors;
 };
 } // namespace interface1
-using interface1::CompressionStream;
-using interface1::DecompressionStream;
+
+namespace interface2
+{
+/**
+ * <a name="DAAL-CLASS-COMPRESSIONSTREAM"></a>
+ * \brief %CompressionStream class compresses input raw data by blocks or by independent frames in parallel.
+ *
+ * \par References
+ *      - <a href="DAAL-REF-COMPRESSION">Data compression usage model</a>
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref CompressorImpl class
+ */
+class DAAL_EXPORT CompressionStream : public interface1::CompressionStream
+{
+public:
+    /**
+     * %CompressionStream constructor
+     * \param compr Pointer to a specific Compressor used for compression
+     * \param minSize Optional parameter, minimal size of internal data blocks. Size of frames in the parallelFrames mode
+     * \param mode Optional parameter, mode of the stream, \ref CompressionStreamMode.
+     *             In the parallelFrames mode copies of the compressor are created with CompressorImpl::clone(),
+     *             compressors that cannot be copied compress the frames sequentially
+     */
+    CompressionStream(interface1::CompressorImpl *compr, size_t minSize = 1024 * 64, CompressionStreamMode mode = sequentialBlocks);
+    virtual ~CompressionStream();
+
+    /**
+     * Writes the next DataBlock to %CompressionStream and compresses it
+     * \param[in] inBlock  Pointer to the next DataBlock to be compressed
+     */
+    virtual void push_back(DataBlock *inBlock);
+    /**
+     * Provides access to compressed data blocks stored in %CompressionStream
+     * \return Pointer to an internal \ref DataBlockCollection
+     */
+    virtual services::SharedPtr<DataBlockCollection> getCompressedBlocksCollection();
+    /**
+     * Returns the size of compressed data stored in %CompressionStream
+     * \return Size in bytes
+     */
+    virtual size_t getCompressedDataSize();
+
+    using interface1::CompressionStream::copyCompressedArray;
+    /**
+     * Copies compressed data stored in %CompressionStream to an external array
+     * \param[out] outPtr Pointer to the array where compressed data is stored
+     * \param[in] outSize Number of bytes available in external memory
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyCompressedArray(byte *outPtr, size_t outSize);
+
+private:
+    void *_frames;  /* Frames of the parallelFrames mode, NULL in the sequentialBlocks mode */
+
+    void compressFrames(bool compressPartialFrame);
+    void pushFrames(DataBlock *block);
+};
+
+/**
+ * <a name="DAAL-CLASS-DECOMPRESSIONSTREAM"></a>
+ * \brief %DecompressionStream class decompresses compressed input data by blocks or by independent frames in parallel.
+ *
+ * \par References
+ *      - <a href="DAAL-REF-COMPRESSION">Data compression usage model</a>
+ *      - \ref services::ErrorCompressionNullInputStream "Data compression error codes"
+ *      - \ref DecompressorImpl class
+ */
+class DAAL_EXPORT DecompressionStream : public interface1::DecompressionStream
+{
+public:
+    /**
+     * \brief %DecompressionStream constructor
+     * \param decompr Pointer to a specific Decompressor used for decompression
+     * \param minSize Optional parameter, minimal size of internal data blocks
+     * \param mode Optional parameter, mode of the stream, \ref CompressionStreamMode.
+     *             Must match the mode of the %CompressionStream that produced the compressed data
+     */
+    DecompressionStream(interface1::DecompressorImpl *decompr, size_t minSize = 1024 * 64,
+                        CompressionStreamMode mode = sequentialBlocks);
+    virtual ~DecompressionStream();
+
+    /**
+     * Writes the next compressed DataBlock to %DecompressionStream and decompresses it
+     * \param[in] inBlock  Pointer to the next DataBlock to be decompressed
+     */
+    virtual void push_back(DataBlock *inBlock);
+    /**
+     * Provides access to decompressed data blocks stored in %DecompressionStream
+     * \return Pointer to internal \ref DataBlockCollection
+     */
+    virtual services::SharedPtr<DataBlockCollection> getDecompressedBlocksCollection();
+    /**
+     * Returns the size of decompressed data stored in %DecompressionStream
+     * \return Size in bytes
+     */
+    virtual size_t getDecompressedDataSize();
+
+    using interface1::DecompressionStream::copyDecompressedArray;
+    /**
+     * Copies decompressed data stored in %DecompressionStream to an external array
+     * \param[out] outPtr Pointer to the array where decompressed data is stored
+     * \param[in] outSize Number of bytes available in external memory
+     * \return Size of copied data in bytes
+     */
+    virtual size_t copyDecompressedArray(byte *outPtr, size_t outSize);
+    /**
+     * Returns the number of complete compressed frames written to %DecompressionStream in the parallelFrames mode
+     * \return Number of frames
+     */
+    virtual size_t getNumberOfFrames();
+    /**
+     * Moves the read position of %DecompressionStream in the parallelFrames mode to the beginning of a frame,
+     * so that the next call to copyDecompressedArray() decompresses data starting from this frame
+     * \param[in] frame Index of the frame
+     */
+    virtual void seekFrame(size_t frame);
+
+private:
+    void *_frames;  /* Index of the frames of the parallelFrames mode, NULL in the sequentialBlocks mode */
+};
+} // namespace interface2
+using interface2::CompressionStream;
+using interface2::DecompressionStream;
 
 } //namespace data_management
 } //namespace daal
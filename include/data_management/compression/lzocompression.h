@@ -111,6 +111,17 @@ public:
         run( outBlock.getPtr(), outBlock.getSize(), 0 );
     }
 
+    /**
+     * Creates a Compressor<lzo> with the same parameters
+     * \return Pointer to the new compressor
+     */
+    CompressorImpl *clone() const DAAL_C11_OVERRIDE
+    {
+        Compressor<lzo> *compr = new Compressor<lzo>();
+        compr->parameter = parameter;
+        return compr;
+    }
+
     LzoCompressionParameter parameter; /*!< LZO compression parameters structure */
 
 protected:
@@ -180,6 +191,17 @@ public:
         run( outBlock.getPtr(), outBlock.getSize(), 0 );
     }
 
+    /**
+     * Creates a Decompressor<lzo> with the same parameters
+     * \return Pointer to the new decompressor
+     */
+    DecompressorImpl *clone() const DAAL_C11_OVERRIDE
+    {
+        Decompressor<lzo> *decompr = new Decompressor<lzo>();
+        decompr->parameter = parameter;
+        return decompr;
+    }
+
     LzoCompressionParameter parameter; /*!< LZO compression parameters structure */
 
 protected:
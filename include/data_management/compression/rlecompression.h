@@ -108,6 +108,17 @@ public:
         run( outBlock.getPtr(), outBlock.getSize(), 0 );
     }
 
+    /**
+     * Creates a Compressor<rle> with the same parameters
+     * \return Pointer to the new compressor
+     */
+    CompressorImpl *clone() const DAAL_C11_OVERRIDE
+    {
+        Compressor<rle> *compr = new Compressor<rle>();
+        compr->parameter = parameter;
+        return compr;
+    }
+
     RleCompressionParameter parameter; /*!< RLE compression parameters structure */
 
 protected:
@@ -172,6 +183,17 @@ public:
         run( outBlock.getPtr(), outBlock.getSize(), 0 );
     }
 
+    /**
+     * Creates a Decompressor<rle> with the same parameters
+     * \return Pointer to the new decompressor
+     */
+    DecompressorImpl *clone() const DAAL_C11_OVERRIDE
+    {
+        Decompressor<rle> *decompr = new Decompressor<rle>();
+        decompr->parameter = parameter;
+        return decompr;
+    }
+
     RleCompressionParameter parameter; /*!< RLE compression parameters structure */
 
 protected:
@@ -110,6 +110,17 @@ public:
         run( outBlock.getPtr(), outBlock.getSize(), 0 );
     }
 
+    /**
+     * Creates a Compressor<zlib> with the same parameters
+     * \return Pointer to the new compressor
+     */
+    CompressorImpl *clone() const DAAL_C11_OVERRIDE
+    {
+        Compressor<zlib> *compr = new Compressor<zlib>();
+        compr->parameter = parameter;
+        return compr;
+    }
+
     ZlibCompressionParameter parameter; /*!< Zlib compression parameters structure */
 
 protected:
@@ -173,6 +184,17 @@ public:
         run( outBlock.getPtr(), outBlock.getSize(), 0 );
     }
 
+    /**
+     * Creates a Decompressor<zlib> with the same parameters
+     * \return Pointer to the new decompressor
+     */
+    DecompressorImpl *clone() const DAAL_C11_OVERRIDE
+    {
+        Decompressor<zlib> *decompr = new Decompressor<zlib>();
+        decompr->parameter = parameter;
+        return decompr;
+    }
+
     ZlibCompressionParameter parameter; /*!< Zlib compression parameters structure */
 
 protected:
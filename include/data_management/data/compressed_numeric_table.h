@@ -0,0 +1,673 @@
+/* file: compressed_numeric_table.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of a numeric table that stores data compressed by blocks of rows.
+//--
+*/
+
+
+#ifndef __COMPRESSED_NUMERIC_TABLE_H__
+#define __COMPRESSED_NUMERIC_TABLE_H__
+
+#include "data_management/data/numeric_table.h"
+#include "data_management/compression/compression.h"
+#include "data_management/compression/zlibcompression.h"
+#include "data_management/compression/lzocompression.h"
+#include "data_management/compression/rlecompression.h"
+#include "data_management/compression/bzip2compression.h"
+#include "services/daal_atomic_int.h"
+#include "services/env_detect.h"
+#include "services/daal_memory.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+
+/**
+ *  <a name="DAAL-CLASS-COMPRESSEDNUMERICTABLE"></a>
+ *  \brief Class that stores a data set as blocks of rows compressed with one of the \ref CompressionMethod methods.
+ *  Only the blocks that contain the requested rows are decompressed on access.
+ *  Recently decompressed blocks are kept in a cache with one entry per thread.
+ *  The table is read-only: requests for write access are not supported
+ *  \tparam DataType Defines the underlying data type that describes a Numeric Table
+ */
+template<typename DataType = double>
+class CompressedNumericTable : public NumericTable
+{
+public:
+    /**
+     *  Typedef that stores a datatype used for template instantiation
+     */
+    typedef DataType baseDataType;
+
+public:
+    /**
+     *  Constructor for an empty compressed Numeric Table
+     */
+    CompressedNumericTable() : NumericTable(0, 0), _method(zlib), _level(defaultLevel), _nRowsInBlock(0), _nBlocks(0),
+        _blocks(NULL), _blockSizes(NULL), _nCacheEntries(0), _cache(NULL)
+    {
+        _layout = aos;
+        initializeCache();
+    }
+
+    /**
+     *  Constructor for a compressed Numeric Table that contains the data of another Numeric Table
+     *  \param[in]  table           Numeric Table to compress
+     *  \param[in]  method          Compression method, \ref CompressionMethod
+     *  \param[in]  nRowsInBlock    Number of rows compressed into one block.
+     *                              If 0, the number of rows is chosen so that a block takes about 64 KB
+     *  \param[in]  level           Compression level for the zlib and bzip2 methods, \ref CompressionLevel
+     */
+    CompressedNumericTable( const services::SharedPtr<NumericTable> &table, CompressionMethod method = zlib,
+                            size_t nRowsInBlock = 0, CompressionLevel level = defaultLevel ) :
+        NumericTable(0, 0), _method(method), _level(level), _nRowsInBlock(nRowsInBlock), _nBlocks(0),
+        _blocks(NULL), _blockSizes(NULL), _nCacheEntries(0), _cache(NULL)
+    {
+        _layout = aos;
+        initializeCache();
+        compressTable(table.get());
+    }
+
+    /** \private */
+    virtual ~CompressedNumericTable()
+    {
+        freeDataMemory();
+        deleteCache();
+    }
+
+    virtual int getSerializationTag() DAAL_C11_OVERRIDE
+    {
+        return data_feature_utils::getIndexNumType<DataType>() + SERIALIZATION_COMPRESSED_NT_ID;
+    }
+
+    /**
+     *  Returns the compression method used to store the data
+     *  \return Compression method
+     */
+    CompressionMethod getCompressionMethod() const { return _method; }
+
+    /**
+     *  Returns the number of rows compressed into one block
+     *  \return Number of rows in a block
+     */
+    size_t getNumberOfRowsInBlock() const { return _nRowsInBlock; }
+
+    /**
+     *  Returns the total size of the compressed blocks in bytes
+     *  \return Size of the compressed data
+     */
+    size_t getCompressedDataSize() const
+    {
+        size_t size = 0;
+        for(size_t i = 0; i < _nBlocks; i++)
+        {
+            size += _blockSizes[i];
+        }
+        return size;
+    }
+
+    virtual void setNumberOfRows(size_t nrow) DAAL_C11_OVERRIDE
+    {
+        if(nrow > _nBlocks * _nRowsInBlock)
+        {
+            this->_errors->add(services::ErrorIncorrectNumberOfRows);
+            return;
+        }
+        _obsnum = nrow;
+    }
+
+    /**
+     *  The data of a compressed Numeric Table is only set on construction or deserialization.
+     *  The method is not supported
+     */
+    virtual void allocateDataMemory() DAAL_C11_OVERRIDE
+    {
+        this->_errors->add(services::ErrorMethodNotSupported);
+    }
+
+    virtual void freeDataMemory() DAAL_C11_OVERRIDE
+    {
+        for(size_t i = 0; i < _nBlocks; i++)
+        {
+            daal::services::daal_free(_blocks[i]);
+        }
+        daal::services::daal_free(_blocks);
+        daal::services::daal_free(_blockSizes);
+        _blocks     = NULL;
+        _blockSizes = NULL;
+        _nBlocks    = 0;
+        _obsnum     = 0;
+        invalidateCache();
+        _memStatus = notAllocated;
+    }
+
+    void getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    void getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    void getBlockOfRows(size_t vector_idx, size_t vector_num, ReadWriteMode rwflag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    void releaseBlockOfRows(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        block.setDetails( 0, 0, 0 );
+    }
+    void releaseBlockOfRows(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        block.setDetails( 0, 0, 0 );
+    }
+    void releaseBlockOfRows(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        block.setDetails( 0, 0, 0 );
+    }
+
+    void getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                ReadWriteMode rwflag, BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    void getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                ReadWriteMode rwflag, BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    void getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                ReadWriteMode rwflag, BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        return getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    void releaseBlockOfColumnValues(BlockDescriptor<double> &block) DAAL_C11_OVERRIDE
+    {
+        block.setDetails( 0, 0, 0 );
+    }
+    void releaseBlockOfColumnValues(BlockDescriptor<float> &block) DAAL_C11_OVERRIDE
+    {
+        block.setDetails( 0, 0, 0 );
+    }
+    void releaseBlockOfColumnValues(BlockDescriptor<int> &block) DAAL_C11_OVERRIDE
+    {
+        block.setDetails( 0, 0, 0 );
+    }
+
+    /** \private */
+    void serializeImpl  (InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<InputDataArchive, false>( arch );}
+
+    /** \private */
+    void deserializeImpl(OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<OutputDataArchive, true>( arch );}
+
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl( Archive *arch )
+    {
+        if( onDeserialize )
+        {
+            freeDataMemory();
+        }
+
+        NumericTable::serialImpl<Archive, onDeserialize>( arch );
+
+        arch->set( _method );
+        arch->set( _nRowsInBlock );
+        arch->set( _nBlocks );
+
+        if( onDeserialize )
+        {
+            _blocks     = (byte **)daal::services::daal_malloc( _nBlocks * sizeof(byte *) );
+            _blockSizes = (size_t *)daal::services::daal_malloc( _nBlocks * sizeof(size_t) );
+            if( _nBlocks && (!_blocks || !_blockSizes) )
+            {
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+                return;
+            }
+        }
+
+        arch->set( _blockSizes, _nBlocks );
+
+        for(size_t i = 0; i < _nBlocks; i++)
+        {
+            if( onDeserialize )
+            {
+                _blocks[i] = (byte *)daal::services::daal_malloc( _blockSizes[i] );
+                if( !_blocks[i] )
+                {
+                    _nBlocks = i;
+                    freeDataMemory();
+                    this->_errors->add(services::ErrorMemoryAllocationFailed);
+                    return;
+                }
+            }
+            arch->set( _blocks[i], _blockSizes[i] );
+        }
+
+        if( onDeserialize )
+        {
+            _memStatus = internallyAllocated;
+        }
+    }
+
+private:
+    /* Decompressed block of rows and the decompressor that produced it */
+    struct CacheEntry
+    {
+        CacheEntry() : decompressor(NULL), rows(NULL), block(0), isValid(false) {}
+
+        services::Atomic<int> lock;     /* Number of threads that try to use the entry, the entry is acquired by the first one */
+        DecompressorImpl *decompressor;
+        DataType *rows;
+        size_t block;
+        bool isValid;
+    };
+
+    CompressionMethod _method;
+    CompressionLevel _level;
+    size_t _nRowsInBlock;
+    size_t _nBlocks;
+    byte **_blocks;         /* Compressed blocks of rows */
+    size_t *_blockSizes;    /* Sizes of the compressed blocks in bytes */
+
+    size_t _nCacheEntries;
+    CacheEntry *_cache;
+    services::Atomic<int> _errorsLock;  /* Serializes the errors added by the threads that read the table */
+
+    /* Copying of the table is not supported */
+    CompressedNumericTable(const CompressedNumericTable &);
+    CompressedNumericTable &operator=(const CompressedNumericTable &);
+
+    void initializeCache()
+    {
+        _nCacheEntries = daal::services::Environment::getInstance()->getNumberOfThreads();
+        if(_nCacheEntries == 0) { _nCacheEntries = 1; }
+        _cache = new CacheEntry[_nCacheEntries];
+    }
+
+    static void clearEntry(CacheEntry &entry)
+    {
+        daal::services::daal_free(entry.rows);
+        delete entry.decompressor;
+        entry.rows         = NULL;
+        entry.decompressor = NULL;
+        entry.isValid      = false;
+    }
+
+    void invalidateCache()
+    {
+        for(size_t i = 0; i < _nCacheEntries; i++)
+        {
+            clearEntry(_cache[i]);
+        }
+    }
+
+    void deleteCache()
+    {
+        invalidateCache();
+        delete[] _cache;
+        _cache = NULL;
+        _nCacheEntries = 0;
+    }
+
+    CompressorImpl *createCompressor() const
+    {
+        switch(_method)
+        {
+        case zlib:
+        {
+            Compressor<zlib> *compressor = new Compressor<zlib>();
+            compressor->parameter.level = _level;
+            return compressor;
+        }
+        case lzo:
+            return new Compressor<lzo>();
+        case rle:
+            return new Compressor<rle>();
+        case bzip2:
+        {
+            Compressor<bzip2> *compressor = new Compressor<bzip2>();
+            compressor->parameter.level = _level;
+            return compressor;
+        }
+        }
+        return NULL;
+    }
+
+    DecompressorImpl *createDecompressor() const
+    {
+        switch(_method)
+        {
+        case zlib:  return new Decompressor<zlib>();
+        case lzo:   return new Decompressor<lzo>();
+        case rle:   return new Decompressor<rle>();
+        case bzip2: return new Decompressor<bzip2>();
+        }
+        return NULL;
+    }
+
+    /* Number of rows in the block with the given index */
+    size_t getBlockRowCount(size_t iBlock) const
+    {
+        size_t begin = iBlock * _nRowsInBlock;
+        return (begin + _nRowsInBlock < _obsnum ? _nRowsInBlock : _obsnum - begin);
+    }
+
+    void compressTable(NumericTable *table)
+    {
+        if(!table)
+        {
+            this->_errors->add(services::ErrorNullInputNumericTable);
+            return;
+        }
+
+        const size_t ncols = table->getNumberOfColumns();
+        const size_t nrows = table->getNumberOfRows();
+        setNumberOfColumns(ncols);
+        NumericTableFeature df;
+        df.setType<DataType>();
+        _ddict->setAllFeatures(df);
+
+        if(ncols == 0 || nrows == 0) { return; }
+
+        if(_nRowsInBlock == 0)
+        {
+            const size_t blockSize = 64 * 1024;
+            _nRowsInBlock = blockSize / (ncols * sizeof(DataType));
+            if(_nRowsInBlock == 0) { _nRowsInBlock = 1; }
+        }
+        _nBlocks = (nrows + _nRowsInBlock - 1) / _nRowsInBlock;
+        _obsnum  = nrows;
+
+        _blocks     = (byte **)daal::services::daal_malloc(_nBlocks * sizeof(byte *));
+        _blockSizes = (size_t *)daal::services::daal_malloc(_nBlocks * sizeof(size_t));
+        for(size_t i = 0; _blocks && _blockSizes && i < _nBlocks; i++)
+        {
+            _blocks[i]     = NULL;
+            _blockSizes[i] = 0;
+        }
+        size_t bufferSize = _nRowsInBlock * ncols * sizeof(DataType);
+        bufferSize += bufferSize / 8 + 1024;
+        byte *buffer = (byte *)daal::services::daal_malloc(bufferSize);
+        CompressorImpl *compressor = createCompressor();
+        if(!_blocks || !_blockSizes || !buffer || !compressor)
+        {
+            daal::services::daal_free(buffer);
+            delete compressor;
+            freeDataMemory();
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        bool isOk = true;
+        BlockDescriptor<DataType> block;
+        for(size_t i = 0; i < _nBlocks && isOk; i++)
+        {
+            const size_t nBlockRows = getBlockRowCount(i);
+            table->getBlockOfRows(i * _nRowsInBlock, nBlockRows, readOnly, block);
+
+            size_t usedSize = 0;
+            isOk = internal::processDataBlock(compressor, (byte *)block.getBlockPtr(), nBlockRows * ncols * sizeof(DataType),
+                                              &buffer, &bufferSize, 0, &usedSize, true);
+            table->releaseBlockOfRows(block);
+            if(!isOk)
+            {
+                this->_errors->add(compressor->getErrors()->getErrors());
+                break;
+            }
+
+            _blocks[i] = (byte *)daal::services::daal_malloc(usedSize);
+            if(!_blocks[i])
+            {
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+                isOk = false;
+                break;
+            }
+            daal::services::daal_memcpy_s(_blocks[i], usedSize, buffer, usedSize);
+            _blockSizes[i] = usedSize;
+        }
+
+        daal::services::daal_free(buffer);
+        delete compressor;
+
+        if(!isOk)
+        {
+            freeDataMemory();
+            return;
+        }
+        _memStatus = internallyAllocated;
+    }
+
+    bool decompressBlock(CacheEntry &entry, size_t iBlock)
+    {
+        const size_t ncols = getNumberOfColumns();
+        entry.isValid = false;
+
+        if(!entry.decompressor)
+        {
+            entry.decompressor = createDecompressor();
+        }
+        if(!entry.rows)
+        {
+            entry.rows = (DataType *)daal::services::daal_malloc(_nRowsInBlock * ncols * sizeof(DataType));
+        }
+        if(!entry.decompressor || !entry.rows)
+        {
+            addError(services::ErrorMemoryAllocationFailed);
+            return false;
+        }
+
+        const size_t expectedSize = getBlockRowCount(iBlock) * ncols * sizeof(DataType);
+        byte *out = (byte *)entry.rows;
+        size_t outSize = _nRowsInBlock * ncols * sizeof(DataType);
+        size_t usedSize = 0;
+        if(!internal::processDataBlock(entry.decompressor, _blocks[iBlock], _blockSizes[iBlock], &out, &outSize, 0, &usedSize, false))
+        {
+            /* The decompressor that failed is replaced on the next use */
+            addError(entry.decompressor->getErrors()->getErrors());
+            delete entry.decompressor;
+            entry.decompressor = NULL;
+            return false;
+        }
+        if(usedSize != expectedSize)
+        {
+            addError(services::ErrorCompressionFrameFormat);
+            return false;
+        }
+
+        entry.block   = iBlock;
+        entry.isValid = true;
+        return true;
+    }
+
+    /*
+     * Acquires a cache entry that contains the decompressed block. If all entries are used by other threads,
+     * the block is decompressed to the local entry of the caller. Returns NULL if the block cannot be decompressed
+     */
+    CacheEntry *acquireBlock(size_t iBlock, CacheEntry &localEntry)
+    {
+        /* An entry that already holds the block is preferred. The contents of an entry are checked only under its lock */
+        for(size_t i = 0; i < _nCacheEntries; i++)
+        {
+            CacheEntry &entry = _cache[i];
+            if(tryLock(entry))
+            {
+                if(entry.isValid && entry.block == iBlock) { return &entry; }
+                entry.lock.dec();
+            }
+        }
+
+        for(size_t i = 0; i < _nCacheEntries; i++)
+        {
+            CacheEntry &entry = _cache[i];
+            if(tryLock(entry))
+            {
+                if(entry.isValid && entry.block == iBlock) { return &entry; }
+                if(decompressBlock(entry, iBlock)) { return &entry; }
+                entry.lock.dec();
+                return NULL;
+            }
+        }
+
+        if(localEntry.isValid && localEntry.block == iBlock) { return &localEntry; }
+        return (decompressBlock(localEntry, iBlock) ? &localEntry : NULL);
+    }
+
+    static bool tryLock(CacheEntry &entry)
+    {
+        if(entry.lock.inc() == 1) { return true; }
+        entry.lock.dec();
+        return false;
+    }
+
+    static void releaseEntry(CacheEntry *entry, CacheEntry &localEntry)
+    {
+        if(entry != &localEntry) { entry->lock.dec(); }
+    }
+
+    /* Adds an error to the collection of errors of the table, the blocks of rows can be read by several threads */
+    template <typename ErrorType>
+    void addError(const ErrorType &error)
+    {
+        while(_errorsLock.inc() != 1)
+        {
+            _errorsLock.dec();
+        }
+        this->_errors->add(error);
+        _errorsLock.dec();
+    }
+
+    template <typename T>
+    void getTBlock( size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> &block )
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs = getNumberOfRows();
+        block.setDetails( 0, idx, rwFlag );
+
+        if( rwFlag & (int)writeOnly )
+        {
+            addError(services::ErrorMethodNotSupported);
+            return;
+        }
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( ncols, 0 );
+            return;
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeBuffer( ncols, nrows ) )
+        {
+            addError(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        T *dst = block.getBlockPtr();
+        const size_t firstBlock = idx / _nRowsInBlock;
+        const size_t lastBlock  = (idx + nrows - 1) / _nRowsInBlock;
+        CacheEntry localEntry;
+        for(size_t iBlock = firstBlock; iBlock <= lastBlock; iBlock++)
+        {
+            CacheEntry *entry = acquireBlock(iBlock, localEntry);
+            if(!entry) { break; }
+
+            const size_t blockBegin = iBlock * _nRowsInBlock;
+            const size_t rowBegin = (idx > blockBegin ? idx : blockBegin);
+            const size_t rowEnd = (idx + nrows < blockBegin + _nRowsInBlock ? idx + nrows : blockBegin + _nRowsInBlock);
+            const DataType *src = entry->rows + (rowBegin - blockBegin) * ncols;
+            T *blockDst = dst + (rowBegin - idx) * ncols;
+            const size_t n = (rowEnd - rowBegin) * ncols;
+            for(size_t i = 0; i < n; i++)
+            {
+                blockDst[i] = static_cast<T>(src[i]);
+            }
+            releaseEntry(entry, localEntry);
+        }
+        clearEntry(localEntry);
+    }
+
+    template <typename T>
+    void getTFeature( size_t feat_idx, size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T> &block )
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs = getNumberOfRows();
+        block.setDetails( feat_idx, idx, rwFlag );
+
+        if( rwFlag & (int)writeOnly )
+        {
+            addError(services::ErrorMethodNotSupported);
+            return;
+        }
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( 1, 0 );
+            return;
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        if( !block.resizeBuffer( 1, nrows ) )
+        {
+            addError(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        T *dst = block.getBlockPtr();
+        const size_t firstBlock = idx / _nRowsInBlock;
+        const size_t lastBlock  = (idx + nrows - 1) / _nRowsInBlock;
+        CacheEntry localEntry;
+        for(size_t iBlock = firstBlock; iBlock <= lastBlock; iBlock++)
+        {
+            CacheEntry *entry = acquireBlock(iBlock, localEntry);
+            if(!entry) { break; }
+
+            const size_t blockBegin = iBlock * _nRowsInBlock;
+            const size_t rowBegin = (idx > blockBegin ? idx : blockBegin);
+            const size_t rowEnd = (idx + nrows < blockBegin + _nRowsInBlock ? idx + nrows : blockBegin + _nRowsInBlock);
+            const DataType *src = entry->rows + (rowBegin - blockBegin) * ncols + feat_idx;
+            T *blockDst = dst + (rowBegin - idx);
+            for(size_t i = 0; i < rowEnd - rowBegin; i++)
+            {
+                blockDst[i] = static_cast<T>(src[i * ncols]);
+            }
+            releaseEntry(entry, localEntry);
+        }
+        clearEntry(localEntry);
+    }
+};
+} // namespace interface1
+using interface1::CompressedNumericTable;
+
+} // namespace data_management
+} // namespace daal
+
+#endif
@@ -59,6 +59,17 @@ public:
      */
     virtual void write(byte *ptr, size_t size) = 0;
 
+    /**
+     *  Adds data to an archive. Archives that support scatter/gather serialization store a reference to the data
+     *  instead of copying it, so the data must not be changed or deallocated while the archive is used
+     *  \param[in]  ptr  Pointer to the data represented in the byte format
+     *  \param[in]  size Size of the data array
+     */
+    virtual void writeReference(byte *ptr, size_t size)
+    {
+        write(ptr, size);
+    }
+
     /**
      *  Copies the content of an archive into a byte array
      *  \param[in]  ptr  Pointer to the array that represents the data
@@ -66,6 +77,19 @@ public:
      */
     virtual void read(byte *ptr, size_t size) = 0;
 
+    /**
+     *  Skips the data in an archive and returns a pointer to the data in the memory of the archive without copying it
+     *  \param[in]  size      Size of the data
+     *  \param[in]  alignment Required alignment of the pointer in bytes
+     *  \param[out] buffer    Shared pointer to the memory of the archive that must be kept while the data is used
+     *  \return Pointer to the data or NULL if the archive does not support deserialization in place
+     *          or the data is not aligned. In the latter case the data is not read from the archive
+     */
+    virtual byte *readReference(size_t size, size_t alignment, services::SharedPtr<byte> &buffer)
+    {
+        return 0;
+    }
+
     /**
      *  Returns the size of an archive
      *  \return Size of the archive in bytes
@@ -92,6 +116,28 @@ public:
      */
     virtual size_t copyArchiveToArray( byte *ptr, size_t maxLength ) const = 0;
 
+    /**
+     *  Returns the number of contiguous memory segments of an archive
+     *  \return Number of segments
+     */
+    virtual size_t getNumberOfSegments()
+    {
+        return (getSizeOfArchive() > 0 ? 1 : 0);
+    }
+
+    /**
+     *  Returns a contiguous memory segment of an archive. The segments taken in the order of their indices
+     *  contain the same data as the array returned by getArchiveAsArray()
+     *  \param[in]  index  Index of the segment
+     *  \param[out] ptr    Pointer to the data of the segment
+     *  \param[out] size   Size of the segment in bytes
+     */
+    virtual void getSegment(size_t index, const byte **ptr, size_t *size)
+    {
+        *ptr  = getArchiveAsArray();
+        *size = getSizeOfArchive();
+    }
+
     /**
      * Sets the major version of the archive
      * \param[in] majorVersion The major version of the archive
@@ -251,12 +297,38 @@ public:
         blockOffset[currentWriteBlock] += size;
     }
 
+    /**
+     *  Constructor of a data archive that uses data in a byte array without copying it.
+     *  Objects deserialized from the archive can use the memory of the array as their storage
+     *  \param[in]  ptr  Shared pointer to the array that represents the data
+     *  \param[in]  size Size of the data array
+     */
+    DataArchive( const services::SharedPtr<byte> &ptr, size_t size ) : minBlockSize(1024 * 16), minBlocksNum(16),
+        _errors(new services::ErrorCollection()), sharedBuffer(ptr)
+    {
+        blockPtr           = 0;
+        blockAllocatedSize = 0;
+        blockOffset        = 0;
+        arraysSize         = 0;
+        currentWriteBlock  = -1;
+
+        currentReadBlock   = 0;
+        currentReadBlockOffset = 0;
+
+        serializedBuffer   = 0;
+
+        addReferenceBlock( ptr.get(), size );
+    }
+
     ~DataArchive()
     {
         int i;
         for(i = 0; i <= currentWriteBlock; i++)
         {
-            daal::services::daal_free( blockPtr[i] );
+            if( !isReferenceBlock(i) )
+            {
+                daal::services::daal_free( blockPtr[i] );
+            }
         }
         daal::services::daal_free( blockPtr           );
         daal::services::daal_free( blockAllocatedSize );
@@ -286,6 +358,25 @@ public:
         blockOffset[currentWriteBlock] += alignedSize;
     }
 
+    void writeReference(byte *ptr, size_t size) DAAL_C11_OVERRIDE
+    {
+        if( size == 0 ) { return; }
+
+        addReferenceBlock( ptr, size );
+
+        /* Padding is stored in a new block that is used for the next writes */
+        size_t paddingSize = alignValueUp(size) - size;
+        if( paddingSize > 0 )
+        {
+            addBlock(paddingSize);
+            for (size_t i = 0; i < paddingSize; i++)
+            {
+                blockPtr[currentWriteBlock][i] = 0;
+            }
+            blockOffset[currentWriteBlock] = paddingSize;
+        }
+    }
+
     void read(byte *ptr, size_t size) DAAL_C11_OVERRIDE
     {
         size_t alignedSize = alignValueUp(size);
@@ -305,6 +396,28 @@ public:
         }
     }
 
+    byte *readReference(size_t size, size_t alignment, services::SharedPtr<byte> &buffer) DAAL_C11_OVERRIDE
+    {
+        /* Only the memory shared with the owner of the serialized data can outlive the archive */
+        if( !sharedBuffer.get() || currentReadBlock > currentWriteBlock ) { return 0; }
+
+        size_t alignedSize = alignValueUp(size);
+        if( blockOffset[currentReadBlock] < currentReadBlockOffset + alignedSize ) { return 0; }
+
+        byte *ptr = &(blockPtr[currentReadBlock][currentReadBlockOffset]);
+        if( alignment > 1 && ((size_t)ptr) % alignment != 0 ) { return 0; }
+
+        currentReadBlockOffset += alignedSize;
+        if( blockOffset[currentReadBlock] == currentReadBlockOffset )
+        {
+            currentReadBlock++;
+            currentReadBlockOffset = 0;
+        }
+
+        buffer = sharedBuffer;
+        return ptr;
+    }
+
     size_t getSizeOfArchive() const DAAL_C11_OVERRIDE
     {
         int i;
@@ -360,6 +473,33 @@ public:
         return length;
     }
 
+    size_t getNumberOfSegments() DAAL_C11_OVERRIDE
+    {
+        size_t nSegments = 0;
+        for(int i = 0; i <= currentWriteBlock; i++)
+        {
+            if( blockOffset[i] > 0 ) { nSegments++; }
+        }
+        return nSegments;
+    }
+
+    void getSegment(size_t index, const byte **ptr, size_t *size) DAAL_C11_OVERRIDE
+    {
+        *ptr  = 0;
+        *size = 0;
+        for(int i = 0; i <= currentWriteBlock; i++)
+        {
+            if( blockOffset[i] == 0 ) { continue; }
+            if( index == 0 )
+            {
+                *ptr  = blockPtr[i];
+                *size = blockOffset[i];
+                return;
+            }
+            index--;
+        }
+    }
+
     /**
      * Returns errors during the computation
      * \return Errors during the computation
@@ -372,6 +512,35 @@ public:
 protected:
 
     void addBlock( size_t minNewSize )
+    {
+        if( !addBlockDescriptor() ) { return; }
+
+        size_t allocationSize = (minBlockSize > minNewSize) ? minBlockSize : minNewSize;
+
+        blockPtr          [currentWriteBlock] = (byte *)daal::services::daal_malloc(allocationSize);
+        blockAllocatedSize[currentWriteBlock] = allocationSize;
+        blockOffset       [currentWriteBlock] = 0;
+    }
+
+    /**
+     *  Adds a block that references external memory. Such blocks have zero allocated size,
+     *  so the next write adds a new block, and are not deallocated by the archive
+     */
+    void addReferenceBlock( byte *ptr, size_t size )
+    {
+        if( !addBlockDescriptor() ) { return; }
+
+        blockPtr          [currentWriteBlock] = ptr;
+        blockAllocatedSize[currentWriteBlock] = 0;
+        blockOffset       [currentWriteBlock] = size;
+    }
+
+    bool isReferenceBlock( int i ) const
+    {
+        return (blockAllocatedSize[i] == 0);
+    }
+
+    bool addBlockDescriptor()
     {
         if( currentWriteBlock + 1 == arraysSize )
         {
@@ -383,7 +552,7 @@ protected:
             blockAllocatedSize = (size_t *)daal::services::daal_malloc(sizeof(size_t) * (arraysSize + minBlocksNum));
             blockOffset        = (size_t *)daal::services::daal_malloc(sizeof(size_t) * (arraysSize + minBlocksNum));
 
-            if( blockPtr == 0 || blockAllocatedSize == 0 || blockOffset == 0 ) { return; }
+            if( blockPtr == 0 || blockAllocatedSize == 0 || blockOffset == 0 ) { return false; }
 
             daal::services::daal_memcpy_s(blockPtr,           arraysSize * sizeof(byte *), oldBlockPtr,           arraysSize * sizeof(byte *));
             daal::services::daal_memcpy_s(blockAllocatedSize, arraysSize * sizeof(size_t), oldBlockAllocatedSize, arraysSize * sizeof(size_t));
@@ -397,12 +566,7 @@ protected:
         }
 
         currentWriteBlock++;
-
-        size_t allocationSize = (minBlockSize > minNewSize) ? minBlockSize : minNewSize;
-
-        blockPtr          [currentWriteBlock] = (byte *)daal::services::daal_malloc(allocationSize);
-        blockAllocatedSize[currentWriteBlock] = allocationSize;
-        blockOffset       [currentWriteBlock] = 0;
+        return true;
     }
 
     inline size_t alignValueUp(size_t value)
@@ -437,6 +601,8 @@ private:
     size_t  currentReadBlockOffset;
 
     byte   *serializedBuffer;
+
+    services::SharedPtr<byte> sharedBuffer;  /*!< Memory of the archive shared with objects deserialized in place */
 };
 
 /**
@@ -452,7 +618,7 @@ public:
      *  Constructor of a compressed data archive from compressor
      *  \param[in]  compressor  Pointer to the compressor
      */
-    CompressedDataArchive(daal::data_management::CompressorImpl *compressor) : minBlockSize(1024 * 64),
+    CompressedDataArchive(daal::data_management::interface1::CompressorImpl *compressor) : minBlockSize(1024 * 64),
         _errors(new services::ErrorCollection())
     {
         compressionStream = new daal::data_management::CompressionStream(compressor, minBlockSize);
@@ -546,7 +712,7 @@ public:
      *  Constructor of a decompressed data archive from decompressor
      *  \param[in]  decompressor  Pointer to the decompressor
      */
-    DecompressedDataArchive(daal::data_management::DecompressorImpl *decompressor) : minBlockSize(1024 * 64),
+    DecompressedDataArchive(daal::data_management::interface1::DecompressorImpl *decompressor) : minBlockSize(1024 * 64),
         _errors(new services::ErrorCollection())
     {
         decompressionStream = new daal::data_management::DecompressionStream(decompressor, minBlockSize);
@@ -640,7 +806,7 @@ public:
     /**
      *  Default constructor
      */
-    InputDataArchive() : _finalized(false), _errors(new services::ErrorCollection())
+    InputDataArchive() : _finalized(false), _errors(new services::ErrorCollection()), _minReferencedArraySize(0)
     {
         _arch = new DataArchive;
         archiveHeader();
@@ -649,8 +815,8 @@ public:
     /**
      *  Constructor of an input data archive to a byte array of compressed data
      */
-    InputDataArchive(daal::data_management::CompressorImpl *compressor) : _finalized(false),
-        _errors(new services::ErrorCollection())
+    InputDataArchive(daal::data_management::interface1::CompressorImpl *compressor) : _finalized(false),
+        _errors(new services::ErrorCollection()), _minReferencedArraySize(0)
     {
         _arch = new CompressedDataArchive(compressor);
         archiveHeader();
@@ -727,7 +893,27 @@ public:
     template<typename T>
     void set(T *ptr, size_t size)
     {
-        _arch->write( (byte *)ptr, size * sizeof(T) );
+        size_t nBytes = size * sizeof(T);
+        if( _minReferencedArraySize > 0 && nBytes >= _minReferencedArraySize )
+        {
+            _arch->writeReference( (byte *)ptr, nBytes );
+        }
+        else
+        {
+            _arch->write( (byte *)ptr, nBytes );
+        }
+    }
+
+    /**
+     *  Enables scatter/gather serialization: arrays of at least the specified size serialized after the call
+     *  are stored in the archive as references to the memory of the serialized objects instead of copies.
+     *  The objects must not be changed or deallocated while the archive is used.
+     *  Use getNumberOfSegments() and getArchiveSegment() to access the archive without copying it into one array
+     *  \param[in]   size  Minimum size of the referenced arrays in bytes, 0 disables the references
+     */
+    void setMinReferencedArraySize( size_t size )
+    {
+        _minReferencedArraySize = size;
     }
 
     /**
@@ -819,6 +1005,31 @@ public:
         return _arch->copyArchiveToArray( ptr, maxLength );
     }
 
+    /**
+     *  Returns the number of contiguous memory segments of a data archive
+     *  \return Number of segments
+     */
+    size_t getNumberOfSegments()
+    {
+        if(!_finalized) { archiveFooter(); }
+
+        return _arch->getNumberOfSegments();
+    }
+
+    /**
+     *  Returns a contiguous memory segment of a data archive. The segments taken in the order of their indices,
+     *  for example, as an array of iovec structures, contain the same data as the array returned by getArchiveAsArray()
+     *  \param[in]   index Index of the segment
+     *  \param[out]  ptr   Pointer to the data of the segment
+     *  \param[out]  size  Size of the segment in bytes
+     */
+    void getArchiveSegment( size_t index, const byte **ptr, size_t *size )
+    {
+        if(!_finalized) { archiveFooter(); }
+
+        _arch->getSegment( index, ptr, size );
+    }
+
     /**
      *  Returns a data archive object of the InputDataArchive type
      *  \return Data archive object
@@ -841,6 +1052,7 @@ protected:
     DataArchiveIface *_arch;
     bool        _finalized;
     services::SharedPtr<services::ErrorCollection> _errors;
+    size_t      _minReferencedArraySize;
 };
 
 /**
@@ -868,10 +1080,21 @@ public:
         archiveHeader();
     }
 
+    /**
+     *  Constructor of an output data archive from a byte array that is not copied.
+     *  Numeric tables deserialized from the archive use the memory of the array as their storage
+     *  and share its ownership
+     */
+    OutputDataArchive( const services::SharedPtr<byte> &ptr, size_t size ) : _errors(new services::ErrorCollection())
+    {
+        _arch = new DataArchive(ptr, size);
+        archiveHeader();
+    }
+
     /**
      *  Constructor of an output data archive from a byte array of compressed data
      */
-    OutputDataArchive( daal::data_management::DecompressorImpl *decompressor, byte *ptr, size_t size ) :
+    OutputDataArchive( daal::data_management::interface1::DecompressorImpl *decompressor, byte *ptr, size_t size ) :
         _errors(new services::ErrorCollection())
     {
         _arch = new DecompressedDataArchive(decompressor);
@@ -946,6 +1169,20 @@ public:
         _arch->read( (byte *)ptr, size * sizeof(T) );
     }
 
+    /**
+     *  Performs data deserialization of an array of values of the basic datatype without copying the array
+     *  \tparam  T           Basic datatype
+     *  \param[in]   size    Number of elements in the array
+     *  \param[out]  buffer  Shared pointer to the memory of the archive that must be kept while the array is used
+     *  \return Pointer to the array in the memory of the archive, or NULL if the archive does not support
+     *          deserialization in place. In the latter case the array is not read from the archive
+     */
+    template<typename T>
+    T *getArrayReference(size_t size, services::SharedPtr<byte> &buffer)
+    {
+        return (T *)_arch->readReference( size * sizeof(T), sizeof(T), buffer );
+    }
+
     /**
      *  Performs data deserialization of a data segment
      *  \tparam  T        Class that implements SerializationIface
@@ -58,7 +58,7 @@ public:
      *  \param[in]  ddict   Pointer to the predefined NumericTableDictionary
      */
     HomogenNumericTable( NumericTableDictionary *ddict ):
-        NumericTable(ddict), _ptr(0)
+        NumericTable(ddict), _ptr(0), _hasAllocationPolicy(false)
     {
         _layout = aos;
     }
@@ -68,7 +68,7 @@ public:
      *  \param[in]  ddict   Pointer to the predefined NumericTableDictionary
      */
     HomogenNumericTable( services::SharedPtr<NumericTableDictionary> ddict ):
-        NumericTable(ddict), _ptr(0)
+        NumericTable(ddict), _ptr(0), _hasAllocationPolicy(false)
     {
         _layout = aos;
     }
@@ -80,7 +80,7 @@ public:
      *  \param[in]  nRows       Number of rows in the table
      */
     HomogenNumericTable( DataType *const ptr = 0, size_t nColumns = 0, size_t nRows = 0 ):
-        NumericTable( nColumns, nRows ), _ptr(0)
+        NumericTable( nColumns, nRows ), _ptr(0), _hasAllocationPolicy(false)
     {
         _layout = aos;
         setArray( ptr );
@@ -98,7 +98,7 @@ public:
      *  \param[in]  constValue  Constant to initialize entries of the homogeneous numeric table
      */
     HomogenNumericTable( DataType *const ptr, size_t nColumns, size_t nRows, const DataType &constValue ):
-        NumericTable( nColumns, nRows ), _ptr(0)
+        NumericTable( nColumns, nRows ), _ptr(0), _hasAllocationPolicy(false)
     {
         _layout = aos;
         setArray( ptr );
@@ -117,7 +117,7 @@ public:
      *  \param[in]  memoryAllocationFlag    Flag that controls internal memory allocation for data in the numeric table
      */
     HomogenNumericTable( size_t nColumns, size_t nRows, AllocationFlag memoryAllocationFlag ):
-        NumericTable( nColumns, nRows ), _ptr(0)
+        NumericTable( nColumns, nRows ), _ptr(0), _hasAllocationPolicy(false)
     {
         _layout = aos;
 
@@ -137,7 +137,7 @@ public:
      */
     HomogenNumericTable( size_t nColumns, size_t nRows, NumericTable::AllocationFlag memoryAllocationFlag,
                          const DataType &constValue ):
-        NumericTable( nColumns, nRows ), _ptr(0)
+        NumericTable( nColumns, nRows ), _ptr(0), _hasAllocationPolicy(false)
     {
         _layout = aos;
 
@@ -151,6 +151,50 @@ public:
         assign( constValue );
     }
 
+    /**
+     *  Constructor for a Numeric Table with memory allocation controlled via a flag and a policy of allocation
+     *  and filling the table with a constant
+     *  \param[in]  nColumns                Number of columns in the table
+     *  \param[in]  nRows                   Number of rows in the table
+     *  \param[in]  memoryAllocationFlag    Flag that controls internal memory allocation for data in the numeric table
+     *  \param[in]  constValue              Constant to initialize entries of the homogeneous numeric table
+     *  \param[in]  policy                  Page size and placement of the internally allocated memory, \ref services::AllocationPolicy
+     */
+    HomogenNumericTable( size_t nColumns, size_t nRows, NumericTable::AllocationFlag memoryAllocationFlag,
+                         const DataType &constValue, const services::AllocationPolicy &policy ):
+        NumericTable( nColumns, nRows ), _ptr(0), _hasAllocationPolicy(true), _allocationPolicy(policy)
+    {
+        _layout = aos;
+
+        NumericTableFeature df;
+        df.setType<DataType>();
+        _ddict->setAllFeatures(df);
+
+        if( memoryAllocationFlag == doAllocate ) { allocateDataMemory(); }
+
+        assign( constValue );
+    }
+
+    /**
+     *  Constructor for a Numeric Table with memory allocation controlled via a flag and a policy of allocation
+     *  \param[in]  nColumns                Number of columns in the table
+     *  \param[in]  nRows                   Number of rows in the table
+     *  \param[in]  memoryAllocationFlag    Flag that controls internal memory allocation for data in the numeric table
+     *  \param[in]  policy                  Page size and placement of the internally allocated memory, \ref services::AllocationPolicy
+     */
+    HomogenNumericTable( size_t nColumns, size_t nRows, NumericTable::AllocationFlag memoryAllocationFlag,
+                         const services::AllocationPolicy &policy ):
+        NumericTable( nColumns, nRows ), _ptr(0), _hasAllocationPolicy(true), _allocationPolicy(policy)
+    {
+        _layout = aos;
+
+        NumericTableFeature df;
+        df.setType<DataType>();
+        _ddict->setAllFeatures(df);
+
+        if( memoryAllocationFlag == doAllocate ) { allocateDataMemory(); }
+    }
+
     virtual ~HomogenNumericTable()
     {
         freeDataMemory();
@@ -183,6 +227,17 @@ public:
         return _ptr;
     }
 
+    /**
+     *  Sets the page size and placement of the memory allocated by allocateDataMemory.
+     *  The policy overrides the default policy of daal_malloc
+     *  \param[in] policy  Allocation policy, \ref services::AllocationPolicy
+     */
+    void setAllocationPolicy( const services::AllocationPolicy &policy )
+    {
+        _allocationPolicy = policy;
+        _hasAllocationPolicy = true;
+    }
+
     /**
      *  Sets a pointer to a homogeneous data set
      *  \param[in] ptr Pointer to the data set in the homogeneous format
@@ -309,7 +364,7 @@ public:
             }
         }
 
-        _ptr = (DataType *)daal::services::daal_malloc( size * sizeof(DataType) );
+        _ptr = (DataType *)services::internal::allocateTableData( size * sizeof(DataType), _hasAllocationPolicy ? &_allocationPolicy : NULL );
 
         if( _ptr == 0 )
         {
@@ -328,6 +383,7 @@ public:
         }
 
         _ptr = 0;
+        _archiveBuffer = services::SharedPtr<byte>();
         _memStatus = notAllocated;
     }
 
@@ -342,18 +398,45 @@ public:
     {
         NumericTable::serialImpl<Archive, onDeserialize>( archive );
 
+        size_t size = getNumberOfColumns() * getNumberOfRows();
+
         if( onDeserialize )
         {
+            if( deserializeInPlace( archive, size ) ) { return; }
+
             allocateDataMemory();
         }
 
-        size_t size = getNumberOfColumns() * getNumberOfRows();
-
         archive->set( _ptr, size );
     }
 
 protected:
+    bool deserializeInPlace( InputDataArchive *archive, size_t size )
+    {
+        return false;
+    }
+
+    /* Uses the memory of the archive as the storage of the table if the archive was created from a shared buffer */
+    bool deserializeInPlace( OutputDataArchive *archive, size_t size )
+    {
+        if( size == 0 ) { return false; }
+
+        services::SharedPtr<byte> buffer;
+        DataType *ptr = archive->getArrayReference<DataType>( size, buffer );
+        if( !ptr ) { return false; }
+
+        freeDataMemory();
+
+        _ptr = ptr;
+        _archiveBuffer = buffer;
+        _memStatus = userAllocated;
+        return true;
+    }
+
     DataType *_ptr;
+    services::SharedPtr<byte> _archiveBuffer;  /*!< Archive memory used as the storage after deserialization in place */
+    bool _hasAllocationPolicy;                  /*!< True if the memory is allocated with _allocationPolicy */
+    services::AllocationPolicy _allocationPolicy;
 
 private:
     DataType *internal_getBlockOfRows( size_t idx )
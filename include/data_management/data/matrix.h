@@ -84,6 +84,30 @@ public:
             const DataType &constValue ):
         HomogenNumericTable<DataType>( nColumns, nRows, memoryAllocationFlag, constValue ) { }
 
+    /**
+     *  Constructor for a Numeric Table with memory allocation controlled via a flag and a policy of allocation
+     *  \param[in]  nColumns                Number of columns in the table
+     *  \param[in]  nRows                   Number of rows in the table
+     *  \param[in]  memoryAllocationFlag    Flag that controls internal memory allocation for data in the numeric table
+     *  \param[in]  policy                  Page size and placement of the internally allocated memory, \ref services::AllocationPolicy
+     */
+    Matrix( size_t nColumns,   size_t nRows,   NumericTable::AllocationFlag memoryAllocationFlag,
+            const services::AllocationPolicy &policy ):
+        HomogenNumericTable<DataType>( nColumns, nRows, memoryAllocationFlag, policy ) { }
+
+    /**
+     *  Constructor for a Numeric Table with memory allocation controlled via a flag and a policy of allocation
+     *  and filling the table with a constant
+     *  \param[in]  nColumns                Number of columns in the table
+     *  \param[in]  nRows                   Number of rows in the table
+     *  \param[in]  memoryAllocationFlag    Flag that controls internal memory allocation for data in the numeric table
+     *  \param[in]  constValue              Constant to initialize entries of the homogeneous numeric table
+     *  \param[in]  policy                  Page size and placement of the internally allocated memory, \ref services::AllocationPolicy
+     */
+    Matrix( size_t nColumns,   size_t nRows,   NumericTable::AllocationFlag memoryAllocationFlag,
+            const DataType &constValue, const services::AllocationPolicy &policy ):
+        HomogenNumericTable<DataType>( nColumns, nRows, memoryAllocationFlag, constValue, policy ) { }
+
     /** \private */
     virtual ~Matrix() { }
 
@@ -0,0 +1,492 @@
+/* file: row_merged_numeric_table.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of row merged numeric table.
+//--
+*/
+
+
+#ifndef __ROW_MERGED_NUMERIC_TABLE_H__
+#define __ROW_MERGED_NUMERIC_TABLE_H__
+
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/data_collection.h"
+#include "services/collection.h"
+#include "services/daal_memory.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace interface1
+{
+
+/**
+ *  <a name="DAAL-CLASS-ROWMERGEDNUMERICTABLE"></a>
+ *  \brief Class that provides methods to access a collection of numeric tables as if they are joined by rows.
+ *  The tables are not copied: adding a table takes time that does not depend on the number of rows already in the table.
+ *  A block of rows or column values that lies within one table is obtained from that table directly,
+ *  so no copy is made if the table provides direct access to its memory
+ */
+class RowMergedNumericTable : public NumericTable
+{
+public:
+    /**
+     *  Constructor for an empty row merged Numeric Table
+     */
+    RowMergedNumericTable() : NumericTable(0, 0), _tables(new DataCollection)
+    {
+        _rowOffsets.push_back(0);
+    }
+
+    /**
+     *  Constructor for a row merged Numeric Table consisting of one table
+     *  \param[in]  table       Pointer to the table
+     */
+    RowMergedNumericTable( services::SharedPtr<NumericTable> table) : NumericTable(0, 0), _tables(new DataCollection)
+    {
+        _rowOffsets.push_back(0);
+        addNumericTable(table);
+    }
+
+    /**
+     *  Constructor for a row merged Numeric Table consisting of two tables
+     *  \param[in]  first      Pointer to the first table
+     *  \param[in]  second     Pointer to the second table
+     */
+    RowMergedNumericTable( services::SharedPtr<NumericTable> first, services::SharedPtr<NumericTable> second ):
+        NumericTable(0, 0), _tables(new DataCollection)
+    {
+        _rowOffsets.push_back(0);
+        addNumericTable(first);
+        addNumericTable(second);
+    }
+
+    /**
+     *  Adds the table below the rows of the row merged Numeric Table.
+     *  The table must have the same number of columns as the tables that are already added
+     *  \param[in] table Pointer to the table
+     */
+    void addNumericTable(services::SharedPtr<NumericTable> table)
+    {
+        if (table->getDataLayout() & csrArray)
+        {
+            this->_errors->add(services::ErrorIncorrectTypeOfInputNumericTable);
+            return;
+        }
+
+        size_t cols = table->getNumberOfColumns();
+
+        if (_tables->size() == 0)
+        {
+            setNumberOfColumns(cols);
+            for (size_t i = 0; i < cols; i++)
+            {
+                NumericTableFeature &f = table->getDictionary()->operator[](i);
+                _ddict->setFeature(f, i);
+            }
+        }
+        else if (cols != getNumberOfColumns())
+        {
+            this->_errors->add(services::ErrorIncorrectNumberOfColumns);
+            return;
+        }
+
+        _tables->push_back(table);
+
+        size_t obs = _rowOffsets[_rowOffsets.size() - 1] + table->getNumberOfRows();
+        _rowOffsets.push_back(obs);
+        _obsnum = obs;
+        _memStatus = userAllocated;
+    }
+
+    /**
+     *  Returns the number of tables in the row merged Numeric Table
+     *  \return Number of tables
+     */
+    size_t getNumberOfTables() const { return _tables->size(); }
+
+    /**
+     *  Sets the number of rows that are accessible in the row merged Numeric Table.
+     *  The number of rows cannot exceed the total number of rows in the merged tables
+     *  \param[in] nrow Number of rows
+     */
+    void setNumberOfRows(size_t nrow) DAAL_C11_OVERRIDE
+    {
+        if (nrow > _rowOffsets[_rowOffsets.size() - 1])
+        {
+            this->_errors->add(services::ErrorIncorrectNumberOfRows);
+            return;
+        }
+        _obsnum = nrow;
+    }
+
+    void allocateDataMemory() DAAL_C11_OVERRIDE
+    {
+        for (size_t i = 0;i < _tables->size(); i++)
+        {
+            NumericTable* nt = (NumericTable*)(_tables->operator[](i).get());
+            nt->allocateDataMemory();
+        }
+    }
+
+    void freeDataMemory() DAAL_C11_OVERRIDE
+    {
+        for (size_t i = 0;i < _tables->size(); i++)
+        {
+            NumericTable* nt = (NumericTable*)(_tables->operator[](i).get());
+            nt->freeDataMemory();
+        }
+    }
+
+    virtual int getSerializationTag() DAAL_C11_OVERRIDE
+    {
+        return SERIALIZATION_ROWMERGE_NT_ID;
+    }
+
+    void serializeImpl(InputDataArchive *archive) DAAL_C11_OVERRIDE
+    {
+        serialImpl<InputDataArchive, false>( archive );
+    }
+
+    void deserializeImpl(OutputDataArchive *archive) DAAL_C11_OVERRIDE
+    {
+        serialImpl<OutputDataArchive, true>( archive );
+    }
+
+    void getBlockOfRows(size_t vector_idx, size_t vector_num,
+                          ReadWriteMode rwflag, BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        getTBlock<double>(vector_idx, vector_num, rwflag, block);
+    }
+    void getBlockOfRows(size_t vector_idx, size_t vector_num,
+                          ReadWriteMode rwflag, BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        getTBlock<float>(vector_idx, vector_num, rwflag, block);
+    }
+    void getBlockOfRows(size_t vector_idx, size_t vector_num,
+                          ReadWriteMode rwflag, BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        getTBlock<int>(vector_idx, vector_num, rwflag, block);
+    }
+
+    void releaseBlockOfRows(BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTBlock<double>(block);
+    }
+    void releaseBlockOfRows(BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTBlock<float>(block);
+    }
+    void releaseBlockOfRows(BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTBlock<int>(block);
+    }
+
+    void getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                  ReadWriteMode rwflag, BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        getTFeature<double>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    void getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                  ReadWriteMode rwflag, BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        getTFeature<float>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+    void getBlockOfColumnValues(size_t feature_idx, size_t vector_idx, size_t value_num,
+                                  ReadWriteMode rwflag, BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        getTFeature<int>(feature_idx, vector_idx, value_num, rwflag, block);
+    }
+
+    void releaseBlockOfColumnValues(BlockDescriptor<double>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTFeature<double>(block);
+    }
+    void releaseBlockOfColumnValues(BlockDescriptor<float>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTFeature<float>(block);
+    }
+    void releaseBlockOfColumnValues(BlockDescriptor<int>& block) DAAL_C11_OVERRIDE
+    {
+        releaseTFeature<int>(block);
+    }
+
+protected:
+    template<typename Archive, bool onDeserialize>
+    void serialImpl( Archive *arch )
+    {
+        NumericTable::serialImpl<Archive, onDeserialize>( arch );
+
+        arch->setSharedPtrObj(_tables);
+
+        if (onDeserialize)
+        {
+            size_t nobs = _obsnum;
+            _rowOffsets.clear();
+            _rowOffsets.push_back(0);
+            for (size_t i = 0; i < _tables->size(); i++)
+            {
+                NumericTable* nt = (NumericTable*)(_tables->operator[](i).get());
+                _rowOffsets.push_back(_rowOffsets[i] + nt->getNumberOfRows());
+            }
+            _obsnum = nobs;
+            _memStatus = (_tables->size() ? userAllocated : notAllocated);
+        }
+    }
+
+private:
+    NumericTable *getTable(size_t k)
+    {
+        return (NumericTable*)(_tables->operator[](k).get());
+    }
+
+    /* Returns the index of the table that contains the row with the given index */
+    size_t findTable(size_t idx)
+    {
+        size_t lo = 0;
+        size_t hi = _tables->size();
+        while (hi - lo > 1)
+        {
+            size_t mid = (lo + hi) / 2;
+            if (_rowOffsets[mid] <= idx)
+            {
+                lo = mid;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+protected:
+    template <typename T>
+    void getTBlock( size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T>& block )
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs = getNumberOfRows();
+        block.setDetails( 0, idx, rwFlag );
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( ncols, 0 );
+            return;
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        size_t k = findTable(idx);
+        if (idx + nrows <= _rowOffsets[k + 1])
+        {
+            /* The rows belong to one table, the block is provided by that table */
+            getTable(k)->getBlockOfRows(idx - _rowOffsets[k], nrows, (ReadWriteMode)rwFlag, block);
+            block.setDetails( 0, idx, rwFlag );
+            return;
+        }
+
+        if( !block.resizeBuffer( ncols, nrows ) )
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        if( rwFlag & (int)readOnly )
+        {
+            T *buffer = block.getBlockPtr();
+            BlockDescriptor<T> innerBlock;
+            for (size_t pos = idx; pos < idx + nrows; k++)
+            {
+                size_t end = ( idx + nrows < _rowOffsets[k + 1] ) ? idx + nrows : _rowOffsets[k + 1];
+                if (end == pos) { continue; }
+
+                NumericTable* nt = getTable(k);
+                nt->getBlockOfRows(pos - _rowOffsets[k], end - pos, readOnly, innerBlock);
+
+                T *location = innerBlock.getBlockPtr();
+                T *dst = buffer + (pos - idx) * ncols;
+                for (size_t i = 0; i < (end - pos) * ncols; i++)
+                {
+                    dst[i] = location[i];
+                }
+
+                nt->releaseBlockOfRows(innerBlock);
+                pos = end;
+            }
+        }
+    }
+
+    template <typename T>
+    void releaseTBlock(BlockDescriptor<T>& block)
+    {
+        size_t idx = block.getRowsOffset();
+        size_t nrows = block.getNumberOfRows();
+        if (nrows == 0)
+        {
+            block.setDetails( 0, 0, 0 );
+            return;
+        }
+
+        size_t k = findTable(idx);
+        if (idx + nrows <= _rowOffsets[k + 1])
+        {
+            block.setDetails( 0, idx - _rowOffsets[k], block.getRWFlag() );
+            getTable(k)->releaseBlockOfRows(block);
+            return;
+        }
+
+        if(block.getRWFlag() & (int)writeOnly)
+        {
+            size_t ncols = getNumberOfColumns();
+            T *buffer = block.getBlockPtr();
+            BlockDescriptor<T> innerBlock;
+            for (size_t pos = idx; pos < idx + nrows; k++)
+            {
+                size_t end = ( idx + nrows < _rowOffsets[k + 1] ) ? idx + nrows : _rowOffsets[k + 1];
+                if (end == pos) { continue; }
+
+                NumericTable* nt = getTable(k);
+                nt->getBlockOfRows(pos - _rowOffsets[k], end - pos, writeOnly, innerBlock);
+
+                T *location = innerBlock.getBlockPtr();
+                T *src = buffer + (pos - idx) * ncols;
+                for (size_t i = 0; i < (end - pos) * ncols; i++)
+                {
+                    location[i] = src[i];
+                }
+
+                nt->releaseBlockOfRows(innerBlock);
+                pos = end;
+            }
+        }
+        block.setDetails( 0, 0, 0 );
+    }
+
+    template <typename T>
+    void getTFeature( size_t feat_idx, size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T>& block )
+    {
+        size_t nobs = getNumberOfRows();
+        block.setDetails( feat_idx, idx, rwFlag );
+
+        if (idx >= nobs)
+        {
+            block.resizeBuffer( 1, 0 );
+            return;
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        size_t k = findTable(idx);
+        if (idx + nrows <= _rowOffsets[k + 1])
+        {
+            /* The rows belong to one table, the block is provided by that table */
+            getTable(k)->getBlockOfColumnValues(feat_idx, idx - _rowOffsets[k], nrows, (ReadWriteMode)rwFlag, block);
+            block.setDetails( feat_idx, idx, rwFlag );
+            return;
+        }
+
+        if( !block.resizeBuffer( 1, nrows ) )
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        if( rwFlag & (int)readOnly )
+        {
+            T *buffer = block.getBlockPtr();
+            BlockDescriptor<T> innerBlock;
+            for (size_t pos = idx; pos < idx + nrows; k++)
+            {
+                size_t end = ( idx + nrows < _rowOffsets[k + 1] ) ? idx + nrows : _rowOffsets[k + 1];
+                if (end == pos) { continue; }
+
+                NumericTable* nt = getTable(k);
+                nt->getBlockOfColumnValues(feat_idx, pos - _rowOffsets[k], end - pos, readOnly, innerBlock);
+
+                T *location = innerBlock.getBlockPtr();
+                for (size_t i = 0; i < end - pos; i++)
+                {
+                    buffer[pos - idx + i] = location[i];
+                }
+
+                nt->releaseBlockOfColumnValues(innerBlock);
+                pos = end;
+            }
+        }
+    }
+
+    template <typename T>
+    void releaseTFeature( BlockDescriptor<T>& block )
+    {
+        size_t feat_idx = block.getColumnsOffset();
+        size_t idx = block.getRowsOffset();
+        size_t nrows = block.getNumberOfRows();
+        if (nrows == 0)
+        {
+            block.setDetails( 0, 0, 0 );
+            return;
+        }
+
+        size_t k = findTable(idx);
+        if (idx + nrows <= _rowOffsets[k + 1])
+        {
+            block.setDetails( feat_idx, idx - _rowOffsets[k], block.getRWFlag() );
+            getTable(k)->releaseBlockOfColumnValues(block);
+            return;
+        }
+
+        if (block.getRWFlag() & (int)writeOnly)
+        {
+            T *buffer = block.getBlockPtr();
+            BlockDescriptor<T> innerBlock;
+            for (size_t pos = idx; pos < idx + nrows; k++)
+            {
+                size_t end = ( idx + nrows < _rowOffsets[k + 1] ) ? idx + nrows : _rowOffsets[k + 1];
+                if (end == pos) { continue; }
+
+                NumericTable* nt = getTable(k);
+                nt->getBlockOfColumnValues(feat_idx, pos - _rowOffsets[k], end - pos, writeOnly, innerBlock);
+
+                T *location = innerBlock.getBlockPtr();
+                for (size_t i = 0; i < end - pos; i++)
+                {
+                    location[i] = buffer[pos - idx + i];
+                }
+
+                nt->releaseBlockOfColumnValues(innerBlock);
+                pos = end;
+            }
+        }
+        block.setDetails( 0, 0, 0 );
+    }
+
+protected:
+    services::SharedPtr<DataCollection> _tables;
+    services::Collection<size_t> _rowOffsets;   /* Index of the first row of each table in the row merged table */
+};
+} // namespace interface1
+using interface1::RowMergedNumericTable;
+
+} // namespace data_management
+} // namespace daal
+
+#endif
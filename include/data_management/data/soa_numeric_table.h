@@ -45,7 +45,7 @@ public:
      *  \param[in]  nColumns    Number of columns in the table
      *  \param[in]  nRows       Number of rows in the table
      */
-    SOANumericTable( size_t nColumns = 0, size_t nRows = 0 ): NumericTable(nColumns, nRows), _arrays(0)
+    SOANumericTable( size_t nColumns = 0, size_t nRows = 0 ): NumericTable(nColumns, nRows), _arrays(0), _hasAllocationPolicy(false)
     {
         _layout = soa;
         if( nColumns != 0 )
@@ -72,7 +72,23 @@ public:
      *  \param[in]  memoryAllocationFlag  Flag that controls internal memory allocation for data in the numeric table
      */
     SOANumericTable( NumericTableDictionary *ddict, size_t nRows,
-                     AllocationFlag memoryAllocationFlag = notAllocate ) : NumericTable(0, nRows), _arrays(0)
+                     AllocationFlag memoryAllocationFlag = notAllocate ) : NumericTable(0, nRows), _arrays(0), _hasAllocationPolicy(false)
+    {
+        _layout = soa;
+        setDictionary( ddict );
+        if( memoryAllocationFlag == doAllocate ) { allocateDataMemory(); }
+    }
+
+    /**
+     *  Constructor for an empty Numeric Table with a predefined NumericTableDictionary and a policy of allocation
+     *  \param[in]  ddict                 Pointer to the predefined NumericTableDictionary
+     *  \param[in]  nRows                 Number of rows in the table
+     *  \param[in]  memoryAllocationFlag  Flag that controls internal memory allocation for data in the numeric table
+     *  \param[in]  policy                Page size and placement of the internally allocated arrays, \ref services::AllocationPolicy
+     */
+    SOANumericTable( NumericTableDictionary *ddict, size_t nRows, AllocationFlag memoryAllocationFlag,
+                     const services::AllocationPolicy &policy ) :
+        NumericTable(0, nRows), _arrays(0), _hasAllocationPolicy(true), _allocationPolicy(policy)
     {
         _layout = soa;
         setDictionary( ddict );
@@ -121,6 +137,17 @@ public:
         }
     }
 
+    /**
+     *  Sets the page size and placement of the arrays allocated by allocateDataMemory.
+     *  The policy overrides the default policy of daal_malloc
+     *  \param[in] policy  Allocation policy, \ref services::AllocationPolicy
+     */
+    void setAllocationPolicy( const services::AllocationPolicy &policy )
+    {
+        _allocationPolicy = policy;
+        _hasAllocationPolicy = true;
+    }
+
     /**
      *  Returns a pointer to an array of values for a given feature
      *  \param[in]  idx Feature index
@@ -279,7 +306,7 @@ public:
             NumericTableFeature f = (*_ddict)[i];
             if( f.typeSize != 0 )
             {
-                _arrays[i] = daal::services::daal_malloc( f.typeSize * nrows );
+                _arrays[i] = services::internal::allocateTableData( f.typeSize * nrows, _hasAllocationPolicy ? &_allocationPolicy : NULL );
             }
             if( _arrays[i] == 0 )
             {
@@ -340,6 +367,8 @@ public:
 
 protected:
     void **_arrays;
+    bool _hasAllocationPolicy;                  /*!< True if the arrays are allocated with _allocationPolicy */
+    services::AllocationPolicy _allocationPolicy;
 
 private:
 
@@ -115,7 +115,7 @@ public:
      *  \param[in]  nDim        Matrix dimension
      */
     PackedSymmetricMatrix( DataType *const ptr = 0, size_t nDim = 0 ):
-        NumericTable( nDim, nDim ), _ptr(0)
+        NumericTable( nDim, nDim ), _ptr(0), _hasAllocationPolicy(false)
     {
         _layout = packedLayout;
         setArray( ptr );
@@ -132,7 +132,7 @@ public:
      *  \param[in]  constValue  Constant to initialize entries of the packed symmetric matrix
      */
     PackedSymmetricMatrix( DataType *const ptr, size_t nDim, const DataType &constValue ):
-        NumericTable( nDim, nDim ), _ptr(0)
+        NumericTable( nDim, nDim ), _ptr(0), _hasAllocationPolicy(false)
     {
         _layout = packedLayout;
         setArray( ptr );
@@ -150,7 +150,7 @@ public:
      *  \param[in]  memoryAllocationFlag    Flag that controls internal memory allocation for data in the numeric table
      */
     PackedSymmetricMatrix( size_t nDim, AllocationFlag memoryAllocationFlag ):
-        NumericTable( nDim, nDim ), _ptr(0)
+        NumericTable( nDim, nDim ), _ptr(0), _hasAllocationPolicy(false)
     {
         _layout = packedLayout;
 
@@ -169,7 +169,49 @@ public:
      */
     PackedSymmetricMatrix( size_t nDim, NumericTable::AllocationFlag memoryAllocationFlag,
                            const DataType &constValue ):
-        NumericTable( nDim, nDim ), _ptr(0)
+        NumericTable( nDim, nDim ), _ptr(0), _hasAllocationPolicy(false)
+    {
+        _layout = packedLayout;
+
+        NumericTableFeature df;
+        df.setType<DataType>();
+        _ddict->setAllFeatures(df);
+
+        if( memoryAllocationFlag == doAllocate ) { allocateDataMemory(); }
+
+        assign( constValue );
+    }
+
+    /**
+     *  Constructor for a Numeric Table with memory allocation controlled via a flag and a policy of allocation
+     *  \param[in]  nDim                    Matrix dimension
+     *  \param[in]  memoryAllocationFlag    Flag that controls internal memory allocation for data in the numeric table
+     *  \param[in]  policy                  Page size and placement of the internally allocated memory, \ref services::AllocationPolicy
+     */
+    PackedSymmetricMatrix( size_t nDim, NumericTable::AllocationFlag memoryAllocationFlag,
+                           const services::AllocationPolicy &policy ):
+        NumericTable( nDim, nDim ), _ptr(0), _hasAllocationPolicy(true), _allocationPolicy(policy)
+    {
+        _layout = packedLayout;
+
+        NumericTableFeature df;
+        df.setType<DataType>();
+        _ddict->setAllFeatures(df);
+
+        if( memoryAllocationFlag == doAllocate ) { allocateDataMemory(); }
+    }
+
+    /**
+     *  Constructor for a Numeric Table with memory allocation controlled via a flag and a policy of allocation
+     *  and filling the table with a constant
+     *  \param[in]  nDim                    Matrix dimension
+     *  \param[in]  memoryAllocationFlag    Flag that controls internal memory allocation for data in the numeric table
+     *  \param[in]  constValue              Constant to initialize entries of the packed symmetric matrix
+     *  \param[in]  policy                  Page size and placement of the internally allocated memory, \ref services::AllocationPolicy
+     */
+    PackedSymmetricMatrix( size_t nDim, NumericTable::AllocationFlag memoryAllocationFlag,
+                           const DataType &constValue, const services::AllocationPolicy &policy ):
+        NumericTable( nDim, nDim ), _ptr(0), _hasAllocationPolicy(true), _allocationPolicy(policy)
     {
         _layout = packedLayout;
 
@@ -232,6 +274,17 @@ public:
         return _ptr;
     }
 
+    /**
+     *  Sets the page size and placement of the memory allocated by allocateDataMemory.
+     *  The policy overrides the default policy of daal_malloc
+     *  \param[in] policy  Allocation policy, \ref services::AllocationPolicy
+     */
+    void setAllocationPolicy( const services::AllocationPolicy &policy )
+    {
+        _allocationPolicy = policy;
+        _hasAllocationPolicy = true;
+    }
+
     /**
      *  Sets a pointer to a packed array
      *  \param[in] ptr Pointer to the data set in the packed format
@@ -373,7 +426,7 @@ public:
             }
         }
 
-        _ptr = (DataType *)daal::services::daal_malloc( size * sizeof(DataType) );
+        _ptr = (DataType *)services::internal::allocateTableData( size * sizeof(DataType), _hasAllocationPolicy ? &_allocationPolicy : NULL );
 
         if( _ptr == 0 )
         {
@@ -422,6 +475,8 @@ public:
 
 protected:
     DataType *_ptr;
+    bool _hasAllocationPolicy;                  /*!< True if the memory is allocated with _allocationPolicy */
+    services::AllocationPolicy _allocationPolicy;
 
 private:
     DataType *internal_getBlockOfRows( size_t idx )
@@ -676,7 +731,7 @@ public:
      *  \param[in]  nDim        Matrix dimension
      */
     PackedTriangularMatrix( DataType *const ptr = 0, size_t nDim = 0 ):
-        NumericTable( nDim, nDim ), _ptr(0)
+        NumericTable( nDim, nDim ), _ptr(0), _hasAllocationPolicy(false)
     {
         _layout = packedLayout;
         setArray( ptr );
@@ -693,7 +748,7 @@ public:
      *  \param[in]  constValue  Constant to initialize entries of the packed symmetric matrix
      */
     PackedTriangularMatrix( DataType *const ptr, size_t nDim, const DataType &constValue ):
-        NumericTable( nDim, nDim ), _ptr(0)
+        NumericTable( nDim, nDim ), _ptr(0), _hasAllocationPolicy(false)
     {
         _layout = packedLayout;
         setArray( ptr );
@@ -711,7 +766,7 @@ public:
      *  \param[in]  memoryAllocationFlag    Flag that controls internal memory allocation for data in the numeric table
      */
     PackedTriangularMatrix( size_t nDim, AllocationFlag memoryAllocationFlag ):
-        NumericTable( nDim, nDim ), _ptr(0)
+        NumericTable( nDim, nDim ), _ptr(0), _hasAllocationPolicy(false)
     {
         _layout = packedLayout;
 
@@ -730,7 +785,7 @@ public:
      */
     PackedTriangularMatrix( size_t nDim, NumericTable::AllocationFlag memoryAllocationFlag,
                             const DataType &constValue ):
-        NumericTable( nDim, nDim ), _ptr(0)
+        NumericTable( nDim, nDim ), _ptr(0), _hasAllocationPolicy(false)
     {
         _layout = packedLayout;
 
@@ -744,6 +799,48 @@ public:
         assign( constValue );
     }
 
+    /**
+     *  Constructor for a Numeric Table with memory allocation controlled via a flag and a policy of allocation
+     *  \param[in]  nDim                    Matrix dimension
+     *  \param[in]  memoryAllocationFlag    Flag that controls internal memory allocation for data in the numeric table
+     *  \param[in]  policy                  Page size and placement of the internally allocated memory, \ref services::AllocationPolicy
+     */
+    PackedTriangularMatrix( size_t nDim, NumericTable::AllocationFlag memoryAllocationFlag,
+                            const services::AllocationPolicy &policy ):
+        NumericTable( nDim, nDim ), _ptr(0), _hasAllocationPolicy(true), _allocationPolicy(policy)
+    {
+        _layout = packedLayout;
+
+        NumericTableFeature df;
+        df.setType<DataType>();
+        _ddict->setAllFeatures(df);
+
+        if( memoryAllocationFlag == doAllocate ) { allocateDataMemory(); }
+    }
+
+    /**
+     *  Constructor for a Numeric Table with memory allocation controlled via a flag and a policy of allocation
+     *  and filling the table with a constant
+     *  \param[in]  nDim                    Matrix dimension
+     *  \param[in]  memoryAllocationFlag    Flag that controls internal memory allocation for data in the numeric table
+     *  \param[in]  constValue              Constant to initialize entries of the packed triangular matrix
+     *  \param[in]  policy                  Page size and placement of the internally allocated memory, \ref services::AllocationPolicy
+     */
+    PackedTriangularMatrix( size_t nDim, NumericTable::AllocationFlag memoryAllocationFlag,
+                            const DataType &constValue, const services::AllocationPolicy &policy ):
+        NumericTable( nDim, nDim ), _ptr(0), _hasAllocationPolicy(true), _allocationPolicy(policy)
+    {
+        _layout = packedLayout;
+
+        NumericTableFeature df;
+        df.setType<DataType>();
+        _ddict->setAllFeatures(df);
+
+        if( memoryAllocationFlag == doAllocate ) { allocateDataMemory(); }
+
+        assign( constValue );
+    }
+
     /** \private */
     virtual ~PackedTriangularMatrix()
     {
@@ -784,6 +881,17 @@ public:
         return _ptr;
     }
 
+    /**
+     *  Sets the page size and placement of the memory allocated by allocateDataMemory.
+     *  The policy overrides the default policy of daal_malloc
+     *  \param[in] policy  Allocation policy, \ref services::AllocationPolicy
+     */
+    void setAllocationPolicy( const services::AllocationPolicy &policy )
+    {
+        _allocationPolicy = policy;
+        _hasAllocationPolicy = true;
+    }
+
     /**
      *  Sets a pointer to an array that stores a packed triangular matrix
      *  \param[in] ptr Pointer to the array that stores the packed triangular matrix
@@ -920,7 +1028,7 @@ public:
             }
         }
 
-        _ptr = (DataType *)daal::services::daal_malloc( size * sizeof(DataType) );
+        _ptr = (DataType *)services::internal::allocateTableData( size * sizeof(DataType), _hasAllocationPolicy ? &_allocationPolicy : NULL );
 
         if( _ptr == 0 )
         {
@@ -969,6 +1077,8 @@ public:
 
 protected:
     DataType *_ptr;
+    bool _hasAllocationPolicy;                  /*!< True if the memory is allocated with _allocationPolicy */
+    services::AllocationPolicy _allocationPolicy;
 
 private:
     DataType *internal_getBlockOfRows( size_t idx )
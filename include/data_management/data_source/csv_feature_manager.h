@@ -24,9 +24,10 @@
 #ifndef __CSV_DATA_SOURCE_H__
 #define __CSV_DATA_SOURCE_H__
 
-#include <sstream>
-#include <fstream>
-#include <list>
+#include <cstring>
+#include <cstdlib>
+#include <string>
+#include <vector>
 
 #include "services/daal_memory.h"
 #include "data_management/data_source/data_source.h"
@@ -39,6 +40,126 @@ namespace daal
 namespace data_management
 {
 
+namespace internal
+{
+/**
+ *  Parses a decimal floating-point number at the beginning of the string [begin, end).
+ *  Numbers with at most 19 significant digits and a decimal exponent in [-22, 22] are converted exactly
+ *  without calls to the C runtime library, other numbers are converted by strtod
+ *  \param[in]  begin  Pointer to the first character of the string
+ *  \param[in]  end    Pointer to the character that follows the last character of the string
+ *  \param[out] f      Converted value
+ *  \return true if the string starts with a number, false otherwise
+ */
+inline bool parseNumber(const char *begin, const char *end, double &f)
+{
+    static const double powersOf10[] =
+    {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const DAAL_UINT64 maxExactMantissa = ((DAAL_UINT64)1) << 53;
+    const int maxSignificantDigits = 19;
+    const int maxExactExponent = 22;
+
+    const char *p = begin;
+    while( p < end && (*p == ' ' || *p == '\t') ) { p++; }
+    const char *numberBegin = p;
+
+    bool isNegative = false;
+    if( p < end && (*p == '-' || *p == '+') )
+    {
+        isNegative = (*p == '-');
+        p++;
+    }
+
+    DAAL_UINT64 mantissa = 0;
+    int nSignificantDigits = 0;
+    int exponent = 0;
+    bool hasDigits = false;
+    bool isTruncated = false;
+
+    for( ; p < end && (unsigned)(*p - '0') < 10; p++ )
+    {
+        hasDigits = true;
+        if( nSignificantDigits < maxSignificantDigits )
+        {
+            mantissa = mantissa * 10 + (unsigned)(*p - '0');
+            if( mantissa ) { nSignificantDigits++; }
+        }
+        else
+        {
+            exponent++;
+            isTruncated = true;
+        }
+    }
+
+    if( p < end && *p == '.' )
+    {
+        for( p++; p < end && (unsigned)(*p - '0') < 10; p++ )
+        {
+            hasDigits = true;
+            if( nSignificantDigits < maxSignificantDigits )
+            {
+                mantissa = mantissa * 10 + (unsigned)(*p - '0');
+                exponent--;
+                if( mantissa ) { nSignificantDigits++; }
+            }
+            else
+            {
+                isTruncated = true;
+            }
+        }
+    }
+
+    if( !hasDigits ) { return false; }
+
+    if( p < end && (*p == 'e' || *p == 'E') )
+    {
+        const char *q = p + 1;
+        bool isNegativeExponent = false;
+        if( q < end && (*q == '-' || *q == '+') )
+        {
+            isNegativeExponent = (*q == '-');
+            q++;
+        }
+        if( q < end && (unsigned)(*q - '0') < 10 )
+        {
+            int decimalExponent = 0;
+            for( ; q < end && (unsigned)(*q - '0') < 10; q++ )
+            {
+                if( decimalExponent < 100000 ) { decimalExponent = decimalExponent * 10 + (*q - '0'); }
+            }
+            exponent += (isNegativeExponent ? -decimalExponent : decimalExponent);
+            p = q;
+        }
+    }
+
+    if( !isTruncated && mantissa <= maxExactMantissa && exponent >= -maxExactExponent && exponent <= maxExactExponent )
+    {
+        double value = (double)mantissa;
+        value = (exponent < 0 ? value / powersOf10[-exponent] : value * powersOf10[exponent]);
+        f = (isNegative ? -value : value);
+        return true;
+    }
+
+    const size_t length = (size_t)(p - numberBegin);
+    char word[64];
+    if( length < sizeof(word) )
+    {
+        memcpy( word, numberBegin, length );
+        word[length] = 0;
+        f = strtod( word, NULL );
+    }
+    else
+    {
+        std::string longWord( numberBegin, p );
+        f = strtod( longWord.c_str(), NULL );
+    }
+    return true;
+}
+} // namespace internal
+
 namespace interface1
 {
 /**
@@ -50,6 +171,12 @@ class CSVFeatureManager : public StringRowFeatureManagerIface
 protected:
     char _delimiter;
 
+    std::string _word;                                      /*!< Buffer for the values of categorical features */
+    std::vector<CategoricalFeatureDictionary *> _catDicts;  /*!< Dictionaries of the features, NULL for continuous features */
+
+    /* Size of the data below which a block of rows is parsed in one thread */
+    static const size_t minChunkSize = 1 << 16;
+
 public:
     /**
      *  Default constructor
@@ -68,22 +195,22 @@ public:
     virtual void parseRowAsDictionary( char *rawRowData, size_t rawDataSize,
                                        DataSourceDictionary *dict ) DAAL_C11_OVERRIDE
     {
-        std::stringstream ssLine(rawRowData);
-        char *word = new char[rawDataSize];
+        const char *rowEnd = findRowEnd( rawRowData, rawDataSize );
 
-        std::list<DataSourceFeature> featureList;
+        std::vector<DataSourceFeature> featureList;
 
-        bool isEmpty = false;
-        size_t nCols = 0;
-        while( ssLine.getline( word, rawDataSize, _delimiter ) )
+        const char *word = rawRowData;
+        while( word <= rowEnd )
         {
-            double f;
-            isEmpty = (word[0] == 0 || word[0] == '\r' || word[0] == '\n');
-            bool isNumeric = readNumeric<>( word, f );
+            const char *wordEnd = findWordEnd( word, rowEnd );
+
+            /* Empty field after the last delimiter does not define a feature */
+            if( wordEnd == word && wordEnd == rowEnd ) { break; }
 
             DataSourceFeature feat;
 
-            if( isNumeric )
+            double f;
+            if( internal::parseNumber( word, wordEnd, f ) )
             {
                 feat.setType<double>();
             }
@@ -95,21 +222,16 @@ public:
 
             featureList.push_back(feat);
 
-            nCols++;
+            word = wordEnd + 1;
         }
 
-        if(isEmpty) { nCols--; }
-
-        delete[] word;
+        size_t nCols = featureList.size();
 
         dict->setNumberOfFeatures(nCols);
 
-        size_t idx = 0;
-        for( std::list<DataSourceFeature>::iterator it = featureList.begin() ; it != featureList.end() ; it++ )
+        for( size_t i = 0; i < nCols; i++ )
         {
-            dict->setFeature( *it, idx );
-            idx++;
-            if( idx == nCols ) { break; }
+            dict->setFeature( featureList[i], i );
         }
     }
 
@@ -124,69 +246,393 @@ public:
     virtual void parseRowIn ( char *rawRowData, size_t rawDataSize, DataSourceDictionary *dict,
                               NumericTable *nt, size_t  ntRowIndex  ) DAAL_C11_OVERRIDE
     {
-        std::stringstream ssLine( rawRowData );
-        char *word = new char[rawDataSize];
+        size_t nCols = nt->getNumberOfColumns();
+        if( nCols == 0 ) { return; }
+
+        setCategoricalDictionaries( dict, nCols );
+
+        switch( internal::getCommonFeatureType( nt ) )
+        {
+        case data_feature_utils::DAAL_FLOAT32:
+            parseRowInImpl<float >( rawRowData, rawDataSize, nt, ntRowIndex ); break;
+        case data_feature_utils::DAAL_INT32_S:
+            parseRowInImpl<int   >( rawRowData, rawDataSize, nt, ntRowIndex ); break;
+        default:
+            parseRowInImpl<double>( rawRowData, rawDataSize, nt, ntRowIndex ); break;
+        }
+    }
+
+    /**
+     *  Parses a block of strings that represent feature vectors and converts them into a numeric representation.
+     *  The block is split into the ranges of whole strings that are parsed in parallel.
+     *  Values of categorical features are collected into the dictionaries of the ranges
+     *  that are merged into the dictionary of the Data Source in the order of the strings
+     *  \param[in]  rawData      Array of characters with nRows strings separated by the '\n' character
+     *  \param[in]  rawDataSize  Size of the rawData array
+     *  \param[in]  nRows        Number of strings in the rawData array
+     *  \param[in]  dict         Pointer to the dictionary
+     *  \param[out] nt           Pointer to a Numeric Table to store the result of parsing
+     *  \param[in]  ntRowIndex   Position in the Numeric Table at which to store the result of parsing of the first string
+     */
+    virtual void parseRowsIn( char *rawData, size_t rawDataSize, size_t nRows, DataSourceDictionary *dict,
+                              NumericTable *nt, size_t ntRowIndex ) DAAL_C11_OVERRIDE
+    {
+        size_t nCols = nt->getNumberOfColumns();
+        if( nCols == 0 || nRows == 0 ) { return; }
+
+        setCategoricalDictionaries( dict, nCols );
+
+        /* Values are written in the type of the features of the table to avoid the conversion of the block */
+        switch( internal::getCommonFeatureType( nt ) )
+        {
+        case data_feature_utils::DAAL_FLOAT32:
+            parseRowsInImpl<float >( rawData, rawDataSize, nRows, nt, ntRowIndex ); break;
+        case data_feature_utils::DAAL_INT32_S:
+            parseRowsInImpl<int   >( rawData, rawDataSize, nRows, nt, ntRowIndex ); break;
+        default:
+            parseRowsInImpl<double>( rawData, rawDataSize, nRows, nt, ntRowIndex ); break;
+        }
+    }
 
+protected:
+    template<typename T>
+    void parseRowInImpl( char *rawRowData, size_t rawDataSize, NumericTable *nt, size_t ntRowIndex )
+    {
         size_t nCols = nt->getNumberOfColumns();
 
-        BlockDescriptor<double> block;
+        BlockDescriptor<T> block;
         nt->getBlockOfRows( ntRowIndex, 1, writeOnly, block );
-        double *row = block.getBlockPtr();
 
-        size_t i;
-        for( i = 0; i < nCols; i++ )
+        parseRow( rawRowData, findRowEnd( rawRowData, rawDataSize ), nCols, &_catDicts[0], _word, block.getBlockPtr() );
+
+        nt->releaseBlockOfRows( block );
+    }
+
+    template<typename T>
+    void parseRowsInImpl( char *rawData, size_t rawDataSize, size_t nRows, NumericTable *nt, size_t ntRowIndex )
+    {
+        size_t nCols = nt->getNumberOfColumns();
+
+        BlockDescriptor<T> block;
+        nt->getBlockOfRows( ntRowIndex, nRows, writeOnly, block );
+        T *rows = block.getBlockPtr();
+
+        size_t nChunks = internal::getNumberOfThreads() * 4;
+        if( nChunks > rawDataSize / minChunkSize + 1 ) { nChunks = rawDataSize / minChunkSize + 1; }
+        if( nChunks > nRows ) { nChunks = nRows; }
+
+        if( nChunks <= 1 )
+        {
+            parseRows( rawData, rawData + rawDataSize, nRows, nCols, &_catDicts[0], _word, rows );
+        }
+        else
+        {
+            parseRowsParallel( rawData, rawDataSize, nRows, nCols, nChunks, rows );
+        }
+
+        nt->releaseBlockOfRows( block );
+    }
+
+    /**
+     *  Range of strings parsed by one task
+     */
+    struct RowsChunk
+    {
+        const char *begin;
+        const char *end;
+        size_t nRows;
+        size_t rowOffset;
+        std::vector<CategoricalFeatureDictionary> dicts;  /* Values of the categorical features found in the range */
+        std::vector<std::vector<int> > indices;           /* Indices of these values in the dictionaries of the Data Source */
+    };
+
+    struct CountRowsTask
+    {
+        RowsChunk *chunks;
+
+        void run( size_t iChunk ) const
+        {
+            RowsChunk &chunk = chunks[iChunk];
+            size_t nRows = 0;
+            for( const char *p = chunk.begin; p < chunk.end; p++ )
+            {
+                const char *rowEnd = (const char *)memchr( p, '\n', chunk.end - p );
+                nRows++;
+                if( rowEnd == NULL ) { break; }
+                p = rowEnd;
+            }
+            chunk.nRows = nRows;
+        }
+    };
+
+    template<typename T>
+    struct ParseRowsTask
+    {
+        const CSVFeatureManager *featureManager;
+        RowsChunk *chunks;
+        const std::vector<size_t> *catFeatures;
+        size_t nCols;
+        T *rows;
+
+        void run( size_t iChunk ) const
         {
-            ssLine.getline( word, rawDataSize, _delimiter );
-            if( ssLine.fail() ) { break; }
+            RowsChunk &chunk = chunks[iChunk];
+            if( chunk.nRows == 0 ) { return; }
 
-            DataSourceFeature   &dsFeat = (*dict)[i];
-            NumericTableFeature &ntFeat = dsFeat.ntFeature;
-            if( ntFeat.featureType == data_feature_utils::DAAL_CONTINUOUS )
+            std::vector<CategoricalFeatureDictionary *> dicts( nCols, (CategoricalFeatureDictionary *)NULL );
+            for( size_t j = 0; j < catFeatures->size(); j++ )
             {
-                double f;
-                if( readNumeric<>( word, f ) )
-                {
-                    row[ i ] = f;
-                }
-                else
+                dicts[(*catFeatures)[j]] = &chunk.dicts[j];
+            }
+
+            std::string word;
+            featureManager->parseRows( chunk.begin, chunk.end, chunk.nRows, nCols, &dicts[0], word,
+                                       rows + chunk.rowOffset * nCols );
+        }
+    };
+
+    template<typename T>
+    struct RemapCategoriesTask
+    {
+        RowsChunk *chunks;
+        const std::vector<size_t> *catFeatures;
+        size_t nCols;
+        T *rows;
+
+        void run( size_t iChunk ) const
+        {
+            RowsChunk &chunk = chunks[iChunk];
+            T *chunkRows = rows + chunk.rowOffset * nCols;
+            for( size_t i = 0; i < chunk.nRows; i++ )
+            {
+                for( size_t j = 0; j < catFeatures->size(); j++ )
                 {
-                    /* NonNumeric data in NumericTable is invalid */
-                    row[ i ] = 0;
+                    T &value = chunkRows[i * nCols + (*catFeatures)[j]];
+                    value = (T)(chunk.indices[j][(size_t)value]);
                 }
             }
-            else
+        }
+    };
+
+    template<typename T>
+    void parseRowsParallel( const char *rawData, size_t rawDataSize, size_t nRows, size_t nCols, size_t nChunks, T *rows )
+    {
+        std::vector<size_t> catFeatures;
+        for( size_t i = 0; i < nCols; i++ )
+        {
+            if( _catDicts[i] ) { catFeatures.push_back(i); }
+        }
+
+        /* Split the data into the ranges of approximately equal size that start at the beginning of a string */
+        std::vector<RowsChunk> chunks( nChunks );
+        const char *dataEnd = rawData + rawDataSize;
+        const char *chunkBegin = rawData;
+        for( size_t iChunk = 0; iChunk < nChunks; iChunk++ )
+        {
+            const char *chunkEnd = dataEnd;
+            if( iChunk + 1 < nChunks )
             {
-                std::string sWord(word);
+                chunkEnd = rawData + (rawDataSize / nChunks) * (iChunk + 1);
+                if( chunkEnd <= chunkBegin ) { chunkEnd = chunkBegin + 1; }
+                const char *rowEnd = (chunkEnd <= dataEnd ? (const char *)memchr( chunkEnd - 1, '\n', dataEnd - chunkEnd + 1 ) : NULL);
+                chunkEnd = (rowEnd ? rowEnd + 1 : dataEnd);
+            }
+            chunks[iChunk].begin = chunkBegin;
+            chunks[iChunk].end   = chunkEnd;
+            chunks[iChunk].dicts.resize( catFeatures.size() );
+            chunks[iChunk].indices.resize( catFeatures.size() );
+            chunkBegin = chunkEnd;
+        }
+
+        CountRowsTask countTask;
+        countTask.chunks = &chunks[0];
+        internal::parallelFor( nChunks, countTask );
+
+        size_t rowOffset = 0;
+        for( size_t iChunk = 0; iChunk < nChunks; iChunk++ )
+        {
+            RowsChunk &chunk = chunks[iChunk];
+            if( chunk.nRows > nRows - rowOffset ) { chunk.nRows = nRows - rowOffset; }
+            chunk.rowOffset = rowOffset;
+            rowOffset += chunk.nRows;
+        }
 
-                CategoricalFeatureDictionary *catDict = dsFeat.getCategoricalDictionary();
-                CategoricalFeatureDictionary::iterator it = catDict->find( sWord );
+        ParseRowsTask<T> parseTask;
+        parseTask.featureManager = this;
+        parseTask.chunks         = &chunks[0];
+        parseTask.catFeatures    = &catFeatures;
+        parseTask.nCols          = nCols;
+        parseTask.rows           = rows;
+        internal::parallelFor( nChunks, parseTask );
 
-                if( it != catDict->end() )
+        /* Rows that are not present in the data are filled with zeros */
+        for( size_t i = rowOffset * nCols; i < nRows * nCols; i++ )
+        {
+            rows[i] = 0;
+        }
+
+        if( catFeatures.empty() ) { return; }
+
+        /* Merge the dictionaries of the ranges in the order of the strings, so that the indices of the values
+           of categorical features are the same as in the case of sequential parsing */
+        for( size_t iChunk = 0; iChunk < nChunks; iChunk++ )
+        {
+            RowsChunk &chunk = chunks[iChunk];
+            for( size_t j = 0; j < catFeatures.size(); j++ )
+            {
+                CategoricalFeatureDictionary &chunkDict = chunk.dicts[j];
+                CategoricalFeatureDictionary *catDict = _catDicts[catFeatures[j]];
+
+                std::vector<CategoricalFeatureDictionary::iterator> chunkValues( chunkDict.size() );
+                for( CategoricalFeatureDictionary::iterator it = chunkDict.begin(); it != chunkDict.end(); it++ )
                 {
-                    row[ i ] = it->second.first;
-                    it->second.second++;
+                    chunkValues[it->second.first] = it;
                 }
-                else
+
+                chunk.indices[j].resize( chunkValues.size() );
+                for( size_t k = 0; k < chunkValues.size(); k++ )
                 {
-                    int index = (int)(catDict->size());
-                    catDict->insert( std::pair<std::string, std::pair<int, int> >( sWord, std::pair<int, int>(index, 1) ) );
-                    row[ i ] = index;
+                    CategoricalFeatureDictionary::iterator chunkIt = chunkValues[k];
+                    CategoricalFeatureDictionary::iterator it = catDict->find( chunkIt->first );
+                    if( it != catDict->end() )
+                    {
+                        it->second.second += chunkIt->second.second;
+                        chunk.indices[j][k] = it->second.first;
+                    }
+                    else
+                    {
+                        int index = (int)(catDict->size());
+                        catDict->insert( std::pair<std::string, std::pair<int, int> >( chunkIt->first,
+                                                                                       std::pair<int, int>(index, chunkIt->second.second) ) );
+                        chunk.indices[j][k] = index;
+                    }
                 }
             }
         }
 
-        delete[] word;
+        RemapCategoriesTask<T> remapTask;
+        remapTask.chunks      = &chunks[0];
+        remapTask.catFeatures = &catFeatures;
+        remapTask.nCols       = nCols;
+        remapTask.rows        = rows;
+        internal::parallelFor( nChunks, remapTask );
+    }
 
-        nt->releaseBlockOfRows( block );
+    /**
+     *  Parses nRows strings of the range [begin, end) separated by the '\n' character
+     */
+    template<typename T>
+    void parseRows( const char *begin, const char *end, size_t nRows, size_t nCols,
+                    CategoricalFeatureDictionary *const *catDicts, std::string &word, T *rows ) const
+    {
+        const char *rowBegin = begin;
+        size_t i = 0;
+        for( ; i < nRows && rowBegin < end; i++ )
+        {
+            const char *rowEnd = (const char *)memchr( rowBegin, '\n', end - rowBegin );
+            if( rowEnd == NULL ) { rowEnd = end; }
+
+            const char *valuesEnd = rowEnd;
+            if( valuesEnd > rowBegin && valuesEnd[-1] == '\r' ) { valuesEnd--; }
+
+            parseRow( rowBegin, valuesEnd, nCols, catDicts, word, rows + i * nCols );
+
+            rowBegin = rowEnd + 1;
+        }
+        for( size_t j = i * nCols; j < nRows * nCols; j++ )
+        {
+            rows[j] = 0;
+        }
+    }
+
+    /**
+     *  Parses the string [rowBegin, rowEnd) that represents a feature vector.
+     *  Missing values are set to zero
+     */
+    template<typename T>
+    void parseRow( const char *rowBegin, const char *rowEnd, size_t nCols,
+                   CategoricalFeatureDictionary *const *catDicts, std::string &word, T *row ) const
+    {
+        const char *value = rowBegin;
+        size_t i = 0;
+        /* Empty string does not contain values */
+        const size_t nValues = (rowBegin < rowEnd ? nCols : 0);
+        for( ; i < nValues && value <= rowEnd; i++ )
+        {
+            const char *valueEnd = findWordEnd( value, rowEnd );
+
+            if( catDicts[i] == NULL )
+            {
+                double f;
+                /* NonNumeric data in NumericTable is invalid */
+                row[i] = (internal::parseNumber( value, valueEnd, f ) ? (T)f : 0);
+            }
+            else
+            {
+                row[i] = (T)getCategoricalIndex( catDicts[i], value, valueEnd, word );
+            }
+
+            value = valueEnd + 1;
+        }
+        for( ; i < nCols; i++ )
+        {
+            row[i] = 0;
+        }
+    }
+
+    static int getCategoricalIndex( CategoricalFeatureDictionary *catDict, const char *value, const char *valueEnd,
+                                    std::string &word )
+    {
+        word.assign( value, valueEnd );
+
+        CategoricalFeatureDictionary::iterator it = catDict->find( word );
+        if( it != catDict->end() )
+        {
+            it->second.second++;
+            return it->second.first;
+        }
+
+        int index = (int)(catDict->size());
+        catDict->insert( std::pair<std::string, std::pair<int, int> >( word, std::pair<int, int>(index, 1) ) );
+        return index;
+    }
+
+    void setCategoricalDictionaries( DataSourceDictionary *dict, size_t nCols )
+    {
+        _catDicts.resize( nCols );
+        for( size_t i = 0; i < nCols; i++ )
+        {
+            DataSourceFeature &dsFeat = (*dict)[i];
+            _catDicts[i] = (dsFeat.ntFeature.featureType == data_feature_utils::DAAL_CONTINUOUS ?
+                            NULL : dsFeat.getCategoricalDictionary());
+        }
+    }
+
+    const char *findWordEnd( const char *word, const char *rowEnd ) const
+    {
+        const char *wordEnd = (const char *)memchr( word, _delimiter, rowEnd - word );
+        return (wordEnd ? wordEnd : rowEnd);
+    }
+
+    /**
+     *  Returns the end of the string that represents a row of data: the first of the characters
+     *  '\0', '\r' and '\n', or rawRowData + rawDataSize if the string contains none of them
+     */
+    static const char *findRowEnd( const char *rawRowData, size_t rawDataSize )
+    {
+        const char *rowEnd = rawRowData;
+        const char *dataEnd = rawRowData + rawDataSize;
+        while( rowEnd < dataEnd && *rowEnd != 0 && *rowEnd != '\n' && *rowEnd != '\r' ) { rowEnd++; }
+        return rowEnd;
     }
 
-protected:
     template<class T>
     bool readNumeric(char *text, T &f)
     {
-        std::istringstream iss(text);
-        iss >> f;
-        return !(iss.fail());
+        double value;
+        if( !internal::parseNumber( text, text + strlen(text), value ) ) { return false; }
+        f = (T)value;
+        return true;
     }
 
 };
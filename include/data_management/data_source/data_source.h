@@ -346,15 +346,31 @@ protected:
         return structureSize;
     }
 
+    /**
+     *  Copies the features of the Data Source dictionary into the dictionary of a Numeric Table.
+     *  Data types already defined in the Numeric Table are kept, because they describe the memory of the table
+     */
     void setNumericTableDictionary(NumericTable *nt)
     {
-        services::SharedPtr<NumericTableDictionary> ntDict = nt->getDictionarySharedPtr();
+        NumericTableDictionary *ntDict = nt->getDictionary();
 
         size_t nFeatures = _dict->getNumberOfFeatures();
+        if( ntDict->getNumberOfFeatures() != nFeatures )
+        {
+            ntDict->setNumberOfFeatures(nFeatures);
+        }
 
         for(size_t i = 0; i < nFeatures; i++)
         {
-            (*ntDict)[i] = (*_dict)[i].ntFeature;
+            NumericTableFeature feature = (*_dict)[i].ntFeature;
+            const NumericTableFeature &ntFeature = (*ntDict)[i];
+            if( ntFeature.indexType != data_feature_utils::DAAL_OTHER_T )
+            {
+                feature.indexType = ntFeature.indexType;
+                feature.pmmlType  = ntFeature.pmmlType;
+                feature.typeSize  = ntFeature.typeSize;
+            }
+            ntDict->setFeature(feature, i);
         }
     }
 };
@@ -377,7 +393,9 @@ inline void DataSource::allocateNumericTableImpl(AOSNumericTable **nt)
 template<>
 inline void DataSource::allocateNumericTableImpl(SOANumericTable **nt)
 {
-    *nt = 0;
+    size_t nFeatures = _dict->getNumberOfFeatures();
+    *nt = new SOANumericTable(nFeatures, 0);
+    setNumericTableDictionary(*nt);
 }
 
 template<typename FPType>
@@ -507,6 +525,11 @@ public:
     }
 
     void updateStatistics( size_t ntRowIndex, NumericTable *nt)
+    {
+        updateStatistics( ntRowIndex, 1, nt );
+    }
+
+    void updateStatistics( size_t ntRowIndex, size_t nRows, NumericTable *nt)
     {
         if( nt == NULL ) { this->_errors->add(services::ErrorNullInputNumericTable); return; }
 
@@ -539,27 +562,31 @@ public:
         size_t nCols = nt->getNumberOfColumns();
 
         BlockDescriptor<_summaryStatisticsType> block;
-        nt->getBlockOfRows( ntRowIndex, 1, readOnly, block );
-        _summaryStatisticsType *row = block.getBlockPtr();
+        nt->getBlockOfRows( ntRowIndex, nRows, readOnly, block );
+        _summaryStatisticsType *rows = block.getBlockPtr();
 
-        if( ntRowIndex != 0 )
+        size_t iFirst = 0;
+        if( ntRowIndex == 0 && nRows > 0 )
         {
             for( size_t i = 0; i < nCols; i++ )
             {
-                if( minimum[i] > row[i] ) { minimum[i] = row[i]; }
-                if( maximum[i] < row[i] ) { maximum[i] = row[i]; }
-                sum[i]   += row[i];
-                sumSquares[i] += row[i] * row[i];
+                minimum[i]    = rows[i];
+                maximum[i]    = rows[i];
+                sum[i]        = rows[i];
+                sumSquares[i] = rows[i] * rows[i];
             }
+            iFirst = 1;
         }
-        else
+
+        for( size_t j = iFirst; j < nRows; j++ )
         {
+            _summaryStatisticsType *row = rows + j * nCols;
             for( size_t i = 0; i < nCols; i++ )
             {
-                minimum[i]    = row[i];
-                maximum[i]    = row[i];
-                sum[i]        = row[i];
-                sumSquares[i] = row[i] * row[i];
+                if( minimum[i] > row[i] ) { minimum[i] = row[i]; }
+                if( maximum[i] < row[i] ) { maximum[i] = row[i]; }
+                sum[i]   += row[i];
+                sumSquares[i] += row[i] * row[i];
             }
         }
 
@@ -24,6 +24,7 @@
 #ifndef __DATA_SOURCE_UTILS_H__
 #define __DATA_SOURCE_UTILS_H__
 
+#include <vector>
 #include "data_management/data_source/data_source_dictionary.h"
 #include "data_management/data/numeric_table.h"
 
@@ -31,6 +32,67 @@ namespace daal
 {
 namespace data_management
 {
+namespace internal
+{
+typedef void (*ThreaderFunctionType)(int i, const void *a);
+}
+}
+}
+
+extern "C" {
+    DAAL_EXPORT int  _daal_threader_get_max_threads();
+    DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void *a,
+                                        daal::data_management::internal::ThreaderFunctionType func);
+}
+
+namespace daal
+{
+namespace data_management
+{
+namespace internal
+{
+/**
+ *  Returns the number of threads available to the library
+ */
+inline size_t getNumberOfThreads()
+{
+    return (size_t)_daal_threader_get_max_threads();
+}
+
+template<typename Task>
+inline void threaderForTasks(int i, const void *a)
+{
+    static_cast<const Task *>(a)->run((size_t)i);
+}
+
+/**
+ *  Calls task.run(i) for every i in [0, n) in parallel using the threading layer of the library
+ *  \tparam Task  Type of the task that provides the method void run(size_t i) const
+ */
+template<typename Task>
+inline void parallelFor(size_t n, const Task &task)
+{
+    _daal_threader_for((int)n, (int)n, &task, threaderForTasks<Task>);
+}
+
+/**
+ *  Returns the type of the features of a Numeric Table if all the features have the same type,
+ *  so that feature managers can write the values in this type without conversion, or DAAL_FLOAT64 otherwise
+ */
+inline data_feature_utils::IndexNumType getCommonFeatureType(NumericTable *nt)
+{
+    NumericTableDictionary *ntDict = nt->getDictionary();
+    size_t nFeatures = ntDict->getNumberOfFeatures();
+    if( nFeatures == 0 ) { return data_feature_utils::DAAL_FLOAT64; }
+
+    data_feature_utils::IndexNumType type = (*ntDict)[0].indexType;
+    for( size_t i = 1; i < nFeatures; i++ )
+    {
+        if( (*ntDict)[i].indexType != type ) { return data_feature_utils::DAAL_FLOAT64; }
+    }
+    return type;
+}
+} // namespace internal
 
 namespace interface1
 {
@@ -60,6 +122,34 @@ public:
      */
     virtual void parseRowIn ( char *rawRowData, size_t rawDataSize, DataSourceDictionary *dict, NumericTable *nt,
                               size_t  ntRowIndex  ) = 0;
+
+    /**
+     *  Parses a block of strings that represent feature vectors and converts them into a numeric representation
+     *  \param[in]  rawData      Array of characters with nRows strings separated by the '\n' character
+     *  \param[in]  rawDataSize  Size of the rawData array
+     *  \param[in]  nRows        Number of strings in the rawData array
+     *  \param[in]  dict         Pointer to the dictionary
+     *  \param[out] nt           Pointer to a Numeric Table to store the result of parsing
+     *  \param[in]  ntRowIndex   Position in the Numeric Table at which to store the result of parsing of the first string
+     */
+    virtual void parseRowsIn( char *rawData, size_t rawDataSize, size_t nRows, DataSourceDictionary *dict, NumericTable *nt,
+                              size_t ntRowIndex )
+    {
+        std::vector<char> line;
+        const char *rowBegin = rawData;
+        const char *dataEnd  = rawData + rawDataSize;
+        for( size_t i = 0; i < nRows && rowBegin < dataEnd; i++ )
+        {
+            const char *rowEnd = rowBegin;
+            while( rowEnd < dataEnd && *rowEnd != '\n' ) { rowEnd++; }
+
+            line.assign( rowBegin, rowEnd );
+            line.push_back( 0 );
+            parseRowIn( &line[0], line.size(), dict, nt, ntRowIndex + i );
+
+            rowBegin = rowEnd + 1;
+        }
+    }
 };
 } // namespace interface1
 using interface1::StringRowFeatureManagerIface;
@@ -24,6 +24,7 @@
 #ifndef __FILE_DATA_SOURCE_H__
 #define __FILE_DATA_SOURCE_H__
 
+#include <cstring>
 #include <sstream>
 #include <fstream>
 #include "services/daal_memory.h"
@@ -43,9 +44,14 @@ namespace interface1
  *  <a name="DAAL-CLASS-FILEDATASOURCE"></a>
  *  \brief Specifies methods to access data stored in files
  *  \tparam _featureManager     FeatureManager to use to get numeric data from file strings
+ *  \tparam _summaryStatisticsType  Type of the basic statistics computed for the loaded data
+ *  \tparam _numericTableType       Type of the Numeric Table allocated by the Data Source: HomogenNumericTable<double>,
+ *                                  HomogenNumericTable<float>, HomogenNumericTable<int>, or SOANumericTable
+ *                                  with the columns of the types specified in the data dictionary
  */
-template< typename _featureManager, typename _summaryStatisticsType = double >
-class FileDataSource : public DataSourceTemplate<data_management::HomogenNumericTable<double>, _summaryStatisticsType>
+template< typename _featureManager, typename _summaryStatisticsType = double,
+          typename _numericTableType = data_management::HomogenNumericTable<double> >
+class FileDataSource : public DataSourceTemplate<_numericTableType, _summaryStatisticsType>
 {
 public:
     using DataSourceIface::NumericTableAllocationFlag;
@@ -64,7 +70,7 @@ public:
     typedef _featureManager FeatureManager;
 
 protected:
-    typedef data_management::HomogenNumericTable<double> DefaultNumericTableType;
+    typedef _numericTableType DefaultNumericTableType;
 
     FeatureManager featureManager;
 
@@ -89,6 +95,11 @@ public:
         _rawLineBufferLen = 1024;
         _rawLineBuffer    = (char *)daal::services::daal_malloc( _rawLineBufferLen );
 
+        _rawDataBufferLen = 1 << 20;
+        _rawDataBuffer    = (char *)daal::services::daal_malloc( _rawDataBufferLen );
+        _rawDataBegin     = 0;
+        _rawDataEnd       = 0;
+
         _fileStream.open( fileName.c_str(), std::fstream::in );
 
         if( _fileStream.rdstate() & std::ifstream::failbit )
@@ -107,6 +118,7 @@ public:
     {
         _fileStream.close();
         daal::services::daal_free( _rawLineBuffer );
+        daal::services::daal_free( _rawDataBuffer );
         DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::freeNumericTable();
         if( _contextDictFlag )
         {
@@ -142,31 +154,28 @@ public:
 
         if( nt == NULL ) { this->_errors->add(services::ErrorNullInputNumericTable); return 0; }
 
-        size_t j;
-
         DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::resizeNumericTableImpl( maxRows, nt );
 
         nt->setNormalizationFlag(NumericTable::nonNormalized);
 
-        for( j = 0; j < maxRows && !_fileStream.eof() ; j++ )
+        size_t rawDataSize = 0;
+        size_t j = readRows( maxRows, rawDataSize );
+
+        if( j > 0 && this->_errors->size() == 0 )
         {
-            readLine();
-            if (_rawLineLength == 0) { break; }
-            if(this->_errors->size() != 0) { break; }
-            featureManager.parseRowIn( _rawLineBuffer, _rawLineLength, _dict, nt, j );
+            featureManager.parseRowsIn( _rawDataBuffer + _rawDataBegin, rawDataSize, j, _dict, nt, 0 );
+            _rawDataBegin += rawDataSize;
 
-            DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::updateStatistics( j, nt );
+            DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::updateStatistics( 0, j, nt );
+        }
+        else
+        {
+            j = 0;
         }
 
         nt->setNumberOfRows( j );
 
-        NumericTableDictionary *ntDict = nt->getDictionary();
-        size_t nFeatures = _dict->getNumberOfFeatures();
-        ntDict->setNumberOfFeatures(nFeatures);
-        for (size_t i = 0; i < nFeatures; i++)
-        {
-            ntDict->setFeature((*_dict)[i].ntFeature, i);
-        }
+        DataSource::setNumericTableDictionary( nt );
 
         return j;
     }
@@ -189,61 +198,40 @@ public:
 
         if( nt == NULL ) { this->_errors->add(services::ErrorNullInputNumericTable); return 0; }
 
-        size_t maxRows = (_initialMaxRows > 0 ? _initialMaxRows : 10);
-        size_t nrows = 0;
-        size_t ncols = _dict->getNumberOfFeatures();
-
-        DataCollection tables;
+        /* The number of rows is counted first so that the Numeric Table is allocated only once */
+        size_t rawDataSize = 0;
+        size_t nRows = countRemainingRows( rawDataSize );
+        if( this->_errors->size() != 0 ) { return 0; }
 
-        for( ; ; )
-        {
-            NumericTable *ntCurrent = new HomogenNumericTable<double>(ncols, maxRows, NumericTableIface::doAllocate);
-            if (ntCurrent == NULL)
-            {
-                this->_errors->add(services::ErrorNumericTableNotAllocated);
-                break;
-            }
-            tables.push_back(services::SharedPtr<NumericTable>(ntCurrent));
-            size_t rows = loadDataBlock(maxRows, ntCurrent);
-            nrows += rows;
-            if (rows < maxRows) { break; }
-            maxRows *= 2;
-        }
+        DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::resizeNumericTableImpl( nRows, nt );
+        if( this->_errors->size() != 0 ) { return 0; }
 
-        DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::resizeNumericTableImpl( nrows, nt );
         nt->setNormalizationFlag(NumericTable::nonNormalized);
 
-        BlockDescriptor<double> blockCurrent, block;
+        /* Rows are parsed directly into the Numeric Table in blocks that fit into the raw data buffer */
+        size_t rowSize = (nRows > 0 ? rawDataSize / nRows + 1 : 1);
+        size_t blockRows = _rawDataBufferLen / 2 / rowSize;
+        if( blockRows == 0 ) { blockRows = 1; }
 
         size_t pos = 0;
+        while( pos < nRows )
+        {
+            size_t blockSize = 0;
+            size_t j = readRows( (nRows - pos < blockRows ? nRows - pos : blockRows), blockSize );
+            if( j == 0 || this->_errors->size() != 0 ) { break; }
 
-        for (size_t i = 0; i < tables.size(); i++) {
-            NumericTable *ntCurrent = (NumericTable*)(tables[i].get());
-            size_t rows = ntCurrent->getNumberOfRows();
-
-            if (rows == 0) { continue; }
-
-            ntCurrent->getBlockOfRows(0, rows, readOnly, blockCurrent);
-            nt->getBlockOfRows(pos, rows, writeOnly, block);
-
-            services::daal_memcpy_s(block.getBlockPtr(), rows * ncols * sizeof(double), blockCurrent.getBlockPtr(), rows * ncols * sizeof(double));
-
-            ntCurrent->releaseBlockOfRows(blockCurrent);
-            nt->releaseBlockOfRows(block);
+            featureManager.parseRowsIn( _rawDataBuffer + _rawDataBegin, blockSize, j, _dict, nt, pos );
+            _rawDataBegin += blockSize;
 
-            DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::combineStatistics( ntCurrent, nt, pos == 0);
-            pos += rows;
+            DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::updateStatistics( pos, j, nt );
+            pos += j;
         }
 
-        NumericTableDictionary *ntDict = nt->getDictionary();
-        size_t nFeatures = _dict->getNumberOfFeatures();
-        ntDict->setNumberOfFeatures(nFeatures);
-        for (size_t i = 0; i < nFeatures; i++)
-        {
-            ntDict->setFeature((*_dict)[i].ntFeature, i);
-        }
+        nt->setNumberOfRows( pos );
 
-        return nrows;
+        DataSource::setNumericTableDictionary( nt );
+
+        return pos;
     }
 
     void createDictionaryFromContext() DAAL_C11_OVERRIDE
@@ -268,13 +256,15 @@ public:
             _dict = NULL;
         }
 
-        _fileStream.seekg(0);
         _fileStream.clear();
+        _fileStream.seekg(0);
+        _rawDataBegin = 0;
+        _rawDataEnd   = 0;
     }
 
     DataSourceIface::DataSourceStatus getStatus() DAAL_C11_OVERRIDE
     {
-        if( _fileStream.eof() )
+        if( _fileStream.eof() && _rawDataBegin == _rawDataEnd )
         {
             return DataSourceIface::endOfData;
         }
@@ -302,28 +292,155 @@ protected:
         }
     }
 
-    void readLine()
+    /**
+     *  Reads the next portion of the file into the raw data buffer.
+     *  Unprocessed data is moved to the beginning of the buffer, the buffer is enlarged if it is full
+     *  \return true if any data was read, false if the end of the file is reached
+     */
+    bool readRawData()
+    {
+        if( !_fileStream.good() || _rawDataBuffer == 0 ) { return false; }
+
+        size_t available = _rawDataEnd - _rawDataBegin;
+        if( _rawDataBegin > 0 )
+        {
+            memmove( _rawDataBuffer, _rawDataBuffer + _rawDataBegin, available );
+            _rawDataBegin = 0;
+            _rawDataEnd   = available;
+        }
+
+        if( _rawDataEnd == _rawDataBufferLen )
+        {
+            char *newBuffer = (char *)daal::services::daal_malloc( 2 * _rawDataBufferLen );
+            if( newBuffer == 0 )
+            {
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+                return false;
+            }
+            daal::services::daal_memcpy_s( newBuffer, 2 * _rawDataBufferLen, _rawDataBuffer, _rawDataEnd );
+            daal::services::daal_free( _rawDataBuffer );
+            _rawDataBuffer    = newBuffer;
+            _rawDataBufferLen = 2 * _rawDataBufferLen;
+        }
+
+        _fileStream.read( _rawDataBuffer + _rawDataEnd, _rawDataBufferLen - _rawDataEnd );
+        size_t nRead = (size_t)_fileStream.gcount();
+        _rawDataEnd += nRead;
+
+        return (nRead > 0);
+    }
+
+    /**
+     *  Counts the lines from the current position to the end of the file without storing them.
+     *  The position in the file is restored after counting
+     *  \param[out] rawDataSize  Size of the counted data in bytes
+     *  \return Number of lines
+     */
+    size_t countRemainingRows( size_t &rawDataSize )
     {
-        std::streampos position = _fileStream.tellg();
+        size_t nRows = 0;
+        char lastChar = '\n';
 
-        _istream->getline( _rawLineBuffer, _rawLineBufferLen );
-        while( _istream->rdstate() & std::ifstream::failbit )
+        rawDataSize = _rawDataEnd - _rawDataBegin;
+        countRows( _rawDataBuffer + _rawDataBegin, rawDataSize, nRows, lastChar );
+
+        if( _fileStream.good() )
         {
-            if( _istream->rdstate() & std::ifstream::eofbit )
+            const size_t chunkSize = 1 << 20;
+            char *chunk = (char *)daal::services::daal_malloc( chunkSize );
+            if( chunk == 0 )
             {
-                _rawLineLength = 0;
-                return;
+                this->_errors->add(services::ErrorMemoryAllocationFailed);
+                return 0;
             }
 
+            std::streampos position = _fileStream.tellg();
+            while( _fileStream.good() )
+            {
+                _fileStream.read( chunk, chunkSize );
+                size_t nRead = (size_t)_fileStream.gcount();
+                countRows( chunk, nRead, nRows, lastChar );
+                rawDataSize += nRead;
+            }
+            daal::services::daal_free( chunk );
+
+            _fileStream.clear();
+            _fileStream.seekg( position );
+        }
+
+        /* The last line of the file is not terminated by the end-of-line character */
+        if( lastChar != '\n' ) { nRows++; }
+        return nRows;
+    }
+
+    static void countRows( const char *data, size_t size, size_t &nRows, char &lastChar )
+    {
+        if( size == 0 ) { return; }
+        const char *end = data + size;
+        for( const char *p = (const char *)memchr( data, '\n', size ); p; p = (const char *)memchr( p, '\n', end - p ) )
+        {
+            nRows++;
+            p++;
+        }
+        lastChar = end[-1];
+    }
+
+    /**
+     *  Reads whole lines into the raw data buffer starting from the position _rawDataBegin
+     *  \param[in]  maxRows      Maximum number of lines to read
+     *  \param[out] rawDataSize  Size of the data that contains the lines read
+     *  \return Number of lines read
+     */
+    size_t readRows( size_t maxRows, size_t &rawDataSize )
+    {
+        size_t nRows = 0;
+        rawDataSize = 0;
+        while( nRows < maxRows )
+        {
+            const char *rowBegin = _rawDataBuffer + _rawDataBegin + rawDataSize;
+            const char *rowEnd = (const char *)memchr( rowBegin, '\n', _rawDataEnd - _rawDataBegin - rawDataSize );
+            if( rowEnd )
+            {
+                rawDataSize += (size_t)(rowEnd - rowBegin) + 1;
+                nRows++;
+                continue;
+            }
+
+            if( !readRawData() )
+            {
+                /* The last line of the file is not terminated by the end-of-line character */
+                if( _rawDataEnd - _rawDataBegin > rawDataSize )
+                {
+                    rawDataSize = _rawDataEnd - _rawDataBegin;
+                    nRows++;
+                }
+                break;
+            }
+        }
+        return nRows;
+    }
+
+    void readLine()
+    {
+        size_t lineSize = 0;
+        readRows( 1, lineSize );
+        if( this->_errors->size() != 0 ) { return; }
+
+        while( (size_t)_rawLineBufferLen <= lineSize )
+        {
             enlargeBuffer();
             if( this->_errors->size() != 0 ) { return; }
+        }
 
-            _istream->clear();
-            _istream->seekg( position );
-            _istream->getline( _rawLineBuffer, _rawLineBufferLen );
+        if( lineSize > 0 )
+        {
+            daal::services::daal_memcpy_s( _rawLineBuffer, _rawLineBufferLen, _rawDataBuffer + _rawDataBegin, lineSize );
         }
+        _rawLineBuffer[lineSize] = 0;
+        if( lineSize > 0 && _rawLineBuffer[lineSize - 1] == '\n' ) { _rawLineBuffer[lineSize - 1] = 0; }
 
-        _rawLineLength = (size_t)_istream->gcount();
+        _rawDataBegin += lineSize;
+        _rawLineLength = lineSize;
     }
 
 private:
@@ -336,6 +453,11 @@ private:
 
     size_t _rawLineLength;
 
+    char  *_rawDataBuffer;
+    size_t _rawDataBufferLen;
+    size_t _rawDataBegin;
+    size_t _rawDataEnd;
+
     bool _contextDictFlag;
 };
 } // namespace interface1
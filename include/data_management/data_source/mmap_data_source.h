@@ -0,0 +1,756 @@
+/* file: mmap_data_source.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the memory-mapped binary data file format:
+//  the writer of the files and the data source that exposes the files as Numeric Tables.
+//--
+*/
+
+#ifndef __MMAP_DATA_SOURCE_H__
+#define __MMAP_DATA_SOURCE_H__
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+
+#include "services/daal_memory.h"
+#include "data_management/data_source/data_source.h"
+#include "data_management/data_source/data_source_dictionary.h"
+#include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/soa_numeric_table.h"
+#include "data_management/data/csr_numeric_table.h"
+
+namespace daal
+{
+namespace data_management
+{
+
+namespace internal
+{
+/**
+ *  Maps the file into memory. The pages are private: modifications of the mapped memory are not written to the file
+ *  \param[in]  fileName  Name of the file
+ *  \param[out] data      Pointer to the mapped memory
+ *  \param[out] size      Size of the file in bytes
+ *  \return NoErrorMessageFound if the file is mapped, the identifier of the error otherwise
+ */
+DAAL_EXPORT services::ErrorID mapFile(const char *fileName, char **data, size_t *size);
+
+/**
+ *  Unmaps the memory mapped by mapFile
+ *  \param[in]  data      Pointer to the mapped memory
+ *  \param[in]  size      Size of the file in bytes
+ */
+DAAL_EXPORT void unmapFile(char *data, size_t size);
+} // namespace internal
+
+namespace interface1
+{
+/**
+ * <a name="DAAL-ENUM-MMAPFILELAYOUT"></a>
+ * \brief Layouts of the data in the memory-mapped binary data file
+ */
+enum MmapFileLayout
+{
+    mmapRowMajor    = 0,   /*!< All features have the same type, values are stored row by row */
+    mmapColumnMajor = 1,   /*!< Every feature has its own type, values of each feature are stored in a separate array */
+    mmapCsr         = 2    /*!< Values are stored in the one-based CSR layout */
+};
+
+/**
+ *  <a name="DAAL-STRUCT-MMAPFILEHEADER"></a>
+ *  \brief Header of the memory-mapped binary data file.
+ *         The header is followed by nColumns MmapFileFeature structures.
+ *         All offsets are counted from the beginning of the file, arrays of data are aligned at mmapFileAlignment bytes
+ */
+struct MmapFileHeader
+{
+    char        magic[8];           /*!< File signature, "DAALMMAP" */
+    DAAL_UINT64 version;            /*!< Version of the format */
+    DAAL_UINT64 layout;             /*!< Layout of the data, MmapFileLayout */
+    DAAL_UINT64 nRows;              /*!< Number of rows */
+    DAAL_UINT64 nColumns;           /*!< Number of columns */
+    DAAL_UINT64 nValues;            /*!< Number of values stored in the CSR layout */
+    DAAL_UINT64 dataOffset;         /*!< Offset of the values for the row-major and CSR layouts */
+    DAAL_UINT64 colIndicesOffset;   /*!< Offset of the column indices for the CSR layout */
+    DAAL_UINT64 rowOffsetsOffset;   /*!< Offset of the row offsets for the CSR layout */
+};
+
+/**
+ *  <a name="DAAL-STRUCT-MMAPFILEFEATURE"></a>
+ *  \brief Description of a feature stored in the memory-mapped binary data file
+ */
+struct MmapFileFeature
+{
+    DAAL_INT64  indexType;          /*!< Type of the values, data_feature_utils::IndexNumType */
+    DAAL_INT64  featureType;        /*!< Type of the feature, data_feature_utils::FeatureType */
+    DAAL_INT64  categoryNumber;     /*!< Number of categories of a categorical feature */
+    DAAL_UINT64 dataOffset;         /*!< Offset of the values of the feature for the column-major layout */
+};
+
+const char        mmapFileMagic[8]  = { 'D', 'A', 'A', 'L', 'M', 'M', 'A', 'P' };
+const DAAL_UINT64 mmapFileVersion   = 1;
+const DAAL_UINT64 mmapFileAlignment = 64;
+
+/**
+ *  <a name="DAAL-CLASS-MMAPFILEWRITER"></a>
+ *  \brief Writes Numeric Tables into memory-mapped binary data files that can be read by MmapDataSource.
+ *         Values of the features are stored as float, double or int. Values of other types are stored as double
+ */
+class MmapFileWriter
+{
+public:
+    MmapFileWriter() : _errors(new services::ErrorCollection()) {}
+
+    /**
+     *  Writes a Numeric Table into a file. CSR Numeric Tables are written in the CSR layout,
+     *  SOA Numeric Tables are written in the column-major layout, other Numeric Tables are written in the row-major layout
+     *  \param[in]  nt        Pointer to the Numeric Table
+     *  \param[in]  fileName  Name of the file
+     */
+    void write( NumericTable *nt, const std::string &fileName )
+    {
+        if( nt == NULL ) { _errors->add(services::ErrorNullInputNumericTable); return; }
+
+        NumericTableIface::StorageLayout ntLayout = nt->getDataLayout();
+        MmapFileLayout layout = (ntLayout == NumericTableIface::csrArray ? mmapCsr :
+                                 (ntLayout == NumericTableIface::soa ? mmapColumnMajor : mmapRowMajor));
+        write( nt, fileName, layout );
+    }
+
+    /**
+     *  Writes a Numeric Table into a file with the specified layout of the data
+     *  \param[in]  nt        Pointer to the Numeric Table
+     *  \param[in]  fileName  Name of the file
+     *  \param[in]  layout    Layout of the data in the file. The CSR layout is supported for CSR Numeric Tables only
+     */
+    void write( NumericTable *nt, const std::string &fileName, MmapFileLayout layout )
+    {
+        if( nt == NULL ) { _errors->add(services::ErrorNullInputNumericTable); return; }
+
+        CSRNumericTableIface *csrNt = dynamic_cast<CSRNumericTableIface *>(nt);
+        if( layout == mmapCsr && csrNt == NULL ) { _errors->add(services::ErrorIncorrectTypeOfNumericTable); return; }
+        if( nt->getNumberOfColumns() == 0 ) { _errors->add(services::ErrorIncorrectNumberOfColumns); return; }
+
+        std::ofstream file( fileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+        if( !file.is_open() ) { _errors->add(services::ErrorOnFileOpen); return; }
+
+        const size_t nRows = nt->getNumberOfRows();
+        const size_t nCols = nt->getNumberOfColumns();
+        NumericTableDictionary *ntDict = nt->getDictionary();
+
+        /* Values of the row-major and CSR layouts have the type of the first feature
+           if all the features have the same type */
+        data_feature_utils::IndexNumType commonType = getStoredType( (*ntDict)[0].indexType );
+        for( size_t j = 1; j < nCols; j++ )
+        {
+            if( getStoredType( (*ntDict)[j].indexType ) != commonType ) { commonType = data_feature_utils::DAAL_FLOAT64; }
+        }
+
+        MmapFileHeader header;
+        memcpy( header.magic, mmapFileMagic, sizeof(header.magic) );
+        header.version          = mmapFileVersion;
+        header.layout           = layout;
+        header.nRows            = nRows;
+        header.nColumns         = nCols;
+        header.nValues          = (layout == mmapCsr ? csrNt->getDataSize() : 0);
+        header.dataOffset       = 0;
+        header.colIndicesOffset = 0;
+        header.rowOffsetsOffset = 0;
+
+        std::vector<MmapFileFeature> features( nCols );
+        MmapFileFeature *feat = &features[0];
+
+        DAAL_UINT64 offset = align( sizeof(MmapFileHeader) + nCols * sizeof(MmapFileFeature) );
+        for( size_t j = 0; j < nCols; j++ )
+        {
+            NumericTableFeature &f = (*ntDict)[j];
+            feat[j].indexType      = (layout == mmapColumnMajor ? getStoredType( f.indexType ) : commonType);
+            feat[j].featureType    = f.featureType;
+            feat[j].categoryNumber = f.categoryNumber;
+            feat[j].dataOffset     = 0;
+            if( layout == mmapColumnMajor )
+            {
+                feat[j].dataOffset = offset;
+                offset = align( offset + nRows * getTypeSize( feat[j].indexType ) );
+            }
+        }
+        if( layout == mmapRowMajor )
+        {
+            header.dataOffset = offset;
+        }
+        else if( layout == mmapCsr )
+        {
+            header.dataOffset       = offset;
+            header.colIndicesOffset = align( header.dataOffset + header.nValues * getTypeSize( commonType ) );
+            header.rowOffsetsOffset = align( header.colIndicesOffset + header.nValues * sizeof(DAAL_UINT64) );
+        }
+
+        file.write( (const char *)&header, sizeof(header) );
+        file.write( (const char *)feat, nCols * sizeof(MmapFileFeature) );
+
+        if( layout == mmapRowMajor )
+        {
+            pad( file, header.dataOffset );
+            switch( commonType )
+            {
+            case data_feature_utils::DAAL_FLOAT32: writeRows<float >( file, nt ); break;
+            case data_feature_utils::DAAL_INT32_S: writeRows<int   >( file, nt ); break;
+            default:                               writeRows<double>( file, nt ); break;
+            }
+        }
+        else if( layout == mmapColumnMajor )
+        {
+            for( size_t j = 0; j < nCols; j++ )
+            {
+                pad( file, feat[j].dataOffset );
+                switch( feat[j].indexType )
+                {
+                case data_feature_utils::DAAL_FLOAT32: writeColumn<float >( file, nt, j ); break;
+                case data_feature_utils::DAAL_INT32_S: writeColumn<int   >( file, nt, j ); break;
+                default:                               writeColumn<double>( file, nt, j ); break;
+                }
+            }
+        }
+        else
+        {
+            switch( commonType )
+            {
+            case data_feature_utils::DAAL_FLOAT32: writeCsr<float >( file, csrNt, header ); break;
+            case data_feature_utils::DAAL_INT32_S: writeCsr<int   >( file, csrNt, header ); break;
+            default:                               writeCsr<double>( file, csrNt, header ); break;
+            }
+        }
+
+        file.close();
+        if( file.fail() ) { _errors->add(services::ErrorOnFileWrite); }
+    }
+
+    /**
+     * Returns errors that occurred during writing
+     * \return Errors that occurred during writing
+     */
+    services::SharedPtr<services::ErrorCollection> getErrors()
+    {
+        return _errors;
+    }
+
+protected:
+    services::SharedPtr<services::ErrorCollection> _errors;
+
+    static const size_t blockSize = 4096;
+
+    static DAAL_UINT64 align( DAAL_UINT64 offset )
+    {
+        return (offset + mmapFileAlignment - 1) / mmapFileAlignment * mmapFileAlignment;
+    }
+
+    static data_feature_utils::IndexNumType getStoredType( data_feature_utils::IndexNumType type )
+    {
+        return ((type == data_feature_utils::DAAL_FLOAT32 || type == data_feature_utils::DAAL_INT32_S) ?
+                type : data_feature_utils::DAAL_FLOAT64);
+    }
+
+    static size_t getTypeSize( DAAL_INT64 type )
+    {
+        return (type == data_feature_utils::DAAL_FLOAT64 ? sizeof(double) : sizeof(float));
+    }
+
+    static void pad( std::ofstream &file, DAAL_UINT64 offset )
+    {
+        const char zeros[mmapFileAlignment] = { 0 };
+        DAAL_UINT64 position = (DAAL_UINT64)file.tellp();
+        while( position < offset )
+        {
+            const DAAL_UINT64 size = (offset - position < mmapFileAlignment ? offset - position : mmapFileAlignment);
+            file.write( zeros, (std::streamsize)size );
+            position += size;
+        }
+    }
+
+    template<typename T>
+    void writeRows( std::ofstream &file, NumericTable *nt )
+    {
+        const size_t nRows = nt->getNumberOfRows();
+        const size_t nCols = nt->getNumberOfColumns();
+        BlockDescriptor<T> block;
+        for( size_t i = 0; i < nRows; i += blockSize )
+        {
+            const size_t n = (i + blockSize < nRows ? blockSize : nRows - i);
+            nt->getBlockOfRows( i, n, readOnly, block );
+            file.write( (const char *)block.getBlockPtr(), n * nCols * sizeof(T) );
+            nt->releaseBlockOfRows( block );
+        }
+    }
+
+    template<typename T>
+    void writeColumn( std::ofstream &file, NumericTable *nt, size_t j )
+    {
+        const size_t nRows = nt->getNumberOfRows();
+        BlockDescriptor<T> block;
+        for( size_t i = 0; i < nRows; i += blockSize )
+        {
+            const size_t n = (i + blockSize < nRows ? blockSize : nRows - i);
+            nt->getBlockOfColumnValues( j, i, n, readOnly, block );
+            file.write( (const char *)block.getBlockPtr(), n * sizeof(T) );
+            nt->releaseBlockOfColumnValues( block );
+        }
+    }
+
+    template<typename T>
+    void writeCsr( std::ofstream &file, CSRNumericTableIface *csrNt, const MmapFileHeader &header )
+    {
+        const size_t nRows = (size_t)header.nRows;
+        CSRBlockDescriptor<T> block;
+
+        pad( file, header.dataOffset );
+        for( size_t i = 0; i < nRows; i += blockSize )
+        {
+            const size_t n = (i + blockSize < nRows ? blockSize : nRows - i);
+            csrNt->getSparseBlock( i, n, readOnly, block );
+            file.write( (const char *)block.getBlockValuesPtr(), block.getDataSize() * sizeof(T) );
+            csrNt->releaseSparseBlock( block );
+        }
+
+        pad( file, header.colIndicesOffset );
+        for( size_t i = 0; i < nRows; i += blockSize )
+        {
+            const size_t n = (i + blockSize < nRows ? blockSize : nRows - i);
+            csrNt->getSparseBlock( i, n, readOnly, block );
+            const size_t *colIndices = block.getBlockColumnIndicesPtr();
+            for( size_t k = 0; k < block.getDataSize(); k++ )
+            {
+                DAAL_UINT64 index = colIndices[k];
+                file.write( (const char *)&index, sizeof(index) );
+            }
+            csrNt->releaseSparseBlock( block );
+        }
+
+        pad( file, header.rowOffsetsOffset );
+        DAAL_UINT64 rowOffset = 1;
+        file.write( (const char *)&rowOffset, sizeof(rowOffset) );
+        for( size_t i = 0; i < nRows; i += blockSize )
+        {
+            const size_t n = (i + blockSize < nRows ? blockSize : nRows - i);
+            csrNt->getSparseBlock( i, n, readOnly, block );
+            const size_t *rowOffsets = block.getBlockRowIndicesPtr();
+            const DAAL_UINT64 base = rowOffset - rowOffsets[0];
+            for( size_t k = 1; k <= n; k++ )
+            {
+                DAAL_UINT64 offset = base + rowOffsets[k];
+                file.write( (const char *)&offset, sizeof(offset) );
+            }
+            rowOffset = base + rowOffsets[n];
+            csrNt->releaseSparseBlock( block );
+        }
+    }
+};
+
+/**
+ *  \brief CSR Numeric Table over the mapped memory that owns the row offsets rebased for its block of rows
+ */
+class MmapCSRNumericTable : public CSRNumericTable
+{
+public:
+    template<typename DataType>
+    MmapCSRNumericTable( DataType *const ptr, size_t *colIndices, const services::SharedPtr<size_t> &rowOffsets,
+                         size_t nColumns, size_t nRows ) :
+        CSRNumericTable( ptr, colIndices, rowOffsets.get(), nColumns, nRows ), _rowOffsetsBuffer(rowOffsets) {}
+
+private:
+    services::SharedPtr<size_t> _rowOffsetsBuffer;
+};
+
+/**
+ *  <a name="DAAL-CLASS-MMAPDATASOURCE"></a>
+ *  \brief Specifies methods to access data stored in the memory-mapped binary data files written by MmapFileWriter.
+ *         The file is mapped into memory and exposed without copies as HomogenNumericTable for the row-major layout,
+ *         SOANumericTable for the column-major layout and CSRNumericTable for the CSR layout.
+ *         Pages of the file are shared between the processes that map the same file until they are modified.
+ *         The Numeric Tables created by the Data Source refer to the mapped memory
+ *         and can be used while the Data Source exists
+ */
+class MmapDataSource : public DataSource
+{
+public:
+    /**
+     *  Main constructor for a Data Source
+     *  \param[in]  fileName  Name of the file that stores data
+     */
+    MmapDataSource( const std::string &fileName ) :
+        DataSource(), _fileName(fileName), _data(0), _size(0), _header(0), _features(0), _rowOffset(0),
+        _contextDictFlag(false)
+    {
+        _autoNumericTableFlag = doAllocateNumericTable;
+        _autoDictionaryFlag   = doDictionaryFromContext;
+
+        services::ErrorID errorId = internal::mapFile( _fileName.c_str(), &_data, &_size );
+        if( errorId != services::NoErrorMessageFound ) { this->_errors->add(errorId); return; }
+
+        checkFile();
+    }
+
+    ~MmapDataSource()
+    {
+        freeNumericTable();
+        if( _contextDictFlag )
+        {
+            delete _dict;
+        }
+        internal::unmapFile( _data, _size );
+    }
+
+    /**
+     *  Returns the layout of the data in the file
+     *  \return Layout of the data in the file
+     */
+    MmapFileLayout getLayout() const
+    {
+        return (_header ? (MmapFileLayout)_header->layout : mmapRowMajor);
+    }
+
+    void createDictionaryFromContext() DAAL_C11_OVERRIDE
+    {
+        if( _dict != NULL )
+        {
+            this->_errors->add(services::ErrorDictionaryAlreadyAvailable);
+            return;
+        }
+        if( _header == NULL )
+        {
+            this->_errors->add(services::ErrorIncorrectDataFileFormat);
+            return;
+        }
+
+        _contextDictFlag = true;
+        _dict = new DataSourceDictionary();
+
+        const size_t nCols = (size_t)_header->nColumns;
+        _dict->setNumberOfFeatures( nCols );
+        for( size_t j = 0; j < nCols; j++ )
+        {
+            DataSourceFeature feat;
+            switch( _features[j].indexType )
+            {
+            case data_feature_utils::DAAL_FLOAT32: feat.setType<float >(); break;
+            case data_feature_utils::DAAL_INT32_S: feat.setType<int   >(); break;
+            default:                               feat.setType<double>(); break;
+            }
+            feat.ntFeature.featureType    = (data_feature_utils::FeatureType)_features[j].featureType;
+            feat.ntFeature.categoryNumber = (size_t)_features[j].categoryNumber;
+            _dict->setFeature( feat, j );
+        }
+    }
+
+    void allocateNumericTable() DAAL_C11_OVERRIDE
+    {
+        if( _spnt.get() != NULL ) { this->_errors->add(services::ErrorNumericTableAlreadyAllocated); return; }
+
+        checkDictionary();
+        if( this->_errors->size() != 0 ) { return; }
+
+        _spnt = createNumericTable( 0, 0 );
+    }
+
+    void freeNumericTable() DAAL_C11_OVERRIDE
+    {
+        _spnt = services::SharedPtr<NumericTable>();
+    }
+
+    DataSourceIface::DataSourceStatus getStatus() DAAL_C11_OVERRIDE
+    {
+        if( _header == NULL ) { return DataSourceIface::notReady; }
+        return (_rowOffset < _header->nRows ? DataSourceIface::readyForLoad : DataSourceIface::endOfData);
+    }
+
+    size_t getNumberOfAvailableRows() DAAL_C11_OVERRIDE
+    {
+        return (_header ? (size_t)_header->nRows - _rowOffset : 0);
+    }
+
+    /**
+     *  Exposes the next maxRows rows of the file as the Numeric Table of the Data Source without copying the data
+     *  \param[in] maxRows Maximum number of rows to load
+     *  \return Number of loaded rows
+     */
+    size_t loadDataBlock(size_t maxRows) DAAL_C11_OVERRIDE
+    {
+        checkDictionary();
+        if( this->_errors->size() != 0 ) { return 0; }
+
+        size_t nRows = getNumberOfAvailableRows();
+        if( nRows > maxRows ) { nRows = maxRows; }
+
+        _spnt = createNumericTable( _rowOffset, nRows );
+        if( this->_errors->size() != 0 ) { return 0; }
+
+        _rowOffset += nRows;
+        return nRows;
+    }
+
+    /**
+     *  Exposes all the remaining rows of the file as the Numeric Table of the Data Source without copying the data
+     *  \return Number of loaded rows
+     */
+    size_t loadDataBlock() DAAL_C11_OVERRIDE
+    {
+        return loadDataBlock( getNumberOfAvailableRows() );
+    }
+
+    /**
+     *  Copies the next maxRows rows of the file into a provided Numeric Table
+     *  \param[in] maxRows Maximum number of rows to load
+     *  \param[in] nt      Pointer to the Numeric Table
+     *  \return Number of loaded rows
+     */
+    size_t loadDataBlock(size_t maxRows, NumericTable *nt) DAAL_C11_OVERRIDE
+    {
+        checkDictionary();
+        if( this->_errors->size() != 0 ) { return 0; }
+
+        if( nt == NULL ) { this->_errors->add(services::ErrorNullInputNumericTable); return 0; }
+
+        size_t nRows = getNumberOfAvailableRows();
+        if( nRows > maxRows ) { nRows = maxRows; }
+
+        services::SharedPtr<NumericTable> src = createNumericTable( _rowOffset, nRows );
+        if( this->_errors->size() != 0 ) { return 0; }
+
+        /* The rows are copied as contiguous blocks, so the table must have exactly the columns of the file */
+        const size_t nCols = _dict->getNumberOfFeatures();
+        if( nt->getNumberOfColumns() != nCols || nt->getNumberOfRows() < nRows )
+        {
+            nt->setNumberOfColumns( nCols );
+            nt->setNumberOfRows( nRows );
+            nt->allocateDataMemory();
+        }
+        setNumericTableDictionary( nt );
+
+        BlockDescriptor<double> srcBlock, dstBlock;
+        const size_t blockSize = 4096;
+        for( size_t i = 0; i < nRows; i += blockSize )
+        {
+            const size_t n = (i + blockSize < nRows ? blockSize : nRows - i);
+            src->getBlockOfRows( i, n, readOnly, srcBlock );
+            nt->getBlockOfRows( i, n, writeOnly, dstBlock );
+            daal::services::daal_memcpy_s( dstBlock.getBlockPtr(), n * nCols * sizeof(double),
+                                           srcBlock.getBlockPtr(), n * nCols * sizeof(double) );
+            nt->releaseBlockOfRows( dstBlock );
+            src->releaseBlockOfRows( srcBlock );
+        }
+        nt->setNumberOfRows( nRows );
+
+        _rowOffset += nRows;
+        return nRows;
+    }
+
+    /**
+     *  Copies all the remaining rows of the file into a provided Numeric Table
+     *  \param[in] nt      Pointer to the Numeric Table
+     *  \return Number of loaded rows
+     */
+    size_t loadDataBlock(NumericTable *nt) DAAL_C11_OVERRIDE
+    {
+        return loadDataBlock( getNumberOfAvailableRows(), nt );
+    }
+
+protected:
+    /**
+     *  Creates a Numeric Table that refers to the rows [rowOffset, rowOffset + nRows) of the mapped file
+     */
+    services::SharedPtr<NumericTable> createNumericTable( size_t rowOffset, size_t nRows )
+    {
+        services::SharedPtr<NumericTable> nt;
+        if( _header == NULL ) { this->_errors->add(services::ErrorIncorrectDataFileFormat); return nt; }
+
+        const size_t nCols = (size_t)_header->nColumns;
+        switch( _header->layout )
+        {
+        case mmapRowMajor:
+        {
+            char *rows = _data + _header->dataOffset + rowOffset * nCols * getTypeSize( _features[0].indexType );
+            switch( _features[0].indexType )
+            {
+            case data_feature_utils::DAAL_FLOAT32:
+                nt = services::SharedPtr<NumericTable>(new HomogenNumericTable<float >( (float  *)rows, nCols, nRows )); break;
+            case data_feature_utils::DAAL_INT32_S:
+                nt = services::SharedPtr<NumericTable>(new HomogenNumericTable<int   >( (int    *)rows, nCols, nRows )); break;
+            default:
+                nt = services::SharedPtr<NumericTable>(new HomogenNumericTable<double>( (double *)rows, nCols, nRows )); break;
+            }
+            break;
+        }
+        case mmapColumnMajor:
+        {
+            SOANumericTable *soaNt = new SOANumericTable( nCols, nRows );
+            nt = services::SharedPtr<NumericTable>(soaNt);
+            for( size_t j = 0; j < nCols; j++ )
+            {
+                char *column = _data + _features[j].dataOffset + rowOffset * getTypeSize( _features[j].indexType );
+                switch( _features[j].indexType )
+                {
+                case data_feature_utils::DAAL_FLOAT32: soaNt->setArray<float >( (float  *)column, j ); break;
+                case data_feature_utils::DAAL_INT32_S: soaNt->setArray<int   >( (int    *)column, j ); break;
+                default:                               soaNt->setArray<double>( (double *)column, j ); break;
+                }
+            }
+            break;
+        }
+        default:
+        {
+            size_t *rowOffsets = (size_t *)(_data + _header->rowOffsetsOffset) + rowOffset;
+            size_t firstValue = rowOffsets[0] - 1;
+            char *values = _data + _header->dataOffset + firstValue * getTypeSize( _features[0].indexType );
+            size_t *colIndices = (size_t *)(_data + _header->colIndicesOffset) + firstValue;
+
+            /* Row offsets of the rows that do not start the file are rebased to one
+             * in the array owned by the returned table */
+            if( rowOffset > 0 )
+            {
+                services::SharedPtr<size_t> rebasedRowOffsets(new size_t[nRows + 1], services::ArrayDeleter<size_t>());
+                for( size_t i = 0; i <= nRows; i++ )
+                {
+                    rebasedRowOffsets.get()[i] = rowOffsets[i] - firstValue;
+                }
+
+                switch( _features[0].indexType )
+                {
+                case data_feature_utils::DAAL_FLOAT32:
+                    nt = services::SharedPtr<NumericTable>(new MmapCSRNumericTable( (float  *)values, colIndices, rebasedRowOffsets, nCols, nRows )); break;
+                case data_feature_utils::DAAL_INT32_S:
+                    nt = services::SharedPtr<NumericTable>(new MmapCSRNumericTable( (int    *)values, colIndices, rebasedRowOffsets, nCols, nRows )); break;
+                default:
+                    nt = services::SharedPtr<NumericTable>(new MmapCSRNumericTable( (double *)values, colIndices, rebasedRowOffsets, nCols, nRows )); break;
+                }
+                break;
+            }
+
+            switch( _features[0].indexType )
+            {
+            case data_feature_utils::DAAL_FLOAT32:
+                nt = services::SharedPtr<NumericTable>(new CSRNumericTable( (float  *)values, colIndices, rowOffsets, nCols, nRows )); break;
+            case data_feature_utils::DAAL_INT32_S:
+                nt = services::SharedPtr<NumericTable>(new CSRNumericTable( (int    *)values, colIndices, rowOffsets, nCols, nRows )); break;
+            default:
+                nt = services::SharedPtr<NumericTable>(new CSRNumericTable( (double *)values, colIndices, rowOffsets, nCols, nRows )); break;
+            }
+            break;
+        }
+        }
+
+        setNumericTableDictionary( nt.get() );
+        return nt;
+    }
+
+    static size_t getTypeSize( DAAL_INT64 type )
+    {
+        return (type == data_feature_utils::DAAL_FLOAT64 ? sizeof(double) : sizeof(float));
+    }
+
+    /**
+     *  Checks that the mapped file contains the header, the descriptions of the features and the arrays of data
+     */
+    void checkFile()
+    {
+        MmapFileHeader *header = (MmapFileHeader *)_data;
+        if( _size < sizeof(MmapFileHeader) || memcmp( header->magic, mmapFileMagic, sizeof(header->magic) ) != 0 ||
+            header->version != mmapFileVersion || header->layout > mmapCsr || sizeof(size_t) != sizeof(DAAL_UINT64) ||
+            header->nColumns == 0 || header->nColumns > (_size - sizeof(MmapFileHeader)) / sizeof(MmapFileFeature) )
+        {
+            this->_errors->add(services::ErrorIncorrectDataFileFormat);
+            return;
+        }
+
+        MmapFileFeature *features = (MmapFileFeature *)(_data + sizeof(MmapFileHeader));
+        const DAAL_UINT64 nRows = header->nRows;
+        const DAAL_UINT64 nCols = header->nColumns;
+        bool isCorrect = true;
+
+        for( DAAL_UINT64 j = 0; j < nCols; j++ )
+        {
+            const DAAL_INT64 type = features[j].indexType;
+            if( type != data_feature_utils::DAAL_FLOAT32 && type != data_feature_utils::DAAL_FLOAT64 &&
+                type != data_feature_utils::DAAL_INT32_S ) { isCorrect = false; }
+            if( header->layout != mmapColumnMajor && type != features[0].indexType ) { isCorrect = false; }
+            if( header->layout == mmapColumnMajor && !checkArray( features[j].dataOffset, nRows, getTypeSize( type ) ) )
+            {
+                isCorrect = false;
+            }
+        }
+
+        if( isCorrect && header->layout == mmapRowMajor )
+        {
+            isCorrect = (nRows <= (DAAL_UINT64)(-1) / nCols) &&
+                        checkArray( header->dataOffset, nRows * nCols, getTypeSize( features[0].indexType ) );
+        }
+        if( isCorrect && header->layout == mmapCsr )
+        {
+            isCorrect = checkArray( header->dataOffset, header->nValues, getTypeSize( features[0].indexType ) ) &&
+                        checkArray( header->colIndicesOffset, header->nValues, sizeof(DAAL_UINT64) ) &&
+                        checkArray( header->rowOffsetsOffset, nRows + 1, sizeof(DAAL_UINT64) );
+            if( isCorrect )
+            {
+                const DAAL_UINT64 *rowOffsets = (const DAAL_UINT64 *)(_data + header->rowOffsetsOffset);
+                isCorrect = (rowOffsets[0] == 1 && rowOffsets[nRows] == header->nValues + 1);
+            }
+        }
+
+        if( !isCorrect )
+        {
+            this->_errors->add(services::ErrorIncorrectDataFileFormat);
+            return;
+        }
+
+        _header   = header;
+        _features = features;
+    }
+
+    bool checkArray( DAAL_UINT64 offset, DAAL_UINT64 nElements, size_t elementSize ) const
+    {
+        return (offset % elementSize == 0) && (offset <= _size) && (nElements <= (_size - offset) / elementSize);
+    }
+
+private:
+    std::string _fileName;
+
+    char  *_data;
+    size_t _size;
+
+    MmapFileHeader  *_header;
+    MmapFileFeature *_features;
+
+    size_t  _rowOffset;
+
+    bool _contextDictFlag;
+};
+} // namespace interface1
+using interface1::MmapFileLayout;
+using interface1::mmapRowMajor;
+using interface1::mmapColumnMajor;
+using interface1::mmapCsr;
+using interface1::MmapFileHeader;
+using interface1::MmapFileFeature;
+using interface1::MmapFileWriter;
+using interface1::MmapDataSource;
+
+}
+}
+#endif
@@ -23,6 +23,7 @@
 #ifndef __MYSQL_FEATURE_MANAGER_H__
 #define __MYSQL_FEATURE_MANAGER_H__
 
+#include <cstring>
 #include <sstream>
 #include "services/daal_memory.h"
 #include "data_management/data_source/data_source.h"
@@ -54,12 +55,34 @@ namespace interface1
 class MySQLFeatureManager
 {
 public:
-    MySQLFeatureManager() : _errors(new services::ErrorCollection()) {}
+    MySQLFeatureManager() : _errors(new services::ErrorCollection()), _rowArraySize(1024) {}
 
     /**
-     *  Executes an SQL statement from an ODBC statement handle and writes it to a Numeric Table
+     *  Sets the number of rows fetched from the data source in one call of the ODBC API (default 1024)
      *
-     *  \param[in]   hdlStmt ODBC statement handle that contains an SQL query
+     *  \param[in]   rowArraySize  Number of rows in one fetch
+     */
+    void setRowArraySize(size_t rowArraySize)
+    {
+        _rowArraySize = (rowArraySize > 0 ? rowArraySize : 1);
+    }
+
+    /**
+     *  Returns the number of rows fetched from the data source in one call of the ODBC API
+     *
+     *  \return Number of rows in one fetch
+     */
+    size_t getRowArraySize() const
+    {
+        return _rowArraySize;
+    }
+
+    /**
+     *  Fetches the results of an executed SQL statement from an ODBC statement handle and writes them to a Numeric Table.
+     *  Rows are fetched in arrays of getRowArraySize() rows. The columns of a Numeric Table with the structure of arrays layout
+     *  are bound directly to the arrays of the table, the rows of other tables are bound to blocks of rows of the table
+     *
+     *  \param[in]   hdlStmt ODBC statement handle that contains an executed SQL query
      *  \param[out]  nt      Numeric Table to store query results
      *  \param[in]   maxRows Maximum number of rows that can be read
      */
@@ -161,6 +184,11 @@ public:
 
 private:
     services::SharedPtr<services::ErrorCollection> _errors;
+    size_t _rowArraySize;
+
+    bool        isDirectlyBindable(NumericTable *nt);
+    SQLRETURN   bindColumns(SQLHSTMT hdlStmt, NumericTable *nt, size_t rowOffset, size_t nRows, SQLLEN *bindInd);
+    SQLRETURN   bindRows(SQLHSTMT hdlStmt, size_t nFeatures, double *rows, char *bindInd);
 
     size_t      getStrictureSize(NumericTableDictionary *dict);
     size_t      typeSize(data_feature_utils::IndexNumType indexNumType);
@@ -199,75 +227,164 @@ private:
 
 DataSourceIface::DataSourceStatus MySQLFeatureManager::statementResultsNumericTable(SQLHSTMT hdlStmt, NumericTable *nt, size_t maxRows)
 {
-    SQLRETURN ret;
+    SQLRETURN ret = SQL_SUCCESS;
     size_t nFeatures = nt->getNumberOfColumns();
     nt->setNumberOfRows(maxRows);
-    services::SharedPtr<NumericTableDictionary> dict = nt->getDictionarySharedPtr();
-    data_feature_utils::IndexNumType indexNumType = data_feature_utils::getIndexNumType<double>();
 
-    SQLLEN *bindInd     = (SQLLEN *)daal::services::daal_malloc(sizeof(SQLLEN) * nFeatures);
-    double *fetchBuffer = (double *)daal::services::daal_malloc(sizeof(double) * nFeatures);
-    for (int j = 0; j < nFeatures; j++)
+    const bool bindToColumns = isDirectlyBindable(nt);
+    const size_t rowArraySize = (_rowArraySize < maxRows ? _rowArraySize : maxRows);
+
+    /* Length/indicator values of one fetch. In the row-wise binding they are spaced by the size of a row of doubles */
+    const size_t bindIndSize = (bindToColumns ? sizeof(SQLLEN) * nFeatures : sizeof(double) * nFeatures) * rowArraySize;
+    char *bindInd = (char *)daal::services::daal_malloc(bindIndSize > 0 ? bindIndSize : 1);
+    if (!bindInd) { _errors->add(services::ErrorMemoryAllocationFailed); return DataSource::notReady; }
+
+    SQLULEN nFetched = 0;
+    ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROWS_FETCHED_PTR, (SQLPOINTER)&nFetched, 0);
+    if (SQL_SUCCEEDED(ret))
     {
-        if (indexNumType != data_feature_utils::DAAL_OTHER_T)
-        {
-            ret = SQLBindCol(hdlStmt, j + 1, getTargetType(indexNumType), (SQLPOINTER)&fetchBuffer[j], 0, &bindInd[j]);
-            if (!SQL_SUCCEEDED(ret)) { _errors->add(services::ErrorODBC); return DataSource::notReady; }
-        }
-        else
-        {
-            bindInd[j] = 0;
-        }
+        ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROW_BIND_TYPE,
+                             (SQLPOINTER)(bindToColumns ? (size_t)SQL_BIND_BY_COLUMN : sizeof(double) * nFeatures), 0);
+    }
+    if (!SQL_SUCCEEDED(ret))
+    {
+        daal::services::daal_free(bindInd);
+        _errors->add(services::ErrorODBC);
+        return DataSource::notReady;
     }
-    size_t read = 0;
-
-    BlockDescriptor<double> block;
-    nt->getBlockOfRows(0, maxRows, writeOnly, block);
-    double *ntBuffer = block.getBlockPtr();
 
-    while (SQL_SUCCEEDED(ret = SQLFetchScroll(hdlStmt, SQL_FETCH_NEXT, 1)))
+    size_t read = 0;
+    while (read < maxRows)
     {
-        for (int j = 0; j < nFeatures; j++)
+        const size_t nRows = (maxRows - read < rowArraySize ? maxRows - read : rowArraySize);
+        ret = SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)nRows, 0);
+        if (!SQL_SUCCEEDED(ret)) { break; }
+
+        if (bindToColumns)
         {
-            if (bindInd[j] == SQL_NULL_DATA)
+            SQLLEN *columnsInd = (SQLLEN *)bindInd;
+            ret = bindColumns(hdlStmt, nt, read, nRows, columnsInd);
+            if (!SQL_SUCCEEDED(ret)) { break; }
+
+            nFetched = 0;
+            ret = SQLFetchScroll(hdlStmt, SQL_FETCH_NEXT, 0);
+            if (!SQL_SUCCEEDED(ret)) { break; }
+
+            /* NULL values are replaced with zeros */
+            SOANumericTable *soaTable = static_cast<SOANumericTable *>(nt);
+            for (size_t j = 0; j < nFeatures; j++)
             {
-                ntBuffer[read * nFeatures + j] = 0.0;
-                continue;
+                const size_t typeSize = (*nt->getDictionary())[j].typeSize;
+                char *column = (char *)soaTable->getArray(j) + read * typeSize;
+                for (size_t i = 0; i < nFetched; i++)
+                {
+                    if (columnsInd[j * nRows + i] == SQL_NULL_DATA) { memset(column + i * typeSize, 0, typeSize); }
+                }
             }
-            indexNumType = (*dict)[j].indexType;
-            if (indexNumType != data_feature_utils::DAAL_OTHER_T)
+        }
+        else
+        {
+            BlockDescriptor<double> block;
+            nt->getBlockOfRows(read, nRows, writeOnly, block);
+            double *rows = block.getBlockPtr();
+
+            ret = bindRows(hdlStmt, nFeatures, rows, bindInd);
+            if (SQL_SUCCEEDED(ret))
             {
-                ntBuffer[read * nFeatures + j] = *((double *) & (fetchBuffer[j]));
+                nFetched = 0;
+                ret = SQLFetchScroll(hdlStmt, SQL_FETCH_NEXT, 0);
             }
-            else
+            if (SQL_SUCCEEDED(ret))
             {
-                ntBuffer[read * nFeatures + j] = 0.0;
+                for (size_t i = 0; i < nFetched; i++)
+                {
+                    const SQLLEN *rowInd = (const SQLLEN *)(bindInd + i * sizeof(double) * nFeatures);
+                    for (size_t j = 0; j < nFeatures; j++)
+                    {
+                        if (rowInd[j] == SQL_NULL_DATA) { rows[i * nFeatures + j] = 0.0; }
+                    }
+                }
             }
+            nt->releaseBlockOfRows(block);
+            if (!SQL_SUCCEEDED(ret)) { break; }
         }
-        read++;
+
+        read += nFetched;
+        if (nFetched < nRows) { break; }
     }
+    SQLFreeStmt(hdlStmt, SQL_UNBIND);
+    SQLSetStmtAttr(hdlStmt, SQL_ATTR_ROWS_FETCHED_PTR, NULL, 0);
+    daal::services::daal_free(bindInd);
+
     nt->setNumberOfRows(read);
-    nt->releaseBlockOfRows(block);
 
     DataSourceIface::DataSourceStatus status = DataSourceIface::readyForLoad;
-    if (ret != SQL_NO_DATA)
+    if (ret == SQL_NO_DATA || (SQL_SUCCEEDED(ret) && read < maxRows))
     {
-        if (!SQL_SUCCEEDED(ret))
-        {
-            status = DataSourceIface::notReady;
-            _errors->add(services::ErrorODBC);
-        }
+        status = DataSourceIface::endOfData;
+    }
+    else if (!SQL_SUCCEEDED(ret))
+    {
+        status = DataSourceIface::notReady;
+        _errors->add(services::ErrorODBC);
     }
-    else
+    return status;
+}
+
+/**
+ *  Checks whether the columns of the result set can be bound to the arrays of a Numeric Table
+ */
+bool MySQLFeatureManager::isDirectlyBindable(NumericTable *nt)
+{
+    if (nt->getDataLayout() != NumericTableIface::soa) { return false; }
+
+    SOANumericTable *soaTable = static_cast<SOANumericTable *>(nt);
+    NumericTableDictionary *dict = nt->getDictionary();
+    size_t nFeatures = nt->getNumberOfColumns();
+    for (size_t j = 0; j < nFeatures; j++)
     {
-        if (read < maxRows)
+        data_feature_utils::IndexNumType indexNumType = (*dict)[j].indexType;
+        if (indexNumType == data_feature_utils::DAAL_OTHER_T || (*dict)[j].typeSize != typeSize(indexNumType) ||
+            soaTable->getArray(j) == NULL)
         {
-            status = DataSourceIface::endOfData;
+            return false;
         }
     }
-    daal::services::daal_free(fetchBuffer);
-    daal::services::daal_free(bindInd);
-    return status;
+    return true;
+}
+
+/**
+ *  Binds the columns of the result set to the rows [rowOffset, rowOffset + nRows) of the arrays of a Numeric Table
+ *  with the structure of arrays layout
+ */
+SQLRETURN MySQLFeatureManager::bindColumns(SQLHSTMT hdlStmt, NumericTable *nt, size_t rowOffset, size_t nRows, SQLLEN *bindInd)
+{
+    SOANumericTable *soaTable = static_cast<SOANumericTable *>(nt);
+    NumericTableDictionary *dict = nt->getDictionary();
+    size_t nFeatures = nt->getNumberOfColumns();
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        const NumericTableFeature &feature = (*dict)[j];
+        char *column = (char *)soaTable->getArray(j) + rowOffset * feature.typeSize;
+        SQLRETURN ret = SQLBindCol(hdlStmt, (SQLUSMALLINT)(j + 1), getTargetType(feature.indexType), (SQLPOINTER)column,
+                                   (SQLLEN)feature.typeSize, &bindInd[j * nRows]);
+        if (!SQL_SUCCEEDED(ret)) { return ret; }
+    }
+    return SQL_SUCCESS;
+}
+
+/**
+ *  Binds the columns of the result set to a block of rows of doubles with the row-wise binding
+ */
+SQLRETURN MySQLFeatureManager::bindRows(SQLHSTMT hdlStmt, size_t nFeatures, double *rows, char *bindInd)
+{
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        SQLRETURN ret = SQLBindCol(hdlStmt, (SQLUSMALLINT)(j + 1), SQL_C_DOUBLE, (SQLPOINTER)&rows[j], (SQLLEN)sizeof(double),
+                                   (SQLLEN *)bindInd + j);
+        if (!SQL_SUCCEEDED(ret)) { return ret; }
+    }
+    return SQL_SUCCESS;
 }
 
 size_t MySQLFeatureManager::getStrictureSize(NumericTableDictionary *dict)
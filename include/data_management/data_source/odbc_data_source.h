@@ -51,14 +51,28 @@ namespace interface1
  * \brief Connects to data sources with the ODBC API.
  *
  * \tparam _featureManager       Type of a data source, supports only \ref MySQLFeatureManager
+ * \tparam summaryStatisticsType Type of the basic statistics computed for the loaded data
+ * \tparam _numericTableType     Type of the Numeric Table allocated by the Data Source. Columns of the result set are fetched
+ *                              directly into the arrays of SOANumericTable
  */
 
-template<typename _featureManager, typename summaryStatisticsType = double>
-class ODBCDataSource : public DataSourceTemplate<data_management::HomogenNumericTable<double>, summaryStatisticsType>
+template<typename _featureManager, typename summaryStatisticsType = double,
+         typename _numericTableType = data_management::HomogenNumericTable<double> >
+class ODBCDataSource : public DataSourceTemplate<_numericTableType, summaryStatisticsType>
 {
 public:
     typedef _featureManager FeatureManager;
 
+    /**
+     * <a name="DAAL-ENUM-ODBCDATASOURCE__QUERYMODE"></a>
+     * Modes of execution of the query by the loadDataBlock(maxRows) methods
+     */
+    enum QueryMode
+    {
+        limitQueryForEachBlock = 0, /*!< The query limited to maxRows rows is executed for each block */
+        streamingCursor        = 1  /*!< The query is executed once, the blocks are fetched from the open cursor */
+    };
+
     using DataSourceIface::NumericTableAllocationFlag;
     using DataSourceIface::DictionaryCreationFlag;
     using DataSourceIface::DataSourceStatus;
@@ -70,7 +84,7 @@ public:
     using DataSource::_initialMaxRows;
 
 protected:
-    typedef data_management::HomogenNumericTable<double> DefaultNumericTableType;
+    typedef _numericTableType DefaultNumericTableType;
 
     FeatureManager featureManager;
 
@@ -88,16 +102,17 @@ public:
      *                                                     is created from the context of the ODBC Data Source
      * \param[in]  initialMaxRows                          Initial value of maximum number of rows in Numeric Table allocated in
      *                                                     loadDataBlock() method
+     * \param[in]  queryMode                               (optional) Mode of execution of the query by loadDataBlock(maxRows) methods
      *
      */
     ODBCDataSource(const std::string &dbname, const std::string &tablename, const std::string &username = "",
                    const std::string &password = "",
                    DataSourceIface::NumericTableAllocationFlag doAllocateNumericTable    = DataSource::notAllocateNumericTable,
                    DataSourceIface::DictionaryCreationFlag doCreateDictionaryFromContext = DataSource::notDictionaryFromContext,
-                   size_t initialMaxRows = 10) :
+                   size_t initialMaxRows = 10, QueryMode queryMode = limitQueryForEachBlock) :
         DataSourceTemplate<DefaultNumericTableType, summaryStatisticsType>(doAllocateNumericTable, doCreateDictionaryFromContext),
         _dbname(dbname), _username(username), _password(password), _tablename(tablename),
-        _idx_last_read(0), _hdlDbc(SQL_NULL_HDBC), _hdlEnv(SQL_NULL_HENV)
+        _idx_last_read(0), _queryMode(queryMode), _hdlDbc(SQL_NULL_HDBC), _hdlEnv(SQL_NULL_HENV), _hdlCursorStmt(SQL_NULL_HSTMT)
     {
         _query = "SELECT * FROM " + _tablename;
         _connectionStatus = DataSource::notReady;
@@ -162,48 +177,61 @@ public:
             }
         }
 
-        std::string query_exec = featureManager.setLimitQuery(_query, _idx_last_read, maxRows);
         SQLRETURN ret;
         ret = _establishHandles();
         if (!SQL_SUCCEEDED(ret)) { this->_errors->add(services::ErrorHandlesSQL); return 0; }
 
-        SQLHSTMT hdlStmt = SQL_NULL_HSTMT;
-        ret = SQLAllocHandle(SQL_HANDLE_STMT, _hdlDbc, &hdlStmt);
-        if (!SQL_SUCCEEDED(ret)) { this->_errors->add(services::ErrorSQLstmtHandle); return 0; }
+        DataSourceIface::DataSourceStatus dataSourceStatus;
 
-        ret = SQLExecDirect(hdlStmt, (SQLCHAR *)query_exec.c_str(), SQL_NTS);
-        if (!SQL_SUCCEEDED(ret)) { this->_errors->add(services::ErrorODBC); return 0; }
+        if (_queryMode == streamingCursor)
+        {
+            /* The query is executed on the first call, next blocks are fetched from the same result set */
+            if (_hdlCursorStmt == SQL_NULL_HSTMT)
+            {
+                ret = _executeCursorQuery();
+                if (!SQL_SUCCEEDED(ret)) { this->_errors->add(services::ErrorODBC); return 0; }
+            }
 
-        DataSourceIface::DataSourceStatus dataSourceStatus;
+            dataSourceStatus = featureManager.statementResultsNumericTable(_hdlCursorStmt, nt, maxRows);
 
-        dataSourceStatus = featureManager.statementResultsNumericTable(hdlStmt, nt, maxRows);
+            if (dataSourceStatus != DataSource::readyForLoad)
+            {
+                ret = _freeCursorStatement();
+                if (!SQL_SUCCEEDED(ret)) { this->_errors->add(services::ErrorSQLstmtHandle); }
+            }
+        }
+        else
+        {
+            std::string query_exec = featureManager.setLimitQuery(_query, _idx_last_read, maxRows);
+
+            SQLHSTMT hdlStmt = SQL_NULL_HSTMT;
+            ret = SQLAllocHandle(SQL_HANDLE_STMT, _hdlDbc, &hdlStmt);
+            if (!SQL_SUCCEEDED(ret)) { this->_errors->add(services::ErrorSQLstmtHandle); return 0; }
+
+            ret = SQLExecDirect(hdlStmt, (SQLCHAR *)query_exec.c_str(), SQL_NTS);
+            if (!SQL_SUCCEEDED(ret)) { SQLFreeHandle(SQL_HANDLE_STMT, hdlStmt); this->_errors->add(services::ErrorODBC); return 0; }
+
+            dataSourceStatus = featureManager.statementResultsNumericTable(hdlStmt, nt, maxRows);
+
+            ret = SQLFreeHandle(SQL_HANDLE_STMT, hdlStmt);
+            if (!SQL_SUCCEEDED(ret)) { this->_errors->add(services::ErrorSQLstmtHandle); return 0; }
+        }
 
         size_t nRead = nt->getNumberOfRows();
         _idx_last_read += nRead;
 
-        if(nt->basicStatistics.get(NumericTableIface::minimum   ).get() != NULL &&
+        if(nRead > 0 &&
+           nt->basicStatistics.get(NumericTableIface::minimum   ).get() != NULL &&
            nt->basicStatistics.get(NumericTableIface::maximum   ).get() != NULL &&
            nt->basicStatistics.get(NumericTableIface::sum       ).get() != NULL &&
            nt->basicStatistics.get(NumericTableIface::sumSquares).get() != NULL)
         {
-            for(size_t i = 0; i < nRead; i++)
-            {
-                DataSourceTemplate<DefaultNumericTableType, summaryStatisticsType>::updateStatistics( i, nt );
-            }
+            DataSourceTemplate<DefaultNumericTableType, summaryStatisticsType>::updateStatistics( 0, nRead, nt );
         }
 
-        ret = SQLFreeHandle(SQL_HANDLE_STMT, hdlStmt);
-        if (!SQL_SUCCEEDED(ret)) { this->_errors->add(services::ErrorSQLstmtHandle); return 0; }
-
         if (dataSourceStatus == DataSource::endOfData) { _connectionStatus = DataSource::endOfData; }
 
-        NumericTableDictionary *ntDict = nt->getDictionary();
-        size_t nFeatures = _dict->getNumberOfFeatures();
-        ntDict->setNumberOfFeatures(nFeatures);
-        for (size_t i = 0; i < nFeatures; i++)
-        {
-            ntDict->setFeature((*_dict)[i].ntFeature, i);
-        }
+        DataSource::setNumericTableDictionary( nt );
 
         return nRead;
     }
@@ -226,61 +254,22 @@ public:
 
         if( nt == NULL ) { this->_errors->add(services::ErrorNullInputNumericTable); return 0; }
 
-        size_t maxRows = (_initialMaxRows > 0 ? _initialMaxRows : 10);
-        size_t nrows = 0;
-        size_t ncols = _dict->getNumberOfFeatures();
+        /* The number of rows is counted first so that the Numeric Table is allocated only once
+           and the rows are fetched with a single query */
+        size_t nRows = getNumberOfAvailableRows();
+        nRows = (nRows > _idx_last_read ? nRows - _idx_last_read : 0);
 
-        DataCollection tables;
-
-        for( ; ; )
-        {
-            NumericTable *ntCurrent = new HomogenNumericTable<double>(ncols, maxRows, NumericTableIface::doAllocate);
-            if (ntCurrent == NULL)
-            {
-                this->_errors->add(services::ErrorNumericTableNotAllocated);
-                break;
-            }
-            tables.push_back(services::SharedPtr<NumericTable>(ntCurrent));
-            size_t rows = loadDataBlock(maxRows, ntCurrent);
-            nrows += rows;
-            if (rows < maxRows) { break; }
-            maxRows *= 2;
-        }
-
-        DataSourceTemplate<DefaultNumericTableType, summaryStatisticsType>::resizeNumericTableImpl( nrows, nt );
         nt->setNormalizationFlag(NumericTable::nonNormalized);
 
-        BlockDescriptor<double> blockCurrent, block;
-
-        size_t pos = 0;
-
-        for (size_t i = 0; i < tables.size(); i++) {
-            NumericTable *ntCurrent = (NumericTable*)(tables[i].get());
-            size_t rows = ntCurrent->getNumberOfRows();
-
-            if (rows == 0) { continue; }
-
-            ntCurrent->getBlockOfRows(0, rows, readOnly, blockCurrent);
-            nt->getBlockOfRows(pos, rows, writeOnly, block);
-
-            services::daal_memcpy_s(block.getBlockPtr(), rows * ncols * sizeof(double), blockCurrent.getBlockPtr(), rows * ncols * sizeof(double));
-
-            ntCurrent->releaseBlockOfRows(blockCurrent);
-            nt->releaseBlockOfRows(block);
-
-            DataSourceTemplate<DefaultNumericTableType, summaryStatisticsType>::combineStatistics( ntCurrent, nt, pos == 0);
-            pos += rows;
-        }
-
-        NumericTableDictionary *ntDict = nt->getDictionary();
-        size_t nFeatures = _dict->getNumberOfFeatures();
-        ntDict->setNumberOfFeatures(nFeatures);
-        for (size_t i = 0; i < nFeatures; i++)
+        if (nRows == 0)
         {
-            ntDict->setFeature((*_dict)[i].ntFeature, i);
+            nt->setNumberOfRows(0);
+            DataSource::setNumericTableDictionary( nt );
+            _connectionStatus = DataSource::endOfData;
+            return 0;
         }
 
-        return nrows;
+        return loadDataBlock(nRows, nt);
     }
 
     void createDictionaryFromContext() DAAL_C11_OVERRIDE
@@ -358,10 +347,39 @@ private:
     std::string      _tablename;
     std::string      _query;
     size_t           _idx_last_read;
+    QueryMode        _queryMode;
     DataSourceIface::DataSourceStatus _connectionStatus;
 
     SQLHENV _hdlEnv;
     SQLHDBC _hdlDbc;
+    SQLHSTMT _hdlCursorStmt;
+
+    SQLRETURN _executeCursorQuery()
+    {
+        SQLRETURN ret = SQLAllocHandle(SQL_HANDLE_STMT, _hdlDbc, &_hdlCursorStmt);
+        if (!SQL_SUCCEEDED(ret)) { _hdlCursorStmt = SQL_NULL_HSTMT; return ret; }
+
+        /* Forward-only read-only cursor lets the driver stream the result set instead of buffering it */
+        SQLSetStmtAttr(_hdlCursorStmt, SQL_ATTR_CURSOR_TYPE, (SQLPOINTER)SQL_CURSOR_FORWARD_ONLY, 0);
+        SQLSetStmtAttr(_hdlCursorStmt, SQL_ATTR_CONCURRENCY, (SQLPOINTER)SQL_CONCUR_READ_ONLY, 0);
+
+        /* Rows loaded before the cursor is opened are skipped */
+        std::string query_exec = (_idx_last_read > 0 ? featureManager.setLimitQuery(_query, _idx_last_read, (size_t)(-1)) :
+                                  _query + ";");
+
+        ret = SQLExecDirect(_hdlCursorStmt, (SQLCHAR *)query_exec.c_str(), SQL_NTS);
+        if (!SQL_SUCCEEDED(ret)) { _freeCursorStatement(); }
+        return ret;
+    }
+
+    SQLRETURN _freeCursorStatement()
+    {
+        if (_hdlCursorStmt == SQL_NULL_HSTMT) { return SQL_SUCCESS; }
+
+        SQLRETURN ret = SQLFreeHandle(SQL_HANDLE_STMT, _hdlCursorStmt);
+        _hdlCursorStmt = SQL_NULL_HSTMT;
+        return ret;
+    }
 
     SQLRETURN _establishHandles()
     {
@@ -413,6 +431,9 @@ private:
 
         SQLRETURN ret;
 
+        ret = _freeCursorStatement();
+        if (!SQL_SUCCEEDED(ret)) { return ret; }
+
         ret = SQLDisconnect(_hdlDbc);
         if (!SQL_SUCCEEDED(ret)) { return ret; }
 
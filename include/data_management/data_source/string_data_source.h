@@ -42,9 +42,14 @@ namespace interface1
  *  <a name="DAAL-CLASS-STRINGDATASOURCE"></a>
  *  \brief Specifies methods to access data stored in byte arrays in the C-string format
  *  \tparam _featureManager     FeatureManager used to get numeric data from file strings
+ *  \tparam _summaryStatisticsType  Type of the basic statistics computed for the loaded data
+ *  \tparam _numericTableType       Type of the Numeric Table allocated by the Data Source: HomogenNumericTable<double>,
+ *                                  HomogenNumericTable<float>, HomogenNumericTable<int>, or SOANumericTable
+ *                                  with the columns of the types specified in the data dictionary
  */
-template< typename _featureManager, typename _summaryStatisticsType = double >
-class StringDataSource : public DataSourceTemplate<data_management::HomogenNumericTable<double>, _summaryStatisticsType>
+template< typename _featureManager, typename _summaryStatisticsType = double,
+          typename _numericTableType = data_management::HomogenNumericTable<double> >
+class StringDataSource : public DataSourceTemplate<_numericTableType, _summaryStatisticsType>
 {
 public:
     using DataSourceIface::NumericTableAllocationFlag;
@@ -63,7 +68,7 @@ public:
     typedef _featureManager FeatureManager;
 
 protected:
-    typedef data_management::HomogenNumericTable<double> DefaultNumericTableType;
+    typedef _numericTableType DefaultNumericTableType;
 
     FeatureManager featureManager;
 
@@ -177,13 +182,7 @@ public:
 
         nt->setNumberOfRows( j );
 
-        NumericTableDictionary *ntDict = nt->getDictionary();
-        size_t nFeatures = _dict->getNumberOfFeatures();
-        ntDict->setNumberOfFeatures(nFeatures);
-        for (size_t i = 0; i < nFeatures; i++)
-        {
-            ntDict->setFeature((*_dict)[i].ntFeature, i);
-        }
+        DataSource::setNumericTableDictionary( nt );
 
         return j;
     }
@@ -222,13 +221,7 @@ public:
             DataSourceTemplate<DefaultNumericTableType, _summaryStatisticsType>::updateStatistics( rowOffset + j, nt );
         }
 
-        NumericTableDictionary *ntDict = nt->getDictionary();
-        size_t nFeatures = _dict->getNumberOfFeatures();
-        ntDict->setNumberOfFeatures(nFeatures);
-        for (size_t i = 0; i < nFeatures; i++)
-        {
-            ntDict->setFeature((*_dict)[i].ntFeature, i);
-        }
+        DataSource::setNumericTableDictionary( nt );
 
         return fullRows;
     }
@@ -297,13 +290,7 @@ public:
             pos += rows;
         }
 
-        NumericTableDictionary *ntDict = nt->getDictionary();
-        size_t nFeatures = _dict->getNumberOfFeatures();
-        ntDict->setNumberOfFeatures(nFeatures);
-        for (size_t i = 0; i < nFeatures; i++)
-        {
-            ntDict->setFeature((*_dict)[i].ntFeature, i);
-        }
+        DataSource::setNumericTableDictionary( nt );
 
         return nrows;
     }
@@ -112,6 +112,8 @@ const int SERIALIZATION_JAVANIO_NT_ID                                          =
 const int SERIALIZATION_PACKEDSYMMETRIC_NT_ID                                  = 11000;
 const int SERIALIZATION_PACKEDTRIANGULAR_NT_ID                                 = 12000;
 const int SERIALIZATION_MERGE_NT_ID                                            = 13000;
+const int SERIALIZATION_COMPRESSED_NT_ID                                       = 14000;
+const int SERIALIZATION_ROWMERGE_NT_ID                                         = 15000;
 
 const int SERIALIZATION_HOMOGEN_TENSOR_ID                                      = 20000;
 const int SERIALIZATION_JAVANIO_TENSOR_ID                                      = 21000;
@@ -127,6 +129,7 @@ const int SERIALIZATION_LINEAR_REGRESSION_GROUP_OF_BETAS_RESULT_ID             =
 const int SERIALIZATION_PCA_RESULT_ID                                          = 100200;
 const int SERIALIZATION_PCA_PARTIAL_RESULT_CORRELATION_ID                      = 100210;
 const int SERIALIZATION_PCA_PARTIAL_RESULT_SVD_ID                              = 100220;
+const int SERIALIZATION_PCA_PARTIAL_RESULT_RANDOMIZED_ID                       = 100230;
 
 const int SERIALIZATION_STUMP_MODEL_ID                                         = 100300;
 const int SERIALIZATION_STUMP_TRAINING_RESULT_ID                               = 100310;
@@ -155,6 +158,7 @@ const int SERIALIZATION_COVARIANCE_RESULT_ID                                   =
 
 const int SERIALIZATION_KMEANS_PARTIAL_RESULT_ID                               = 101100;
 const int SERIALIZATION_KMEANS_RESULT_ID                                       = 101110;
+const int SERIALIZATION_KMEANS_ONLINE_PARTIAL_RESULT_ID                        = 101120;
 const int SERIALIZATION_KMEANS_INIT_PARTIAL_RESULT_ID                          = 101200;
 const int SERIALIZATION_KMEANS_INIT_RESULT_ID                                  = 101300;
 
@@ -202,6 +206,7 @@ const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_ID                       =
 const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_STEP3_ID                 = 102430;
 
 const int SERIALIZATION_QUANTILES_RESULT_ID                                    = 102500;
+const int SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID                            = 102510;
 
 const int SERIALIZATION_WEAK_LEARNER_RESULT_ID                                 = 102600;
 
@@ -210,9 +215,18 @@ const int SERIALIZATION_SVD_ONLINE_PARTIAL_RESULT_ID                           =
 const int SERIALIZATION_SVD_DISTRIBUTED_PARTIAL_RESULT_ID                      = 102720;
 const int SERIALIZATION_SVD_DISTRIBUTED_PARTIAL_RESULT_STEP3_ID                = 102730;
 
+const int SERIALIZATION_GBT_CLASSIFICATION_MODEL_ID                            = 102800;
+const int SERIALIZATION_GBT_CLASSIFICATION_TRAINING_RESULT_ID                  = 102810;
+const int SERIALIZATION_GBT_REGRESSION_MODEL_ID                                = 102900;
+const int SERIALIZATION_GBT_REGRESSION_TRAINING_RESULT_ID                      = 102910;
+const int SERIALIZATION_GBT_REGRESSION_PREDICTION_RESULT_ID                    = 102920;
+const int SERIALIZATION_GBT_TRAINING_PARTIAL_RESULT_ID                         = 102930;
+const int SERIALIZATION_GBT_TRAINING_DISTRIBUTED_PARTIAL_RESULT_ID             = 102940;
+
 const int SERIALIZATION_RELU_RESULT_ID                                         = 103000;
 
 const int SERIALIZATION_SORTING_RESULT_ID                                      = 103100;
+const int SERIALIZATION_SORTING_PARTIAL_RESULT_ID                              = 103110;
 
 const int SERIALIZATION_SOFTMAX_RESULT_ID                                      = 103200;
 const int SERIALIZATION_LOGISTIC_RESULT_ID                                     = 103300;
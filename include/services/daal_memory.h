@@ -43,6 +43,102 @@ namespace services
  */
 DAAL_EXPORT void *daal_malloc(size_t size, size_t alignment = DAAL_MALLOC_DEFAULT_ALIGNMENT);
 
+/**
+ * <a name="DAAL-ENUM-SERVICES__MEMORYPAGESIZE"></a>
+ * \brief Size of the pages that back large blocks of memory
+ */
+enum MemoryPageSize
+{
+    defaultPageSize = 0,    /*!< Pages of the size chosen by the operating system */
+    hugePageSize    = 1     /*!< Transparent huge pages. Blocks of at least the huge page size are aligned to its boundary */
+};
+
+/**
+ * <a name="DAAL-ENUM-SERVICES__MEMORYPLACEMENT"></a>
+ * \brief Placement of the pages of large blocks of memory on NUMA nodes
+ */
+enum MemoryPlacement
+{
+    defaultPlacement            = 0,    /*!< A page is placed on the node of the thread that first touches it */
+    interleavedPlacement        = 1,    /*!< Pages are interleaved across all nodes available to the process */
+    parallelFirstTouchPlacement = 2     /*!< Pages of the data of numeric tables are touched on allocation by all threads
+                                         *   of the library, so that they are distributed across the nodes the threads
+                                         *   run on. Pages of other blocks are placed by the first touch */
+};
+
+/**
+ * <a name="DAAL-STRUCT-SERVICES__ALLOCATIONPOLICY"></a>
+ * \brief Policy of page size and page placement for large blocks of memory allocated by daal_malloc.
+ *        Blocks the policy applies to are mapped separately from the heap and are unmapped by daal_free.
+ *        The policy is supported on Linux* and is ignored on other operating systems
+ */
+struct AllocationPolicy
+{
+    /**
+     * Constructs the allocation policy
+     * \param[in] size         Size of the pages, \ref MemoryPageSize
+     * \param[in] place        Placement of the pages, \ref MemoryPlacement
+     * \param[in] minSize      Minimal size of a block of memory in bytes the policy is applied to
+     */
+    explicit AllocationPolicy(MemoryPageSize size = defaultPageSize, MemoryPlacement place = defaultPlacement,
+                              size_t minSize = 4 * 1024 * 1024) :
+        pageSize(size), placement(place), minBlockSize(minSize) {}
+
+    MemoryPageSize pageSize;    /*!< Size of the pages */
+    MemoryPlacement placement;  /*!< Placement of the pages */
+    size_t minBlockSize;        /*!< Smaller blocks are allocated without the policy */
+};
+
+/**
+ * Sets the allocation policy used by daal_malloc. The policy must not be changed while the library computes
+ * \param[in] policy    Allocation policy
+ */
+DAAL_EXPORT void setDefaultAllocationPolicy(const AllocationPolicy &policy);
+
+/**
+ * Returns the allocation policy used by daal_malloc
+ * \return Allocation policy
+ */
+DAAL_EXPORT AllocationPolicy getDefaultAllocationPolicy();
+
+/**
+ * Allocates an aligned block of memory with the given allocation policy
+ * \param[in] size      Size of the block of memory in bytes
+ * \param[in] alignment Alignment constraint. Must be a power of two
+ * \param[in] policy    Allocation policy
+ * \return Pointer to the beginning of a newly allocated block of memory
+ */
+DAAL_EXPORT void *daal_malloc(size_t size, size_t alignment, const AllocationPolicy &policy);
+
+/**
+ * Touches every page of a newly allocated block of memory by the threads of the library,
+ * so that the pages are placed on the NUMA nodes the threads run on. The contents of the block are not changed
+ * \param[in] ptr   Pointer to the beginning of a block of memory
+ * \param[in] size  Size of the block of memory in bytes
+ */
+DAAL_EXPORT void daal_touch_pages(void *ptr, size_t size);
+
+namespace internal
+{
+/**
+ * Allocates the data of a numeric table with the allocation policy of the table or, if the table has no policy,
+ * with the default policy. The pages are touched by the threads of the library if the policy requires
+ * \param[in] size      Size of the block of memory in bytes
+ * \param[in] policy    Allocation policy of the table, NULL if the table has no policy
+ * \return Pointer to the beginning of a newly allocated block of memory
+ */
+inline void *allocateTableData(size_t size, const AllocationPolicy *policy)
+{
+    const AllocationPolicy tablePolicy = (policy ? *policy : getDefaultAllocationPolicy());
+    void *ptr = daal_malloc(size, DAAL_MALLOC_DEFAULT_ALIGNMENT, tablePolicy);
+    if(ptr && tablePolicy.placement == parallelFirstTouchPlacement && size >= tablePolicy.minBlockSize)
+    {
+        daal_touch_pages(ptr, size);
+    }
+    return ptr;
+}
+} // namespace internal
+
 /**
  * Deallocates the space previously allocated by daal_malloc
  * \param[in] ptr   Pointer to the beginning of a block of memory to deallocate
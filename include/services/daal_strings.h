@@ -31,6 +31,9 @@
 #define DAAL_STRINGS_LIST()\
     DECLARE_DAAL_STRINGS(strBasicStatisticsSum,      "basicStatisticsSum"     ) \
     DECLARE_DAAL_STRINGS(strSortedData,              "sortedData"             ) \
+    DECLARE_DAAL_STRINGS(strSortedIndices,           "sortedIndices"          ) \
+    DECLARE_DAAL_STRINGS(strSortedRuns,              "sortedRuns"             ) \
+    DECLARE_DAAL_STRINGS(strSortedRunIndices,        "sortedRunIndices"       ) \
     DECLARE_DAAL_STRINGS(strNormalizedData,          "normalizedData"         ) \
     DECLARE_DAAL_STRINGS(strInputGradient,           "inputGradient"          ) \
     DECLARE_DAAL_STRINGS(strGradient,                "gradient"               ) \
@@ -50,7 +53,7 @@
     DECLARE_DAAL_STRINGS(strAuxProbabilities,        "auxProbabilities"       ) \
     DECLARE_DAAL_STRINGS(strAuxGroundTruth,          "auxGroundTruth"         ) \
     DECLARE_DAAL_STRINGS(strInputLayerData,          "inputLayerData"         ) \
-    DECLARE_DAAL_STRINGS(strAuxMask,                 "auxMask"                ) \
+    DECLARE_DAAL_STRINGS(strAuxSelectedIndices,      "auxSelectedIndices"     ) \
     DECLARE_DAAL_STRINGS(strInputGradientCollection, "inputGradientCollection") \
     DECLARE_DAAL_STRINGS(strValueCollection,         "valueCollection"        ) \
     DECLARE_DAAL_STRINGS(strWeightDerivatives,       "weightDerivatives"      ) \
@@ -59,6 +62,7 @@
     DECLARE_DAAL_STRINGS(strCosineDistance,          "cosineDistance"         ) \
     DECLARE_DAAL_STRINGS(strQuantiles,               "quantiles"              ) \
     DECLARE_DAAL_STRINGS(strQuantileOrders,          "quantileOrders"         ) \
+    DECLARE_DAAL_STRINGS(strSketches,                "sketches"               ) \
     DECLARE_DAAL_STRINGS(strCovariance,              "covariance"             ) \
     DECLARE_DAAL_STRINGS(strCorrelation,             "correlation"            ) \
     DECLARE_DAAL_STRINGS(strMean,                    "mean"                   ) \
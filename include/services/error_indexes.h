@@ -215,6 +215,9 @@ enum ErrorID
                                                                          *   in cross-product numeric table is not equal */
     ErrorInputCorrelationNotSupportedInOnlineAndDistributed = -7804,    /*!< Input correlation matrix is not supported in online and distributed
                                                                              computation modes */
+    ErrorPCAIncorrectNumberOfComponents = -7805,                        /*!< Number of principal components exceeds the number of features
+                                                                         *   or the number of random test vectors */
+    ErrorPCAFailedToDecomposeSketch = -7806,                            /*!< Failed to decompose the sketch of the correlation matrix */
 
     // QR errors: -8000..-8199
 
@@ -263,6 +266,8 @@ enum ErrorID
                                                                          *   compressed block header size */
     ErrorRleDataFormatNotFullBlock = -9022,                             /*!< Input compressed stream contains not a whole
                                                                          *   number of compressed blocks */
+    ErrorCompressionFrameFormat = -9023,                                /*!< Input compressed stream is not a sequence of
+                                                                         *   compressed frames or is corrupted */
 
     // Quantile error: -10000..-11000
     ErrorQuantileOrderValueIsInvalid = -10001,                          /*!< Quantile order value is invalid */
@@ -297,6 +302,9 @@ enum ErrorID
     ErrorODBC = -90043,                                                 /*!< ErrorODBC */
     ErrorSQLstmtHandle = -90044,                                        /*!< ErrorSQLstmtHandle */
     ErrorOnFileOpen = -90045,                                           /*!< Error on file open */
+    ErrorOnFileMapping = -90046,                                        /*!< Error on mapping of file into memory */
+    ErrorOnFileWrite = -90047,                                          /*!< Error on file write */
+    ErrorIncorrectDataFileFormat = -90048,                              /*!< Data file is in wrong format or corrupted */
 
     // Other errors: -100000..
     ErrorObjectDoesNotSupportSerialization = -100000,                   /*!< SerializationIface is not implemented or implemented incorrectly */
@@ -83,7 +83,8 @@ public class InitBatch extends AnalysisBatch {
 
         if (this.method != InitMethod.defaultDense     && this.method != InitMethod.randomDense &&
             this.method != InitMethod.deterministicCSR && this.method != InitMethod.randomCSR
-            && this.method != InitMethod.deterministicDense) {
+            && this.method != InitMethod.deterministicDense && this.method != InitMethod.plusPlusDense
+            && this.method != InitMethod.plusPlusCSR && this.method != InitMethod.parallelPlusDense) {
             throw new IllegalArgumentException("method unsupported");
         }
 
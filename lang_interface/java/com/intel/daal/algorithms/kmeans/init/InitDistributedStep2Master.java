@@ -90,7 +90,8 @@ public class InitDistributedStep2Master extends AnalysisDistributed {
 
         if (this.method != InitMethod.defaultDense       &&
             this.method != InitMethod.deterministicDense && this.method != InitMethod.randomDense &&
-            this.method != InitMethod.deterministicCSR   && this.method != InitMethod.randomCSR  ) {
+            this.method != InitMethod.deterministicCSR   && this.method != InitMethod.randomCSR  &&
+            this.method != InitMethod.parallelPlusDense) {
             throw new IllegalArgumentException("method unsupported");
         }
 
@@ -45,6 +45,9 @@ public final class InitMethod {
     private static final int RandomDenseValue        = 1;
     private static final int DeterministicCSRValue   = 2;
     private static final int RandomCSRValue          = 3;
+    private static final int PlusPlusDenseValue      = 4;
+    private static final int PlusPlusCSRValue        = 5;
+    private static final int ParallelPlusDenseValue  = 6;
 
     public static final InitMethod defaultDense       = new InitMethod(DeterministicDenseValue); /*!< Default: uses first nClusters points as
                                                                                                       initial clusters */
@@ -55,4 +58,11 @@ public final class InitMethod {
                                                                                                       clusters for data in a CSR numeric table */
     public static final InitMethod randomCSR          = new InitMethod(RandomCSRValue);          /*!< Uses random nClusters points as initial
                                                                                                       clusters for data in a CSR numeric table */
+    public static final InitMethod plusPlusDense      = new InitMethod(PlusPlusDenseValue);      /*!< Chooses initial clusters with the
+                                                                                                      k-means++ algorithm */
+    public static final InitMethod plusPlusCSR        = new InitMethod(PlusPlusCSRValue);        /*!< Chooses initial clusters with the
+                                                                                                      k-means++ algorithm for data in a CSR
+                                                                                                      numeric table */
+    public static final InitMethod parallelPlusDense  = new InitMethod(ParallelPlusDenseValue);  /*!< Chooses initial clusters with the
+                                                                                                      scalable k-means++ (k-means||) algorithm */
 }
@@ -85,6 +85,22 @@ public class InitParameter extends com.intel.daal.algorithms.Parameter {
         return cGetOffset(this.cObject);
     }
 
+    /**
+     * Retrieves the fraction of nClusters sampled as candidates in every round of the parallelPlusDense method
+     * @return Oversampling factor
+     */
+    public double getOversamplingFactor() {
+        return cGetOversamplingFactor(this.cObject);
+    }
+
+    /**
+     * Retrieves the number of candidate sampling rounds of the parallelPlusDense method
+     * @return Number of rounds
+     */
+    public long getNRounds() {
+        return cGetNRounds(this.cObject);
+    }
+
     /**
     * Sets the number of clusters
     * @param nClusters Number of clusters
@@ -109,6 +125,22 @@ public class InitParameter extends com.intel.daal.algorithms.Parameter {
         cSetOffset(this.cObject, offset);
     }
 
+    /**
+     * Sets the fraction of nClusters sampled as candidates in every round of the parallelPlusDense method
+     * @param oversamplingFactor Oversampling factor
+     */
+    public void setOversamplingFactor(double oversamplingFactor) {
+        cSetOversamplingFactor(this.cObject, oversamplingFactor);
+    }
+
+    /**
+     * Sets the number of candidate sampling rounds of the parallelPlusDense method
+     * @param nRounds Number of rounds
+     */
+    public void setNRounds(long nRounds) {
+        cSetNRounds(this.cObject, nRounds);
+    }
+
     private native long init(long nClusters, long maxIterations);
 
     private native long cGetNClusters(long parameterAddress);
@@ -122,4 +154,12 @@ public class InitParameter extends com.intel.daal.algorithms.Parameter {
     private native void cSetNRowsTotal(long parameterAddress, long nClusters);
 
     private native void cSetOffset(long parameterAddress, long offset);
+
+    private native double cGetOversamplingFactor(long parameterAddress);
+
+    private native long cGetNRounds(long parameterAddress);
+
+    private native void cSetOversamplingFactor(long parameterAddress, double oversamplingFactor);
+
+    private native void cSetNRounds(long parameterAddress, long nRounds);
 }
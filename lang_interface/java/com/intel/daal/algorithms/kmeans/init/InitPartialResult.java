@@ -56,7 +56,8 @@ public class InitPartialResult extends com.intel.daal.algorithms.PartialResult {
     public NumericTable get(InitPartialResultId id) {
         int idValue = id.getValue();
         if (idValue != InitPartialResultId.partialClustersNumber.getValue()
-                && idValue != InitPartialResultId.partialClusters.getValue()) {
+                && idValue != InitPartialResultId.partialClusters.getValue()
+                && idValue != InitPartialResultId.partialClustersWeights.getValue()) {
             throw new IllegalArgumentException("id unsupported");
         }
         return new HomogenNumericTable(getContext(), cGetPartialResultTable(getCObject(), idValue));
@@ -70,7 +71,8 @@ public class InitPartialResult extends com.intel.daal.algorithms.PartialResult {
     public void set(InitPartialResultId id, NumericTable value) {
         int idValue = id.getValue();
         if (idValue != InitPartialResultId.partialClustersNumber.getValue()
-                && idValue != InitPartialResultId.partialClusters.getValue()) {
+                && idValue != InitPartialResultId.partialClusters.getValue()
+                && idValue != InitPartialResultId.partialClustersWeights.getValue()) {
             throw new IllegalArgumentException("id unsupported");
         }
         cSetPartialResultTable(getCObject(), idValue, value.getCObject());
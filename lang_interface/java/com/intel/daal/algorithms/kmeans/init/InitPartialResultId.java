@@ -38,9 +38,12 @@ public final class InitPartialResultId {
 
     private static final int PartialClustersNumber = 0;
     private static final int PartialClusters       = 1;
+    private static final int PartialClustersWeights = 2;
 
     /** Number of assigned observations */
     public static final InitPartialResultId partialClustersNumber = new InitPartialResultId(PartialClustersNumber);
     /** Sum of observations */
     public static final InitPartialResultId partialClusters       = new InitPartialResultId(PartialClusters);
+    /** Numbers of observations closest to candidate centroids, used with the parallelPlusDense method only */
+    public static final InitPartialResultId partialClustersWeights = new InitPartialResultId(PartialClustersWeights);
 }
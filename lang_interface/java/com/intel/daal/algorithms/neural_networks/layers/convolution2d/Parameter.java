@@ -147,6 +147,24 @@ public class Parameter extends com.intel.daal.algorithms.neural_networks.layers.
         cSetPadding(cObject, size[0], size[1]);
     }
 
+    /**
+     * Gets the flag that specifies whether the layer is used at the prediction stage or not
+     * @return  Flag that specifies whether the layer is used at the prediction stage or not
+     */
+    public boolean getPredictionStage() {
+        return cGetPredictionStage(cObject);
+    }
+
+    /**
+     *  Sets the flag that specifies whether the layer is used at the prediction stage or not.
+     *  At the prediction stage the weights and biases converted to the internal layout are reused
+     *  until the layer gets other weights or biases
+     *  @param predictionStage    Flag that specifies whether the layer is used at the prediction stage or not
+     */
+    public void setPredictionStage(boolean predictionStage) {
+        cSetPredictionStage(cObject, predictionStage);
+    }
+
     /**
      * Gets the data structure representing the dimension for convolution kernels
      * @return Data structure representing the dimension for convolution kernels
@@ -180,4 +198,6 @@ public class Parameter extends com.intel.daal.algorithms.neural_networks.layers.
     private native long[] cGetStride(long cObject);
     private native long[] cGetPadding(long cObject);
     private native long[] cGetSD(long cObject);
+    private native boolean cGetPredictionStage(long cObject);
+    private native void cSetPredictionStage(long cObject, boolean predictionStage);
 }
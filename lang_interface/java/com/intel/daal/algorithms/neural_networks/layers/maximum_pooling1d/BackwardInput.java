@@ -18,7 +18,9 @@
 package com.intel.daal.algorithms.neural_networks.layers.maximum_pooling1d;
 
 import com.intel.daal.services.DaalContext;
+import com.intel.daal.data_management.data.HomogenNumericTable;
 import com.intel.daal.data_management.data.HomogenTensor;
+import com.intel.daal.data_management.data.NumericTable;
 import com.intel.daal.data_management.data.Tensor;
 
 /**
@@ -41,7 +43,7 @@ public final class BackwardInput extends com.intel.daal.algorithms.neural_networ
      * @param val   Value of the input object
      */
     public void set(LayerDataId id, Tensor val) {
-        if (id == LayerDataId.auxMask) {
+        if (id == LayerDataId.auxSelectedIndices) {
             cSetInput(cObject, id.getValue(), val.getCObject());
         }
         else {
@@ -55,7 +57,7 @@ public final class BackwardInput extends com.intel.daal.algorithms.neural_networ
      * @return   Input object that corresponds to the given identifier
      */
     public Tensor get(LayerDataId id) {
-        if (id == LayerDataId.auxMask) {
+        if (id == LayerDataId.auxSelectedIndices) {
             return new HomogenTensor(getContext(), cGetInput(cObject, id.getValue()));
         }
         else {
@@ -63,6 +65,36 @@ public final class BackwardInput extends com.intel.daal.algorithms.neural_networ
         }
     }
 
+    /**
+     * Sets the input object of the backward one-dimensional maximum pooling layer
+     * @param id    Identifier of the input object
+     * @param val   Value of the input object
+     */
+    public void set(LayerDataNumericTableId id, NumericTable val) {
+        if (id == LayerDataNumericTableId.auxInputDimensions) {
+            cSetInputNumericTable(cObject, id.getValue(), val.getCObject());
+        }
+        else {
+            throw new IllegalArgumentException("Incorrect BackwardInputId");
+        }
+    }
+
+    /**
+     * Returns the input object of the backward one-dimensional maximum pooling layer
+     * @param id Identifier of the input object
+     * @return   Input object that corresponds to the given identifier
+     */
+    public NumericTable get(LayerDataNumericTableId id) {
+        if (id == LayerDataNumericTableId.auxInputDimensions) {
+            return new HomogenNumericTable(getContext(), cGetInputNumericTable(cObject, id.getValue()));
+        }
+        else {
+            throw new IllegalArgumentException("id unsupported");
+        }
+    }
+
     private native void cSetInput(long cObject, int id, long ntAddr);
     private native long cGetInput(long cObject, int id);
+    private native void cSetInputNumericTable(long cObject, int id, long ntAddr);
+    private native long cGetInputNumericTable(long cObject, int id);
 }
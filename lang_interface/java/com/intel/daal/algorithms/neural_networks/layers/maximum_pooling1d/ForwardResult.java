@@ -17,7 +17,9 @@
 
 package com.intel.daal.algorithms.neural_networks.layers.maximum_pooling1d;
 
+import com.intel.daal.data_management.data.HomogenNumericTable;
 import com.intel.daal.data_management.data.HomogenTensor;
+import com.intel.daal.data_management.data.NumericTable;
 import com.intel.daal.data_management.data.Tensor;
 import com.intel.daal.services.DaalContext;
 
@@ -51,7 +53,7 @@ public final class ForwardResult extends com.intel.daal.algorithms.neural_networ
      * @return Result that corresponds to the given identifier
      */
     public Tensor get(LayerDataId id) {
-        if (id == LayerDataId.auxMask) {
+        if (id == LayerDataId.auxSelectedIndices) {
             return new HomogenTensor(getContext(), cGetValue(cObject, id.getValue()));
         }
         else {
@@ -65,7 +67,7 @@ public final class ForwardResult extends com.intel.daal.algorithms.neural_networ
      * @param val  Result that corresponds to the given identifier
      */
     public void set(LayerDataId id, Tensor val) {
-        if (id == LayerDataId.auxMask) {
+        if (id == LayerDataId.auxSelectedIndices) {
             cSetValue(cObject, id.getValue(), val.getCObject());
         }
         else {
@@ -73,7 +75,37 @@ public final class ForwardResult extends com.intel.daal.algorithms.neural_networ
         }
     }
 
+    /**
+     * Returns the result of the forward one-dimensional maximum pooling layer
+     * @param  id   Identifier of the result
+     * @return Result that corresponds to the given identifier
+     */
+    public NumericTable get(LayerDataNumericTableId id) {
+        if (id == LayerDataNumericTableId.auxInputDimensions) {
+            return new HomogenNumericTable(getContext(), cGetNumericTable(cObject, id.getValue()));
+        }
+        else {
+            throw new IllegalArgumentException("id unsupported");
+        }
+    }
+
+    /**
+     * Sets the result of the forward one-dimensional maximum pooling layer
+     * @param id   Identifier of the result
+     * @param val  Result that corresponds to the given identifier
+     */
+    public void set(LayerDataNumericTableId id, NumericTable val) {
+        if (id == LayerDataNumericTableId.auxInputDimensions) {
+            cSetNumericTable(cObject, id.getValue(), val.getCObject());
+        }
+        else {
+            throw new IllegalArgumentException("id unsupported");
+        }
+    }
+
     private native long cNewResult();
     private native long cGetValue(long cObject, int id);
     private native void cSetValue(long cObject, int id, long ntAddr);
+    private native long cGetNumericTable(long cObject, int id);
+    private native void cSetNumericTable(long cObject, int id, long ntAddr);
 }
@@ -46,8 +46,8 @@ public final class LayerDataId {
         return _value;
     }
 
-    private static final int auxMaskId = 0;
+    private static final int auxSelectedIndicesId = 0;
 
-    public static final LayerDataId auxMask = new LayerDataId(
-        auxMaskId);    /*!< p-dimensional tensor that stores forward maximum pooling layer results */
+    public static final LayerDataId auxSelectedIndices = new LayerDataId(
+        auxSelectedIndicesId);    /*!< Tensor that stores indices of maximum elements */
 }
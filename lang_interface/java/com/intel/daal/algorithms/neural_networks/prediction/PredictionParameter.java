@@ -39,5 +39,24 @@ public class PredictionParameter extends com.intel.daal.algorithms.Parameter {
         super(context, cParameter);
     }
 
+    /**
+     *  Gets the flag that specifies whether the tensors passed between the adjacent layers
+     *  that use the same internal data layout are kept in that layout
+     */
+    public boolean getLayoutPropagation() {
+        return cGetLayoutPropagation(cObject);
+    }
+
+    /**
+     *  Sets the flag that specifies whether the tensors passed between the adjacent layers
+     *  that use the same internal data layout are kept in that layout
+     *  @param layoutPropagation Flag. If true, the tensors are converted to the default layout only on access by other layers
+     */
+    public void setLayoutPropagation(boolean layoutPropagation) {
+        cSetLayoutPropagation(cObject, layoutPropagation);
+    }
+
     private native long cInit();
+    private native boolean cGetLayoutPropagation(long cParameter);
+    private native void cSetLayoutPropagation(long cParameter, boolean layoutPropagation);
 }
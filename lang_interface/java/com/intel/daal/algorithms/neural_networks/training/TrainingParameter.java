@@ -71,9 +71,28 @@ public class TrainingParameter extends com.intel.daal.algorithms.Parameter {
        cSetOptimizationSolver(cObject, optimizationSolver.cObject);
     }
 
+    /**
+     *  Gets the flag that specifies whether the tensors passed between the adjacent layers
+     *  that use the same internal data layout are kept in that layout
+     */
+    public boolean getLayoutPropagation() {
+        return cGetLayoutPropagation(cObject);
+    }
+
+    /**
+     *  Sets the flag that specifies whether the tensors passed between the adjacent layers
+     *  that use the same internal data layout are kept in that layout
+     *  @param layoutPropagation Flag. If true, the tensors are converted to the default layout only on access by other layers
+     */
+    public void setLayoutPropagation(boolean layoutPropagation) {
+        cSetLayoutPropagation(cObject, layoutPropagation);
+    }
+
     private native long cInit();
     private native long cGetBatchSize(long cParameter);
     private native void cSetBatchSize(long cParameter, long batchSize);
     private native long cGetOptimizationSolver(long cParameter);
     private native void cSetOptimizationSolver(long cParameter, long optAddr);
+    private native boolean cGetLayoutPropagation(long cParameter);
+    private native void cSetLayoutPropagation(long cParameter, boolean layoutPropagation);
 }
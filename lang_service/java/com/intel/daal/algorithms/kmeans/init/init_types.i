@@ -53,6 +53,24 @@ using namespace daal::services;
                     staticPointerCast<Batch<double, randomCSR>, AlgorithmIface>                                 \
                         (*(SharedPtr<AlgorithmIface> *)addr);                                                   \
                 result = cast(op(alg->call));                                                                   \
+            } else if(method == plusPlusDense)                                                                  \
+            {                                                                                                   \
+                SharedPtr<Batch<double, plusPlusDense> > alg =                                                  \
+                    staticPointerCast<Batch<double, plusPlusDense>, AlgorithmIface>                             \
+                        (*(SharedPtr<AlgorithmIface> *)addr);                                                   \
+                result = cast(op(alg->call));                                                                   \
+            } else if(method == plusPlusCSR)                                                                    \
+            {                                                                                                   \
+                SharedPtr<Batch<double, plusPlusCSR> > alg =                                                    \
+                    staticPointerCast<Batch<double, plusPlusCSR>, AlgorithmIface>                               \
+                        (*(SharedPtr<AlgorithmIface> *)addr);                                                   \
+                result = cast(op(alg->call));                                                                   \
+            } else if(method == parallelPlusDense)                                                              \
+            {                                                                                                   \
+                SharedPtr<Batch<double, parallelPlusDense> > alg =                                              \
+                    staticPointerCast<Batch<double, parallelPlusDense>, AlgorithmIface>                         \
+                        (*(SharedPtr<AlgorithmIface> *)addr);                                                   \
+                result = cast(op(alg->call));                                                                   \
             }                                                                                                   \
         }                                                                                                       \
         else                                                                                                    \
@@ -81,6 +99,24 @@ using namespace daal::services;
                     staticPointerCast<Batch<float, randomCSR>, AlgorithmIface>                                  \
                         (*(SharedPtr<AlgorithmIface> *)addr);                                                   \
                 result = cast(op(alg->call));                                                                   \
+            } else if(method == plusPlusDense)                                                                  \
+            {                                                                                                   \
+                SharedPtr<Batch<float, plusPlusDense> > alg =                                                   \
+                    staticPointerCast<Batch<float, plusPlusDense>, AlgorithmIface>                              \
+                        (*(SharedPtr<AlgorithmIface> *)addr);                                                   \
+                result = cast(op(alg->call));                                                                   \
+            } else if(method == plusPlusCSR)                                                                    \
+            {                                                                                                   \
+                SharedPtr<Batch<float, plusPlusCSR> > alg =                                                     \
+                    staticPointerCast<Batch<float, plusPlusCSR>, AlgorithmIface>                                \
+                        (*(SharedPtr<AlgorithmIface> *)addr);                                                   \
+                result = cast(op(alg->call));                                                                   \
+            } else if(method == parallelPlusDense)                                                              \
+            {                                                                                                   \
+                SharedPtr<Batch<float, parallelPlusDense> > alg =                                               \
+                    staticPointerCast<Batch<float, parallelPlusDense>, AlgorithmIface>                          \
+                        (*(SharedPtr<AlgorithmIface> *)addr);                                                   \
+                result = cast(op(alg->call));                                                                   \
             }                                                                                                   \
         }                                                                                                       \
     }                                                                                                           \
@@ -114,6 +150,12 @@ using namespace daal::services;
                         staticPointerCast<Distributed<step1Local, double, randomCSR>, AlgorithmIface>           \
                             (*(SharedPtr<AlgorithmIface> *)addr);                                               \
                     result = cast(op(alg->call));                                                               \
+                } else if(method == parallelPlusDense)                                                          \
+                {                                                                                               \
+                    SharedPtr<Distributed<step1Local, double, parallelPlusDense> > alg =                        \
+                        staticPointerCast<Distributed<step1Local, double, parallelPlusDense>, AlgorithmIface>   \
+                            (*(SharedPtr<AlgorithmIface> *)addr);                                               \
+                    result = cast(op(alg->call));                                                               \
                 }                                                                                               \
             }                                                                                                   \
             else                                                                                                \
@@ -142,6 +184,12 @@ using namespace daal::services;
                         staticPointerCast<Distributed<step1Local, float, randomCSR>, AlgorithmIface>            \
                             (*(SharedPtr<AlgorithmIface> *)addr);                                               \
                     result = cast(op(alg->call));                                                               \
+                } else if(method == parallelPlusDense)                                                          \
+                {                                                                                               \
+                    SharedPtr<Distributed<step1Local, float, parallelPlusDense> > alg =                         \
+                        staticPointerCast<Distributed<step1Local, float, parallelPlusDense>, AlgorithmIface>    \
+                            (*(SharedPtr<AlgorithmIface> *)addr);                                               \
+                    result = cast(op(alg->call));                                                               \
                 }                                                                                               \
             }                                                                                                   \
         }                                                                                                       \
@@ -173,6 +221,12 @@ using namespace daal::services;
                         staticPointerCast<Distributed<step2Master, double, randomCSR>, AlgorithmIface>          \
                             (*(SharedPtr<AlgorithmIface> *)addr);                                               \
                     result = cast(op(alg->call));                                                               \
+                } else if(method == parallelPlusDense)                                                          \
+                {                                                                                               \
+                    SharedPtr<Distributed<step2Master, double, parallelPlusDense> > alg =                       \
+                        staticPointerCast<Distributed<step2Master, double, parallelPlusDense>, AlgorithmIface>  \
+                            (*(SharedPtr<AlgorithmIface> *)addr);                                               \
+                    result = cast(op(alg->call));                                                               \
                 }                                                                                               \
             }                                                                                                   \
             else                                                                                                \
@@ -201,6 +255,12 @@ using namespace daal::services;
                         staticPointerCast<Distributed<step2Master, float, randomCSR>, AlgorithmIface>           \
                             (*(SharedPtr<AlgorithmIface> *)addr);                                               \
                     result = cast(op(alg->call));                                                               \
+                } else if(method == parallelPlusDense)                                                          \
+                {                                                                                               \
+                    SharedPtr<Distributed<step2Master, float, parallelPlusDense> > alg =                        \
+                        staticPointerCast<Distributed<step2Master, float, parallelPlusDense>, AlgorithmIface>   \
+                            (*(SharedPtr<AlgorithmIface> *)addr);                                               \
+                    result = cast(op(alg->call));                                                               \
                 }                                                                                               \
             }                                                                                                   \
         }                                                                                                       \
@@ -33,7 +33,7 @@ using namespace daal::algorithms::kmeans::init;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitBatch_cInit
 (JNIEnv *, jobject, jint precision, jint method, jlong nClusters)
 {
-    return jniBatch<kmeans::init::Method,Batch,deterministicDense,randomDense,deterministicCSR,randomCSR>::newObj(precision,method,nClusters);
+    return jniBatch<kmeans::init::Method,Batch,deterministicDense,randomDense,deterministicCSR,randomCSR,plusPlusDense,plusPlusCSR,parallelPlusDense>::newObj(precision,method,nClusters);
 }
 
 /*
@@ -44,7 +44,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitBatch_cIn
 JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitBatch_cSetResult
 (JNIEnv *, jobject, jlong algAddr, jint precision, jint method, jlong resultAddr)
 {
-    jniBatch<kmeans::init::Method,Batch,deterministicDense,randomDense,deterministicCSR,randomCSR>::
+    jniBatch<kmeans::init::Method,Batch,deterministicDense,randomDense,deterministicCSR,randomCSR,plusPlusDense,plusPlusCSR,parallelPlusDense>::
         setResult<kmeans::init::Result>(precision,method,algAddr,resultAddr);
 }
 
@@ -56,7 +56,7 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitBatch_cSet
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitBatch_cGetResult
 (JNIEnv *, jobject, jlong algAddr, jint precision, jint method)
 {
-    return jniBatch<kmeans::init::Method,Batch,deterministicDense,randomDense,deterministicCSR,randomCSR>::
+    return jniBatch<kmeans::init::Method,Batch,deterministicDense,randomDense,deterministicCSR,randomCSR,plusPlusDense,plusPlusCSR,parallelPlusDense>::
         getResult(precision,method,algAddr);
 }
 
@@ -68,7 +68,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitBatch_cGe
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitBatch_cInitParameter
 (JNIEnv *, jobject, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kmeans::init::Method,Batch,deterministicDense,randomDense,deterministicCSR,randomCSR>::getParameter(prec,method,algAddr);
+    return jniBatch<kmeans::init::Method,Batch,deterministicDense,randomDense,deterministicCSR,randomCSR,plusPlusDense,plusPlusCSR,parallelPlusDense>::getParameter(prec,method,algAddr);
 }
 
 /*
@@ -79,7 +79,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitBatch_cIn
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitBatch_cGetInput
 (JNIEnv *, jobject, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kmeans::init::Method,Batch,deterministicDense,randomDense,deterministicCSR,randomCSR>::getInput(prec,method,algAddr);
+    return jniBatch<kmeans::init::Method,Batch,deterministicDense,randomDense,deterministicCSR,randomCSR,plusPlusDense,plusPlusCSR,parallelPlusDense>::getInput(prec,method,algAddr);
 }
 
 /*
@@ -90,5 +90,5 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitBatch_cGe
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitBatch_cClone
 (JNIEnv *, jobject, jlong algAddr, jint prec, jint method)
 {
-    return jniBatch<kmeans::init::Method,Batch,deterministicDense,randomDense,deterministicCSR,randomCSR>::getClone(prec,method,algAddr);
+    return jniBatch<kmeans::init::Method,Batch,deterministicDense,randomDense,deterministicCSR,randomCSR,plusPlusDense,plusPlusCSR,parallelPlusDense>::getClone(prec,method,algAddr);
 }
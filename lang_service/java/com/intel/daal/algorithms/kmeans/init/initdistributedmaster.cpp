@@ -34,7 +34,7 @@ using namespace daal::algorithms::kmeans::init;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitDistributedStep2Master_cInit
 (JNIEnv *env, jobject thisObj, jint prec, jint method, jlong nClusters)
 {
-    return jniDistributed<step2Master, kmeans::init::Method, Distributed, deterministicDense, randomDense, deterministicCSR, randomCSR>::
+    return jniDistributed<step2Master, kmeans::init::Method, Distributed, deterministicDense, randomDense, deterministicCSR, randomCSR, parallelPlusDense>::
         newObj(prec, method, nClusters);
 }
 
@@ -46,7 +46,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitDistribut
 JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitDistributedStep2Master_cSetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method, jlong resultAddr)
 {
-    jniDistributed<step2Master, kmeans::init::Method, Distributed, deterministicDense, randomDense, deterministicCSR, randomCSR>::
+    jniDistributed<step2Master, kmeans::init::Method, Distributed, deterministicDense, randomDense, deterministicCSR, randomCSR, parallelPlusDense>::
         setResult<kmeans::init::Result>(prec, method, algAddr, resultAddr);
 }
 
@@ -58,7 +58,7 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitDistribute
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitDistributedStep2Master_cGetResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniDistributed<step2Master, kmeans::init::Method, Distributed, deterministicDense, randomDense, deterministicCSR, randomCSR>::
+    return jniDistributed<step2Master, kmeans::init::Method, Distributed, deterministicDense, randomDense, deterministicCSR, randomCSR, parallelPlusDense>::
         getResult(prec, method, algAddr);
 }
 
@@ -70,7 +70,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitDistribut
 JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitDistributedStep2Master_cSetPartialResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method, jlong partialResultAddr, jboolean initFlag)
 {
-    jniDistributed<step2Master, kmeans::init::Method, Distributed, deterministicDense, randomDense, deterministicCSR, randomCSR>::
+    jniDistributed<step2Master, kmeans::init::Method, Distributed, deterministicDense, randomDense, deterministicCSR, randomCSR, parallelPlusDense>::
         setPartialResult<kmeans::init::PartialResult>(prec, method, algAddr, partialResultAddr);
 }
 
@@ -82,7 +82,7 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitDistribute
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitDistributedStep2Master_cGetPartialResult
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniDistributed<step2Master, kmeans::init::Method, Distributed, deterministicDense, randomDense, deterministicCSR, randomCSR>::
+    return jniDistributed<step2Master, kmeans::init::Method, Distributed, deterministicDense, randomDense, deterministicCSR, randomCSR, parallelPlusDense>::
         getPartialResult(prec, method, algAddr);
 }
 
@@ -94,7 +94,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitDistribut
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitDistributedStep2Master_cInitParameter
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniDistributed<step2Master, kmeans::init::Method, Distributed, deterministicDense, randomDense, deterministicCSR, randomCSR>::
+    return jniDistributed<step2Master, kmeans::init::Method, Distributed, deterministicDense, randomDense, deterministicCSR, randomCSR, parallelPlusDense>::
         getParameter(prec, method, algAddr);
 }
 
@@ -106,7 +106,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitDistribut
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitDistributedStep2Master_cGetInput
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniDistributed<step2Master, kmeans::init::Method, Distributed, deterministicDense, randomDense, deterministicCSR, randomCSR>::
+    return jniDistributed<step2Master, kmeans::init::Method, Distributed, deterministicDense, randomDense, deterministicCSR, randomCSR, parallelPlusDense>::
         getInput(prec, method, algAddr);
 }
 
@@ -118,6 +118,6 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitDistribut
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitDistributedStep2Master_cClone
 (JNIEnv *env, jobject thisObj, jlong algAddr, jint prec, jint method)
 {
-    return jniDistributed<step2Master, kmeans::init::Method, Distributed, deterministicDense, randomDense, deterministicCSR, randomCSR>::
+    return jniDistributed<step2Master, kmeans::init::Method, Distributed, deterministicDense, randomDense, deterministicCSR, randomCSR, parallelPlusDense>::
         getClone(prec, method, algAddr);
 }
@@ -87,3 +87,27 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitParameter_
 {
     ((kmeans::init::Parameter *)parameterAddress)->offset = offset;
 }
+
+JNIEXPORT jdouble JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitParameter_cGetOversamplingFactor
+(JNIEnv *, jobject, jlong parameterAddress)
+{
+    return((kmeans::init::Parameter *)parameterAddress)->oversamplingFactor;
+}
+
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitParameter_cGetNRounds
+(JNIEnv *, jobject, jlong parameterAddress)
+{
+    return((kmeans::init::Parameter *)parameterAddress)->nRounds;
+}
+
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitParameter_cSetOversamplingFactor
+(JNIEnv *, jobject, jlong parameterAddress, jdouble oversamplingFactor)
+{
+    ((kmeans::init::Parameter *)parameterAddress)->oversamplingFactor = oversamplingFactor;
+}
+
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_kmeans_init_InitParameter_cSetNRounds
+(JNIEnv *, jobject, jlong parameterAddress, jlong nRounds)
+{
+    ((kmeans::init::Parameter *)parameterAddress)->nRounds = nRounds;
+}
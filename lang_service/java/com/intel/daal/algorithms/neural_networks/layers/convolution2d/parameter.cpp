@@ -221,3 +221,25 @@ JNIEXPORT jlongArray JNICALL Java_com_intel_daal_algorithms_neural_1networks_lay
 
     return sizeArray;
 }
+
+/*
+ * Class:     com_intel_daal_algorithms_neural_networks_layers_convolution2d_Parameter
+ * Method:    cGetPredictionStage
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Parameter_cGetPredictionStage
+(JNIEnv *env, jobject thisObj, jlong cParameter)
+{
+    return (((convolution2d::Parameter *)cParameter))->predictionStage;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_neural_networks_layers_convolution2d_Parameter
+ * Method:    cSetPredictionStage
+ * Signature: (JZ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_convolution2d_Parameter_cSetPredictionStage
+(JNIEnv *env, jobject thisObj, jlong cParameter, jboolean predictionStage)
+{
+    (((convolution2d::Parameter *)cParameter))->predictionStage = predictionStage;
+}
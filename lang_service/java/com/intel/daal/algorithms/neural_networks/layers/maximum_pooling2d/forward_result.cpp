@@ -18,12 +18,14 @@
 #include <jni.h>
 #include "neural_networks/layers/maximum_pooling2d/JForwardResult.h"
 #include "neural_networks/layers/maximum_pooling2d/JLayerDataId.h"
+#include "neural_networks/layers/maximum_pooling2d/JLayerDataNumericTableId.h"
 
 #include "daal.h"
 
 #include "common_helpers.h"
 
-#define auxMaskId com_intel_daal_algorithms_neural_networks_layers_maximum_pooling2d_LayerDataId_auxMaskId
+#define auxSelectedIndicesId com_intel_daal_algorithms_neural_networks_layers_maximum_pooling2d_LayerDataId_auxSelectedIndicesId
+#define auxInputDimensionsId com_intel_daal_algorithms_neural_networks_layers_maximum_pooling2d_LayerDataNumericTableId_auxInputDimensionsId
 
 USING_COMMON_NAMESPACES();
 using namespace daal::algorithms::neural_networks::layers::maximum_pooling2d;
@@ -47,7 +49,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_m
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_maximum_1pooling2d_ForwardResult_cGetValue
 (JNIEnv *env, jobject thisObj, jlong resAddr, jint id)
 {
-    if (id == auxMaskId)
+    if (id == auxSelectedIndicesId)
     {
         return jniArgument<forward::Result>::get<LayerDataId, Tensor>(resAddr, id);
     }
@@ -63,8 +65,38 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_m
 JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_maximum_1pooling2d_ForwardResult_cSetValue
 (JNIEnv *env, jobject thisObj, jlong resAddr, jint id, jlong ntAddr)
 {
-    if (id == auxMaskId)
+    if (id == auxSelectedIndicesId)
     {
-        jniArgument<forward::Result>::set<LayerDataId, Tensor>(resAddr, auxMask, id);
+        jniArgument<forward::Result>::set<LayerDataId, Tensor>(resAddr, id, ntAddr);
+    }
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_neural_networks_layers_maximum_1pooling2d_ForwardResult
+ * Method:    cGetNumericTable
+ * Signature: (JI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_maximum_1pooling2d_ForwardResult_cGetNumericTable
+(JNIEnv *env, jobject thisObj, jlong resAddr, jint id)
+{
+    if (id == auxInputDimensionsId)
+    {
+        return jniArgument<forward::Result>::get<LayerDataNumericTableId, NumericTable>(resAddr, id);
+    }
+
+    return (jlong)0;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_neural_networks_layers_maximum_1pooling2d_ForwardResult
+ * Method:    cSetNumericTable
+ * Signature: (JIJ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_maximum_1pooling2d_ForwardResult_cSetNumericTable
+(JNIEnv *env, jobject thisObj, jlong resAddr, jint id, jlong ntAddr)
+{
+    if (id == auxInputDimensionsId)
+    {
+        jniArgument<forward::Result>::set<LayerDataNumericTableId, NumericTable>(resAddr, id, ntAddr);
     }
 }
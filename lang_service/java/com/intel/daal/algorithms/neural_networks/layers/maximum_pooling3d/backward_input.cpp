@@ -18,12 +18,14 @@
 #include <jni.h>
 #include "neural_networks/layers/maximum_pooling3d/JBackwardInput.h"
 #include "neural_networks/layers/maximum_pooling3d/JLayerDataId.h"
+#include "neural_networks/layers/maximum_pooling3d/JLayerDataNumericTableId.h"
 
 #include "daal.h"
 
 #include "common_helpers.h"
 
-#define auxMaskId com_intel_daal_algorithms_neural_networks_layers_maximum_pooling3d_LayerDataId_auxMaskId
+#define auxSelectedIndicesId com_intel_daal_algorithms_neural_networks_layers_maximum_pooling3d_LayerDataId_auxSelectedIndicesId
+#define auxInputDimensionsId com_intel_daal_algorithms_neural_networks_layers_maximum_pooling3d_LayerDataNumericTableId_auxInputDimensionsId
 
 USING_COMMON_NAMESPACES();
 using namespace daal::algorithms::neural_networks::layers::maximum_pooling3d;
@@ -36,7 +38,7 @@ using namespace daal::algorithms::neural_networks::layers::maximum_pooling3d;
 JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_maximum_1pooling3d_BackwardInput_cSetInput
 (JNIEnv *env, jobject thisObj, jlong inputAddr, jint id, jlong ntAddr)
 {
-    if (id == auxMaskId)
+    if (id == auxSelectedIndicesId)
     {
         jniInput<backward::Input>::set<LayerDataId, Tensor>(inputAddr, id, ntAddr);
     }
@@ -50,10 +52,40 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_ma
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_maximum_1pooling3d_BackwardInput_cGetInput
 (JNIEnv *env, jobject thisObj, jlong inputAddr, jint id)
 {
-    if (id == auxMaskId)
+    if (id == auxSelectedIndicesId)
     {
         return jniInput<backward::Input>::get<LayerDataId, Tensor>(inputAddr, id);
     }
 
     return (jlong)0;
 }
+
+/*
+ * Class:     com_intel_daal_algorithms_neural_networks_layers_maximum_1pooling3d_BackwardInput
+ * Method:    cSetInputNumericTable
+ * Signature: (JIJ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_maximum_1pooling3d_BackwardInput_cSetInputNumericTable
+(JNIEnv *env, jobject thisObj, jlong inputAddr, jint id, jlong ntAddr)
+{
+    if (id == auxInputDimensionsId)
+    {
+        jniInput<backward::Input>::set<LayerDataNumericTableId, NumericTable>(inputAddr, id, ntAddr);
+    }
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_neural_networks_layers_maximum_1pooling3d_BackwardInput
+ * Method:    cGetInputNumericTable
+ * Signature: (JI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_layers_maximum_1pooling3d_BackwardInput_cGetInputNumericTable
+(JNIEnv *env, jobject thisObj, jlong inputAddr, jint id)
+{
+    if (id == auxInputDimensionsId)
+    {
+        return jniInput<backward::Input>::get<LayerDataNumericTableId, NumericTable>(inputAddr, id);
+    }
+
+    return (jlong)0;
+}
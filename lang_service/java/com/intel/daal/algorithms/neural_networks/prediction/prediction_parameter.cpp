@@ -35,3 +35,25 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_predicti
 {
     return (jlong)(new prediction::Parameter());
 }
+
+/*
+ * Class:     com_intel_daal_algorithms_neural_networks_prediction_PredictionParameter
+ * Method:    cGetLayoutPropagation
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_intel_daal_algorithms_neural_1networks_prediction_PredictionParameter_cGetLayoutPropagation
+(JNIEnv *env, jobject thisObj, jlong cParameter)
+{
+    return (((prediction::Parameter *)cParameter))->layoutPropagation;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_neural_networks_prediction_PredictionParameter
+ * Method:    cSetLayoutPropagation
+ * Signature: (JZ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_neural_1networks_prediction_PredictionParameter_cSetLayoutPropagation
+(JNIEnv *env, jobject thisObj, jlong cParameter, jboolean layoutPropagation)
+{
+    (((prediction::Parameter *)cParameter))->layoutPropagation = layoutPropagation;
+}
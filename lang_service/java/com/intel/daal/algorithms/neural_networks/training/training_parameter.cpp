@@ -83,3 +83,25 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_training
         new SharedPtr<optimization_solver::iterative_solver::Batch >((((training::Parameter *)cParameter))->optimizationSolver);
     return (jlong)opt;
 }
+
+/*
+ * Class:     com_intel_daal_algorithms_neural_networks_training_TrainingParameter
+ * Method:    cGetLayoutPropagation
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_intel_daal_algorithms_neural_1networks_training_TrainingParameter_cGetLayoutPropagation
+(JNIEnv *env, jobject thisObj, jlong cParameter)
+{
+    return (((training::Parameter *)cParameter))->layoutPropagation;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_neural_networks_training_TrainingParameter
+ * Method:    cSetLayoutPropagation
+ * Signature: (JZ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_neural_1networks_training_TrainingParameter_cSetLayoutPropagation
+(JNIEnv *env, jobject thisObj, jlong cParameter, jboolean layoutPropagation)
+{
+    (((training::Parameter *)cParameter))->layoutPropagation = layoutPropagation;
+}
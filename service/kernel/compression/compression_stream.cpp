@@ -22,6 +22,7 @@
 */
 
 #include "compression_stream.h"
+#include "threading.h"
 
 namespace daal
 {
@@ -104,6 +105,354 @@ private:
 
 typedef services::Collection<services::SharedPtr<CompressionBlock> > CBC;
 
+namespace internal
+{
+
+bool processDataBlock(interface1::Compression *processor, byte *in, size_t inSize, byte **out, size_t *outSize, size_t offset,
+                      size_t *usedSize, bool allowReallocation)
+{
+    processor->setInputDataBlock(in, inSize, 0);
+    if(processor->getErrors()->size() != 0) { return false; }
+
+    size_t used = offset;
+    do
+    {
+        if(used == *outSize)
+        {
+            if(!allowReallocation) { return false; }
+
+            size_t newSize = 2 * (*outSize);
+            byte *newOut = (byte *)daal::services::daal_malloc(newSize);
+            if(!newOut) { return false; }
+            daal::services::daal_memcpy_s(newOut, newSize, *out, used);
+            daal::services::daal_free(*out);
+            *out = newOut;
+            *outSize = newSize;
+        }
+        processor->run(*out, *outSize - used, used);
+        if(processor->getErrors()->size() != 0) { return false; }
+        used += processor->getUsedOutputDataBlockSize();
+    }
+    while(processor->isOutputDataBlockFull());
+
+    *usedSize = used;
+    return true;
+}
+
+} // namespace internal
+
+/* Header stored before the compressed data of every frame in the parallelFrames mode */
+struct FrameHeader
+{
+    DAAL_UINT64 decompressedSize;
+    DAAL_UINT64 compressedSize;
+};
+
+/* Copies of a compressor or a decompressor used by the threads to process frames in parallel */
+template<typename Impl>
+class FrameProcessors
+{
+public:
+    FrameProcessors(Impl *impl) : _impl(impl), _clones(NULL), _capacity(0), _nThreads(1), _isCloneable(impl != NULL)
+    {}
+
+    ~FrameProcessors()
+    {
+        for(size_t i = 0; i < _capacity; i++)
+        {
+            delete _clones[i];
+        }
+        delete[] _clones;
+    }
+
+    /*
+     * Creates a copy for each of the threads that are currently available if needed,
+     * returns false if the frames must be processed sequentially by the original
+     */
+    bool prepare()
+    {
+        _nThreads = daal::threader_get_threads_number();
+        if(_nThreads < 1) { _nThreads = 1; }
+        if(_nThreads == 1 || !_isCloneable) { return false; }
+
+        if(_nThreads > _capacity)
+        {
+            Impl **clones = new Impl *[_nThreads];
+            for(size_t i = 0; i < _nThreads; i++)
+            {
+                clones[i] = (i < _capacity ? _clones[i] : NULL);
+            }
+            delete[] _clones;
+            _clones = clones;
+            _capacity = _nThreads;
+        }
+
+        for(size_t i = 0; i < _nThreads; i++)
+        {
+            if(_clones[i] && _clones[i]->getErrors()->size() != 0)
+            {
+                delete _clones[i];
+                _clones[i] = NULL;
+            }
+            if(!_clones[i])
+            {
+                _clones[i] = _impl->clone();
+                if(!_clones[i])
+                {
+                    _isCloneable = false;
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /* Number of copies created by the last call to prepare(), the parallel loops request at most this number of threads */
+    size_t getNumberOfThreads() const { return _nThreads; }
+
+    Impl *get(size_t tid) { return _clones[tid]; }
+
+    /* Adds the errors of the copies to the collection and removes the failed copies */
+    void moveErrors(services::ErrorCollection &errors)
+    {
+        for(size_t i = 0; i < _capacity; i++)
+        {
+            if(_clones[i] && _clones[i]->getErrors()->size() != 0)
+            {
+                services::SharedPtr<services::ErrorCollection> cloneErrors = _clones[i]->getErrors();
+                delete _clones[i];
+                _clones[i] = NULL;
+                errors.add(*cloneErrors);
+            }
+        }
+    }
+
+private:
+    Impl *_impl;
+    Impl **_clones;
+    size_t _capacity;
+    size_t _nThreads;
+    bool _isCloneable;
+};
+
+/* Compresses a frame into a new block that starts with the frame header */
+static CompressionBlock *compressFrame(interface1::CompressorImpl *compressor, CompressionBlock *frame)
+{
+    size_t inSize = frame->getWriteOffset();
+    size_t outSize = sizeof(FrameHeader) + inSize + inSize / 8 + 1024;
+    byte *out = (byte *)daal::services::daal_malloc(outSize);
+    if(!out) { return NULL; }
+
+    size_t usedSize = 0;
+    if(!internal::processDataBlock(compressor, frame->getPtr(), inSize, &out, &outSize, sizeof(FrameHeader), &usedSize, true))
+    {
+        daal::services::daal_free(out);
+        return NULL;
+    }
+
+    FrameHeader header;
+    header.decompressedSize = inSize;
+    header.compressedSize   = usedSize - sizeof(FrameHeader);
+    daal::services::daal_memcpy_s(out, sizeof(FrameHeader), &header, sizeof(FrameHeader));
+
+    CompressionBlock *block = new CompressionBlock(out, usedSize);
+    block->setComprState(compressed);
+    block->setAllocState(internallocated);
+    return block;
+}
+
+/* Frames written to a CompressionStream in the parallelFrames mode */
+class FrameCollection
+{
+public:
+    FrameCollection(interface1::CompressorImpl *compr, size_t size) :
+        compressor(compr), processors(dynamic_cast<CompressorImpl *>(compr)), frameSize(size), nPendingFrames(0)
+    {}
+
+    interface1::CompressorImpl *compressor;
+    FrameProcessors<CompressorImpl> processors;    /* Empty if the compressor cannot be copied */
+    CBC frames;
+    size_t frameSize;
+    size_t nPendingFrames;  /* Number of frames at the end of the collection that are not compressed yet */
+};
+
+/* Position of a compressed frame in the data written to a DecompressionStream */
+struct FrameInfo
+{
+    size_t offset;              /* Offset of the compressed data of the frame */
+    size_t compressedSize;
+    size_t decompressedSize;
+    size_t decompressedOffset;  /* Offset of the frame in the decompressed data */
+};
+
+/* Compressed frames written to a DecompressionStream in the parallelFrames mode and the read position in them */
+class FrameIndex
+{
+public:
+    FrameIndex(interface1::DecompressorImpl *decompr) : decompressor(decompr),
+        processors(dynamic_cast<DecompressorImpl *>(decompr)), data(NULL), dataSize(0), dataCapacity(0),
+        parsedSize(0), totalDecompressedSize(0), readFrame(0), readOffset(0), cache(NULL), cacheSize(0), cacheFrame(0),
+        isCacheValid(false)
+    {}
+
+    ~FrameIndex()
+    {
+        clear();
+    }
+
+    void clear()
+    {
+        daal::services::daal_free(data);
+        daal::services::daal_free(cache);
+        data = NULL;
+        cache = NULL;
+        dataSize = dataCapacity = parsedSize = 0;
+        cacheSize = 0;
+        isCacheValid = false;
+        totalDecompressedSize = 0;
+        readFrame = readOffset = 0;
+        frames.clear();
+    }
+
+    interface1::DecompressorImpl *decompressor;
+    FrameProcessors<DecompressorImpl> processors;  /* Empty if the decompressor cannot be copied */
+    services::Collection<FrameInfo> frames;
+
+    byte  *data;
+    size_t dataSize;
+    size_t dataCapacity;
+    size_t parsedSize;
+    size_t totalDecompressedSize;
+
+    size_t readFrame;
+    size_t readOffset;
+
+    byte  *cache;       /* Decompressed frame that is partially read */
+    size_t cacheSize;
+    size_t cacheFrame;
+    bool   isCacheValid;
+};
+
+/* Appends compressed data to the index and adds the frames that are complete. Returns false if the data is not valid */
+static bool appendFrameData(FrameIndex &index, byte *ptr, size_t size)
+{
+    if(index.dataSize + size > index.dataCapacity)
+    {
+        size_t newCapacity = 2 * index.dataCapacity;
+        if(newCapacity < index.dataSize + size) { newCapacity = index.dataSize + size; }
+
+        byte *newData = (byte *)daal::services::daal_malloc(newCapacity);
+        if(!newData) { return false; }
+        if(index.dataSize > 0)
+        {
+            daal::services::daal_memcpy_s(newData, newCapacity, index.data, index.dataSize);
+        }
+        daal::services::daal_free(index.data);
+        index.data = newData;
+        index.dataCapacity = newCapacity;
+    }
+    daal::services::daal_memcpy_s(index.data + index.dataSize, index.dataCapacity - index.dataSize, ptr, size);
+    index.dataSize += size;
+
+    while(index.dataSize - index.parsedSize >= sizeof(FrameHeader))
+    {
+        FrameHeader header;
+        daal::services::daal_memcpy_s(&header, sizeof(FrameHeader), index.data + index.parsedSize, sizeof(FrameHeader));
+        if(header.decompressedSize == 0 || header.compressedSize == 0) { return false; }
+        if(index.dataSize - index.parsedSize - sizeof(FrameHeader) < header.compressedSize) { break; }
+
+        FrameInfo frame;
+        frame.offset             = index.parsedSize + sizeof(FrameHeader);
+        frame.compressedSize     = (size_t)header.compressedSize;
+        frame.decompressedSize   = (size_t)header.decompressedSize;
+        frame.decompressedOffset = index.totalDecompressedSize;
+        index.frames.push_back(frame);
+
+        index.parsedSize = frame.offset + frame.compressedSize;
+        index.totalDecompressedSize += frame.decompressedSize;
+    }
+    return true;
+}
+
+/* Decompresses a frame into an array of the frame decompressed size */
+static bool decompressFrame(interface1::DecompressorImpl *decompressor, FrameIndex &index, size_t frame, byte *out)
+{
+    FrameInfo &info = index.frames[frame];
+    size_t outSize = info.decompressedSize;
+    size_t usedSize = 0;
+    if(!internal::processDataBlock(decompressor, index.data + info.offset, info.compressedSize, &out, &outSize, 0, &usedSize, false))
+    {
+        return false;
+    }
+    return (usedSize == info.decompressedSize);
+}
+
+/* Decompresses frames [first, first + nFrames) in parallel, out[i] receives the frame first + i */
+static bool decompressFrames(FrameIndex &index, size_t first, size_t nFrames, byte **out, services::ErrorCollection &errors)
+{
+    bool *isDecompressed = new bool[nFrames];
+    if(index.processors.prepare())
+    {
+        FrameProcessors<DecompressorImpl> *processors = &index.processors;
+        FrameIndex *pIndex = &index;
+        daal::static_threader_for(nFrames, (int)processors->getNumberOfThreads(), [ = ](size_t i, size_t tid)
+        {
+            isDecompressed[i] = decompressFrame(processors->get(tid), *pIndex, first + i, out[i]);
+        } );
+    }
+    else
+    {
+        for(size_t i = 0; i < nFrames; i++)
+        {
+            isDecompressed[i] = decompressFrame(index.decompressor, index, first + i, out[i]);
+        }
+    }
+
+    bool isFailed = false;
+    for(size_t i = 0; i < nFrames; i++)
+    {
+        if(!isDecompressed[i]) { isFailed = true; }
+    }
+    delete[] isDecompressed;
+
+    if(isFailed)
+    {
+        size_t nErrors = errors.size();
+        index.processors.moveErrors(errors);
+        errors.add(*index.decompressor->getErrors());
+        if(errors.size() == nErrors)
+        {
+            errors.add(services::ErrorCompressionFrameFormat);
+        }
+    }
+    return !isFailed;
+}
+
+/* Decompresses the frame into the cache used for partial reads */
+static bool loadFrameToCache(FrameIndex &index, size_t frame, services::ErrorCollection &errors)
+{
+    if(index.isCacheValid && index.cacheFrame == frame) { return true; }
+
+    size_t size = index.frames[frame].decompressedSize;
+    if(index.cacheSize < size)
+    {
+        daal::services::daal_free(index.cache);
+        index.cache = (byte *)daal::services::daal_malloc(size);
+        index.cacheSize = (index.cache ? size : 0);
+        if(!index.cache)
+        {
+            errors.add(services::ErrorMemoryAllocationFailed);
+            return false;
+        }
+    }
+    index.isCacheValid = decompressFrames(index, frame, 1, &index.cache, errors);
+    index.cacheFrame = frame;
+    return index.isCacheValid;
+}
+
+namespace interface1
+{
+
 //compression stream realization
 CompressionStream::CompressionStream(CompressorImpl *compr, size_t minSize) : _errors(new services::ErrorCollection())
 {
@@ -462,7 +811,7 @@ size_t DecompressionStream::copyDecompressedArray(byte *ptr, size_t size)
 
 size_t DecompressionStream::getDecompressedDataSize()
 {
-    for(int i = 0; i < (*(CBC *)blocks).size(); i++)
+    for(size_t i = 0; i < (*(CBC *)blocks).size(); i++)
     {
         decompressBlock(i);
     }
@@ -475,5 +824,451 @@ size_t DecompressionStream::getDecompressedDataSize()
     return _decompressedDataSize;
 }
 
+} // namespace interface1
+
+namespace interface2
+{
+
+//compression stream realization
+CompressionStream::CompressionStream(interface1::CompressorImpl *compr, size_t minSize, CompressionStreamMode mode) :
+    interface1::CompressionStream(compr, minSize), _frames(NULL)
+{
+    if(compr != NULL && mode == parallelFrames)
+    {
+        _frames = (void *) new FrameCollection(compr, minSize);
+    }
+}
+
+CompressionStream::~CompressionStream()
+{
+    if(_frames) { delete (FrameCollection *)_frames; }
+}
+
+void CompressionStream::compressFrames(bool compressPartialFrame)
+{
+    FrameCollection &collection = *(FrameCollection *)_frames;
+    CBC &frames = collection.frames;
+    size_t nFrames = collection.nPendingFrames;
+    if(nFrames > 0 && !compressPartialFrame && frames[frames.size() - 1]->getWriteOffset() < frames[frames.size() - 1]->getSize())
+    {
+        nFrames--;
+    }
+    if(nFrames == 0) { return; }
+
+    const size_t first = frames.size() - collection.nPendingFrames;
+    CompressionBlock **results = new CompressionBlock *[nFrames];
+
+    FrameProcessors<CompressorImpl> *processors = &collection.processors;
+    if(processors->prepare())
+    {
+        daal::static_threader_for(nFrames, (int)processors->getNumberOfThreads(), [ =, &frames ](size_t i, size_t tid)
+        {
+            results[i] = compressFrame(processors->get(tid), frames[first + i].get());
+        } );
+    }
+    else
+    {
+        for(size_t i = 0; i < nFrames; i++)
+        {
+            results[i] = compressFrame(collection.compressor, frames[first + i].get());
+        }
+    }
+
+    /* Frames that failed to compress are removed, so the stream stays a valid sequence of frames */
+    bool isFailed = false;
+    for(size_t i = nFrames; i > 0; i--)
+    {
+        if(results[i - 1])
+        {
+            frames[first + i - 1] = services::SharedPtr<CompressionBlock>(results[i - 1]);
+        }
+        else
+        {
+            frames.erase(first + i - 1);
+            isFailed = true;
+        }
+    }
+    delete[] results;
+
+    collection.nPendingFrames -= nFrames;
+
+    if(isFailed)
+    {
+        services::SharedPtr<services::ErrorCollection> errors = getErrors();
+        size_t nErrors = errors->size();
+        processors->moveErrors(*errors);
+        errors->add(*collection.compressor->getErrors());
+        if(errors->size() == nErrors)
+        {
+            errors->add(services::ErrorMemoryAllocationFailed);
+        }
+    }
+}
+
+void CompressionStream::pushFrames(DataBlock *block)
+{
+    FrameCollection &collection = *(FrameCollection *)_frames;
+    CBC &frames = collection.frames;
+    const size_t frameSize = collection.frameSize;
+    byte *inPtr = block->getPtr();
+    size_t inSize = block->getSize();
+
+    /* Fill the last partially filled frame */
+    if(collection.nPendingFrames > 0)
+    {
+        CompressionBlock *last = frames[frames.size() - 1].get();
+        size_t freeSize = last->getSize() - last->getWriteOffset();
+        if(freeSize > 0 && last->getAllocState() == internallocated)
+        {
+            size_t copySize = (inSize < freeSize ? inSize : freeSize);
+            daal::services::daal_memcpy_s(last->getPtr() + last->getWriteOffset(), freeSize, inPtr, copySize);
+            last->setWriteOffset(last->getWriteOffset() + copySize);
+            inPtr  += copySize;
+            inSize -= copySize;
+        }
+    }
+
+    /* Whole frames are compressed directly from the input block before it is returned to the caller */
+    bool hasExternalFrames = false;
+    while(inSize >= frameSize)
+    {
+        frames.push_back(services::SharedPtr<CompressionBlock>(new CompressionBlock(inPtr, frameSize)));
+        collection.nPendingFrames++;
+        hasExternalFrames = true;
+        inPtr  += frameSize;
+        inSize -= frameSize;
+    }
+    if(hasExternalFrames)
+    {
+        compressFrames(false);
+    }
+
+    if(inSize > 0)
+    {
+        CompressionBlock *frame = new CompressionBlock(frameSize);
+        daal::services::daal_memcpy_s(frame->getPtr(), frameSize, inPtr, inSize);
+        frame->setWriteOffset(inSize);
+        frames.push_back(services::SharedPtr<CompressionBlock>(frame));
+        collection.nPendingFrames++;
+    }
+
+    /* Internal frames are compressed when there are enough of them for all threads */
+    size_t nThreads = daal::threader_get_threads_number();
+    if(collection.nPendingFrames > nThreads)
+    {
+        compressFrames(false);
+    }
+}
+
+void CompressionStream::push_back(DataBlock *block)
+{
+    if(!_frames)
+    {
+        interface1::CompressionStream::push_back(block);
+        return;
+    }
+
+    //checkParams;
+    if ( block == NULL || block->getPtr() == NULL )
+    {
+        getErrors()->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    if ( block->getSize() == 0 )
+    {
+        getErrors()->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+    //end checkParams;
+
+    pushFrames(block);
+}
+
+services::SharedPtr<DataBlockCollection> CompressionStream::getCompressedBlocksCollection()
+{
+    if(!_frames)
+    {
+        return interface1::CompressionStream::getCompressedBlocksCollection();
+    }
+
+    compressFrames(true);
+
+    CBC &frames = ((FrameCollection *)_frames)->frames;
+    services::SharedPtr<DataBlockCollection> retBlocks(new DataBlockCollection);
+    for(size_t i = 0; i < frames.size(); i++)
+    {
+        retBlocks->push_back(services::SharedPtr<DataBlock>(frames[i]));
+    }
+    frames.clear();
+    return retBlocks;
+}
+
+size_t CompressionStream::getCompressedDataSize()
+{
+    if(!_frames)
+    {
+        return interface1::CompressionStream::getCompressedDataSize();
+    }
+
+    compressFrames(true);
+
+    CBC &frames = ((FrameCollection *)_frames)->frames;
+    size_t compressedDataSize = 0;
+    for(size_t i = 0; i < frames.size(); i++)
+    {
+        compressedDataSize += frames[i]->getWriteOffset() - frames[i]->getReadOffset();
+    }
+    return compressedDataSize;
+}
+
+size_t CompressionStream::copyCompressedArray(byte *ptr, size_t size)
+{
+    if(!_frames)
+    {
+        return interface1::CompressionStream::copyCompressedArray(ptr, size);
+    }
+
+    //checkParams;
+    if ( ptr == NULL )
+    {
+        getErrors()->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if ( size == 0 )
+    {
+        getErrors()->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    //end checkParams;
+
+    compressFrames(true);
+
+    CBC &frames = ((FrameCollection *)_frames)->frames;
+    size_t readSize = 0;
+    while(readSize < size && frames.size() > 0)
+    {
+        CompressionBlock *frame = frames[0].get();
+        size_t availSize = frame->getWriteOffset() - frame->getReadOffset();
+        size_t rs = (size - readSize < availSize ? size - readSize : availSize);
+
+        daal::services::daal_memcpy_s(ptr + readSize, size - readSize, frame->getPtr() + frame->getReadOffset(), rs);
+        frame->setReadOffset(frame->getReadOffset() + rs);
+        readSize += rs;
+
+        if(frame->getReadOffset() == frame->getWriteOffset())
+        {
+            frames.erase(0);
+        }
+    }
+    return readSize;
+}
+
+//decompression stream realization
+DecompressionStream::DecompressionStream(interface1::DecompressorImpl *decompr, size_t minSize, CompressionStreamMode mode) :
+    interface1::DecompressionStream(decompr, minSize), _frames(NULL)
+{
+    if(decompr != NULL && mode == parallelFrames)
+    {
+        _frames = (void *) new FrameIndex(decompr);
+    }
+}
+
+DecompressionStream::~DecompressionStream()
+{
+    if(_frames) { delete (FrameIndex *)_frames; }
+}
+
+void DecompressionStream::push_back(DataBlock *block)
+{
+    if(!_frames)
+    {
+        interface1::DecompressionStream::push_back(block);
+        return;
+    }
+
+    //checkParams;
+    if ( block == NULL || block->getPtr() == NULL )
+    {
+        getErrors()->add(services::ErrorCompressionNullInputStream);
+        return;
+    }
+    if ( block->getSize() == 0 )
+    {
+        getErrors()->add(services::ErrorCompressionEmptyInputStream);
+        return;
+    }
+    //end checkParams;
+
+    /* Frames are decompressed on demand */
+    if(!appendFrameData(*(FrameIndex *)_frames, block->getPtr(), block->getSize()))
+    {
+        getErrors()->add(services::ErrorCompressionFrameFormat);
+    }
+}
+
+services::SharedPtr<DataBlockCollection> DecompressionStream::getDecompressedBlocksCollection()
+{
+    if(!_frames)
+    {
+        return interface1::DecompressionStream::getDecompressedBlocksCollection();
+    }
+
+    FrameIndex &index = *(FrameIndex *)_frames;
+    services::SharedPtr<services::ErrorCollection> errors = getErrors();
+    services::SharedPtr<DataBlockCollection> retBlocks(new DataBlockCollection);
+
+    /* Blocks are returned only if all the frames are decompressed, otherwise the stream keeps its data */
+    size_t firstFrame = index.readFrame;
+    services::SharedPtr<DataBlock> restBlock;
+    if(index.readOffset > 0)
+    {
+        /* The rest of the partially read frame */
+        if(!loadFrameToCache(index, index.readFrame, *errors)) { return retBlocks; }
+
+        size_t restSize = index.frames[index.readFrame].decompressedSize - index.readOffset;
+        CompressionBlock *block = new CompressionBlock(restSize);
+        daal::services::daal_memcpy_s(block->getPtr(), restSize, index.cache + index.readOffset, restSize);
+        block->setWriteOffset(restSize);
+        block->setComprState(decompressed);
+        restBlock = services::SharedPtr<DataBlock>(block);
+        firstFrame++;
+    }
+
+    size_t nFrames = index.frames.size() - firstFrame;
+    CBC frameBlocks;
+    if(nFrames > 0)
+    {
+        byte **out = new byte *[nFrames];
+        for(size_t i = 0; i < nFrames; i++)
+        {
+            CompressionBlock *frameBlock = new CompressionBlock(index.frames[firstFrame + i].decompressedSize);
+            frameBlock->setWriteOffset(frameBlock->getSize());
+            frameBlock->setComprState(decompressed);
+            frameBlocks.push_back(services::SharedPtr<CompressionBlock>(frameBlock));
+            out[i] = frameBlock->getPtr();
+        }
+        bool isDecompressed = decompressFrames(index, firstFrame, nFrames, out, *errors);
+        delete[] out;
+        if(!isDecompressed) { return retBlocks; }
+    }
+
+    if(restBlock.get()) { retBlocks->push_back(restBlock); }
+    for(size_t i = 0; i < nFrames; i++)
+    {
+        retBlocks->push_back(services::SharedPtr<DataBlock>(frameBlocks[i]));
+    }
+
+    index.clear();
+    return retBlocks;
+}
+
+size_t DecompressionStream::copyDecompressedArray(byte *ptr, size_t size)
+{
+    if(!_frames)
+    {
+        return interface1::DecompressionStream::copyDecompressedArray(ptr, size);
+    }
+
+    //checkParams;
+    if ( ptr == NULL )
+    {
+        getErrors()->add(services::ErrorCompressionNullOutputStream);
+        return 0;
+    }
+    if ( size == 0 )
+    {
+        getErrors()->add(services::ErrorCompressionEmptyOutputStream);
+        return 0;
+    }
+    //end checkParams;
+
+    FrameIndex &index = *(FrameIndex *)_frames;
+    services::SharedPtr<services::ErrorCollection> errors = getErrors();
+    size_t readSize = 0;
+    size_t nFrames = index.frames.size();
+    while(readSize < size && index.readFrame < nFrames)
+    {
+        if(index.readOffset == 0)
+        {
+            /* Frames that fit into the output entirely are decompressed in parallel directly to the output */
+            size_t last = index.readFrame;
+            size_t fitSize = 0;
+            while(last < nFrames && fitSize + index.frames[last].decompressedSize <= size - readSize)
+            {
+                fitSize += index.frames[last].decompressedSize;
+                last++;
+            }
+            if(last > index.readFrame)
+            {
+                byte **out = new byte *[last - index.readFrame];
+                for(size_t i = index.readFrame; i < last; i++)
+                {
+                    out[i - index.readFrame] = ptr + readSize + (index.frames[i].decompressedOffset -
+                                                                 index.frames[index.readFrame].decompressedOffset);
+                }
+                bool isDecompressed = decompressFrames(index, index.readFrame, last - index.readFrame, out, *errors);
+                delete[] out;
+                if(!isDecompressed) { return readSize; }
+
+                readSize += fitSize;
+                index.readFrame = last;
+                continue;
+            }
+        }
+
+        /* Frame that does not fit into the output is read partially from the cache */
+        if(!loadFrameToCache(index, index.readFrame, *errors)) { return readSize; }
+
+        size_t frameSize = index.frames[index.readFrame].decompressedSize;
+        size_t rs = (frameSize - index.readOffset < size - readSize ? frameSize - index.readOffset : size - readSize);
+        daal::services::daal_memcpy_s(ptr + readSize, size - readSize, index.cache + index.readOffset, rs);
+        readSize += rs;
+        index.readOffset += rs;
+        if(index.readOffset == frameSize)
+        {
+            index.readFrame++;
+            index.readOffset = 0;
+        }
+    }
+    return readSize;
+}
+
+size_t DecompressionStream::getDecompressedDataSize()
+{
+    if(!_frames)
+    {
+        return interface1::DecompressionStream::getDecompressedDataSize();
+    }
+
+    FrameIndex &index = *(FrameIndex *)_frames;
+    if(index.readFrame == index.frames.size()) { return 0; }
+    return index.totalDecompressedSize - index.frames[index.readFrame].decompressedOffset - index.readOffset;
+}
+
+size_t DecompressionStream::getNumberOfFrames()
+{
+    if(!_frames) { return 0; }
+    return ((FrameIndex *)_frames)->frames.size();
+}
+
+void DecompressionStream::seekFrame(size_t frame)
+{
+    if(!_frames)
+    {
+        getErrors()->add(services::ErrorIncorrectParameter);
+        return;
+    }
+    FrameIndex &index = *(FrameIndex *)_frames;
+    if(frame > index.frames.size())
+    {
+        getErrors()->add(services::ErrorIncorrectIndex);
+        return;
+    }
+    index.readFrame = frame;
+    index.readOffset = 0;
+}
+
+} // namespace interface2
+
 } //namespace data_management
 } //namespace daal
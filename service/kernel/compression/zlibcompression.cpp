@@ -32,6 +32,7 @@ namespace data_management
 Compressor<zlib>::Compressor() :
     data_management::CompressorImpl()
 {
+    _strmp = NULL;
     this->_isOutBlockFull = 0;
     _isInitialized = false;
 }
@@ -352,6 +353,11 @@ void Decompressor<zlib>::run(byte *out, size_t outLen, size_t off)
                 ((z_stream *)_strmp)->next_out = tmpPtrOut;
                 ((z_stream *)_strmp)->avail_out = tmpSizeOut;
             }
+            else
+            {
+                /* Next input block starts a new stream */
+                resetCompression();
+            }
             break;
         case Z_NEED_DICT:
             finalizeCompression();